@@ -0,0 +1,167 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/background_model.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+using std::make_pair;
+using std::map;
+using std::sort;
+using std::vector;
+
+namespace {
+
+// Type and version of the model files.
+const char kBackgroundModelMagic[8] = {'T', 'S', 'B', 'K', 'G', 'M', 'D', 'L'};
+const uint32 kBackgroundModelVersion = 1;
+
+// Models returned by BackgroundModel::Get, by path, protected by
+// models_mutex. They are never deleted.
+pthread_mutex_t models_mutex = PTHREAD_MUTEX_INITIALIZER;
+map<string, const BackgroundModel*>* models = NULL;
+
+// Compares the words of the distribution in byte order.
+bool CompareWords(Distribution::const_iterator a,
+                  Distribution::const_iterator b) {
+  return a->first < b->first;
+}
+
+}  // namespace
+
+BackgroundModel::BackgroundModel()
+    : num_words_(0),
+      offsets_(NULL),
+      chars_(NULL),
+      probabilities_(NULL),
+      unknown_probability_(0) {
+}
+
+bool BackgroundModel::Write(const Distribution& distribution,
+                            double unknown_probability,
+                            const string& path) {
+  vector<Distribution::const_iterator> words;
+  words.reserve(distribution.size());
+  for (Distribution::const_iterator it = distribution.begin();
+       it != distribution.end();
+       ++it) {
+    words.push_back(it);
+  }
+  sort(words.begin(), words.end(), CompareWords);
+
+  vector<int64> offsets(1, 0);
+  string chars;
+  vector<float> probabilities;
+  for (uint i = 0; i < words.size(); i++) {
+    chars.append(words[i]->first);
+    offsets.push_back(chars.size());
+    probabilities.push_back(words[i]->second);
+  }
+
+  BinaryWriter writer;
+  writer.WriteInt64(words.size());
+  writer.WriteDouble(unknown_probability);
+  writer.WriteArray(&offsets[0], offsets.size());
+  writer.WriteArray(chars.data(), chars.size());
+  writer.WriteArray(probabilities.empty() ? NULL : &probabilities[0],
+                    probabilities.size());
+  return writer.WriteFile(path, kBackgroundModelMagic,
+                          kBackgroundModelVersion);
+}
+
+const BackgroundModel* BackgroundModel::Get(const string& path) {
+  pthread_mutex_lock(&models_mutex);
+  if (models == NULL)
+    models = new map<string, const BackgroundModel*>;
+  map<string, const BackgroundModel*>::iterator it = models->find(path);
+  if (it == models->end()) {
+    // Only the models which could be opened are cached, so that a model
+    // written after a failed call can still be loaded.
+    BackgroundModel* model = new BackgroundModel;
+    if (!model->Open(path)) {
+      LOG(ERROR) << "Cannot open the background model " << path;
+      delete model;
+      pthread_mutex_unlock(&models_mutex);
+      return NULL;
+    }
+    it = models->insert(make_pair(path, model)).first;
+  }
+  const BackgroundModel* model = it->second;
+  pthread_mutex_unlock(&models_mutex);
+  return model;
+}
+
+bool BackgroundModel::Open(const string& path) {
+  num_words_ = 0;
+  if (!reader_.Open(path, kBackgroundModelMagic, kBackgroundModelVersion))
+    return false;
+
+  int64 num_words;
+  if (reader_.ReadInt64(&num_words) && num_words >= 0 &&
+      reader_.ReadDouble(&unknown_probability_)) {
+    offsets_ = reader_.ReadArray<int64>(num_words + 1);
+    if (offsets_ != NULL && offsets_[0] == 0) {
+      chars_ = reader_.ReadArray<char>(offsets_[num_words]);
+      probabilities_ = reader_.ReadArray<float>(num_words);
+      if (chars_ != NULL && probabilities_ != NULL && reader_.done()) {
+        num_words_ = num_words;
+        return true;
+      }
+    }
+  }
+  LOG(ERROR) << "Invalid background model: " << path;
+  return false;
+}
+
+double BackgroundModel::GetProbability(const string& word) const {
+  int64 i = Find(word);
+  return i >= 0 ? probabilities_[i] : unknown_probability_;
+}
+
+int64 BackgroundModel::Find(const string& word) const {
+  // Binary search of the first word which is not less than word.
+  int64 begin = 0;
+  int64 end = num_words_;
+  while (begin < end) {
+    int64 middle = begin + (end - begin) / 2;
+    size_t length = offsets_[middle + 1] - offsets_[middle];
+    int cmp = memcmp(chars_ + offsets_[middle], word.data(),
+                     std::min(length, word.size()));
+    if (cmp < 0 || (cmp == 0 && length < word.size())) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  if (begin == num_words_) return -1;
+  size_t length = offsets_[begin + 1] - offsets_[begin];
+  if (length != word.size() ||
+      memcmp(chars_ + offsets_[begin], word.data(), length) != 0) {
+    return -1;
+  }
+  return begin;
+}
+
+}  // namespace topicsum
@@ -0,0 +1,257 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/background_model_builder.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include "summarizer/background_model.h"
+#include "summarizer/binary_file.h"
+#include "summarizer/document.pb.h"
+#include "summarizer/logging.h"
+#include "summarizer/thread_pool.h"
+#include "summarizer/xml_parser.h"
+
+namespace topicsum {
+
+using std::ifstream;
+using std::istreambuf_iterator;
+using std::make_pair;
+using std::pair;
+using std::sort;
+
+namespace {
+
+// Number of shards of the tables.
+const int kNumShards = 64;
+
+// Orders the words by decreasing count, and then in byte order so that the
+// cutoffs do not depend on the order of the hash tables.
+bool CompareCounts(const pair<int64, string>& a,
+                   const pair<int64, string>& b) {
+  if (a.first != b.first) return a.first > b.first;
+  return a.second < b.second;
+}
+
+}  // namespace
+
+// Counts the files of each thread in its table.
+class BackgroundModelBuilder::CountTask : public ParallelTask {
+ public:
+  CountTask(BackgroundModelBuilder* builder, const vector<string>* paths)
+      : builder_(builder),
+        paths_(paths),
+        num_errors_(builder->num_threads_, 0) {}
+
+  virtual void Run(int thread) {
+    int begin, end;
+    ThreadPool::GetShardRange(paths_->size(), builder_->num_threads_, thread,
+                              &begin, &end);
+    for (int i = begin; i < end; i++) {
+      const string& path = (*paths_)[i];
+      Document document;
+      bool parsed = false;
+      ifstream file(path.c_str());
+      if (file) {
+        string article((istreambuf_iterator<char>(file)),
+                       istreambuf_iterator<char>());
+        parsed = builder_->xml_parser_->ParseDocument(article, &document);
+      }
+      if (!parsed) {
+        LOG(ERROR) << "Could not parse: " << path;
+        num_errors_[thread]++;
+        continue;
+      }
+      builder_->CountDocument(document, builder_->thread_tables_[thread]);
+    }
+  }
+
+  int num_errors() const {
+    int num_errors = 0;
+    for (uint i = 0; i < num_errors_.size(); i++)
+      num_errors += num_errors_[i];
+    return num_errors;
+  }
+
+ private:
+  BackgroundModelBuilder* builder_;
+  const vector<string>* paths_;
+  vector<int> num_errors_;
+};
+
+// Moves the counts of the threads to the table of the builder, one shard at a
+// time.
+class BackgroundModelBuilder::MergeTask : public ParallelTask {
+ public:
+  explicit MergeTask(BackgroundModelBuilder* builder) : builder_(builder) {}
+
+  virtual void Run(int shard_index) {
+    Shard* shard = builder_->table_.shards[shard_index];
+    for (uint t = 0; t < builder_->thread_tables_.size(); t++) {
+      Shard* thread_shard = builder_->thread_tables_[t]->shards[shard_index];
+      for (WordCounts::const_iterator it = thread_shard->counts.begin();
+           it != thread_shard->counts.end();
+           ++it) {
+        shard->counts[it->first] += it->second;
+      }
+      builder_->Prune(shard);
+
+      // Only the threshold of the pruning is kept.
+      thread_shard->counts.clear();
+    }
+  }
+
+ private:
+  BackgroundModelBuilder* builder_;
+};
+
+BackgroundModelBuilder::Table::Table() : num_tokens(0) {
+  for (int i = 0; i < kNumShards; i++)
+    shards.push_back(new Shard);
+}
+
+BackgroundModelBuilder::Table::~Table() {
+  for (uint i = 0; i < shards.size(); i++)
+    delete shards[i];
+}
+
+BackgroundModelBuilder::Shard* BackgroundModelBuilder::Table::shard(
+    const string& word) {
+  return shards[Crc32(word.data(), word.size()) % kNumShards];
+}
+
+BackgroundModelBuilder::BackgroundModelBuilder(int num_threads,
+                                               int64 max_table_size)
+    : max_shard_size_(std::max<int64>(1, max_table_size / kNumShards)),
+      num_threads_(std::max(1, num_threads)),
+      thread_pool_(new ThreadPool(num_threads_)),
+      xml_parser_(new XmlParser) {
+  for (int i = 0; i < num_threads_; i++)
+    thread_tables_.push_back(new Table);
+}
+
+BackgroundModelBuilder::~BackgroundModelBuilder() {
+  for (uint i = 0; i < thread_tables_.size(); i++)
+    delete thread_tables_[i];
+}
+
+int BackgroundModelBuilder::AddFiles(const vector<string>& paths) {
+  CountTask count(this, &paths);
+  thread_pool_->Run(num_threads_, &count);
+
+  MergeTask merge(this);
+  thread_pool_->Run(kNumShards, &merge);
+  for (int t = 0; t < num_threads_; t++) {
+    table_.num_tokens += thread_tables_[t]->num_tokens;
+    thread_tables_[t]->num_tokens = 0;
+  }
+  return count.num_errors();
+}
+
+void BackgroundModelBuilder::AddDocument(const Document& document) {
+  CountDocument(document, &table_);
+}
+
+void BackgroundModelBuilder::CountDocument(const Document& document,
+                                           Table* table) const {
+  for (int s = 0; s < document.sentence_size(); s++) {
+    const Sentence& sentence = document.sentence(s);
+    for (int i = 0; i < sentence.token_size(); i++) {
+      const string& word = sentence.token(i);
+      Shard* shard = table->shard(word);
+      shard->counts[word]++;
+      Prune(shard);
+    }
+    table->num_tokens += sentence.token_size();
+  }
+}
+
+void BackgroundModelBuilder::Prune(Shard* shard) const {
+  if (static_cast<int64>(shard->counts.size()) <= max_shard_size_) return;
+
+  // Raise the threshold until enough words are pruned. The words which are
+  // counted again after being pruned start from 0, so that their counts are
+  // underestimated by at most the threshold.
+  while (static_cast<int64>(shard->counts.size()) > max_shard_size_ / 2) {
+    shard->prune_count++;
+    for (WordCounts::iterator it = shard->counts.begin();
+         it != shard->counts.end();) {
+      if (it->second <= shard->prune_count) {
+        shard->counts.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+double BackgroundModelBuilder::GetDistribution(
+    int64 min_count,
+    int64 max_words,
+    Distribution* distribution) const {
+  CHECK(distribution);
+  distribution->clear();
+
+  // Collect the words above the count cutoff. The pruned words are not
+  // counted as cut: they may have been pruned several times, or counted again
+  // since, and their number is not known.
+  vector<pair<int64, string> > words;
+  int64 cut_tokens = 0;
+  int64 cut_words = 0;
+  for (int i = 0; i < kNumShards; i++) {
+    const Shard& shard = *table_.shards[i];
+    for (WordCounts::const_iterator it = shard.counts.begin();
+         it != shard.counts.end();
+         ++it) {
+      if (it->second >= min_count) {
+        words.push_back(make_pair(it->second, it->first));
+      } else {
+        cut_tokens += it->second;
+        cut_words++;
+      }
+    }
+  }
+
+  // Keep the most frequent ones.
+  sort(words.begin(), words.end(), CompareCounts);
+  if (max_words > 0 && static_cast<int64>(words.size()) > max_words) {
+    for (uint i = max_words; i < words.size(); i++) {
+      cut_tokens += words[i].first;
+      cut_words++;
+    }
+    words.resize(max_words);
+  }
+
+  if (table_.num_tokens == 0) return 0;
+  double inv_num_tokens = 1.0 / table_.num_tokens;
+  for (uint i = 0; i < words.size(); i++)
+    (*distribution)[words[i].second] = words[i].first * inv_num_tokens;
+  if (cut_words == 0) return 0;
+  return cut_tokens * inv_num_tokens / cut_words;
+}
+
+bool BackgroundModelBuilder::Write(int64 min_count,
+                                   int64 max_words,
+                                   const string& path) const {
+  Distribution distribution;
+  double unknown_probability =
+      GetDistribution(min_count, max_words, &distribution);
+  return BackgroundModel::Write(distribution, unknown_probability, path);
+}
+
+}  // namespace topicsum
@@ -0,0 +1,168 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/background_model_builder.h"
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "summarizer/background_model.h"
+#include "summarizer/document.pb.h"
+#include "summarizer/file.h"
+#include "summarizer/logging.h"
+#include "summarizer/xml_parser.h"
+
+namespace topicsum {
+
+namespace {
+
+// Returns a document with one sentence of the space-separated tokens.
+Document MakeDocument(const string& tokens) {
+  Document document;
+  Sentence* sentence = document.add_sentence();
+  size_t begin = 0;
+  while (begin < tokens.size()) {
+    size_t end = tokens.find(' ', begin);
+    if (end == string::npos) end = tokens.size();
+    sentence->add_token(tokens.substr(begin, end - begin));
+    begin = end + 1;
+  }
+  return document;
+}
+
+// Returns the paths of the xml articles of the test data.
+vector<string> GetTestFiles() {
+  vector<string> paths;
+  for (int c = 1; c <= 3; c++) {
+    for (int d = 1; d <= 4; d++) {
+      char path[100];
+      snprintf(path, sizeof(path), DATADIR "testdata/realcol%d/d%d.xml", c, d);
+      paths.push_back(path);
+    }
+  }
+  return paths;
+}
+
+}  // namespace
+
+TEST(BackgroundModelBuilder, Cutoffs) {
+  BackgroundModelBuilder builder(1, 1000);
+  builder.AddDocument(MakeDocument("the cat and the dog"));
+  builder.AddDocument(MakeDocument("the bird and a cat"));
+  EXPECT_EQ(10, builder.num_tokens());
+
+  Distribution distribution;
+  EXPECT_EQ(0, builder.GetDistribution(1, 0, &distribution));
+  EXPECT_EQ(6, distribution.size());
+  EXPECT_DOUBLE_EQ(0.3, distribution["the"]);
+  EXPECT_DOUBLE_EQ(0.1, distribution["dog"]);
+
+  // The words seen once are cut, and their average probability is the one
+  // of the unknown words.
+  EXPECT_DOUBLE_EQ(0.1, builder.GetDistribution(2, 0, &distribution));
+  EXPECT_EQ(3, distribution.size());
+  EXPECT_DOUBLE_EQ(0.2, distribution["cat"]);
+
+  // Only the most frequent words are kept, with ties broken in byte order.
+  EXPECT_DOUBLE_EQ(0.5 / 4, builder.GetDistribution(1, 2, &distribution));
+  EXPECT_EQ(2, distribution.size());
+  EXPECT_DOUBLE_EQ(0.3, distribution["the"]);
+  EXPECT_DOUBLE_EQ(0.2, distribution["and"]);
+}
+
+TEST(BackgroundModelBuilder, AddFiles) {
+  vector<string> paths = GetTestFiles();
+
+  // Count the articles serially.
+  BackgroundModelBuilder serial(1, 1000000);
+  XmlParser xml_parser;
+  for (uint i = 0; i < paths.size(); i++) {
+    string article;
+    File::ReadFileToStringOrDie(paths[i], &article);
+    Document document;
+    ASSERT_TRUE(xml_parser.ParseDocument(article, &document));
+    serial.AddDocument(document);
+  }
+
+  // The counts do not depend on the threads and batches.
+  BackgroundModelBuilder parallel(3, 1000000);
+  vector<string> first_batch(paths.begin(), paths.begin() + 5);
+  vector<string> second_batch(paths.begin() + 5, paths.end());
+  second_batch.push_back("nonexistent.xml");
+  EXPECT_EQ(0, parallel.AddFiles(first_batch));
+  EXPECT_EQ(1, parallel.AddFiles(second_batch));
+  EXPECT_EQ(serial.num_tokens(), parallel.num_tokens());
+
+  Distribution expected, distribution;
+  serial.GetDistribution(2, 0, &expected);
+  parallel.GetDistribution(2, 0, &distribution);
+  EXPECT_LT(100, expected.size());
+  EXPECT_TRUE(expected == distribution);
+
+  // The model file has the same distribution.
+  const char kPath[] = "background_model_builder_test.tmp";
+  ASSERT_TRUE(parallel.Write(2, 0, kPath));
+  BackgroundModel model;
+  ASSERT_TRUE(model.Open(kPath));
+  EXPECT_EQ(distribution.size(), model.size());
+  for (Distribution::const_iterator it = distribution.begin();
+       it != distribution.end();
+       ++it) {
+    EXPECT_FLOAT_EQ(it->second, model.GetProbability(it->first));
+  }
+  remove(kPath);
+}
+
+TEST(BackgroundModelBuilder, Pruning) {
+  vector<string> paths = GetTestFiles();
+  BackgroundModelBuilder exact(2, 1000000);
+  exact.AddFiles(paths);
+  BackgroundModelBuilder pruned(2, 256);
+  pruned.AddFiles(paths);
+  EXPECT_EQ(exact.num_tokens(), pruned.num_tokens());
+
+  // The tables are bounded, but the most frequent words are still counted.
+  Distribution expected, distribution;
+  exact.GetDistribution(1, 0, &expected);
+  pruned.GetDistribution(1, 0, &distribution);
+  EXPECT_LT(256, expected.size());
+  EXPECT_GE(256, distribution.size());
+  exact.GetDistribution(1, 5, &expected);
+  for (Distribution::const_iterator it = expected.begin();
+       it != expected.end();
+       ++it) {
+    EXPECT_NEAR(it->second, distribution[it->first], 0.1 * it->second)
+        << it->first;
+  }
+
+  // The probability of the unknown words is the average one of the words cut
+  // from the pruned table, which is close to the one of the unpruned build.
+  EXPECT_DOUBLE_EQ(exact.GetDistribution(2, 0, &expected),
+                   pruned.GetDistribution(2, 0, &distribution));
+  double unknown_probability = exact.GetDistribution(3, 0, &expected);
+  EXPECT_NEAR(unknown_probability,
+              pruned.GetDistribution(3, 0, &distribution),
+              0.2 * unknown_probability);
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
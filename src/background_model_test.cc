@@ -0,0 +1,97 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/background_model.h"
+
+#include <stdio.h>
+
+#include "gtest/gtest.h"
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+namespace {
+
+const char kPath[] = "background_model_test.tmp";
+
+}  // namespace
+
+TEST(BackgroundModel, WriteAndRead) {
+  Distribution distribution;
+  distribution["the"] = 0.5;
+  distribution["of"] = 0.25;
+  distribution["a"] = 0.125;
+  distribution["zebra"] = 0.0625;
+  distribution["th\xc3\xa9\xc3\xa2tre"] = 0.0625;
+  ASSERT_TRUE(BackgroundModel::Write(distribution, 0.001, kPath));
+
+  BackgroundModel model;
+  ASSERT_TRUE(model.Open(kPath));
+  ASSERT_EQ(5, model.size());
+  // The vocabulary is sorted in byte order.
+  EXPECT_EQ("a", model.word(0));
+  EXPECT_EQ("of", model.word(1));
+  EXPECT_EQ("the", model.word(2));
+  EXPECT_EQ("th\xc3\xa9\xc3\xa2tre", model.word(3));
+  EXPECT_EQ("zebra", model.word(4));
+  EXPECT_EQ(0.125, model.probability(0));
+
+  for (Distribution::const_iterator it = distribution.begin();
+       it != distribution.end();
+       ++it) {
+    EXPECT_EQ(it->second, model.GetProbability(it->first)) << it->first;
+  }
+  EXPECT_EQ(0.001f, static_cast<float>(model.unknown_probability()));
+  EXPECT_EQ(model.unknown_probability(), model.GetProbability(""));
+  EXPECT_EQ(model.unknown_probability(), model.GetProbability("th"));
+  EXPECT_EQ(model.unknown_probability(), model.GetProbability("thee"));
+  EXPECT_EQ(model.unknown_probability(), model.GetProbability("zebras"));
+  EXPECT_EQ(model.unknown_probability(), model.GetProbability("0"));
+  remove(kPath);
+}
+
+TEST(BackgroundModel, Empty) {
+  ASSERT_TRUE(BackgroundModel::Write(Distribution(), 0.5, kPath));
+  BackgroundModel model;
+  ASSERT_TRUE(model.Open(kPath));
+  EXPECT_EQ(0, model.size());
+  EXPECT_EQ(0.5, model.GetProbability("the"));
+  remove(kPath);
+}
+
+TEST(BackgroundModel, Get) {
+  // The failures are not cached, so that the model can be written later.
+  remove(kPath);
+  EXPECT_TRUE(BackgroundModel::Get(kPath) == NULL);
+
+  Distribution distribution;
+  distribution["the"] = 1;
+  ASSERT_TRUE(BackgroundModel::Write(distribution, 0, kPath));
+  const BackgroundModel* model = BackgroundModel::Get(kPath);
+  ASSERT_TRUE(model != NULL);
+  EXPECT_EQ(1, model->GetProbability("the"));
+
+  // The model is mapped once and shared, even if the file is removed.
+  remove(kPath);
+  EXPECT_EQ(model, BackgroundModel::Get(kPath));
+  EXPECT_EQ(1, model->GetProbability("the"));
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
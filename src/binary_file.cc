@@ -0,0 +1,169 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/binary_file.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+namespace {
+
+// Header of the binary files.
+struct Header {
+  char magic[8];
+  uint32 version;
+  uint32 crc;
+  uint64 payload_size;
+  uint64 reserved;
+};
+
+// Table of the CRC-32 of the bytes, for the reflected polynomial 0xEDB88320.
+struct Crc32Table {
+  Crc32Table() {
+    for (uint32 i = 0; i < 256; i++) {
+      uint32 crc = i;
+      for (int bit = 0; bit < 8; bit++)
+        crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+      values[i] = crc;
+    }
+  }
+
+  uint32 values[256];
+};
+
+}  // namespace
+
+uint32 Crc32(const void* data, size_t size) {
+  static const Crc32Table table;
+  const uint8* bytes = static_cast<const uint8*>(data);
+  uint32 crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; i++)
+    crc = table.values[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+  return crc ^ 0xFFFFFFFFu;
+}
+
+void BinaryWriter::WriteString(const string& value) {
+  WriteInt64(value.size());
+  WriteArray(value.data(), value.size());
+}
+
+bool BinaryWriter::WriteFile(const string& path, const char magic[8],
+                             uint32 version) const {
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, magic, sizeof(header.magic));
+  header.version = version;
+  header.crc = Crc32(payload_.data(), payload_.size());
+  header.payload_size = payload_.size();
+
+  string temp_path = path + ".tmp";
+  FILE* file = fopen(temp_path.c_str(), "wb");
+  if (file == NULL) {
+    LOG(ERROR) << "Could not write: " << temp_path;
+    return false;
+  }
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  if (!payload_.empty())
+    ok = ok && fwrite(payload_.data(), payload_.size(), 1, file) == 1;
+  ok = (fclose(file) == 0) && ok;
+  if (ok) ok = rename(temp_path.c_str(), path.c_str()) == 0;
+  if (!ok) {
+    LOG(ERROR) << "Could not write: " << path;
+    remove(temp_path.c_str());
+  }
+  return ok;
+}
+
+BinaryReader::BinaryReader()
+    : data_(NULL),
+      size_(0),
+      position_(0),
+      end_(0) {
+}
+
+BinaryReader::~BinaryReader() {
+  Close();
+}
+
+void BinaryReader::Close() {
+  if (data_ != NULL) munmap(const_cast<char*>(data_), size_);
+  data_ = NULL;
+  size_ = 0;
+  position_ = 0;
+  end_ = 0;
+}
+
+bool BinaryReader::Open(const string& path, const char magic[8],
+                        uint32 version) {
+  Close();
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LOG(ERROR) << "Could not open: " << path;
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(Header)) {
+    LOG(ERROR) << "Not a binary file: " << path;
+    close(fd);
+    return false;
+  }
+  void* data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    LOG(ERROR) << "Could not map: " << path;
+    return false;
+  }
+  data_ = static_cast<const char*>(data);
+  size_ = info.st_size;
+
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  if (memcmp(header->magic, magic, sizeof(header->magic)) != 0) {
+    LOG(ERROR) << "Unexpected type of file: " << path;
+  } else if (header->version != version) {
+    LOG(ERROR) << "Unsupported version " << header->version << " of: "
+               << path;
+  } else if (header->payload_size != size_ - sizeof(Header)) {
+    LOG(ERROR) << "Truncated file: " << path;
+  } else if (header->crc != Crc32(data_ + sizeof(Header),
+                                  header->payload_size)) {
+    LOG(ERROR) << "Checksum mismatch in: " << path;
+  } else {
+    position_ = sizeof(Header);
+    end_ = size_;
+    return true;
+  }
+  Close();
+  return false;
+}
+
+bool BinaryReader::ReadString(string* value) {
+  int64 size;
+  if (!ReadInt64(&size)) return false;
+  const char* chars = ReadArray<char>(size);
+  if (chars == NULL) return false;
+  value->assign(chars, size);
+  return true;
+}
+
+}  // namespace topicsum
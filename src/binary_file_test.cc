@@ -0,0 +1,116 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/binary_file.h"
+
+#include <stdio.h>
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "summarizer/file.h"
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+namespace {
+
+const char kMagic[8] = {'T', 'E', 'S', 'T', 'F', 'I', 'L', 'E'};
+const char kPath[] = "binary_file_test.tmp";
+
+// Writes a file with a few values of each type.
+void WriteTestFile(uint32 version) {
+  BinaryWriter writer;
+  writer.WriteInt64(-3);
+  writer.WriteString("word");
+  int counts[3] = {1, 2, 3};
+  writer.WriteArray(counts, 3);
+  writer.WriteDouble(0.25);
+  writer.WriteUint64(kuint64max);
+  ASSERT_TRUE(writer.WriteFile(kPath, kMagic, version));
+}
+
+}  // namespace
+
+TEST(Crc32, KnownValue) {
+  EXPECT_EQ(0xCBF43926u, Crc32("123456789", 9));
+  EXPECT_EQ(0u, Crc32("", 0));
+}
+
+TEST(BinaryFile, ReadsWhatWasWritten) {
+  WriteTestFile(1);
+
+  BinaryReader reader;
+  ASSERT_TRUE(reader.Open(kPath, kMagic, 1));
+  int64 int64_value;
+  ASSERT_TRUE(reader.ReadInt64(&int64_value));
+  EXPECT_EQ(-3, int64_value);
+  string string_value;
+  ASSERT_TRUE(reader.ReadString(&string_value));
+  EXPECT_EQ("word", string_value);
+  const int* counts = reader.ReadArray<int>(3);
+  ASSERT_TRUE(counts != NULL);
+  EXPECT_EQ(0u, reinterpret_cast<size_t>(counts) % 8);
+  EXPECT_EQ(1, counts[0]);
+  EXPECT_EQ(2, counts[1]);
+  EXPECT_EQ(3, counts[2]);
+  double double_value;
+  ASSERT_TRUE(reader.ReadDouble(&double_value));
+  EXPECT_EQ(0.25, double_value);
+  uint64 uint64_value;
+  ASSERT_TRUE(reader.ReadUint64(&uint64_value));
+  EXPECT_EQ(kuint64max, uint64_value);
+  EXPECT_TRUE(reader.done());
+
+  // Reading past the end fails.
+  EXPECT_FALSE(reader.ReadInt64(&int64_value));
+  EXPECT_TRUE(reader.ReadArray<int>(1) == NULL);
+  remove(kPath);
+}
+
+TEST(BinaryFile, RejectsOtherFiles) {
+  BinaryReader reader;
+  EXPECT_FALSE(reader.Open("nonexistent_binary_file", kMagic, 1));
+
+  WriteTestFile(1);
+  const char kOtherMagic[8] = {'O', 'T', 'H', 'E', 'R', 'F', 'I', 'L'};
+  EXPECT_FALSE(reader.Open(kPath, kOtherMagic, 1));
+  EXPECT_FALSE(reader.Open(kPath, kMagic, 2));
+
+  // Flip a bit of the payload.
+  string content;
+  File::ReadFileToStringOrDie(kPath, &content);
+  content[content.size() - 1] ^= 1;
+  FILE* file = fopen(kPath, "wb");
+  ASSERT_TRUE(file != NULL);
+  fwrite(content.data(), content.size(), 1, file);
+  fclose(file);
+  EXPECT_FALSE(reader.Open(kPath, kMagic, 1));
+
+  // Truncate it.
+  file = fopen(kPath, "wb");
+  ASSERT_TRUE(file != NULL);
+  fwrite(content.data(), content.size() - 8, 1, file);
+  fclose(file);
+  EXPECT_FALSE(reader.Open(kPath, kMagic, 1));
+  remove(kPath);
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Builds a background model for TopicSum (see TopicSumOptions.
+// background_model_path) from the term frequencies of a corpus of xml
+// articles. The paths of the articles are read from input_list, one per line,
+// and counted in batches with num_threads threads, so that the corpus can be
+// much larger than the memory. The words counted less than min_count times
+// are removed from the vocabulary, of which only the max_words most frequent
+// words are kept (all of them if it is 0).
+//
+// Usage: build_background_model input_list output [min_count] [max_words]
+//                               [num_threads] [max_table_size]
+
+#include <stdlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "summarizer/background_model_builder.h"
+
+using std::cerr;
+using std::getline;
+using std::ifstream;
+using std::string;
+using std::vector;
+using topicsum::BackgroundModelBuilder;
+using topicsum::int64;
+
+namespace {
+
+// Number of files counted in each batch.
+const int kBatchSize = 10000;
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    cerr << "Usage: " << argv[0] << " input_list output [min_count] "
+         << "[max_words] [num_threads] [max_table_size]\n";
+    return 1;
+  }
+  string input_list = argv[1];
+  string output = argv[2];
+  int64 min_count = argc > 3 ? atoll(argv[3]) : 5;
+  int64 max_words = argc > 4 ? atoll(argv[4]) : 0;
+  int num_threads = argc > 5 ? atoi(argv[5]) : 1;
+  int64 max_table_size = argc > 6 ? atoll(argv[6]) : 10000000;
+
+  ifstream list(input_list.c_str());
+  if (!list) {
+    cerr << "File not found: " << input_list << "\n";
+    return 1;
+  }
+
+  BackgroundModelBuilder builder(num_threads, max_table_size);
+  vector<string> paths;
+  string path;
+  int num_files = 0;
+  int num_errors = 0;
+  while (true) {
+    bool done = !getline(list, path);
+    if (!done && !path.empty())
+      paths.push_back(path);
+    if (paths.size() == kBatchSize || (done && !paths.empty())) {
+      num_errors += builder.AddFiles(paths);
+      num_files += paths.size();
+      paths.clear();
+      cerr << "Counted " << num_files << " files, " << builder.num_tokens()
+           << " tokens\n";
+    }
+    if (done) break;
+  }
+
+  if (!builder.Write(min_count, max_words, output)) {
+    cerr << "Could not write: " << output << "\n";
+    return 1;
+  }
+  if (num_errors > 0)
+    cerr << num_errors << " files could not be parsed\n";
+  return 0;
+}
@@ -0,0 +1,40 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/deadline.h"
+
+#include <time.h>
+
+namespace topicsum {
+
+Deadline::Deadline(int64 budget_ms)
+    : start_micros_(NowMicros()),
+      budget_micros_(budget_ms * 1000) {}
+
+bool Deadline::Expired() const {
+  if (budget_micros_ <= 0) return false;
+  return NowMicros() - start_micros_ >= budget_micros_;
+}
+
+int64 Deadline::ElapsedMs() const {
+  return (NowMicros() - start_micros_) / 1000;
+}
+
+int64 Deadline::NowMicros() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<int64>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+}
+
+}  // namespace topicsum
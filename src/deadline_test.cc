@@ -0,0 +1,47 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/deadline.h"
+
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+namespace topicsum {
+
+TEST(Deadline, NoBudget) {
+  Deadline deadline(0);
+  usleep(2000);
+  EXPECT_FALSE(deadline.Expired());
+  EXPECT_GE(deadline.ElapsedMs(), 2);
+}
+
+TEST(Deadline, Expires) {
+  Deadline deadline(5);
+  usleep(6000);
+  EXPECT_TRUE(deadline.Expired());
+  EXPECT_GE(deadline.ElapsedMs(), 5);
+}
+
+TEST(Deadline, NotExpired) {
+  Deadline deadline(60000);
+  EXPECT_FALSE(deadline.Expired());
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
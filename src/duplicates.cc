@@ -0,0 +1,142 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/duplicates.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+namespace {
+
+// Mixes the bits of x (finalizer of splitmix64).
+inline uint64 Mix(uint64 x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+// Returns the sorted set of values of the vector.
+void SortedSet(const vector<int>& values, vector<int>* set) {
+  *set = values;
+  sort(set->begin(), set->end());
+  set->erase(unique(set->begin(), set->end()), set->end());
+}
+
+}  // anonymous namespace
+
+void ComputeMinHashSignature(const vector<int>& ids,
+                             vector<uint64>* signature) {
+  CHECK(!ids.empty());
+  const int kNumHashes = kMinHashBands * kMinHashRowsPerBand;
+  signature->assign(kNumHashes, std::numeric_limits<uint64>::max());
+  for (uint i = 0; i < ids.size(); ++i) {
+    uint64 id_hash = Mix(ids[i]);
+    // The hash functions are obtained by mixing the hash of the id with a
+    // different seed.
+    for (int h = 0; h < kNumHashes; ++h) {
+      uint64 value = Mix(id_hash + 0x9e3779b97f4a7c15ULL * (h + 1));
+      if (value < (*signature)[h]) (*signature)[h] = value;
+    }
+  }
+}
+
+double JaccardSimilarity(const vector<int>& a, const vector<int>& b) {
+  if (a.empty() && b.empty()) return 1;
+  uint i = 0;
+  uint j = 0;
+  int intersection = 0;
+  while (i < a.size() && j < b.size()) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      ++intersection;
+      ++i;
+      ++j;
+    }
+  }
+  return intersection /
+      static_cast<double>(a.size() + b.size() - intersection);
+}
+
+DuplicateIndex::DuplicateIndex(double min_similarity)
+    : min_similarity_(min_similarity) {}
+
+uint64 DuplicateIndex::HashValues(const uint64* values, int size) {
+  uint64 hash = size;
+  for (int i = 0; i < size; ++i)
+    hash = Mix(hash ^ values[i]) + i;
+  return hash;
+}
+
+int DuplicateIndex::FindOrAdd(const vector<int>& token_ids) {
+  CHECK(!token_ids.empty());
+
+  // Exact duplicates.
+  vector<uint64> values(token_ids.begin(), token_ids.end());
+  uint64 sequence_hash = HashValues(&values[0], values.size());
+  vector<int>& sequence_bucket = sequence_buckets_[sequence_hash];
+  for (uint i = 0; i < sequence_bucket.size(); ++i) {
+    if (sequences_[sequence_bucket[i]] == token_ids)
+      return sequence_bucket[i];
+  }
+
+  vector<int> id_set;
+  SortedSet(token_ids, &id_set);
+
+  // Near duplicates. The candidates are checked in the order of the index, so
+  // that the first near duplicate is returned.
+  vector<uint64> band_hashes;
+  if (min_similarity_ <= 1) {
+    vector<uint64> signature;
+    ComputeMinHashSignature(id_set, &signature);
+    vector<int> candidates;
+    for (int b = 0; b < kMinHashBands; ++b) {
+      band_hashes.push_back(HashValues(&signature[b * kMinHashRowsPerBand],
+                                       kMinHashRowsPerBand));
+      hash_map<uint64, vector<int> >::const_iterator it =
+          band_buckets_[b].find(band_hashes.back());
+      if (it != band_buckets_[b].end())
+        candidates.insert(candidates.end(), it->second.begin(),
+                          it->second.end());
+    }
+    sort(candidates.begin(), candidates.end());
+    candidates.erase(unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+    for (uint i = 0; i < candidates.size(); ++i) {
+      if (JaccardSimilarity(id_sets_[candidates[i]], id_set) >=
+          min_similarity_)
+        return candidates[i];
+    }
+  }
+
+  int index = sequences_.size();
+  sequences_.push_back(token_ids);
+  id_sets_.push_back(id_set);
+  sequence_bucket.push_back(index);
+  for (uint b = 0; b < band_hashes.size(); ++b)
+    band_buckets_[b][band_hashes[b]].push_back(index);
+  return -1;
+}
+
+}  // namespace topicsum
@@ -0,0 +1,89 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/duplicates.h"
+
+#include "gtest/gtest.h"
+
+namespace topicsum {
+
+namespace {
+
+// Returns a vector with the given values.
+vector<int> Ids(int size, const int* values) {
+  return vector<int>(values, values + size);
+}
+
+}  // unnamed namespace
+
+TEST(Duplicates, JaccardSimilarity) {
+  const int kA[] = {1, 2, 3, 4};
+  const int kB[] = {2, 4, 6};
+  EXPECT_DOUBLE_EQ(0.4, JaccardSimilarity(Ids(4, kA), Ids(3, kB)));
+  EXPECT_DOUBLE_EQ(1, JaccardSimilarity(Ids(4, kA), Ids(4, kA)));
+  EXPECT_DOUBLE_EQ(0, JaccardSimilarity(Ids(2, kA), Ids(1, kB + 2)));
+}
+
+TEST(Duplicates, MinHashSignature) {
+  const int kA[] = {1, 2, 3, 4};
+  const int kB[] = {4, 3, 2, 1};
+  const int kC[] = {5, 6, 7, 8};
+  vector<uint64> a, b, c;
+  ComputeMinHashSignature(Ids(4, kA), &a);
+  ComputeMinHashSignature(Ids(4, kB), &b);
+  ComputeMinHashSignature(Ids(4, kC), &c);
+  EXPECT_EQ(kMinHashBands * kMinHashRowsPerBand, a.size());
+  EXPECT_TRUE(a == b);
+
+  // Disjoint sets have no min-hash in common, unless the hashes collide.
+  for (uint i = 0; i < a.size(); ++i)
+    EXPECT_NE(a[i], c[i]);
+}
+
+TEST(Duplicates, FindOrAdd) {
+  DuplicateIndex index(0.8);
+  const int kSentence[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  const int kReordered[] = {10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+  const int kNearDuplicate[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 11};
+  const int kOther[] = {1, 2, 3, 12, 13, 14};
+
+  EXPECT_EQ(-1, index.FindOrAdd(Ids(10, kSentence)));
+  EXPECT_EQ(-1, index.FindOrAdd(Ids(6, kOther)));
+  EXPECT_EQ(2, index.size());
+
+  EXPECT_EQ(0, index.FindOrAdd(Ids(10, kSentence)));
+  EXPECT_EQ(1, index.FindOrAdd(Ids(6, kOther)));
+  EXPECT_EQ(0, index.FindOrAdd(Ids(10, kReordered)));
+
+  // The similarity of the near duplicate is 9/11, which is above the
+  // threshold, while only the exact duplicates are found with a threshold
+  // greater than 1.
+  EXPECT_EQ(0, index.FindOrAdd(Ids(10, kNearDuplicate)));
+  EXPECT_EQ(2, index.size());
+
+  DuplicateIndex exact_index(2);
+  EXPECT_EQ(-1, exact_index.FindOrAdd(Ids(10, kSentence)));
+  EXPECT_EQ(-1, exact_index.FindOrAdd(Ids(10, kReordered)));
+  EXPECT_EQ(-1, exact_index.FindOrAdd(Ids(10, kNearDuplicate)));
+  EXPECT_EQ(0, exact_index.FindOrAdd(Ids(10, kSentence)));
+  EXPECT_EQ(3, exact_index.size());
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -15,13 +15,26 @@
 
 #include "summarizer/gibbs.h"
 
+#include <math.h>
+
 #include <sstream>
 
+#include "summarizer/deadline.h"
+#include "summarizer/logging.h"
+
 namespace topicsum {
 
 using std::make_pair;
 using std::ostringstream;
 
+namespace {
+
+// Type and version of the checkpoint files.
+const char kCheckpointMagic[8] = {'G', 'I', 'B', 'B', 'S', 'C', 'K', 'P'};
+const uint32 kCheckpointVersion = 1;
+
+}  // namespace
+
 const vector<pair<int, double> >& GibbsSampler::saved_likelihoods() const {
   return saved_likelihoods_;
 }
@@ -42,17 +55,31 @@ string GibbsSampler::PrintSamplingIterationInfo() {
 }
 
 void GibbsSampler::Train() {
-  // Initialize data structures (counters...).
-  Init();
-
-  // Sampling initialization.
-  iteration_no_ = -1;
-  DoInitialAssignment();
+  Deadline deadline(deadline_ms_);
+  stop_reason_ = MAX_ITERATIONS;
+  bool early_stopping = convergence_tolerance_ > 0 && convergence_window_ > 0;
+
+  if (resume_) {
+    // The state, including the iteration number, was restored from a
+    // checkpoint.
+    resume_ = false;
+  } else {
+    random_.Reset(seed_, stream_);
+    sum_count_ = 0;
+    saved_likelihoods_.clear();
+
+    // Initialize data structures (counters...).
+    Init();
+
+    // Sampling initialization.
+    iteration_no_ = -1;
+    DoInitialAssignment();
+    iteration_no_ = 0;
+  }
 
   // Core sampling algorithm.
   bool burnin = (burnin_ > 0 ? true : false);
 
-  iteration_no_ = 0;
   while (iteration_no_ < (burnin_ + iterations_)) {
     if (burnin && iteration_no_ > burnin_)
       burnin = false;
@@ -66,7 +93,7 @@ void GibbsSampler::Train() {
       CalculateParams();
       sum_count_++;
 
-      if (track_likelihood_) {
+      if (track_likelihood_ || early_stopping) {
         // Calculate model likelihood. We need to average over the sum of
         // model parameters to get true estimates to use when calculating
         // the likelihood. After using the estimates, the original sums
@@ -80,11 +107,106 @@ void GibbsSampler::Train() {
     }
 
     iteration_no_++;
+
+    bool checkpoint = checkpoint_interval_ > 0 &&
+        iteration_no_ % checkpoint_interval_ == 0;
+    if (checkpoint)
+      SaveCheckpoint();
+
+    if (iteration_no_ < (burnin_ + iterations_)) {
+      if (early_stopping && HasConverged()) {
+        stop_reason_ = CONVERGED;
+        break;
+      }
+      if (deadline.Expired()) {
+        stop_reason_ = DEADLINE_EXCEEDED;
+        if (checkpoint_interval_ > 0 && !checkpoint)
+          SaveCheckpoint();
+        break;
+      }
+    }
+  }
+
+  // If the sampler ran out of time before collecting any sample, the last
+  // one is better than no estimate at all.
+  if (stop_reason_ == DEADLINE_EXCEEDED && sum_count_ == 0) {
+    CalculateParams();
+    sum_count_++;
   }
 
   // Average parameters to obtain final estimates.
   if (sum_count_ > 0)
     MultiplyParams(1/static_cast<double>(sum_count_));
+  FinishParams();
+}
+
+bool GibbsSampler::HasConverged() const {
+  if (iteration_no_ < min_iterations_) return false;
+  int num_likelihoods = saved_likelihoods_.size();
+  if (num_likelihoods <= convergence_window_) return false;
+  double last = saved_likelihoods_[num_likelihoods - 1].second;
+  double previous =
+      saved_likelihoods_[num_likelihoods - 1 - convergence_window_].second;
+  return fabs(last - previous) <= convergence_tolerance_ * fabs(previous);
+}
+
+bool GibbsSampler::SaveCheckpoint() const {
+  BinaryWriter writer;
+  writer.WriteInt64(iteration_no_);
+  writer.WriteInt64(sum_count_);
+  writer.WriteInt64(saved_likelihoods_.size());
+  for (uint i = 0; i < saved_likelihoods_.size(); i++) {
+    writer.WriteInt64(saved_likelihoods_[i].first);
+    writer.WriteDouble(saved_likelihoods_[i].second);
+  }
+  uint64 random_state[Random::kStateSize];
+  random_.GetState(random_state);
+  writer.WriteArray(random_state, Random::kStateSize);
+  if (!SaveState(&writer)) {
+    LOG(ERROR) << "The sampler does not support checkpoints.";
+    return false;
+  }
+  return writer.WriteFile(checkpoint_path_, kCheckpointMagic,
+                          kCheckpointVersion);
+}
+
+bool GibbsSampler::RestoreCheckpoint(const string& path) {
+  resume_ = false;
+  BinaryReader reader;
+  if (!reader.Open(path, kCheckpointMagic, kCheckpointVersion)) return false;
+
+  int64 iteration_no, sum_count, num_likelihoods;
+  if (!reader.ReadInt64(&iteration_no) ||
+      !reader.ReadInt64(&sum_count) ||
+      !reader.ReadInt64(&num_likelihoods)) {
+    LOG(ERROR) << "Invalid checkpoint: " << path;
+    return false;
+  }
+  vector<pair<int, double> > likelihoods;
+  for (int64 i = 0; i < num_likelihoods; i++) {
+    int64 iteration;
+    double likelihood;
+    if (!reader.ReadInt64(&iteration) || !reader.ReadDouble(&likelihood)) {
+      LOG(ERROR) << "Invalid checkpoint: " << path;
+      return false;
+    }
+    likelihoods.push_back(make_pair(static_cast<int>(iteration), likelihood));
+  }
+  const uint64* random_state = reader.ReadArray<uint64>(Random::kStateSize);
+
+  // The deriving sampler allocates its state before overwriting it.
+  Init();
+  if (random_state == NULL || !RestoreState(&reader) || !reader.done()) {
+    LOG(ERROR) << "Checkpoint not matching the sampler: " << path;
+    return false;
+  }
+
+  iteration_no_ = iteration_no;
+  sum_count_ = sum_count;
+  saved_likelihoods_.swap(likelihoods);
+  random_.SetState(random_state);
+  resume_ = true;
+  return true;
 }
 
 }  // namespace topicsum
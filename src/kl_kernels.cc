@@ -0,0 +1,209 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Scalar kernels and runtime dispatch. The vectorized kernels are in
+// kl_kernels_x86.cc.
+
+#include "summarizer/kl_kernels.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "summarizer/kl_kernels_internal.h"
+#include "summarizer/logging.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+double FastLog(double x) {
+  uint64 bits;
+  memcpy(&bits, &x, sizeof(bits));
+  double exponent = static_cast<double>(static_cast<int>(bits >> 52) - 1023);
+  bits = (bits & internal::kMantissaMask) | internal::kOneBits;
+  double mantissa;
+  memcpy(&mantissa, &bits, sizeof(mantissa));
+  if (mantissa > internal::kSqrt2) {
+    mantissa *= 0.5;
+    exponent += 1;
+  }
+
+  // log(m) = 2 atanh(t) = 2 (t + t^3 / 3 + t^5 / 5 + ...) with
+  // t = (m - 1) / (m + 1), |t| < 0.172.
+  double t = (mantissa - 1) / (mantissa + 1);
+  double t2 = t * t;
+  double p = internal::kLogCoefficients[internal::kNumLogCoefficients - 1];
+  for (int k = internal::kNumLogCoefficients - 2; k >= 0; --k)
+    p = p * t2 + internal::kLogCoefficients[k];
+  return exponent * internal::kLn2Hi +
+      (exponent * internal::kLn2Lo + 2 * t * p);
+}
+
+double FastLog1p(double x) {
+  double u = 1 + x;
+  if (u == 1) return x;
+
+  // Compensates the rounding error of 1 + x.
+  return FastLog(u) * (x / (u - 1));
+}
+
+namespace {
+
+// Scalar implementation of the kernels, templated on the logarithm.
+template <double (*Log)(double), double (*Log1p)(double)>
+struct ScalarKernels {
+  static double WeightedLog1pSum(const double* weights,
+                                 const double* values,
+                                 int size,
+                                 double divisor) {
+    double sum = 0;
+    for (int i = 0; i < size; ++i)
+      sum += weights[i] * Log1p(values[i] / divisor);
+    return sum;
+  }
+
+  static double SparseLog1pIncrease(const int* ids,
+                                    const double* values,
+                                    int size,
+                                    const double* weights,
+                                    const double* base,
+                                    double divisor) {
+    double sum = 0;
+    for (int j = 0; j < size; ++j) {
+      double weight = weights[ids[j]];
+      if (weight == 0) continue;
+
+      double base_value = base[ids[j]];
+      double term = Log1p((base_value + values[j]) / divisor);
+      if (base_value != 0)
+        term -= Log1p(base_value / divisor);
+      sum += weight * term;
+    }
+    return sum;
+  }
+
+  static double KLDivergence(const double* a,
+                             const double* b,
+                             const double* c,
+                             int size,
+                             double sum,
+                             double smoothing_factor) {
+    double norm = 1 + size * smoothing_factor;
+    double kl = 0;
+    for (int i = 0; i < size; ++i) {
+      double a_value = a[i];
+      if (a_value == 0) continue;
+
+      double q = c == NULL ? b[i] : b[i] + c[i];
+      q = (q / sum + smoothing_factor) / norm;
+      kl += a_value * Log(a_value / q);
+    }
+    return kl;
+  }
+};
+
+double ScalarAddVector(double* a, const double* b, int size) {
+  double sum = 0.0;
+  for (int i = 0; i < size; ++i) {
+    a[i] += b[i];
+    sum += a[i];
+  }
+  return sum;
+}
+
+double ScalarSubtractVector(double* a, const double* b, int size) {
+  double sum = 0.0;
+  for (int i = 0; i < size; ++i) {
+    a[i] -= b[i];
+    sum += a[i];
+  }
+  return sum;
+}
+
+double PreciseLog(double x) { return log(x); }
+double PreciseLog1p(double x) { return log1p(x); }
+
+typedef ScalarKernels<PreciseLog, PreciseLog1p> PreciseScalarKernels;
+typedef ScalarKernels<FastLog, FastLog1p> FastScalarKernels;
+
+const KLKernels kPreciseScalarKernels = {
+  "scalar",
+  &internal::PreciseWeightedLog1pSum,
+  &internal::PreciseSparseLog1pIncrease,
+  &internal::PreciseKLDivergence,
+  &ScalarAddVector,
+  &ScalarSubtractVector,
+};
+
+const KLKernels kFastScalarKernels = {
+  "scalar-fast",
+  &FastScalarKernels::WeightedLog1pSum,
+  &FastScalarKernels::SparseLog1pIncrease,
+  &FastScalarKernels::KLDivergence,
+  &ScalarAddVector,
+  &ScalarSubtractVector,
+};
+
+}  // anonymous namespace
+
+namespace internal {
+
+double PreciseWeightedLog1pSum(const double* weights,
+                               const double* values,
+                               int size,
+                               double divisor) {
+  return PreciseScalarKernels::WeightedLog1pSum(weights, values, size,
+                                                divisor);
+}
+
+double PreciseSparseLog1pIncrease(const int* ids,
+                                  const double* values,
+                                  int size,
+                                  const double* weights,
+                                  const double* base,
+                                  double divisor) {
+  return PreciseScalarKernels::SparseLog1pIncrease(ids, values, size, weights,
+                                                   base, divisor);
+}
+
+double PreciseKLDivergence(const double* a,
+                           const double* b,
+                           const double* c,
+                           int size,
+                           double sum,
+                           double smoothing_factor) {
+  return PreciseScalarKernels::KLDivergence(a, b, c, size, sum,
+                                            smoothing_factor);
+}
+
+}  // namespace internal
+
+KernelIsa GetBestKernelIsa() {
+  static const KernelIsa best_isa = internal::DetectKernelIsa();
+  return best_isa;
+}
+
+const KLKernels* GetKLKernels(KernelIsa isa, bool fast_log) {
+  if (isa > GetBestKernelIsa()) return NULL;
+  if (isa == KERNEL_SCALAR)
+    return fast_log ? &kFastScalarKernels : &kPreciseScalarKernels;
+  return internal::GetVectorKLKernels(isa, fast_log);
+}
+
+const KLKernels& GetBestKLKernels(bool fast_log) {
+  const KLKernels* kernels = GetKLKernels(GetBestKernelIsa(), fast_log);
+  CHECK(kernels != NULL);
+  return *kernels;
+}
+
+}  // namespace topicsum
@@ -0,0 +1,127 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Microbenchmark of the KL kernels. For every instruction set supported by the
+// CPU, prints the time per element of each kernel and the speedup with respect
+// to the precise scalar kernels.
+//
+// Usage: kl_kernels_benchmark [vector_size] [num_iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <vector>
+
+#include "summarizer/kl_kernels.h"
+
+using std::vector;
+using topicsum::GetKLKernels;
+using topicsum::KLKernels;
+using topicsum::KernelIsa;
+using topicsum::NUM_KERNEL_ISAS;
+
+namespace {
+
+// Number of kernels which are benchmarked.
+static const int kNumKernels = 4;
+static const char* const kKernelNames[kNumKernels] = {
+  "weighted_log1p_sum", "sparse_log1p_increase", "kl_divergence",
+  "add_vector"
+};
+
+double Now() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// Returns the time per element in nanoseconds of the given kernel. The
+// results are accumulated in *checksum so that the calls are not optimized
+// away.
+double TimeKernel(const KLKernels& kernels, int kernel, int num_iterations,
+                  const vector<double>& a, const vector<double>& b,
+                  const vector<int>& ids, vector<double>* c,
+                  double* checksum) {
+  int size = a.size();
+  double start = Now();
+  for (int iteration = 0; iteration < num_iterations; ++iteration) {
+    switch (kernel) {
+      case 0:
+        *checksum += kernels.weighted_log1p_sum(&a[0], &b[0], size, 1e-3);
+        break;
+      case 1:
+        *checksum += kernels.sparse_log1p_increase(&ids[0], &b[0], ids.size(),
+                                                   &a[0], &b[0], 1e-3);
+        break;
+      case 2:
+        *checksum += kernels.kl_divergence(&a[0], &b[0], &(*c)[0], size,
+                                           size, 1e-7);
+        break;
+      case 3:
+        *checksum += kernels.add_vector(&(*c)[0], &a[0], size);
+        break;
+    }
+  }
+  double elapsed = Now() - start;
+  int num_elements = kernel == 1 ? ids.size() : size;
+  return elapsed * 1e9 / num_iterations / num_elements;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+  int size = argc > 1 ? atoi(argv[1]) : 4096;
+  int num_iterations = argc > 2 ? atoi(argv[2]) : 2000;
+
+  vector<double> a(size);
+  vector<double> b(size);
+  vector<double> c(size);
+  vector<int> ids;
+  srandom(0);
+  for (int i = 0; i < size; ++i) {
+    a[i] = static_cast<double>(random()) / RAND_MAX;
+    b[i] = random() % 100;
+    c[i] = random() % 4;
+    if (random() % 4 == 0) ids.push_back(i);
+  }
+
+  double reference[kNumKernels];
+  double checksum = 0;
+  printf("%-12s", "kernels");
+  for (int kernel = 0; kernel < kNumKernels; ++kernel)
+    printf(" %24s", kKernelNames[kernel]);
+  printf("\n");
+
+  for (int isa = 0; isa < NUM_KERNEL_ISAS; ++isa) {
+    for (int fast_log = 0; fast_log < 2; ++fast_log) {
+      const KLKernels* kernels =
+          GetKLKernels(static_cast<KernelIsa>(isa), fast_log);
+      if (kernels == NULL) continue;
+
+      printf("%-12s", kernels->name);
+      for (int kernel = 0; kernel < kNumKernels; ++kernel) {
+        double time = TimeKernel(*kernels, kernel, num_iterations,
+                                 a, b, ids, &c, &checksum);
+        if (isa == 0 && !fast_log) reference[kernel] = time;
+        printf(" %9.3f ns/elt (x%5.2f)", time, reference[kernel] / time);
+      }
+      printf("\n");
+    }
+  }
+
+  // Printed so that the benchmarked calls have an observable effect.
+  fprintf(stderr, "checksum: %g\n", checksum);
+  return 0;
+}
@@ -0,0 +1,162 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/kl_kernels.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::vector;
+
+namespace {
+
+// Size of the test vectors, chosen so that all the kernels have a remainder.
+static const int kSize = 1003;
+
+// Relative tolerance between the scalar and the vectorized kernels.
+static const double kTolerance = 1e-12;
+
+double RandomDouble() {
+  return static_cast<double>(random()) / RAND_MAX;
+}
+
+// Random input of the kernels, with some zero entries.
+struct KernelInput {
+  KernelInput() : a(kSize), b(kSize), c(kSize) {
+    srandom(0);
+    for (int i = 0; i < kSize; ++i) {
+      a[i] = i % 5 == 0 ? 0 : RandomDouble();
+      b[i] = i % 3 == 0 ? 0 : 100 * RandomDouble();
+      c[i] = random() % 4;
+    }
+    for (int i = 0; i < kSize; i += 3) {
+      ids.push_back(i);
+      values.push_back(1 + random() % 3);
+    }
+  }
+
+  vector<double> a;
+  vector<double> b;
+  vector<double> c;
+  vector<int> ids;
+  vector<double> values;
+};
+
+// Checks that all the kernels of an implementation match the precise scalar
+// ones.
+void CheckKernels(const KLKernels& kernels) {
+  const KLKernels& reference = *GetKLKernels(KERNEL_SCALAR, false);
+  KernelInput input;
+
+  double expected = reference.weighted_log1p_sum(&input.a[0], &input.b[0],
+                                                 kSize, 1e-3);
+  EXPECT_NEAR(expected,
+              kernels.weighted_log1p_sum(&input.a[0], &input.b[0], kSize,
+                                         1e-3),
+              kTolerance * fabs(expected)) << kernels.name;
+
+  // Sparse vectors of all sizes up to a few vectors.
+  for (int size = 0; size < 20; ++size) {
+    expected = reference.sparse_log1p_increase(
+        &input.ids[0], &input.values[0], size, &input.a[0], &input.b[0], 1e-3);
+    EXPECT_NEAR(expected,
+                kernels.sparse_log1p_increase(&input.ids[0], &input.values[0],
+                                              size, &input.a[0], &input.b[0],
+                                              1e-3),
+                kTolerance * fabs(expected)) << kernels.name << " " << size;
+  }
+
+  expected = reference.kl_divergence(&input.a[0], &input.b[0], &input.c[0],
+                                     kSize, 5000, 1e-7);
+  EXPECT_NEAR(expected,
+              kernels.kl_divergence(&input.a[0], &input.b[0], &input.c[0],
+                                    kSize, 5000, 1e-7),
+              kTolerance * fabs(expected)) << kernels.name;
+  expected = reference.kl_divergence(&input.a[0], &input.b[0], NULL,
+                                     kSize, 5000, 1e-7);
+  EXPECT_NEAR(expected,
+              kernels.kl_divergence(&input.a[0], &input.b[0], NULL,
+                                    kSize, 5000, 1e-7),
+              kTolerance * fabs(expected)) << kernels.name;
+
+  vector<double> expected_vector(input.b);
+  vector<double> actual_vector(input.b);
+  expected = reference.add_vector(&expected_vector[0], &input.c[0], kSize);
+  EXPECT_NEAR(expected,
+              kernels.add_vector(&actual_vector[0], &input.c[0], kSize),
+              kTolerance * fabs(expected)) << kernels.name;
+  expected = reference.subtract_vector(&expected_vector[0], &input.a[0],
+                                       kSize);
+  EXPECT_NEAR(expected,
+              kernels.subtract_vector(&actual_vector[0], &input.a[0], kSize),
+              kTolerance * fabs(expected)) << kernels.name;
+  for (int i = 0; i < kSize; ++i)
+    EXPECT_EQ(expected_vector[i], actual_vector[i]) << kernels.name << " " << i;
+}
+
+}  // unnamed namespace
+
+TEST(KLKernels, FastLog) {
+  double x = 1e-300;
+  while (x < 1e300) {
+    EXPECT_NEAR(log(x), FastLog(x), 4e-16 * fabs(log(x))) << x;
+    x *= 1.37;
+  }
+  for (x = 0.5; x < 2; x += 0.001)
+    EXPECT_NEAR(log(x), FastLog(x), 3e-16) << x;
+  EXPECT_EQ(0, FastLog(1));
+}
+
+TEST(KLKernels, FastLog1p) {
+  double x = 1e-20;
+  while (x < 1e20) {
+    EXPECT_NEAR(log1p(x), FastLog1p(x), 1e-15 * log1p(x)) << x;
+    x *= 1.37;
+  }
+  EXPECT_EQ(0, FastLog1p(0));
+}
+
+TEST(KLKernels, Dispatch) {
+  KernelIsa best_isa = GetBestKernelIsa();
+  EXPECT_EQ(GetKLKernels(best_isa, false), &GetBestKLKernels(false));
+  EXPECT_EQ(GetKLKernels(best_isa, true), &GetBestKLKernels(true));
+  EXPECT_TRUE(GetKLKernels(KERNEL_SCALAR, false) != NULL);
+  for (int isa = best_isa + 1; isa < NUM_KERNEL_ISAS; ++isa) {
+    EXPECT_TRUE(GetKLKernels(static_cast<KernelIsa>(isa), false) == NULL);
+  }
+}
+
+TEST(KLKernels, MatchScalarKernels) {
+  for (int isa = 0; isa < NUM_KERNEL_ISAS; ++isa) {
+    for (int fast_log = 0; fast_log < 2; ++fast_log) {
+      const KLKernels* kernels =
+          GetKLKernels(static_cast<KernelIsa>(isa), fast_log);
+      if (kernels == NULL) continue;
+      CheckKernels(*kernels);
+    }
+  }
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
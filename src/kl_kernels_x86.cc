@@ -0,0 +1,575 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SSE2, AVX2 and AVX-512 kernels. The functions are compiled with target
+// attributes, so that this file does not need specific compiler flags, and
+// they are only called when the CPU supports the instruction set.
+//
+// The vectorized logarithm follows FastLog in kl_kernels.cc.
+
+#include "summarizer/kl_kernels.h"
+
+#include "summarizer/kl_kernels_internal.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SUMMARIZER_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace topicsum {
+namespace internal {
+
+#ifdef SUMMARIZER_X86_KERNELS
+
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+
+namespace {
+
+// ===================================================================
+// SSE2
+
+TARGET_SSE2 inline __m128d Sse2Select(__m128d mask, __m128d a, __m128d b) {
+  return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+TARGET_SSE2 inline double Sse2HorizontalSum(__m128d v) {
+  return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+
+TARGET_SSE2 inline __m128d Sse2FastLog(__m128d x) {
+  const __m128d one = _mm_set1_pd(1.0);
+  __m128i bits = _mm_castpd_si128(x);
+  __m128d exponent = _mm_sub_pd(
+      _mm_castsi128_pd(_mm_or_si128(
+          _mm_srli_epi64(bits, 52),
+          _mm_set1_epi64x(kTwoPow52Bits))),
+      _mm_set1_pd(kTwoPow52PlusBias));
+  __m128d mantissa = _mm_castsi128_pd(_mm_or_si128(
+      _mm_and_si128(bits, _mm_set1_epi64x(kMantissaMask)),
+      _mm_set1_epi64x(kOneBits)));
+  __m128d large = _mm_cmpgt_pd(mantissa, _mm_set1_pd(kSqrt2));
+  mantissa = Sse2Select(large, _mm_mul_pd(mantissa, _mm_set1_pd(0.5)),
+                        mantissa);
+  exponent = _mm_add_pd(exponent, _mm_and_pd(large, one));
+
+  __m128d t = _mm_div_pd(_mm_sub_pd(mantissa, one), _mm_add_pd(mantissa, one));
+  __m128d t2 = _mm_mul_pd(t, t);
+  __m128d p = _mm_set1_pd(kLogCoefficients[kNumLogCoefficients - 1]);
+  for (int k = kNumLogCoefficients - 2; k >= 0; --k)
+    p = _mm_add_pd(_mm_mul_pd(p, t2), _mm_set1_pd(kLogCoefficients[k]));
+
+  __m128d low = _mm_add_pd(_mm_mul_pd(exponent, _mm_set1_pd(kLn2Lo)),
+                           _mm_mul_pd(_mm_add_pd(t, t), p));
+  return _mm_add_pd(_mm_mul_pd(exponent, _mm_set1_pd(kLn2Hi)), low);
+}
+
+TARGET_SSE2 inline __m128d Sse2FastLog1p(__m128d x) {
+  const __m128d one = _mm_set1_pd(1.0);
+  __m128d u = _mm_add_pd(one, x);
+  __m128d result = _mm_mul_pd(Sse2FastLog(u),
+                              _mm_div_pd(x, _mm_sub_pd(u, one)));
+  return Sse2Select(_mm_cmpeq_pd(u, one), x, result);
+}
+
+TARGET_SSE2 double Sse2WeightedLog1pSum(const double* weights,
+                                        const double* values,
+                                        int size,
+                                        double divisor) {
+  __m128d d = _mm_set1_pd(divisor);
+  __m128d sum = _mm_setzero_pd();
+  int i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d x = _mm_div_pd(_mm_loadu_pd(values + i), d);
+    sum = _mm_add_pd(sum, _mm_mul_pd(_mm_loadu_pd(weights + i),
+                                     Sse2FastLog1p(x)));
+  }
+  double result = Sse2HorizontalSum(sum);
+  for (; i < size; ++i) {
+    double x = values[i] / divisor;
+    result += weights[i] * FastLog1p(x);
+  }
+  return result;
+}
+
+TARGET_SSE2 double Sse2SparseLog1pIncrease(const int* ids,
+                                           const double* values,
+                                           int size,
+                                           const double* weights,
+                                           const double* base,
+                                           double divisor) {
+  __m128d d = _mm_set1_pd(divisor);
+  __m128d sum = _mm_setzero_pd();
+  int j = 0;
+  for (; j + 2 <= size; j += 2) {
+    __m128d w = _mm_set_pd(weights[ids[j + 1]], weights[ids[j]]);
+    __m128d b = _mm_set_pd(base[ids[j + 1]], base[ids[j]]);
+    __m128d v = _mm_loadu_pd(values + j);
+    __m128d increase = _mm_sub_pd(
+        Sse2FastLog1p(_mm_div_pd(_mm_add_pd(b, v), d)),
+        Sse2FastLog1p(_mm_div_pd(b, d)));
+    sum = _mm_add_pd(sum, _mm_mul_pd(w, increase));
+  }
+  double result = Sse2HorizontalSum(sum);
+  for (; j < size; ++j) {
+    double b = base[ids[j]];
+    double x = (b + values[j]) / divisor;
+    double y = b / divisor;
+    result += weights[ids[j]] * (FastLog1p(x) - FastLog1p(y));
+  }
+  return result;
+}
+
+TARGET_SSE2 double Sse2KLDivergence(const double* a,
+                                    const double* b,
+                                    const double* c,
+                                    int size,
+                                    double sum,
+                                    double smoothing_factor) {
+  double norm = 1 + size * smoothing_factor;
+  __m128d s = _mm_set1_pd(sum);
+  __m128d eps = _mm_set1_pd(smoothing_factor);
+  __m128d n = _mm_set1_pd(norm);
+  __m128d kl = _mm_setzero_pd();
+  int i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d a_value = _mm_loadu_pd(a + i);
+    __m128d q = _mm_loadu_pd(b + i);
+    if (c != NULL) q = _mm_add_pd(q, _mm_loadu_pd(c + i));
+    q = _mm_div_pd(_mm_add_pd(_mm_div_pd(q, s), eps), n);
+    __m128d term = _mm_mul_pd(a_value,
+                              Sse2FastLog(_mm_div_pd(a_value, q)));
+    __m128d non_zero = _mm_cmpneq_pd(a_value, _mm_setzero_pd());
+    kl = _mm_add_pd(kl, _mm_and_pd(non_zero, term));
+  }
+  double result = Sse2HorizontalSum(kl);
+  for (; i < size; ++i) {
+    if (a[i] == 0) continue;
+    double q = c == NULL ? b[i] : b[i] + c[i];
+    q = (q / sum + smoothing_factor) / norm;
+    result += a[i] * FastLog(a[i] / q);
+  }
+  return result;
+}
+
+TARGET_SSE2 double Sse2AddVector(double* a, const double* b, int size) {
+  __m128d sum = _mm_setzero_pd();
+  int i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d value = _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+    _mm_storeu_pd(a + i, value);
+    sum = _mm_add_pd(sum, value);
+  }
+  double result = Sse2HorizontalSum(sum);
+  for (; i < size; ++i) {
+    a[i] += b[i];
+    result += a[i];
+  }
+  return result;
+}
+
+TARGET_SSE2 double Sse2SubtractVector(double* a, const double* b, int size) {
+  __m128d sum = _mm_setzero_pd();
+  int i = 0;
+  for (; i + 2 <= size; i += 2) {
+    __m128d value = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+    _mm_storeu_pd(a + i, value);
+    sum = _mm_add_pd(sum, value);
+  }
+  double result = Sse2HorizontalSum(sum);
+  for (; i < size; ++i) {
+    a[i] -= b[i];
+    result += a[i];
+  }
+  return result;
+}
+
+// ===================================================================
+// AVX2
+
+TARGET_AVX2 inline double Avx2HorizontalSum(__m256d v) {
+  __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v),
+                           _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+TARGET_AVX2 inline __m256d Avx2FastLog(__m256d x) {
+  const __m256d one = _mm256_set1_pd(1.0);
+  __m256i bits = _mm256_castpd_si256(x);
+  __m256d exponent = _mm256_sub_pd(
+      _mm256_castsi256_pd(_mm256_or_si256(
+          _mm256_srli_epi64(bits, 52),
+          _mm256_set1_epi64x(kTwoPow52Bits))),
+      _mm256_set1_pd(kTwoPow52PlusBias));
+  __m256d mantissa = _mm256_castsi256_pd(_mm256_or_si256(
+      _mm256_and_si256(bits, _mm256_set1_epi64x(kMantissaMask)),
+      _mm256_set1_epi64x(kOneBits)));
+  __m256d large = _mm256_cmp_pd(mantissa, _mm256_set1_pd(kSqrt2),
+                                _CMP_GT_OQ);
+  mantissa = _mm256_blendv_pd(
+      mantissa, _mm256_mul_pd(mantissa, _mm256_set1_pd(0.5)), large);
+  exponent = _mm256_add_pd(exponent, _mm256_and_pd(large, one));
+
+  __m256d t = _mm256_div_pd(_mm256_sub_pd(mantissa, one),
+                            _mm256_add_pd(mantissa, one));
+  __m256d t2 = _mm256_mul_pd(t, t);
+  __m256d p = _mm256_set1_pd(kLogCoefficients[kNumLogCoefficients - 1]);
+  for (int k = kNumLogCoefficients - 2; k >= 0; --k)
+    p = _mm256_fmadd_pd(p, t2, _mm256_set1_pd(kLogCoefficients[k]));
+
+  __m256d low = _mm256_fmadd_pd(exponent, _mm256_set1_pd(kLn2Lo),
+                                _mm256_mul_pd(_mm256_add_pd(t, t), p));
+  return _mm256_fmadd_pd(exponent, _mm256_set1_pd(kLn2Hi), low);
+}
+
+TARGET_AVX2 inline __m256d Avx2FastLog1p(__m256d x) {
+  const __m256d one = _mm256_set1_pd(1.0);
+  __m256d u = _mm256_add_pd(one, x);
+  __m256d result = _mm256_mul_pd(Avx2FastLog(u),
+                                 _mm256_div_pd(x, _mm256_sub_pd(u, one)));
+  return _mm256_blendv_pd(result, x, _mm256_cmp_pd(u, one, _CMP_EQ_OQ));
+}
+
+TARGET_AVX2 double Avx2WeightedLog1pSum(const double* weights,
+                                        const double* values,
+                                        int size,
+                                        double divisor) {
+  __m256d d = _mm256_set1_pd(divisor);
+  __m256d sum = _mm256_setzero_pd();
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d x = _mm256_div_pd(_mm256_loadu_pd(values + i), d);
+    sum = _mm256_fmadd_pd(_mm256_loadu_pd(weights + i),
+                          Avx2FastLog1p(x), sum);
+  }
+  double result = Avx2HorizontalSum(sum);
+  for (; i < size; ++i) {
+    double x = values[i] / divisor;
+    result += weights[i] * FastLog1p(x);
+  }
+  return result;
+}
+
+TARGET_AVX2 double Avx2SparseLog1pIncrease(const int* ids,
+                                           const double* values,
+                                           int size,
+                                           const double* weights,
+                                           const double* base,
+                                           double divisor) {
+  __m256d d = _mm256_set1_pd(divisor);
+  __m256d sum = _mm256_setzero_pd();
+  // The gathers take an explicit zero source, like the AVX-512 kernels.
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  int j = 0;
+  for (; j + 4 <= size; j += 4) {
+    __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + j));
+    __m256d w = _mm256_mask_i32gather_pd(zero, weights, index, all, 8);
+    __m256d b = _mm256_mask_i32gather_pd(zero, base, index, all, 8);
+    __m256d v = _mm256_loadu_pd(values + j);
+    __m256d increase = _mm256_sub_pd(
+        Avx2FastLog1p(_mm256_div_pd(_mm256_add_pd(b, v), d)),
+        Avx2FastLog1p(_mm256_div_pd(b, d)));
+    sum = _mm256_fmadd_pd(w, increase, sum);
+  }
+  double result = Avx2HorizontalSum(sum);
+  for (; j < size; ++j) {
+    double b = base[ids[j]];
+    double x = (b + values[j]) / divisor;
+    double y = b / divisor;
+    result += weights[ids[j]] * (FastLog1p(x) - FastLog1p(y));
+  }
+  return result;
+}
+
+TARGET_AVX2 double Avx2KLDivergence(const double* a,
+                                    const double* b,
+                                    const double* c,
+                                    int size,
+                                    double sum,
+                                    double smoothing_factor) {
+  double norm = 1 + size * smoothing_factor;
+  __m256d s = _mm256_set1_pd(sum);
+  __m256d eps = _mm256_set1_pd(smoothing_factor);
+  __m256d n = _mm256_set1_pd(norm);
+  __m256d kl = _mm256_setzero_pd();
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d a_value = _mm256_loadu_pd(a + i);
+    __m256d q = _mm256_loadu_pd(b + i);
+    if (c != NULL) q = _mm256_add_pd(q, _mm256_loadu_pd(c + i));
+    q = _mm256_div_pd(_mm256_add_pd(_mm256_div_pd(q, s), eps), n);
+    __m256d term = _mm256_mul_pd(
+        a_value, Avx2FastLog(_mm256_div_pd(a_value, q)));
+    __m256d non_zero = _mm256_cmp_pd(a_value, _mm256_setzero_pd(),
+                                     _CMP_NEQ_OQ);
+    kl = _mm256_add_pd(kl, _mm256_and_pd(non_zero, term));
+  }
+  double result = Avx2HorizontalSum(kl);
+  for (; i < size; ++i) {
+    if (a[i] == 0) continue;
+    double q = c == NULL ? b[i] : b[i] + c[i];
+    q = (q / sum + smoothing_factor) / norm;
+    result += a[i] * FastLog(a[i] / q);
+  }
+  return result;
+}
+
+TARGET_AVX2 double Avx2AddVector(double* a, const double* b, int size) {
+  __m256d sum = _mm256_setzero_pd();
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d value = _mm256_add_pd(_mm256_loadu_pd(a + i),
+                                  _mm256_loadu_pd(b + i));
+    _mm256_storeu_pd(a + i, value);
+    sum = _mm256_add_pd(sum, value);
+  }
+  double result = Avx2HorizontalSum(sum);
+  for (; i < size; ++i) {
+    a[i] += b[i];
+    result += a[i];
+  }
+  return result;
+}
+
+TARGET_AVX2 double Avx2SubtractVector(double* a, const double* b, int size) {
+  __m256d sum = _mm256_setzero_pd();
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m256d value = _mm256_sub_pd(_mm256_loadu_pd(a + i),
+                                  _mm256_loadu_pd(b + i));
+    _mm256_storeu_pd(a + i, value);
+    sum = _mm256_add_pd(sum, value);
+  }
+  double result = Avx2HorizontalSum(sum);
+  for (; i < size; ++i) {
+    a[i] -= b[i];
+    result += a[i];
+  }
+  return result;
+}
+
+// ===================================================================
+// AVX-512
+
+// The reductions and shifts of the intrinsics headers start from undefined
+// vectors, which GCC reports as uninitialized at -O2, so the kernels use the
+// masked forms with an explicit zero source.
+TARGET_AVX512 inline double Avx512HorizontalSum(__m512d v) {
+  const __m256d zero = _mm256_setzero_pd();
+  return Avx2HorizontalSum(_mm256_add_pd(
+      _mm512_mask_extractf64x4_pd(zero, 0xff, v, 0),
+      _mm512_mask_extractf64x4_pd(zero, 0xff, v, 1)));
+}
+
+TARGET_AVX512 inline __m512d Avx512FastLog(__m512d x) {
+  const __m512d one = _mm512_set1_pd(1.0);
+  __m512i bits = _mm512_castpd_si512(x);
+  __m512d exponent = _mm512_sub_pd(
+      _mm512_castsi512_pd(_mm512_or_si512(
+          _mm512_maskz_srli_epi64(0xff, bits, 52),
+          _mm512_set1_epi64(kTwoPow52Bits))),
+      _mm512_set1_pd(kTwoPow52PlusBias));
+  __m512d mantissa = _mm512_castsi512_pd(_mm512_or_si512(
+      _mm512_and_si512(bits, _mm512_set1_epi64(kMantissaMask)),
+      _mm512_set1_epi64(kOneBits)));
+  __mmask8 large = _mm512_cmp_pd_mask(mantissa, _mm512_set1_pd(kSqrt2),
+                                      _CMP_GT_OQ);
+  mantissa = _mm512_mask_mul_pd(mantissa, large, mantissa,
+                                _mm512_set1_pd(0.5));
+  exponent = _mm512_mask_add_pd(exponent, large, exponent, one);
+
+  __m512d t = _mm512_div_pd(_mm512_sub_pd(mantissa, one),
+                            _mm512_add_pd(mantissa, one));
+  __m512d t2 = _mm512_mul_pd(t, t);
+  __m512d p = _mm512_set1_pd(kLogCoefficients[kNumLogCoefficients - 1]);
+  for (int k = kNumLogCoefficients - 2; k >= 0; --k)
+    p = _mm512_fmadd_pd(p, t2, _mm512_set1_pd(kLogCoefficients[k]));
+
+  __m512d low = _mm512_fmadd_pd(exponent, _mm512_set1_pd(kLn2Lo),
+                                _mm512_mul_pd(_mm512_add_pd(t, t), p));
+  return _mm512_fmadd_pd(exponent, _mm512_set1_pd(kLn2Hi), low);
+}
+
+TARGET_AVX512 inline __m512d Avx512FastLog1p(__m512d x) {
+  const __m512d one = _mm512_set1_pd(1.0);
+  __m512d u = _mm512_add_pd(one, x);
+  __m512d result = _mm512_mul_pd(Avx512FastLog(u),
+                                 _mm512_div_pd(x, _mm512_sub_pd(u, one)));
+  return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(u, one, _CMP_EQ_OQ),
+                              result, x);
+}
+
+TARGET_AVX512 double Avx512WeightedLog1pSum(const double* weights,
+                                            const double* values,
+                                            int size,
+                                            double divisor) {
+  __m512d d = _mm512_set1_pd(divisor);
+  __m512d sum = _mm512_setzero_pd();
+  int i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m512d x = _mm512_div_pd(_mm512_loadu_pd(values + i), d);
+    sum = _mm512_fmadd_pd(_mm512_loadu_pd(weights + i),
+                          Avx512FastLog1p(x), sum);
+  }
+
+  // The remaining values are processed with masked loads.
+  if (i < size) {
+    __mmask8 mask = (1 << (size - i)) - 1;
+    __m512d x = _mm512_div_pd(
+        _mm512_maskz_loadu_pd(mask, values + i), d);
+    __m512d w = _mm512_maskz_loadu_pd(mask, weights + i);
+    sum = _mm512_fmadd_pd(w, Avx512FastLog1p(x), sum);
+  }
+  return Avx512HorizontalSum(sum);
+}
+
+TARGET_AVX512 double Avx512SparseLog1pIncrease(const int* ids,
+                                               const double* values,
+                                               int size,
+                                               const double* weights,
+                                               const double* base,
+                                               double divisor) {
+  __m512d d = _mm512_set1_pd(divisor);
+  __m512d sum = _mm512_setzero_pd();
+  for (int j = 0; j < size; j += 8) {
+    __mmask8 mask = size - j >= 8 ? 0xff : (1 << (size - j)) - 1;
+    __m256i index = _mm512_mask_extracti64x4_epi64(
+        _mm256_setzero_si256(), 0xff,
+        _mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), ids + j), 0);
+    __m512d w = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, index,
+                                         weights, 8);
+    __m512d b = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, index,
+                                         base, 8);
+    __m512d v = _mm512_maskz_loadu_pd(mask, values + j);
+    __m512d increase = _mm512_sub_pd(
+        Avx512FastLog1p(_mm512_div_pd(_mm512_add_pd(b, v), d)),
+        Avx512FastLog1p(_mm512_div_pd(b, d)));
+    sum = _mm512_fmadd_pd(w, increase, sum);
+  }
+  return Avx512HorizontalSum(sum);
+}
+
+TARGET_AVX512 double Avx512KLDivergence(const double* a,
+                                        const double* b,
+                                        const double* c,
+                                        int size,
+                                        double sum,
+                                        double smoothing_factor) {
+  double norm = 1 + size * smoothing_factor;
+  __m512d s = _mm512_set1_pd(sum);
+  __m512d eps = _mm512_set1_pd(smoothing_factor);
+  __m512d n = _mm512_set1_pd(norm);
+  __m512d kl = _mm512_setzero_pd();
+  for (int i = 0; i < size; i += 8) {
+    __mmask8 mask = size - i >= 8 ? 0xff : (1 << (size - i)) - 1;
+    __m512d a_value = _mm512_maskz_loadu_pd(mask, a + i);
+    __m512d q = _mm512_maskz_loadu_pd(mask, b + i);
+    if (c != NULL) q = _mm512_add_pd(q, _mm512_maskz_loadu_pd(mask, c + i));
+    q = _mm512_div_pd(_mm512_add_pd(_mm512_div_pd(q, s), eps), n);
+    __m512d term = _mm512_mul_pd(
+        a_value, Avx512FastLog(_mm512_div_pd(a_value, q)));
+    __mmask8 non_zero = _mm512_cmp_pd_mask(a_value, _mm512_setzero_pd(),
+                                           _CMP_NEQ_OQ);
+    kl = _mm512_mask_add_pd(kl, non_zero, kl, term);
+  }
+  return Avx512HorizontalSum(kl);
+}
+
+TARGET_AVX512 double Avx512AddVector(double* a, const double* b, int size) {
+  __m512d sum = _mm512_setzero_pd();
+  for (int i = 0; i < size; i += 8) {
+    __mmask8 mask = size - i >= 8 ? 0xff : (1 << (size - i)) - 1;
+    __m512d value = _mm512_add_pd(_mm512_maskz_loadu_pd(mask, a + i),
+                                  _mm512_maskz_loadu_pd(mask, b + i));
+    _mm512_mask_storeu_pd(a + i, mask, value);
+    sum = _mm512_add_pd(sum, value);
+  }
+  return Avx512HorizontalSum(sum);
+}
+
+TARGET_AVX512 double Avx512SubtractVector(double* a, const double* b,
+                                          int size) {
+  __m512d sum = _mm512_setzero_pd();
+  for (int i = 0; i < size; i += 8) {
+    __mmask8 mask = size - i >= 8 ? 0xff : (1 << (size - i)) - 1;
+    __m512d value = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, a + i),
+                                  _mm512_maskz_loadu_pd(mask, b + i));
+    _mm512_mask_storeu_pd(a + i, mask, value);
+    sum = _mm512_add_pd(sum, value);
+  }
+  return Avx512HorizontalSum(sum);
+}
+
+// ===================================================================
+
+// In precise mode, the calls to the C library dominate the time of the kernels
+// computing logarithms, so the scalar kernels are used for them.
+const KLKernels kVectorKernels[NUM_KERNEL_ISAS][2] = {
+  {
+    // The scalar kernels are defined in kl_kernels.cc.
+    { NULL, NULL, NULL, NULL, NULL, NULL },
+    { NULL, NULL, NULL, NULL, NULL, NULL },
+  },
+  {
+    { "sse2", &PreciseWeightedLog1pSum, &PreciseSparseLog1pIncrease,
+      &PreciseKLDivergence, &Sse2AddVector, &Sse2SubtractVector },
+    { "sse2-fast", &Sse2WeightedLog1pSum, &Sse2SparseLog1pIncrease,
+      &Sse2KLDivergence, &Sse2AddVector, &Sse2SubtractVector },
+  },
+  {
+    { "avx2", &PreciseWeightedLog1pSum, &PreciseSparseLog1pIncrease,
+      &PreciseKLDivergence, &Avx2AddVector, &Avx2SubtractVector },
+    { "avx2-fast", &Avx2WeightedLog1pSum, &Avx2SparseLog1pIncrease,
+      &Avx2KLDivergence, &Avx2AddVector, &Avx2SubtractVector },
+  },
+  {
+    { "avx512", &PreciseWeightedLog1pSum, &PreciseSparseLog1pIncrease,
+      &PreciseKLDivergence, &Avx512AddVector, &Avx512SubtractVector },
+    { "avx512-fast", &Avx512WeightedLog1pSum, &Avx512SparseLog1pIncrease,
+      &Avx512KLDivergence, &Avx512AddVector, &Avx512SubtractVector },
+  },
+};
+
+}  // anonymous namespace
+
+KernelIsa DetectKernelIsa() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return KERNEL_AVX512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return KERNEL_AVX2;
+  if (__builtin_cpu_supports("sse2")) return KERNEL_SSE2;
+  return KERNEL_SCALAR;
+}
+
+const KLKernels* GetVectorKLKernels(KernelIsa isa, bool fast_log) {
+  if (isa <= KERNEL_SCALAR || isa >= NUM_KERNEL_ISAS) return NULL;
+  return &kVectorKernels[isa][fast_log ? 1 : 0];
+}
+
+#else  // SUMMARIZER_X86_KERNELS
+
+KernelIsa DetectKernelIsa() {
+  return KERNEL_SCALAR;
+}
+
+const KLKernels* GetVectorKLKernels(KernelIsa isa, bool fast_log) {
+  return NULL;
+}
+
+#endif  // SUMMARIZER_X86_KERNELS
+
+}  // namespace internal
+}  // namespace topicsum
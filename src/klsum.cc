@@ -19,12 +19,15 @@
 #include <cmath>
 #include <limits>
 #include <list>
+#include <map>
 #include <set>
 #include <sstream>
 
+#include "summarizer/deadline.h"
 #include "summarizer/distribution.h"
 #include "summarizer/document.h"
-#include "summarizer/lexicon.h"
+#include "summarizer/klsum_scorer.h"
+#include "summarizer/klsum_workspace.h"
 #include "summarizer/news_postprocessor.h"
 #include "summarizer/redundancy.h"
 #include "summarizer/scoped_ptr.h"
@@ -33,40 +36,27 @@
 namespace topicsum {
 
 using std::ostringstream;
-using std::nth_element;
 using std::make_pair;
+using std::map;
+using std::make_heap;
+using std::pop_heap;
+using std::push_heap;
 
 static const float kKLSmoothingValue = 0.0000001;
 
 const float KLSum::kMaxCost = std::numeric_limits<float>::max();
 
-namespace {
-
-double CalculateKLDivergence(const VectorDistribution& distriA,
-                             const VectorDistribution& distriB,
-                             double smoothing_factor) {
-  if (smoothing_factor < 0)
-    smoothing_factor = kKLSmoothingValue;
-
-  double kl = 0;
-  for (int i = 0; i < distriA.length; ++i) {
-    double valA = distriA.distribution[i];
-    if (valA == 0) continue;
-
-    double valB = distriB.distribution[i];
-
-    // Apply smoothing factor.
-    valB = (valB + smoothing_factor) /
-        (1 + distriA.length  * smoothing_factor);
-
-    // Update divergence.
-    kl += valA * log(valA / valB);
-  }
-
-  return kl;
-}
+KLSum::KLSum() : coll_distri_(NULL),
+                 output_debug_(NULL),
+                 deadline_(NULL),
+                 redundancy_removal_(true),
+                 lazy_evaluation_(false),
+                 fast_log_(false),
+                 precision_(KLSumOptions::DOUBLE),
+                 collapse_duplicates_(false),
+                 postprocessor_(NULL) {}
 
-}  // unnamed namespace
+KLSum::~KLSum() {}
 
 bool KLSum::Init(const DocumentCollection& collection,
                  const SummarizerOptions& options) {
@@ -97,6 +87,21 @@ bool KLSum::Init(const DocumentCollection& collection,
     }
   }
 
+  lazy_evaluation_ = options.klsum_options().lazy_evaluation();
+  fast_log_ = options.klsum_options().fast_log();
+  precision_ = options.klsum_options().precision();
+  thread_pool_.reset(new ThreadPool(options.klsum_options().num_threads()));
+
+  // The collection distribution is calculated by the first call to Summarize,
+  // since the subclasses may only be able to calculate it after Init.
+  coll_distri_.reset(NULL);
+  workspace_.reset(new KLSumWorkspace(collection_, postprocessor_.get()));
+  collapse_duplicates_ = options.klsum_options().collapse_duplicates();
+  if (collapse_duplicates_) {
+    workspace_->CollapseDuplicates(
+        options.klsum_options().near_duplicate_similarity());
+  }
+
   strategy_ = options.klsum_options().has_optimization_strategy() ?
       options.klsum_options().optimization_strategy() :
       KLSumOptions::GREEDY_OPTIMIZATION;
@@ -122,39 +127,100 @@ bool KLSum::Summarize(const SummaryOptions& options,
     last_error_message_ = "SummarizerOptions does not contain summary length";
     return false;
   }
-  if (options.length().unit() != SummaryLength::TOKEN &&
-      options.length().unit() != SummaryLength::SENTENCE) {
-    ostringstream oss;
-    oss << "This summarizer only supports TOKEN and SENTENCE as "
-        << "summary length unit but you required "
-        << options.length().unit();
-    last_error_message_ = oss.str();
+  vector<SummaryLength> lengths(1, options.length());
+  vector<Document*> summaries(1, summary);
+  return SummarizeLengths(options, lengths, summaries);
+}
+
+bool KLSum::SummarizeMultipleLengths(const SummaryOptions& options,
+                                     vector<Document>* summaries) {
+  CHECK(summaries != NULL);
+  if (!options.has_length()) {
+    last_error_message_ = "SummarizerOptions does not contain summary length";
     return false;
   }
+  vector<SummaryLength> lengths(1, options.length());
+  lengths.insert(lengths.end(),
+                 options.additional_length().begin(),
+                 options.additional_length().end());
+  summaries->resize(lengths.size());
+  vector<Document*> summary_pointers;
+  for (uint i = 0; i < summaries->size(); ++i)
+    summary_pointers.push_back(&(*summaries)[i]);
+  return SummarizeLengths(options, lengths, summary_pointers);
+}
+
+bool KLSum::SummarizeLengths(const SummaryOptions& options,
+                             const vector<SummaryLength>& lengths,
+                             const vector<Document*>& summaries) {
+  for (uint i = 0; i < lengths.size(); ++i) {
+    if (lengths[i].unit() != SummaryLength::TOKEN &&
+        lengths[i].unit() != SummaryLength::SENTENCE) {
+      ostringstream oss;
+      oss << "This summarizer only supports TOKEN and SENTENCE as "
+          << "summary length unit but you required "
+          << lengths[i].unit();
+      last_error_message_ = oss.str();
+      return false;
+    }
+  }
 
+  // The budget starts now, so that it includes the computation of the
+  // collection distribution.
+  Deadline deadline(options.deadline_ms());
+
+  // The summaries start with the same content, which is built in the first
+  // one and copied to the others.
+  Document* summary = summaries[0];
   summary->Clear();
 
   // If we are to generate debug, keep a pointer to the output debug
   // and append the information that has been generated so far.
-  if (options.has_generate_debug() && options.generate_debug()) {
+  bool generate_debug = options.has_generate_debug() &&
+      options.generate_debug();
+  output_debug_ = NULL;
+  if (generate_debug) {
     output_debug_ = summary->mutable_debug_string();
     output_debug_->append(debug_);
   }
 
-  // Calculate distribution of words in the collection.
-  if (!CalculateCollectionDistribution(collection_)) {
-    last_error_message_.append(
-        "\nError computing the collection distribution.");
-    return false;
+  // Calculate distribution of words in the collection, unless it has already
+  // been calculated by a previous call.
+  if (!workspace_->has_collection_distribution()) {
+    if (!CalculateCollectionDistribution(collection_)) {
+      last_error_message_.append(
+          "\nError computing the collection distribution.");
+      return false;
+    }
+    workspace_->SetCollectionDistribution(*coll_distri_);
   }
 
   if (output_debug_) {
     // Add the collection distribution to the debug output.
     output_debug_->append("\nCollection distribution:\n");
     output_debug_->append(PrintDistribution(*coll_distri_, 4));
+
+    if (collapse_duplicates_) {
+      int num_sentences = workspace_->num_uncollapsed_sentences();
+      int num_candidates = workspace_->sentences().size();
+      ostringstream oss;
+      oss << "\nCollapsed duplicates: " << num_sentences
+          << " candidate sentences into " << num_candidates << " (ratio "
+          << (num_sentences > 0 ?
+              num_candidates / static_cast<double>(num_sentences) : 1)
+          << ")";
+      output_debug_->append(oss.str());
+    }
   }
 
-  return SummarizeIncremental(collection_, options, strategy_, summary);
+  for (uint i = 1; i < summaries.size(); ++i)
+    summaries[i]->CopyFrom(*summary);
+
+  deadline_ = &deadline;
+  bool success = SummarizeIncremental(lengths, strategy_, generate_debug,
+                                      summaries);
+  deadline_ = NULL;
+  return success;
 }
 
 struct SecondValueGreater {
@@ -183,101 +249,273 @@ int NumTopTopicModelWords(int length_limit,
   }
 }
 
-struct OrderBySecond {
+// Orders the pairs by second then first element, so that the ties are broken
+// as by a stable sort of pairs stored by increasing first element.
+struct OrderBySecondThenFirst {
   template <class P>
   bool operator()(const P& a, const P& b) const {
-    return a.second < b.second;
+    return a.second < b.second || (a.second == b.second && a.first < b.first);
   }
 };
 
-}  // anonymous namespace
+// Scores all the remaining candidates against the current summary. The
+// candidates are split into contiguous shards which only read the scorer, and
+// every shard writes the scores of its own candidates.
+template <typename T>
+class CandidateScoringTask : public ParallelTask {
+ public:
+  CandidateScoringTask(const BasicKLSumScorer<T>& scorer,
+                       const vector<SparseDistribution*>& sentences,
+                       const vector<int>& doc_positions,
+                       const vector<int>& prior_scores,
+                       bool sentence_position,
+                       float summary_weight,
+                       float prior_weight,
+                       int num_shards,
+                       vector<double>* scores)
+      : scorer_(scorer),
+        sentences_(sentences),
+        doc_positions_(doc_positions),
+        prior_scores_(prior_scores),
+        sentence_position_(sentence_position),
+        summary_weight_(summary_weight),
+        prior_weight_(prior_weight),
+        num_shards_(num_shards),
+        scores_(scores) {
+    scores_->resize(sentences_.size());
+  }
 
-// The greedy approach suggested in Haghighi's NAACL'09 paper consists in
-// iteratively adding sentences minimizing the KL divergence.
-bool KLSum::SummarizeIncremental(const DocumentCollection& collection,
-                                 const SummaryOptions& options,
-                                 KLSumOptions::OptimizationStrategy strategy,
-                                 Document* summary) {
-  int length_limit = options.length().length();
-  int length_unit = options.length().unit();
-
-  // Generate a lexicon for the collection.
-  Lexicon lexicon;
-  for (int d = 0; d < collection.document_size(); d++) {
-    const Document& doc = collection.document(d);
-    for (int s = 0; s < doc.sentence_size(); s++) {
-      const Sentence& sent = doc.sentence(s);
-      for (int w = 0; w < sent.token_size(); w++) {
-        const string& word = sent.token(w);
-        lexicon.add_token(word);
-      }
+  virtual void Run(int shard) {
+    int begin, end;
+    ThreadPool::GetShardRange(sentences_.size(), num_shards_, shard,
+                              &begin, &end);
+    for (int i = begin; i < end; ++i) {
+      // If the sentence has been already selected for the summary, it has
+      // been set to NULL so that we do not select it twice.
+      if (sentences_[i] == NULL) continue;
+
+      // Calculate the divergence between the collection and the summary
+      // extended with the sentence.
+      double kl = scorer_.Score(*sentences_[i]);
+
+      if (sentence_position_)
+        kl = kl * (1 + log(doc_positions_[i]));
+
+      (*scores_)[i] = summary_weight_ * kl + prior_weight_ * prior_scores_[i];
     }
   }
 
-  // For all the sentences in the collection, represent them as
-  // VectorDistributions.
-  vector<VectorDistribution*> sentences;
-  vector<int> doc_positions;
-  vector<int> prior_scores;
-  int num_tokens = lexicon.size();
-  for (int d = 0; d < collection.document_size(); d++) {
-    const Document& doc = collection.document(d);
-    for (int s = 0; s < doc.sentence_size(); s++) {
-      const Sentence& sent = doc.sentence(s);
-
-      // If the sentence will not add any information, we skip it.
-      if (sent.token_size() == 0) continue;
-
-      if (postprocessor_.get() != NULL &&
-          !postprocessor_->IsValidSentence(sent))
-        continue;
-
-      VectorDistribution* sentence_distribution =
-          new VectorDistribution(num_tokens);
-      sentence_distribution->sentence = &sent;
-      sentence_distribution->document = &doc;
-      for (int w = 0; w < sent.token_size(); w++) {
-        const string& word = sent.token(w);
-        int id = lexicon.token2id(word);
-        sentence_distribution->distribution[id]++;
+ private:
+  const BasicKLSumScorer<T>& scorer_;
+  const vector<SparseDistribution*>& sentences_;
+  const vector<int>& doc_positions_;
+  const vector<int>& prior_scores_;
+  bool sentence_position_;
+  float summary_weight_;
+  float prior_weight_;
+  int num_shards_;
+  vector<double>* scores_;
+};
+
+// A candidate sentence in the lazy greedy queue.
+struct LazyCandidate {
+  // Index of the sentence in the list of candidates.
+  int index;
+
+  // Part of the score of the sentence which does not only depend on its
+  // length, i.e. prior_weight * prior - summary_weight * correction, where the
+  // correction was calculated when the summary had num_summary_sentences.
+  // Since the correction can only decrease when the summary grows, this gives
+  // a lower bound of the current score of the sentence.
+  double key;
+
+  // Score of the sentence when the summary had num_summary_sentences.
+  double score;
+  int num_summary_sentences;
+};
+
+// Orders the heap of candidates by increasing key, and by increasing index for
+// equal keys, which is the order in which the sentences are considered when
+// all of them are rescored.
+struct LazyCandidateGreater {
+  bool operator()(const LazyCandidate& a, const LazyCandidate& b) const {
+    if (a.key != b.key) return a.key > b.key;
+    return a.index > b.index;
+  }
+};
+
+// Lazy greedy selection of the sentence with the smallest score. The
+// candidates are grouped by length: inside a group, the part of the score which
+// only depends on the length is shared, so that the candidates can be kept in
+// a heap ordered by their stale keys. The group heads give lower bounds of the
+// scores, and only the candidate with the smallest bound is rescored, until it
+// has been scored against the current summary. The selected sentence is the
+// same as when all the candidates are rescored.
+template <typename T>
+class LazyGreedyQueue {
+ public:
+  LazyGreedyQueue(const BasicKLSumScorer<T>& scorer,
+                  const vector<SparseDistribution*>& sentences,
+                  const vector<int>& prior_scores,
+                  float summary_weight,
+                  float prior_weight)
+      : scorer_(scorer),
+        sentences_(sentences),
+        prior_scores_(prior_scores),
+        summary_weight_(summary_weight),
+        prior_weight_(prior_weight) {
+    CHECK_GE(summary_weight_, 0);
+    map<double, int> group_ids;
+    for (uint i = 0; i < sentences_.size(); ++i) {
+      if (sentences_[i] == NULL) continue;
+      map<double, int>::const_iterator it = group_ids.find(sentences_[i]->sum);
+      int group_id;
+      if (it == group_ids.end()) {
+        group_id = groups_.size();
+        group_ids[sentences_[i]->sum] = group_id;
+        groups_.push_back(Group());
+        groups_.back().length = sentences_[i]->sum;
+      } else {
+        group_id = it->second;
       }
-      sentences.push_back(sentence_distribution);
-      prior_scores.push_back(sent.prior_score());
 
-      doc_positions.push_back(s+1);
+      // Candidates which have never been scored have no lower bound.
+      LazyCandidate candidate;
+      candidate.index = i;
+      candidate.key = -std::numeric_limits<double>::infinity();
+      candidate.score = 0;
+      candidate.num_summary_sentences = -1;
+      groups_[group_id].heap.push_back(candidate);
+    }
+    for (uint g = 0; g < groups_.size(); ++g) {
+      make_heap(groups_[g].heap.begin(), groups_[g].heap.end(),
+                LazyCandidateGreater());
     }
   }
 
-  // Generate the VectorDistribution for the collection.
-  VectorDistribution collection_distribution(num_tokens);
-  vector<double> scores;
-  scores.reserve(coll_distri_->size());
-  double sum_collection = 0;
-  for (Distribution::const_iterator iter = coll_distri_->begin();
-       iter != coll_distri_->end();
-       ++iter) {
-    if (iter->second > 0.0) {
-      int id = lexicon.token2id(iter->first);
-      // Check that the collection token exists in the test collection.
-      if (id != -1) {
-        collection_distribution.distribution[id] = iter->second;
-        scores.push_back(iter->second);
-        sum_collection += iter->second;
+  // Removes from the queue the candidate with the smallest score given the
+  // current summary, which contains num_summary_sentences, and returns its
+  // index and its score. Returns -1 if the queue is empty.
+  int Pop(int num_summary_sentences, double* score, int* num_evaluations) {
+    for (;;) {
+      int best_group = -1;
+      double best_bound = 0;
+      int best_index = -1;
+      for (uint g = 0; g < groups_.size(); ++g) {
+        if (groups_[g].heap.empty()) continue;
+        const LazyCandidate& head = groups_[g].heap.front();
+        double bound = head.num_summary_sentences == num_summary_sentences ?
+            head.score :
+            summary_weight_ * scorer_.LengthScore(groups_[g].length) +
+            head.key;
+        if (best_group == -1 || bound < best_bound ||
+            (bound == best_bound && head.index < best_index)) {
+          best_group = g;
+          best_bound = bound;
+          best_index = head.index;
+        }
+      }
+      if (best_group == -1) return -1;
+
+      vector<LazyCandidate>* heap = &groups_[best_group].heap;
+      pop_heap(heap->begin(), heap->end(), LazyCandidateGreater());
+      LazyCandidate* candidate = &heap->back();
+      if (candidate->num_summary_sentences == num_summary_sentences) {
+        *score = candidate->score;
+        heap->pop_back();
+        return best_index;
       }
+
+      // Rescore the candidate against the current summary.
+      const SparseDistribution& sentence = *sentences_[candidate->index];
+      double correction = scorer_.Correction(sentence);
+      double kl = scorer_.LengthScore(sentence.sum) - correction;
+      double prior = prior_weight_ * prior_scores_[candidate->index];
+      candidate->score = summary_weight_ * kl + prior;
+      candidate->key = prior - summary_weight_ * correction;
+      candidate->num_summary_sentences = num_summary_sentences;
+      push_heap(heap->begin(), heap->end(), LazyCandidateGreater());
+      ++*num_evaluations;
     }
   }
 
+ private:
+  // Candidates sharing the same length.
+  struct Group {
+    double length;
+    vector<LazyCandidate> heap;
+  };
+
+  const BasicKLSumScorer<T>& scorer_;
+  const vector<SparseDistribution*>& sentences_;
+  const vector<int>& prior_scores_;
+  float summary_weight_;
+  float prior_weight_;
+  vector<Group> groups_;
+
+  LazyGreedyQueue(const LazyGreedyQueue&);
+  void operator=(const LazyGreedyQueue&);
+};
+
+}  // anonymous namespace
+
+struct KLSum::SummaryPath {
+  SummaryPath() : num_evaluations(0) {}
+
+  // Indices of the requested lengths which share this summary, and which have
+  // not been reached yet.
+  vector<int> lengths;
+
+  // Summary grown for these lengths.
+  Document summary;
+
+  // Candidate sentences, set to NULL once they have been considered for the
+  // summary, so that we do not select them twice.
+  vector<SparseDistribution*> sentences;
+
+  // Indices of the candidates added to the summary, in order.
+  vector<int> added_sentences;
+
+  int num_evaluations;
+};
+
+// The greedy approach suggested in Haghighi's NAACL'09 paper consists in
+// iteratively adding sentences minimizing the KL divergence.
+bool KLSum::SummarizeIncremental(const vector<SummaryLength>& lengths,
+                                 KLSumOptions::OptimizationStrategy strategy,
+                                 bool generate_debug,
+                                 const vector<Document*>& summaries) {
+  if (precision_ == KLSumOptions::FLOAT) {
+    return SelectSentences<float>(lengths, strategy, generate_debug,
+                                  summaries);
+  }
+  return SelectSentences<double>(lengths, strategy, generate_debug,
+                                 summaries);
+}
+
+template <typename T>
+bool KLSum::SelectSentences(const vector<SummaryLength>& lengths,
+                            KLSumOptions::OptimizationStrategy strategy,
+                            bool generate_debug,
+                            const vector<Document*>& summaries) {
   // If the collection distribution has no non-zero values, then we return.
-  if (sum_collection == 0) {
-    summary->mutable_debug_string()->append(
-        "Collection Distribution is empty.\n");
+  if (workspace_->collection_sum() == 0) {
+    for (uint i = 0; i < summaries.size(); ++i) {
+      summaries[i]->mutable_debug_string()->append(
+          "Collection Distribution is empty.\n");
+    }
     return false;
   }
 
-  // Normalize the collection_distribution.
-  if (sum_collection != 1) {
-    for (int k = 0; k < num_tokens; ++k)
-      collection_distribution.distribution[k] /= sum_collection;
+  const BasicVectorDistribution<T>& collection_distribution =
+      workspace_->GetCollectionVector<T>();
+
+  // The ranking does not grow the summaries, so the candidates are scored only
+  // once against the collection.
+  if (strategy == KLSumOptions::SENTENCE_RANKING) {
+    RankSentences(collection_distribution, lengths, generate_debug, summaries);
+    output_debug_ = NULL;
+    return true;
   }
 
   // The redundancy removal library checks how many of the top words in the
@@ -285,135 +523,319 @@ bool KLSum::SummarizeIncremental(const DocumentCollection& collection,
   // number of top collection words to use for redundancy removal is computed
   // here. The longer the summary, the more collection words are allowed
   // to appear in it.
-  int top_words_threshold_position =
-      scores.size() - NumTopTopicModelWords(length_limit, length_unit);
-  if (top_words_threshold_position < 0) top_words_threshold_position = 0;
-  nth_element(scores.begin(),
-              scores.begin() + top_words_threshold_position,
-              scores.end());
-  collection_distribution.top_words_threshold =
-      scores[top_words_threshold_position];
-
-  // Create an empty VectorDistribution for the summary.
-  VectorDistribution summary_distribution(num_tokens);
-
-  while (!DocumentUtils::ReachesLengthLimit(length_limit,
-                                            length_unit,
-                                            *summary)) {
-    int current_best_sentence = -1;
-    double current_best_kl = -1;
+  vector<double> top_words_thresholds;
+  for (uint i = 0; i < lengths.size(); ++i) {
+    top_words_thresholds.push_back(workspace_->GetTopWordsThreshold<T>(
+        NumTopTopicModelWords(lengths[i].length(), lengths[i].unit())));
+  }
 
-    // To store the normalized summary vector.
-    VectorDistribution normalized(num_tokens);
+  // All the lengths share the same summary at first. The summaries which
+  // diverge from it are grown once it is finished.
+  SummaryPath* path = new SummaryPath;
+  for (uint i = 0; i < lengths.size(); ++i)
+    path->lengths.push_back(i);
+  path->summary.CopyFrom(*summaries[0]);
+  path->sentences = workspace_->sentences();
+  vector<SummaryPath*> paths(1, path);
+  while (!paths.empty()) {
+    scoped_ptr<SummaryPath> current_path(paths.back());
+    paths.pop_back();
+    GrowSummaryPath(collection_distribution, lengths, top_words_thresholds,
+                    strategy, generate_debug, current_path.get(), &paths,
+                    summaries);
+  }
+  output_debug_ = NULL;
 
-    vector<pair<const VectorDistribution*, double> > scored_sentences;
-    for (uint i = 0; i < sentences.size(); ++i) {
-      // If the sentence has been already selected for the summary, it has
-      // been set to NULL so that we do not select it twice.
-      if (sentences[i] == NULL) continue;
+  return true;
+}
 
-      // Calculate and normalize the summary distribution.
-      double sum = summary_distribution.AddVector(*sentences[i]);
-      for (int k = 0; k < num_tokens; ++k) {
-        normalized.distribution[k] = summary_distribution.distribution[k] / sum;
-      }
+template <typename T>
+void KLSum::RankSentences(const BasicVectorDistribution<T>& collection,
+                          const vector<SummaryLength>& lengths,
+                          bool generate_debug,
+                          const vector<Document*>& summaries) {
+  const vector<SparseDistribution*>& sentences = workspace_->sentences();
+  SummaryPath path;
+  for (uint i = 0; i < lengths.size(); ++i)
+    path.lengths.push_back(i);
+  path.summary.CopyFrom(*summaries[0]);
+  output_debug_ = generate_debug ? path.summary.mutable_debug_string() : NULL;
+
+  FinishLengths(lengths, false, true, &path, summaries);
+  if (path.lengths.empty()) return;
+  if (FinishLengthsIfOutOfTime(lengths, &path, summaries)) return;
+
+  // Score every candidate against the empty summary, i.e. compute the
+  // divergence between the collection and the candidate alone.
+  BasicKLSumScorer<T> scorer(collection, kKLSmoothingValue,
+                             GetBestKLKernels(fast_log_));
+  for (uint i = 0; i < sentences.size(); ++i)
+    scorer.AddCandidateLength(sentences[i]->sum);
+  int num_shards = std::min<int>(sentences.size(),
+                                 4 * thread_pool_->num_threads());
+  vector<double> scores;
+  CandidateScoringTask<T> task(scorer, sentences, workspace_->doc_positions(),
+                               workspace_->prior_scores(), sentence_position_,
+                               summary_weight_, prior_weight_, num_shards,
+                               &scores);
+  thread_pool_->Run(num_shards, &task);
+  path.num_evaluations += sentences.size();
+
+  vector<pair<int, double> > ranking;
+  ranking.reserve(sentences.size());
+  for (uint i = 0; i < sentences.size(); ++i)
+    ranking.push_back(make_pair(i, scores[i]));
+
+  // Only the beginning of the ranking is usually needed, so it is sorted by
+  // batches: each batch holds the best of the remaining candidates, and the
+  // next one is only sorted if the lengths are not reached yet. The first
+  // batch is sized from the longest length and the average candidate length,
+  // and the next ones are twice as large as the previous one.
+  uint batch_size = RankingBatchSize(lengths);
+  uint num_ranked = 0;
+  while (num_ranked < ranking.size()) {
+    uint batch_end = std::min<uint>(ranking.size(), num_ranked + batch_size);
+    partial_sort(ranking.begin() + num_ranked, ranking.begin() + batch_end,
+                 ranking.end(), OrderBySecondThenFirst());
+    for (; num_ranked < batch_end; ++num_ranked) {
+      const SparseDistribution& candidate =
+          *sentences[ranking[num_ranked].first];
+      PostprocessAndAddSentence(*candidate.sentence,
+                                ranking[num_ranked].second,
+                                *candidate.document,
+                                &path.summary);
+      FinishLengths(lengths, false, false, &path, summaries);
+      if (path.lengths.empty()) return;
+    }
+    batch_size *= 2;
+  }
 
-      // Calculate the divergence.
-      double kl = CalculateKLDivergence(collection_distribution,
-                                        normalized, -1);
+  FinishLengths(lengths, true, false, &path, summaries);
+}
 
-      if (sentence_position_)
-        kl = kl * (1 + log(doc_positions[i]));
+uint KLSum::RankingBatchSize(const vector<SummaryLength>& lengths) const {
+  const vector<SparseDistribution*>& sentences = workspace_->sentences();
+  double num_tokens = 0;
+  for (uint i = 0; i < sentences.size(); ++i)
+    num_tokens += sentences[i]->sum;
+  double average_length = sentences.empty() ? 1 : num_tokens / sentences.size();
+
+  double batch_size = 1;
+  for (uint i = 0; i < lengths.size(); ++i) {
+    double num_sentences = lengths[i].length();
+    if (lengths[i].unit() == SummaryLength::TOKEN)
+      num_sentences /= average_length;
+    batch_size = std::max(batch_size, num_sentences + 1);
+  }
+  return std::min<double>(batch_size, sentences.size() + 1);
+}
 
-      kl = summary_weight_ * kl + prior_weight_ * prior_scores[i];
+bool KLSum::FinishLengthsIfOutOfTime(const vector<SummaryLength>& lengths,
+                                     SummaryPath* path,
+                                     const vector<Document*>& summaries) {
+  if (deadline_ == NULL || !deadline_->Expired()) return false;
 
-      // Check if this is the best value so far.
-      if ((current_best_kl == -1) || (kl < current_best_kl)) {
-        current_best_sentence = i;
-        current_best_kl = kl;
-      }
-      scored_sentences.push_back(make_pair(sentences[i], kl));
+  // The summary built so far is returned for the lengths which are not
+  // reached yet.
+  path->summary.set_deadline_exceeded(true);
+  if (output_debug_) {
+    ostringstream oss;
+    oss << "\nDeadline exceeded after " << deadline_->ElapsedMs() << " ms.";
+    output_debug_->append(oss.str());
+  }
+  FinishLengths(lengths, true, true, path, summaries);
+  return true;
+}
 
-      // Substract term frequency from distribution to restore the summary.
-      summary_distribution.SubstractVector(*sentences[i]);
-    }
+template <typename T>
+void KLSum::GrowSummaryPath(const BasicVectorDistribution<T>& collection,
+                            const vector<SummaryLength>& lengths,
+                            const vector<double>& top_words_thresholds,
+                            KLSumOptions::OptimizationStrategy strategy,
+                            bool generate_debug,
+                            SummaryPath* path,
+                            vector<SummaryPath*>* forked_paths,
+                            const vector<Document*>& summaries) {
+  const vector<SparseDistribution*>& all_sentences = workspace_->sentences();
+  const vector<int>& doc_positions = workspace_->doc_positions();
+  const vector<int>& prior_scores = workspace_->prior_scores();
+  vector<SparseDistribution*>& sentences = path->sentences;
+  output_debug_ = generate_debug ? path->summary.mutable_debug_string() : NULL;
+
+  // Create the scorer, which keeps track of the summary distribution and
+  // scores the candidates only looking at their non-zero entries. The
+  // sentences which have already been added to the summary of a forked path
+  // are added back to it.
+  BasicKLSumScorer<T> scorer(collection, kKLSmoothingValue,
+                             GetBestKLKernels(fast_log_));
+  for (uint i = 0; i < all_sentences.size(); ++i)
+    scorer.AddCandidateLength(all_sentences[i]->sum);
+  for (uint i = 0; i < path->added_sentences.size(); ++i)
+    scorer.AddSentence(*all_sentences[path->added_sentences[i]]);
+  int num_summary_sentences = path->added_sentences.size();
+
+  // The lazy greedy queue can only be used when the candidates of the same
+  // length share the same weight, which is not the case when the divergence
+  // is weighted by the sentence position.
+  scoped_ptr<LazyGreedyQueue<T> > lazy_queue;
+  if (lazy_evaluation_ && !sentence_position_ && summary_weight_ >= 0 &&
+      strategy == KLSumOptions::GREEDY_OPTIMIZATION) {
+    lazy_queue.reset(new LazyGreedyQueue<T>(scorer, sentences, prior_scores,
+                                            summary_weight_, prior_weight_));
+  }
 
-    // If the caller is just expecting a ranking of sentences instead of the
-    // greedy approach, sort them and *return* them without doing any more
-    // iterations.
-    if (strategy == KLSumOptions::SENTENCE_RANKING) {
-      sort(scored_sentences.begin(), scored_sentences.end(),
-           OrderBySecond());
-      for (uint i = 0; i < scored_sentences.size(); ++i) {
-        PostprocessAndAddSentence(*(scored_sentences[i].first->sentence),
-                                  scored_sentences[i].second,
-                                  *(scored_sentences[i].first->document),
-                                  summary);
-        if (DocumentUtils::ReachesLengthLimit(length_limit,
-                                              length_unit,
-                                              *summary))
-          break;
-      }
+  // Split the candidates in a few shards per thread to balance the work, as
+  // the sentences already selected are not scored anymore.
+  int num_shards = std::min<int>(sentences.size(),
+                                 4 * thread_pool_->num_threads());
+  vector<double> candidate_scores;
 
-      for (vector<VectorDistribution*>::iterator it = sentences.begin();
-           it != sentences.end();
-           ++it) {
-        delete *it;
-      }
+  for (;;) {
+    FinishLengths(lengths, false, true, path, summaries);
+    if (path->lengths.empty()) return;
+    if (FinishLengthsIfOutOfTime(lengths, path, summaries)) return;
+
+    int current_best_sentence = -1;
+    double current_best_kl = -1;
 
-      return true;
+    if (lazy_queue.get() != NULL) {
+      current_best_sentence = lazy_queue->Pop(num_summary_sentences,
+                                              &current_best_kl,
+                                              &path->num_evaluations);
+    }
+
+    if (lazy_queue.get() == NULL) {
+      CandidateScoringTask<T> task(scorer, sentences, doc_positions,
+                                   prior_scores, sentence_position_,
+                                   summary_weight_, prior_weight_, num_shards,
+                                   &candidate_scores);
+      thread_pool_->Run(num_shards, &task);
+
+      // Reduce the scores in the order of the candidates, so that ties are
+      // broken as when they are scored one by one.
+      for (uint i = 0; i < sentences.size(); ++i) {
+        if (sentences[i] == NULL) continue;
+        ++path->num_evaluations;
+        double kl = candidate_scores[i];
+
+        // Check if this is the best value so far.
+        if ((current_best_kl == -1) || (kl < current_best_kl)) {
+          current_best_sentence = i;
+          current_best_kl = kl;
+        }
+      }
     }
 
     // This condition means that all the sentences in the input collection have
     // been added to the summary. In this case, stop growing the summary.
     if (current_best_sentence == -1) break;
 
-    // Check whether this sentence is redundant.
+    // Check whether this sentence is redundant. The top collection words depend
+    // on the length, so the lengths for which the decision is not the same as
+    // for the first one continue in a forked path.
     string redundancy_debug;
-    if (redundancy_removal_ && IsRedundant(summary_distribution,
-                                           collection_distribution,
-                                           *sentences[current_best_sentence],
-                                           &redundancy_debug)) {
-      if (output_debug_) {
-        output_debug_->append("\nRemoved redundant sentence: ");
-        output_debug_->append(
-            sentences[current_best_sentence]->sentence->raw_content());
-        output_debug_->append(" (" + redundancy_debug + ")");
-      }
-    } else {
-      Sentence* new_summary_sentence = PostprocessAndAddSentence(
-          *(sentences[current_best_sentence]->sentence),
-          current_best_kl,
-          *sentences[current_best_sentence]->document,
-          summary);
-      if (new_summary_sentence != NULL) {
-        // Update the summary distribution with the sentence that has just been
-        // added. Note that even if the postprocessor removed some tokens, they
-        // are still added to the distribution as it is hard to know here which
-        // ones were removed.
-        summary_distribution.AddVector(*sentences[current_best_sentence]);
-        if (output_debug_) {
-          ostringstream oss;
-          oss << "\nAdded sentence: "
-              << sentences[current_best_sentence]->sentence->raw_content()
-              << "(" << current_best_kl << ", " << redundancy_debug << ")" ;
-          output_debug_->append(oss.str());
+    bool redundant = redundancy_removal_ &&
+        IsRedundant(scorer.summary(), collection,
+                    top_words_thresholds[path->lengths[0]],
+                    *sentences[current_best_sentence], &redundancy_debug);
+    if (redundancy_removal_) {
+      SummaryPath* forked_path = NULL;
+      string forked_redundancy_debug;
+      for (uint i = 1; i < path->lengths.size(); ++i) {
+        string length_redundancy_debug;
+        int length = path->lengths[i];
+        if (IsRedundant(scorer.summary(), collection,
+                        top_words_thresholds[length],
+                        *sentences[current_best_sentence],
+                        &length_redundancy_debug) == redundant) {
+          continue;
         }
+        if (forked_path == NULL) {
+          forked_path = new SummaryPath(*path);
+          forked_path->lengths.clear();
+          forked_paths->push_back(forked_path);
+          forked_redundancy_debug = length_redundancy_debug;
+        }
+        forked_path->lengths.push_back(length);
+        path->lengths.erase(path->lengths.begin() + i);
+        --i;
+      }
+      if (forked_path != NULL) {
+        output_debug_ = generate_debug ?
+            forked_path->summary.mutable_debug_string() : NULL;
+        AddCandidate(current_best_sentence, current_best_kl, !redundant,
+                     forked_redundancy_debug, forked_path);
+        output_debug_ = generate_debug ?
+            path->summary.mutable_debug_string() : NULL;
       }
     }
 
-    // Remove the sentence that has been selected from the list of candidates.
-    delete sentences[current_best_sentence];
-    sentences[current_best_sentence] = NULL;
+    if (AddCandidate(current_best_sentence, current_best_kl, redundant,
+                     redundancy_debug, path)) {
+      // Update the summary distribution with the sentence that has just been
+      // added. Note that even if the postprocessor removed some tokens, they
+      // are still added to the distribution as it is hard to know here which
+      // ones were removed.
+      scorer.AddSentence(*all_sentences[current_best_sentence]);
+      ++num_summary_sentences;
+    }
   }
 
-  for (vector<VectorDistribution*>::iterator it = sentences.begin();
-        it != sentences.end();
-        ++it) {
-    delete *it;
+  FinishLengths(lengths, true, true, path, summaries);
+}
+
+bool KLSum::AddCandidate(int index, double score, bool redundant,
+                         const string& redundancy_debug, SummaryPath* path) {
+  const SparseDistribution& candidate = *path->sentences[index];
+  bool added = false;
+  if (redundant) {
+    if (output_debug_) {
+      output_debug_->append("\nRemoved redundant sentence: ");
+      output_debug_->append(candidate.sentence->raw_content());
+      output_debug_->append(" (" + redundancy_debug + ")");
+    }
+  } else {
+    Sentence* new_summary_sentence = PostprocessAndAddSentence(
+        *candidate.sentence, score, *candidate.document, &path->summary);
+    if (new_summary_sentence != NULL) {
+      path->added_sentences.push_back(index);
+      added = true;
+      if (output_debug_) {
+        ostringstream oss;
+        oss << "\nAdded sentence: " << candidate.sentence->raw_content()
+            << "(" << score << ", " << redundancy_debug << ")" ;
+        output_debug_->append(oss.str());
+      }
+    }
   }
 
-  return true;
+  // Remove the sentence that has been selected from the list of candidates.
+  path->sentences[index] = NULL;
+  return added;
+}
+
+void KLSum::FinishLengths(const vector<SummaryLength>& lengths,
+                          bool all_lengths,
+                          bool add_num_evaluations,
+                          SummaryPath* path,
+                          const vector<Document*>& summaries) {
+  for (uint i = 0; i < path->lengths.size(); ++i) {
+    const SummaryLength& length = lengths[path->lengths[i]];
+    if (!all_lengths &&
+        !DocumentUtils::ReachesLengthLimit(length.length(), length.unit(),
+                                           path->summary))
+      continue;
+
+    Document* summary = summaries[path->lengths[i]];
+    summary->CopyFrom(path->summary);
+    if (add_num_evaluations && output_debug_) {
+      ostringstream oss;
+      oss << "\nNumber of candidate evaluations: " << path->num_evaluations;
+      summary->mutable_debug_string()->append(oss.str());
+    }
+    path->lengths.erase(path->lengths.begin() + i);
+    --i;
+  }
 }
 
 Sentence* KLSum::PostprocessAndAddSentence(const Sentence& added_sentence,
@@ -0,0 +1,200 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/klsum_scorer.h"
+
+#include <math.h>
+
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+double CalculateKLDivergence(const VectorDistribution& distriA,
+                             const VectorDistribution& distriB,
+                             double smoothing_factor) {
+  return GetBestKLKernels(false).kl_divergence(distriA.distribution,
+                                               distriB.distribution,
+                                               NULL,
+                                               distriA.length,
+                                               1.0,
+                                               smoothing_factor);
+}
+
+namespace {
+
+// Returns \sum_i weights[i] * log1p(values[i] / divisor).
+double WeightedLog1pSum(const KLKernels& kernels,
+                        const double* weights,
+                        const double* values,
+                        int size,
+                        double divisor) {
+  return kernels.weighted_log1p_sum(weights, values, size, divisor);
+}
+
+double WeightedLog1pSum(const KLKernels& /* kernels */,
+                        const float* weights,
+                        const float* values,
+                        int size,
+                        double divisor) {
+  float float_divisor = static_cast<float>(divisor);
+  CompensatedSum<float> sum;
+  for (int i = 0; i < size; ++i)
+    sum.Add(weights[i] * log1pf(values[i] / float_divisor));
+  return sum.value();
+}
+
+// Returns how much the weighted sum of logarithms increases when the sparse
+// vector (ids, values) is added to base. See KLKernels::sparse_log1p_increase.
+double SparseLog1pIncrease(const KLKernels& kernels,
+                           const int* ids,
+                           const double* values,
+                           int size,
+                           const double* weights,
+                           const double* base,
+                           double divisor) {
+  return kernels.sparse_log1p_increase(ids, values, size, weights, base,
+                                       divisor);
+}
+
+// The sentences being short, the sum is not compensated.
+double SparseLog1pIncrease(const KLKernels& /* kernels */,
+                           const int* ids,
+                           const double* values,
+                           int size,
+                           const float* weights,
+                           const float* base,
+                           double divisor) {
+  float float_divisor = static_cast<float>(divisor);
+  float sum = 0;
+  for (int j = 0; j < size; ++j) {
+    float weight = weights[ids[j]];
+    if (weight == 0) continue;
+
+    float base_value = base[ids[j]];
+    float term = log1pf((base_value + static_cast<float>(values[j])) /
+                        float_divisor);
+    if (base_value != 0)
+      term -= log1pf(base_value / float_divisor);
+    sum += weight * term;
+  }
+  return sum;
+}
+
+}  // anonymous namespace
+
+template <typename T>
+BasicKLSumScorer<T>::BasicKLSumScorer(
+    const BasicVectorDistribution<T>& collection,
+    double smoothing_factor,
+    const KLKernels& kernels)
+    : collection_(collection),
+      kernels_(kernels),
+      smoothing_factor_(smoothing_factor),
+      constant_(0),
+      summary_(collection.length),
+      summary_sum_(0) {
+  CHECK_GT(smoothing_factor_, 0);
+
+  // Every word i of the collection contributes
+  //   c_i log(c_i) + c_i log(1 + V eps) - c_i log(eps)
+  //   - c_i log(1 + n_i / (eps N))
+  // to the divergence, where n_i is the number of times it appears in the
+  // summary extended with the candidate. Only the last part depends on the
+  // candidate, and it is zero for all the words with n_i = 0.
+  double collection_sum = 0;
+  for (int i = 0; i < collection_.length; ++i) {
+    double value = collection_.distribution[i];
+    if (value == 0) continue;
+    constant_ += value * log(value);
+    collection_sum += value;
+  }
+  constant_ += collection_sum * (log(1 + collection_.length * smoothing_factor_)
+                                 - log(smoothing_factor_));
+}
+
+template <typename T>
+void BasicKLSumScorer<T>::AddCandidateLength(double length) {
+  int index = static_cast<int>(length);
+  CHECK_GE(index, 0);
+  if (index >= static_cast<int>(summary_terms_.size()))
+    summary_terms_.resize(index + 1, -1);
+
+  if (summary_terms_[index] < 0) {
+    candidate_lengths_.push_back(index);
+    summary_terms_[index] = CalculateSummaryTerm(index);
+  }
+}
+
+template <typename T>
+double BasicKLSumScorer<T>::LengthScore(double length) const {
+  int index = static_cast<int>(length);
+  DCHECK_LT(index, static_cast<int>(summary_terms_.size()));
+  DCHECK_GE(summary_terms_[index], 0);
+  return constant_ - summary_terms_[index];
+}
+
+template <typename T>
+double BasicKLSumScorer<T>::Correction(
+    const SparseDistribution& candidate) const {
+  // Only the words that the candidate adds to the summary change their
+  // contribution.
+  if (candidate.ids.empty()) return 0;
+  return SparseLog1pIncrease(
+      kernels_, &candidate.ids[0], &candidate.values[0], candidate.size(),
+      collection_.distribution, summary_.distribution,
+      smoothing_factor_ * (summary_sum_ + candidate.sum));
+}
+
+template <typename T>
+void BasicKLSumScorer<T>::AddSentence(const SparseDistribution& sentence) {
+  for (int j = 0; j < sentence.size(); ++j) {
+    int id = sentence.ids[j];
+    if (summary_.distribution[id] == 0 && collection_.distribution[id] != 0) {
+      summary_support_.push_back(id);
+      support_collection_values_.push_back(collection_.distribution[id]);
+    }
+    summary_.distribution[id] += sentence.values[j];
+  }
+  summary_sum_ += sentence.sum;
+
+  support_summary_values_.resize(summary_support_.size());
+  for (uint i = 0; i < summary_support_.size(); ++i)
+    support_summary_values_[i] = summary_.distribution[summary_support_[i]];
+
+  UpdateCachedTerms();
+}
+
+template <typename T>
+void BasicKLSumScorer<T>::UpdateCachedTerms() {
+  for (uint i = 0; i < candidate_lengths_.size(); ++i) {
+    int length = candidate_lengths_[i];
+    summary_terms_[length] = CalculateSummaryTerm(length);
+  }
+}
+
+template <typename T>
+double BasicKLSumScorer<T>::CalculateSummaryTerm(double length) const {
+  if (summary_support_.empty()) return 0;
+  double smoothed_sum = smoothing_factor_ * (summary_sum_ + length);
+  return WeightedLog1pSum(kernels_,
+                          &support_collection_values_[0],
+                          &support_summary_values_[0],
+                          summary_support_.size(),
+                          smoothed_sum);
+}
+
+template class BasicKLSumScorer<double>;
+template class BasicKLSumScorer<float>;
+
+}  // namespace topicsum
@@ -0,0 +1,130 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/klsum_scorer.h"
+
+#include <stdlib.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+namespace {
+
+static const int kVocabularySize = 50;
+static const double kSmoothingFactor = 0.0000001;
+
+// Fills a sentence with random tokens.
+void BuildRandomSentence(int num_tokens, SparseDistribution* sentence) {
+  vector<int> token_ids;
+  for (int i = 0; i < num_tokens; ++i)
+    token_ids.push_back(random() % kVocabularySize);
+  sentence->AssignTokenIds(&token_ids);
+}
+
+// Adds a sparse sentence to a dense distribution.
+void AddToVector(const SparseDistribution& sentence,
+                 VectorDistribution* vector_distribution) {
+  for (int j = 0; j < sentence.size(); ++j)
+    vector_distribution->distribution[sentence.ids[j]] += sentence.values[j];
+}
+
+// Calculates the divergence with the dense reference implementation.
+double CalculateDenseKLDivergence(const VectorDistribution& collection,
+                                  const VectorDistribution& summary,
+                                  const SparseDistribution& candidate) {
+  VectorDistribution normalized(collection.length);
+  AddToVector(candidate, &normalized);
+  double sum = 0;
+  for (int i = 0; i < collection.length; ++i) {
+    normalized.distribution[i] += summary.distribution[i];
+    sum += normalized.distribution[i];
+  }
+  for (int i = 0; i < collection.length; ++i)
+    normalized.distribution[i] /= sum;
+  return CalculateKLDivergence(collection, normalized, kSmoothingFactor);
+}
+
+// Grows a summary with a few candidates and checks the scores of all the
+// candidates after each update.
+void CheckScorerMatchesDenseDivergence(const KLKernels& kernels) {
+  srandom(0);
+
+  // Collection distribution with a few words missing.
+  VectorDistribution collection(kVocabularySize);
+  double sum = 0;
+  for (int i = 0; i < kVocabularySize; ++i) {
+    if (i % 7 == 3) continue;
+    collection.distribution[i] = 1 + random() % 20;
+    sum += collection.distribution[i];
+  }
+  for (int i = 0; i < kVocabularySize; ++i)
+    collection.distribution[i] /= sum;
+
+  vector<SparseDistribution> candidates(30);
+  for (uint i = 0; i < candidates.size(); ++i)
+    BuildRandomSentence(1 + random() % 15, &candidates[i]);
+
+  KLSumScorer scorer(collection, kSmoothingFactor, kernels);
+  for (uint i = 0; i < candidates.size(); ++i)
+    scorer.AddCandidateLength(candidates[i].sum);
+
+  VectorDistribution summary(kVocabularySize);
+  for (int step = 0; step < 5; ++step) {
+    for (uint i = 0; i < candidates.size(); ++i) {
+      EXPECT_NEAR(CalculateDenseKLDivergence(collection, summary,
+                                             candidates[i]),
+                  scorer.Score(candidates[i]), 1e-9) << kernels.name;
+    }
+    scorer.AddSentence(candidates[step]);
+    AddToVector(candidates[step], &summary);
+    EXPECT_EQ(summary.distribution[candidates[step].ids[0]],
+              scorer.summary().distribution[candidates[step].ids[0]]);
+  }
+}
+
+}  // unnamed namespace
+
+TEST(SparseDistribution, AssignTokenIds) {
+  int ids[] = {4, 1, 4, 7, 1, 4};
+  vector<int> token_ids(ids, ids + ARRAYSIZE(ids));
+  SparseDistribution sentence;
+  sentence.AssignTokenIds(&token_ids);
+
+  ASSERT_EQ(3, sentence.size());
+  EXPECT_EQ(6, sentence.sum);
+  EXPECT_EQ(1, sentence.ids[0]);
+  EXPECT_EQ(2, sentence.values[0]);
+  EXPECT_EQ(4, sentence.ids[1]);
+  EXPECT_EQ(3, sentence.values[1]);
+  EXPECT_EQ(7, sentence.ids[2]);
+  EXPECT_EQ(1, sentence.values[2]);
+}
+
+TEST(KLSumScorer, MatchesDenseDivergence) {
+  CheckScorerMatchesDenseDivergence(GetBestKLKernels(false));
+}
+
+TEST(KLSumScorer, MatchesDenseDivergenceWithFastLog) {
+  CheckScorerMatchesDenseDivergence(GetBestKLKernels(true));
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
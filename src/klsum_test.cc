@@ -15,9 +15,13 @@
 
 #include "summarizer/klsum.h"
 
+#include <unistd.h>
+
 #include <fstream>
 
 #include "summarizer/document.h"
+#include "summarizer/file.h"
+#include "summarizer/xml_parser.h"
 #include "gtest/gtest.h"
 
 namespace topicsum {
@@ -25,6 +29,40 @@ namespace topicsum {
 using std::fstream;
 using std::ios;
 using std::string;
+using std::vector;
+
+namespace {
+
+// Reads the four documents of one of the real test collections.
+void ReadRealCollection(const string& path, DocumentCollection* collection) {
+  XmlParser xml_parser;
+  const char* const kFilenames[] = {"d1.xml", "d2.xml", "d3.xml", "d4.xml"};
+  for (uint i = 0; i < ARRAYSIZE(kFilenames); ++i) {
+    string file;
+    File::ReadFileToStringOrDie(path + kFilenames[i], &file);
+    xml_parser.ParseDocument(file, collection->add_document());
+  }
+}
+
+// Returns the tokens of the sentence, separated by spaces.
+string SentenceTokens(const Sentence& sentence) {
+  string tokens;
+  for (int i = 0; i < sentence.token_size(); ++i)
+    tokens += sentence.token(i) + " ";
+  return tokens;
+}
+
+// Summarizer which takes 10 ms to compute the collection distribution.
+class SlowKLSum : public KLSum {
+ protected:
+  virtual bool CalculateCollectionDistribution(
+      const DocumentCollection& coll) {
+    usleep(10000);
+    return KLSum::CalculateCollectionDistribution(coll);
+  }
+};
+
+}  // unnamed namespace
 
 TEST(KLSum, Summarize) {
   string path = DATADIR "testdata/singledoc";
@@ -156,6 +194,329 @@ TEST(KLSum, SummarizeVeryLong) {
   EXPECT_EQ(377, summary.num_tokens());
 }
 
+TEST(KLSum, LazyEvaluation) {
+  string path = DATADIR "testdata/singledoc";
+
+  // Read collection.
+  DocumentCollection c;
+  fstream in(path.c_str(), ios::in | ios::binary);
+  CHECK(c.ParseFromIstream(&in));
+
+  // Create the options.
+  SummarizerOptions options;
+  KLSumOptions* klsumoptions = options.mutable_klsum_options();
+  klsumoptions->set_optimization_strategy(KLSumOptions::GREEDY_OPTIMIZATION);
+  klsumoptions->set_redundancy_removal(false);
+
+  SummaryOptions sum_options;
+  SummaryLength* length = sum_options.mutable_length();
+  length->set_length(200);
+  length->set_unit(SummaryLength::TOKEN);
+
+  // Summarize the collection rescoring all the candidates at every step.
+  Document expected_summary;
+  KLSum summarizer;
+  summarizer.Init(c, options);
+  summarizer.Summarize(sum_options, &expected_summary);
+
+  // The lazy greedy queue should select the same sentences.
+  klsumoptions->set_lazy_evaluation(true);
+  Document summary;
+  KLSum lazy_summarizer;
+  lazy_summarizer.Init(c, options);
+  lazy_summarizer.Summarize(sum_options, &summary);
+
+  ASSERT_EQ(expected_summary.sentence_size(), summary.sentence_size());
+  EXPECT_GT(summary.sentence_size(), 2);
+  for (int i = 0; i < summary.sentence_size(); ++i) {
+    EXPECT_EQ(expected_summary.sentence(i).raw_content(),
+              summary.sentence(i).raw_content());
+    EXPECT_DOUBLE_EQ(expected_summary.sentence(i).score(),
+                     summary.sentence(i).score());
+  }
+}
+
+TEST(KLSum, MultipleThreads) {
+  string path = DATADIR "testdata/singledoc";
+
+  // Read collection.
+  DocumentCollection c;
+  fstream in(path.c_str(), ios::in | ios::binary);
+  CHECK(c.ParseFromIstream(&in));
+
+  // Create the options.
+  SummarizerOptions options;
+  KLSumOptions* klsumoptions = options.mutable_klsum_options();
+  klsumoptions->set_optimization_strategy(KLSumOptions::GREEDY_OPTIMIZATION);
+  klsumoptions->set_redundancy_removal(false);
+  klsumoptions->set_sentence_position(true);
+
+  SummaryOptions sum_options;
+  SummaryLength* length = sum_options.mutable_length();
+  length->set_length(200);
+  length->set_unit(SummaryLength::TOKEN);
+
+  // Summarize the collection with a single thread.
+  Document expected_summary;
+  KLSum summarizer;
+  summarizer.Init(c, options);
+  summarizer.Summarize(sum_options, &expected_summary);
+
+  // Scoring the candidates with several threads should select the same
+  // sentences.
+  klsumoptions->set_num_threads(4);
+  Document summary;
+  KLSum parallel_summarizer;
+  parallel_summarizer.Init(c, options);
+  parallel_summarizer.Summarize(sum_options, &summary);
+
+  ASSERT_EQ(expected_summary.sentence_size(), summary.sentence_size());
+  EXPECT_GT(summary.sentence_size(), 2);
+  for (int i = 0; i < summary.sentence_size(); ++i) {
+    EXPECT_EQ(expected_summary.sentence(i).raw_content(),
+              summary.sentence(i).raw_content());
+    EXPECT_DOUBLE_EQ(expected_summary.sentence(i).score(),
+                     summary.sentence(i).score());
+  }
+}
+
+TEST(KLSum, FloatPrecision) {
+  const char* const kPaths[] = {DATADIR "testdata/realcol1/",
+                                DATADIR "testdata/realcol2/",
+                                DATADIR "testdata/realcol3/"};
+  for (uint p = 0; p < ARRAYSIZE(kPaths); ++p) {
+    DocumentCollection c;
+    ReadRealCollection(kPaths[p], &c);
+
+    for (int redundancy_removal = 0; redundancy_removal < 2;
+         ++redundancy_removal) {
+      // Create the options.
+      SummarizerOptions options;
+      KLSumOptions* klsumoptions = options.mutable_klsum_options();
+      klsumoptions->set_optimization_strategy(
+          KLSumOptions::GREEDY_OPTIMIZATION);
+      klsumoptions->set_redundancy_removal(redundancy_removal);
+
+      SummaryOptions sum_options;
+      SummaryLength* length = sum_options.mutable_length();
+      length->set_length(250);
+      length->set_unit(SummaryLength::TOKEN);
+
+      // Summarize the collection with double precision.
+      Document expected_summary;
+      KLSum summarizer;
+      summarizer.Init(c, options);
+      summarizer.Summarize(sum_options, &expected_summary);
+
+      // The single precision distributions should select the same sentences,
+      // with nearly the same scores.
+      klsumoptions->set_precision(KLSumOptions::FLOAT);
+      Document summary;
+      KLSum float_summarizer;
+      float_summarizer.Init(c, options);
+      float_summarizer.Summarize(sum_options, &summary);
+
+      ASSERT_EQ(expected_summary.sentence_size(), summary.sentence_size())
+          << kPaths[p];
+      EXPECT_GT(summary.sentence_size(), 0) << kPaths[p];
+      for (int i = 0; i < summary.sentence_size(); ++i) {
+        EXPECT_EQ(expected_summary.sentence(i).raw_content(),
+                  summary.sentence(i).raw_content()) << kPaths[p];
+        EXPECT_NEAR(expected_summary.sentence(i).score(),
+                    summary.sentence(i).score(), 1e-4) << kPaths[p];
+      }
+    }
+  }
+}
+
+TEST(KLSum, RepeatedSummarize) {
+  DocumentCollection c;
+  ReadRealCollection(DATADIR "testdata/realcol2/", &c);
+
+  // Create the options.
+  SummarizerOptions options;
+  KLSumOptions* klsumoptions = options.mutable_klsum_options();
+  klsumoptions->set_optimization_strategy(KLSumOptions::GREEDY_OPTIMIZATION);
+  klsumoptions->set_redundancy_removal(true);
+
+  // The summarizer is initialized once, and reused for several lengths. The
+  // summaries should be the same as with a new summarizer for each length.
+  KLSum summarizer;
+  summarizer.Init(c, options);
+  const int kLengths[] = {250, 50, 100, 250};
+  for (uint l = 0; l < ARRAYSIZE(kLengths); ++l) {
+    SummaryOptions sum_options;
+    SummaryLength* length = sum_options.mutable_length();
+    length->set_length(kLengths[l]);
+    length->set_unit(SummaryLength::TOKEN);
+
+    Document expected_summary;
+    KLSum new_summarizer;
+    new_summarizer.Init(c, options);
+    new_summarizer.Summarize(sum_options, &expected_summary);
+
+    Document summary;
+    summarizer.Summarize(sum_options, &summary);
+
+    ASSERT_EQ(expected_summary.sentence_size(), summary.sentence_size())
+        << kLengths[l];
+    EXPECT_GT(summary.sentence_size(), 0) << kLengths[l];
+    for (int i = 0; i < summary.sentence_size(); ++i) {
+      EXPECT_EQ(expected_summary.sentence(i).raw_content(),
+                summary.sentence(i).raw_content()) << kLengths[l];
+      EXPECT_DOUBLE_EQ(expected_summary.sentence(i).score(),
+                       summary.sentence(i).score()) << kLengths[l];
+    }
+  }
+}
+
+TEST(KLSum, MultipleLengths) {
+  const char* const kPaths[] = {DATADIR "testdata/realcol1/",
+                                DATADIR "testdata/realcol2/",
+                                DATADIR "testdata/realcol3/"};
+  for (uint p = 0; p < ARRAYSIZE(kPaths); ++p) {
+    DocumentCollection c;
+    ReadRealCollection(kPaths[p], &c);
+
+    for (int strategy = 0; strategy < 2; ++strategy) {
+      for (int redundancy_removal = 0; redundancy_removal < 2;
+           ++redundancy_removal) {
+        // Create the options.
+        SummarizerOptions options;
+        KLSumOptions* klsumoptions = options.mutable_klsum_options();
+        klsumoptions->set_optimization_strategy(
+            strategy == 0 ? KLSumOptions::GREEDY_OPTIMIZATION :
+            KLSumOptions::SENTENCE_RANKING);
+        klsumoptions->set_redundancy_removal(redundancy_removal);
+
+        // The lengths of the summaries, which do not need to be sorted.
+        SummaryOptions sum_options;
+        sum_options.set_generate_debug(true);
+        SummaryLength* length = sum_options.mutable_length();
+        length->set_length(100);
+        length->set_unit(SummaryLength::TOKEN);
+        const int kTokenLengths[] = {20, 300, 60};
+        for (uint l = 0; l < ARRAYSIZE(kTokenLengths); ++l) {
+          length = sum_options.add_additional_length();
+          length->set_length(kTokenLengths[l]);
+          length->set_unit(SummaryLength::TOKEN);
+        }
+        length = sum_options.add_additional_length();
+        length->set_length(3);
+        length->set_unit(SummaryLength::SENTENCE);
+
+        KLSum summarizer;
+        summarizer.Init(c, options);
+        vector<Document> summaries;
+        ASSERT_TRUE(summarizer.SummarizeMultipleLengths(sum_options,
+                                                        &summaries));
+        ASSERT_EQ(5, summaries.size());
+
+        // Every summary, including its debug output, should be the same as
+        // when it is generated alone.
+        for (int l = 0; l < 5; ++l) {
+          SummaryOptions single_options(sum_options);
+          single_options.clear_additional_length();
+          if (l > 0) {
+            single_options.mutable_length()->CopyFrom(
+                sum_options.additional_length(l - 1));
+          }
+          Document expected_summary;
+          KLSum single_summarizer;
+          single_summarizer.Init(c, options);
+          single_summarizer.Summarize(single_options, &expected_summary);
+          EXPECT_GT(summaries[l].sentence_size(), 0) << kPaths[p] << l;
+          EXPECT_EQ(expected_summary.DebugString(), summaries[l].DebugString())
+              << kPaths[p] << " " << strategy << " " << redundancy_removal
+              << " " << l;
+        }
+      }
+    }
+  }
+}
+
+TEST(KLSum, Deadline) {
+  DocumentCollection c;
+  ReadRealCollection(DATADIR "testdata/realcol2/", &c);
+
+  SummarizerOptions options;
+  KLSumOptions* klsumoptions = options.mutable_klsum_options();
+  klsumoptions->set_optimization_strategy(KLSumOptions::GREEDY_OPTIMIZATION);
+  klsumoptions->set_redundancy_removal(true);
+
+  SummaryOptions sum_options;
+  SummaryLength* length = sum_options.mutable_length();
+  length->set_length(100);
+  length->set_unit(SummaryLength::TOKEN);
+
+  KLSum summarizer;
+  summarizer.Init(c, options);
+  Document expected_summary;
+  ASSERT_TRUE(summarizer.Summarize(sum_options, &expected_summary));
+  EXPECT_FALSE(expected_summary.deadline_exceeded());
+  EXPECT_GT(expected_summary.sentence_size(), 0);
+
+  // A budget which is not used up does not change the summary.
+  sum_options.set_deadline_ms(600000);
+  SlowKLSum slow_summarizer;
+  slow_summarizer.Init(c, options);
+  Document summary;
+  ASSERT_TRUE(slow_summarizer.Summarize(sum_options, &summary));
+  EXPECT_EQ(expected_summary.DebugString(), summary.DebugString());
+
+  // The budget is used up before the first sentence is selected, so the
+  // summary is empty.
+  sum_options.set_deadline_ms(1);
+  sum_options.set_generate_debug(true);
+  SlowKLSum late_summarizer;
+  late_summarizer.Init(c, options);
+  ASSERT_TRUE(late_summarizer.Summarize(sum_options, &summary));
+  EXPECT_TRUE(summary.deadline_exceeded());
+  EXPECT_EQ(0, summary.sentence_size());
+  EXPECT_NE(string::npos, summary.debug_string().find("Deadline exceeded"));
+}
+
+TEST(KLSum, CollapseDuplicates) {
+  // Every document appears twice in the collection.
+  DocumentCollection c;
+  ReadRealCollection(DATADIR "testdata/realcol1/", &c);
+  int num_documents = c.document_size();
+  for (int d = 0; d < num_documents; ++d)
+    c.add_document()->CopyFrom(c.document(d));
+
+  SummarizerOptions options;
+  KLSumOptions* klsumoptions = options.mutable_klsum_options();
+  klsumoptions->set_optimization_strategy(KLSumOptions::GREEDY_OPTIMIZATION);
+  klsumoptions->set_redundancy_removal(false);
+
+  SummaryOptions sum_options;
+  sum_options.set_generate_debug(true);
+  SummaryLength* length = sum_options.mutable_length();
+  length->set_length(200);
+  length->set_unit(SummaryLength::TOKEN);
+
+  KLSum summarizer;
+  summarizer.Init(c, options);
+  Document expected_summary;
+  ASSERT_TRUE(summarizer.Summarize(sum_options, &expected_summary));
+
+  // Once the copies are collapsed, there are half as many candidates. The
+  // copies have the same score as the first occurrence, which is preferred,
+  // so the summary does not change.
+  klsumoptions->set_collapse_duplicates(true);
+  KLSum collapsing_summarizer;
+  collapsing_summarizer.Init(c, options);
+  Document summary;
+  ASSERT_TRUE(collapsing_summarizer.Summarize(sum_options, &summary));
+  EXPECT_NE(string::npos, summary.debug_string().find("(ratio 0.5)"));
+  ASSERT_GT(summary.sentence_size(), 0);
+  ASSERT_EQ(expected_summary.sentence_size(), summary.sentence_size());
+  for (int i = 0; i < summary.sentence_size(); ++i) {
+    EXPECT_EQ(SentenceTokens(expected_summary.sentence(i)),
+              SentenceTokens(summary.sentence(i)));
+  }
+}
+
 TEST(KLSum, RankSentencesVeryLongSummary) {
   string path = DATADIR "testdata/singledoc";
 
@@ -248,6 +609,44 @@ TEST(KLSum, RankSentencesShortSummary) {
   }
 }
 
+TEST(KLSum, RankSentencesPrefixes) {
+  DocumentCollection c;
+  ReadRealCollection(DATADIR "testdata/realcol3/", &c);
+
+  SummarizerOptions options;
+  KLSumOptions* klsumoptions = options.mutable_klsum_options();
+  klsumoptions->set_optimization_strategy(KLSumOptions::SENTENCE_RANKING);
+  klsumoptions->set_redundancy_removal(false);
+
+  KLSum summarizer;
+  summarizer.Init(c, options);
+
+  // The ranking of all the sentences, sorted by score.
+  SummaryOptions sum_options;
+  SummaryLength* length = sum_options.mutable_length();
+  length->set_length(100000);
+  length->set_unit(SummaryLength::TOKEN);
+  Document ranking;
+  ASSERT_TRUE(summarizer.Summarize(sum_options, &ranking));
+  ASSERT_GT(ranking.sentence_size(), 20);
+  for (int i = 1; i < ranking.sentence_size(); ++i)
+    EXPECT_LE(ranking.sentence(i - 1).score(), ranking.sentence(i).score());
+
+  // The shorter rankings, which are only partially sorted, are prefixes of
+  // the full one.
+  for (int num_sentences = 1; num_sentences <= 20; ++num_sentences) {
+    length->set_length(num_sentences);
+    length->set_unit(SummaryLength::SENTENCE);
+    Document summary;
+    ASSERT_TRUE(summarizer.Summarize(sum_options, &summary));
+    ASSERT_EQ(num_sentences, summary.sentence_size());
+    for (int i = 0; i < num_sentences; ++i) {
+      EXPECT_EQ(ranking.sentence(i).raw_content(),
+                summary.sentence(i).raw_content()) << num_sentences;
+    }
+  }
+}
+
 }  // namespace topicsum
 
 int main(int argc, char** argv) {
@@ -0,0 +1,195 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/klsum_workspace.h"
+
+#include <algorithm>
+
+#include "summarizer/duplicates.h"
+#include "summarizer/logging.h"
+#include "summarizer/postprocessor.h"
+
+namespace topicsum {
+
+KLSumWorkspace::KLSumWorkspace(const DocumentCollection& collection,
+                               const Postprocessor* postprocessor)
+    : has_collection_distribution_(false),
+      collection_sum_(0) {
+  // Generate a lexicon for the collection.
+  for (int d = 0; d < collection.document_size(); d++) {
+    const Document& doc = collection.document(d);
+    for (int s = 0; s < doc.sentence_size(); s++) {
+      const Sentence& sent = doc.sentence(s);
+      for (int w = 0; w < sent.token_size(); w++) {
+        const string& word = sent.token(w);
+        lexicon_.add_token(word);
+      }
+    }
+  }
+
+  // For all the sentences in the collection, represent them as
+  // SparseDistributions.
+  vector<int> token_ids;
+  for (int d = 0; d < collection.document_size(); d++) {
+    const Document& doc = collection.document(d);
+    for (int s = 0; s < doc.sentence_size(); s++) {
+      const Sentence& sent = doc.sentence(s);
+
+      // If the sentence will not add any information, we skip it.
+      if (sent.token_size() == 0) continue;
+
+      if (postprocessor != NULL && !postprocessor->IsValidSentence(sent))
+        continue;
+
+      SparseDistribution* sentence_distribution = new SparseDistribution;
+      sentence_distribution->sentence = &sent;
+      sentence_distribution->document = &doc;
+      token_ids.clear();
+      for (int w = 0; w < sent.token_size(); w++) {
+        const string& word = sent.token(w);
+        token_ids.push_back(lexicon_.token2id(word));
+      }
+      sentence_distribution->AssignTokenIds(&token_ids);
+      sentences_.push_back(sentence_distribution);
+      prior_scores_.push_back(sent.prior_score());
+
+      doc_positions_.push_back(s+1);
+    }
+  }
+  num_uncollapsed_sentences_ = sentences_.size();
+}
+
+KLSumWorkspace::~KLSumWorkspace() {
+  for (vector<SparseDistribution*>::iterator it = sentences_.begin();
+       it != sentences_.end();
+       ++it) {
+    delete *it;
+  }
+}
+
+void KLSumWorkspace::CollapseDuplicates(double min_similarity) {
+  DuplicateIndex index(min_similarity);
+  vector<int> token_ids;
+  int num_kept = 0;
+  for (uint i = 0; i < sentences_.size(); ++i) {
+    const Sentence& sent = *sentences_[i]->sentence;
+    token_ids.clear();
+    for (int w = 0; w < sent.token_size(); w++)
+      token_ids.push_back(lexicon_.token2id(sent.token(w)));
+
+    // The candidates which are kept are moved to the beginning of the vectors,
+    // in the same order, so that they have the same index as in the duplicate
+    // index.
+    int first = index.FindOrAdd(token_ids);
+    if (first != -1) {
+      sentences_[first]->multiplicity += sentences_[i]->multiplicity;
+      delete sentences_[i];
+      continue;
+    }
+    sentences_[num_kept] = sentences_[i];
+    doc_positions_[num_kept] = doc_positions_[i];
+    prior_scores_[num_kept] = prior_scores_[i];
+    ++num_kept;
+  }
+  sentences_.resize(num_kept);
+  doc_positions_.resize(num_kept);
+  prior_scores_.resize(num_kept);
+}
+
+void KLSumWorkspace::SetCollectionDistribution(
+    const Distribution& distribution) {
+  has_collection_distribution_ = true;
+  collection_ids_.clear();
+  collection_values_.clear();
+  collection_ids_.reserve(distribution.size());
+  collection_values_.reserve(distribution.size());
+  collection_sum_ = 0;
+  for (Distribution::const_iterator iter = distribution.begin();
+       iter != distribution.end();
+       ++iter) {
+    if (iter->second > 0.0) {
+      int id = lexicon_.token2id(iter->first);
+      // Check that the collection token exists in the test collection.
+      if (id != -1) {
+        collection_ids_.push_back(id);
+        collection_values_.push_back(iter->second);
+        collection_sum_ += iter->second;
+      }
+    }
+  }
+
+  // The normalization is monotonic, so the normalized values are sorted too.
+  sorted_values_ = collection_values_;
+  sort(sorted_values_.begin(), sorted_values_.end());
+  sorted_normalized_values_ = sorted_values_;
+  if (collection_sum_ != 1) {
+    for (uint i = 0; i < sorted_normalized_values_.size(); ++i)
+      sorted_normalized_values_[i] /= collection_sum_;
+  }
+
+  collection_vector_.reset(NULL);
+  float_collection_vector_.reset(NULL);
+}
+
+template <typename T>
+const BasicVectorDistribution<T>& KLSumWorkspace::GetCollectionVector() {
+  CHECK(has_collection_distribution_);
+  CHECK_GT(collection_sum_, 0);
+
+  scoped_ptr<BasicVectorDistribution<T> >* cached_vector =
+      collection_vector(T());
+  if (cached_vector->get() == NULL) {
+    BasicVectorDistribution<T>* new_vector =
+        new BasicVectorDistribution<T>(lexicon_.size());
+    for (uint i = 0; i < collection_ids_.size(); ++i) {
+      double value = collection_values_[i];
+      if (collection_sum_ != 1) value /= collection_sum_;
+      new_vector->distribution[collection_ids_[i]] = static_cast<T>(value);
+    }
+    cached_vector->reset(new_vector);
+  }
+  return **cached_vector;
+}
+
+template <typename T>
+double KLSumWorkspace::GetTopWordsThreshold(int num_top_words) const {
+  CHECK(has_collection_distribution_);
+  CHECK_GT(collection_sum_, 0);
+
+  // The threshold is the value of the num_top_words-th largest word before
+  // normalization, and the words over it after normalization are the top
+  // words. The returned threshold is the largest normalized value of the other
+  // words, so that the comparisons with the values of type T give the same
+  // top words.
+  int top_words_threshold_position = sorted_values_.size() - num_top_words;
+  if (top_words_threshold_position < 0) top_words_threshold_position = 0;
+  double top_words_threshold = sorted_values_[top_words_threshold_position];
+  int num_other_words =
+      upper_bound(sorted_normalized_values_.begin(),
+                  sorted_normalized_values_.end(),
+                  top_words_threshold) - sorted_normalized_values_.begin();
+  if (num_other_words == 0) return 0;
+  return static_cast<T>(sorted_normalized_values_[num_other_words - 1]);
+}
+
+template const BasicVectorDistribution<double>&
+KLSumWorkspace::GetCollectionVector<double>();
+template const BasicVectorDistribution<float>&
+KLSumWorkspace::GetCollectionVector<float>();
+template double KLSumWorkspace::GetTopWordsThreshold<double>(
+    int num_top_words) const;
+template double KLSumWorkspace::GetTopWordsThreshold<float>(
+    int num_top_words) const;
+
+}  // namespace topicsum
@@ -0,0 +1,189 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/klsum_workspace.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "summarizer/logging.h"
+#include "summarizer/postprocessor.h"
+
+namespace topicsum {
+
+namespace {
+
+// Adds a sentence with the space-separated tokens to the document.
+void AddSentence(const string& tokens, Document* document) {
+  Sentence* sentence = document->add_sentence();
+  sentence->set_raw_content(tokens);
+  string::size_type begin = 0;
+  while (begin < tokens.size()) {
+    string::size_type end = tokens.find(' ', begin);
+    if (end == string::npos) end = tokens.size();
+    sentence->add_token(tokens.substr(begin, end - begin));
+    begin = end + 1;
+  }
+}
+
+// Builds a collection of two documents, with an empty sentence.
+void BuildCollection(DocumentCollection* collection) {
+  Document* document = collection->add_document();
+  AddSentence("a b a", document);
+  AddSentence("", document);
+  AddSentence("c d", document);
+  document = collection->add_document();
+  AddSentence("e a", document);
+}
+
+// Rejects the sentences starting with "c".
+class RejectingPostprocessor : public Postprocessor {
+ public:
+  virtual bool IsValidSentence(const Sentence& sentence) const {
+    return sentence.token(0) != "c";
+  }
+  virtual bool Compress(Sentence* sentence) const { return false; }
+};
+
+}  // unnamed namespace
+
+TEST(KLSumWorkspace, Sentences) {
+  DocumentCollection collection;
+  BuildCollection(&collection);
+  KLSumWorkspace workspace(collection, NULL);
+
+  EXPECT_EQ(5, workspace.lexicon().size());
+  ASSERT_EQ(3, workspace.sentences().size());
+  ASSERT_EQ(3, workspace.doc_positions().size());
+  ASSERT_EQ(3, workspace.prior_scores().size());
+
+  const SparseDistribution& first = *workspace.sentences()[0];
+  EXPECT_EQ(&collection.document(0).sentence(0), first.sentence);
+  EXPECT_EQ(&collection.document(0), first.document);
+  ASSERT_EQ(2, first.size());
+  EXPECT_EQ(workspace.lexicon().token2id("a"), first.ids[0]);
+  EXPECT_EQ(2, first.values[0]);
+  EXPECT_EQ(3, first.sum);
+
+  // The empty sentence is skipped, but it is counted in the positions.
+  EXPECT_EQ(1, workspace.doc_positions()[0]);
+  EXPECT_EQ(3, workspace.doc_positions()[1]);
+  EXPECT_EQ(1, workspace.doc_positions()[2]);
+  EXPECT_EQ(&collection.document(1), workspace.sentences()[2]->document);
+}
+
+TEST(KLSumWorkspace, Postprocessor) {
+  DocumentCollection collection;
+  BuildCollection(&collection);
+  RejectingPostprocessor postprocessor;
+  KLSumWorkspace workspace(collection, &postprocessor);
+
+  EXPECT_EQ(5, workspace.lexicon().size());
+  ASSERT_EQ(2, workspace.sentences().size());
+  EXPECT_EQ(&collection.document(1).sentence(0),
+            workspace.sentences()[1]->sentence);
+}
+
+TEST(KLSumWorkspace, CollapseDuplicates) {
+  DocumentCollection collection;
+  BuildCollection(&collection);
+  Document* document = collection.add_document();
+  AddSentence("c d", document);
+  AddSentence("a a b", document);
+  AddSentence("a b a", document);
+
+  KLSumWorkspace workspace(collection, NULL);
+  workspace.CollapseDuplicates(0.8);
+  EXPECT_EQ(6, workspace.num_uncollapsed_sentences());
+
+  // "a a b" has the same set of tokens as "a b a", so it is collapsed with it
+  // too. The remaining candidates point to the first occurrence.
+  ASSERT_EQ(3, workspace.sentences().size());
+  EXPECT_EQ(3, workspace.sentences()[0]->multiplicity);
+  EXPECT_EQ(&collection.document(0), workspace.sentences()[0]->document);
+  EXPECT_EQ(2, workspace.sentences()[1]->multiplicity);
+  EXPECT_EQ(&collection.document(0).sentence(2),
+            workspace.sentences()[1]->sentence);
+  EXPECT_EQ(3, workspace.doc_positions()[1]);
+  EXPECT_EQ(1, workspace.sentences()[2]->multiplicity);
+  EXPECT_EQ(&collection.document(1), workspace.sentences()[2]->document);
+
+  // Only the exact duplicates.
+  KLSumWorkspace exact_workspace(collection, NULL);
+  exact_workspace.CollapseDuplicates(2);
+  ASSERT_EQ(4, exact_workspace.sentences().size());
+  EXPECT_EQ(2, exact_workspace.sentences()[0]->multiplicity);
+  EXPECT_EQ(&collection.document(2).sentence(1),
+            exact_workspace.sentences()[3]->sentence);
+}
+
+TEST(KLSumWorkspace, CollectionVector) {
+  DocumentCollection collection;
+  BuildCollection(&collection);
+  KLSumWorkspace workspace(collection, NULL);
+  EXPECT_FALSE(workspace.has_collection_distribution());
+
+  // The tokens which are not in the lexicon are ignored.
+  Distribution distribution;
+  distribution["a"] = 4;
+  distribution["b"] = 2;
+  distribution["c"] = 1;
+  distribution["d"] = 1;
+  distribution["z"] = 10;
+  workspace.SetCollectionDistribution(distribution);
+  EXPECT_TRUE(workspace.has_collection_distribution());
+  EXPECT_EQ(8, workspace.collection_sum());
+
+  // The values are normalized, but the threshold is compared with the values
+  // before normalization, so there are no top words.
+  EXPECT_EQ(0.5, workspace.GetTopWordsThreshold<double>(2));
+
+  // Same distribution, already normalized.
+  distribution["a"] = 0.5;
+  distribution["b"] = 0.25;
+  distribution["c"] = 0.125;
+  distribution["d"] = 0.125;
+  workspace.SetCollectionDistribution(distribution);
+  EXPECT_EQ(1, workspace.collection_sum());
+
+  const Lexicon& lexicon = workspace.lexicon();
+  const VectorDistribution& collection_vector =
+      workspace.GetCollectionVector<double>();
+  EXPECT_EQ(5, collection_vector.length);
+  EXPECT_EQ(0.5, collection_vector.distribution[lexicon.token2id("a")]);
+  EXPECT_EQ(0.25, collection_vector.distribution[lexicon.token2id("b")]);
+  EXPECT_EQ(0, collection_vector.distribution[lexicon.token2id("e")]);
+
+  // The words over the threshold are the top words, except for the ties with
+  // the smallest top word.
+  EXPECT_EQ(0.25, workspace.GetTopWordsThreshold<double>(2));
+  EXPECT_EQ(0.5, workspace.GetTopWordsThreshold<double>(1));
+  EXPECT_EQ(0.125, workspace.GetTopWordsThreshold<double>(3));
+  EXPECT_EQ(0.125, workspace.GetTopWordsThreshold<double>(100));
+
+  // The same vector is returned by the successive calls.
+  EXPECT_EQ(&collection_vector, &workspace.GetCollectionVector<double>());
+
+  const FloatVectorDistribution& float_vector =
+      workspace.GetCollectionVector<float>();
+  EXPECT_EQ(0.5f, float_vector.distribution[lexicon.token2id("a")]);
+  EXPECT_EQ(0.25, workspace.GetTopWordsThreshold<float>(2));
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,102 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/random.h"
+
+#include <string.h>
+
+namespace topicsum {
+
+namespace {
+
+inline uint64 RotateLeft(uint64 x, int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+// Returns the next value of the splitmix64 sequence of the given state.
+uint64 SplitMix64(uint64* state) {
+  uint64 z = (*state += ULONGLONG(0x9e3779b97f4a7c15));
+  z = (z ^ (z >> 30)) * ULONGLONG(0xbf58476d1ce4e5b9);
+  z = (z ^ (z >> 27)) * ULONGLONG(0x94d049bb133111eb);
+  return z ^ (z >> 31);
+}
+
+}  // namespace
+
+Random::Random(uint64 seed, uint64 stream) {
+  Reset(seed, stream);
+}
+
+void Random::Reset(uint64 seed, uint64 stream) {
+  uint64 splitmix_state = seed;
+  for (int i = 0; i < 4; ++i)
+    state_[i] = SplitMix64(&splitmix_state);
+  for (uint64 i = 0; i < stream; ++i)
+    Jump();
+  next_uniform_ = kUniformBatchSize;
+}
+
+uint64 Random::Next() {
+  uint64 result = RotateLeft(state_[1] * 5, 7) * 9;
+  uint64 t = state_[1] << 17;
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= t;
+  state_[3] = RotateLeft(state_[3], 45);
+  return result;
+}
+
+void Random::FillUniform(double* values, int num_values) {
+  // The 53 upper bits give all the doubles of [0, 1) which are multiples of
+  // 2^-53.
+  const double kScale = 1.0 / (ULONGLONG(1) << 53);
+  for (int i = 0; i < num_values; ++i)
+    values[i] = (Next() >> 11) * kScale;
+}
+
+void Random::GetState(uint64* state) const {
+  memcpy(state, state_, sizeof(state_));
+  memcpy(state + 4, uniforms_, sizeof(uniforms_));
+  state[4 + kUniformBatchSize] = next_uniform_;
+}
+
+void Random::SetState(const uint64* state) {
+  memcpy(state_, state, sizeof(state_));
+  memcpy(uniforms_, state + 4, sizeof(uniforms_));
+  next_uniform_ = static_cast<int>(state[4 + kUniformBatchSize]);
+}
+
+void Random::Jump() {
+  static const uint64 kJump[4] = {
+    ULONGLONG(0x180ec6d33cfd0aba), ULONGLONG(0xd5a61266f0c9392c),
+    ULONGLONG(0xa9582618e03fc9aa), ULONGLONG(0x39abdc4529b1661c)
+  };
+  uint64 s[4] = {0, 0, 0, 0};
+  for (int i = 0; i < 4; ++i) {
+    for (int b = 0; b < 64; ++b) {
+      if (kJump[i] & (ULONGLONG(1) << b)) {
+        for (int j = 0; j < 4; ++j)
+          s[j] ^= state_[j];
+      }
+      Next();
+    }
+  }
+  for (int j = 0; j < 4; ++j)
+    state_[j] = s[j];
+}
+
+}  // namespace topicsum
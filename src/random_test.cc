@@ -0,0 +1,98 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/random.h"
+
+#include "gtest/gtest.h"
+#include "summarizer/logging.h"
+#include "summarizer/scoped_ptr.h"
+
+namespace topicsum {
+
+static const int kNumberTrials = 10000;
+
+TEST(Random, SameSeedSameSequence) {
+  Random a(42);
+  Random b(42);
+  Random c(43);
+  bool all_equal_to_c = true;
+  for (int i = 0; i < kNumberTrials; i++) {
+    uint64 value = a.Next();
+    EXPECT_EQ(value, b.Next());
+    if (value != c.Next()) all_equal_to_c = false;
+  }
+  EXPECT_FALSE(all_equal_to_c);
+
+  // Reset restarts the sequence.
+  Random first(42);
+  uint64 first_value = first.Next();
+  a.Reset(42, 0);
+  EXPECT_EQ(first_value, a.Next());
+}
+
+TEST(Random, Streams) {
+  Random stream0(7, 0);
+  Random stream1(7, 1);
+  Random other_stream1(7, 1);
+  bool all_equal = true;
+  for (int i = 0; i < kNumberTrials; i++) {
+    uint64 value = stream1.Next();
+    EXPECT_EQ(value, other_stream1.Next());
+    if (value != stream0.Next()) all_equal = false;
+  }
+  EXPECT_FALSE(all_equal);
+}
+
+TEST(Random, Uniform) {
+  // The batched values are the same as the ones of FillUniform, whatever the
+  // batch boundaries.
+  int num_values = 3 * Random::kUniformBatchSize + 5;
+  scoped_array<double> values(new double[num_values]);
+  Random filler(3);
+  filler.FillUniform(values.get(), num_values);
+
+  Random random(3);
+  double sum = 0;
+  for (int i = 0; i < num_values; i++) {
+    double value = random.Uniform();
+    EXPECT_EQ(values[i], value);
+    EXPECT_LE(0, value);
+    EXPECT_GT(1, value);
+    sum += value;
+  }
+  EXPECT_NEAR(0.5, sum / num_values, 0.05);
+}
+
+TEST(Random, State) {
+  Random random(5);
+  for (int i = 0; i < 100; i++)
+    random.Uniform();
+  uint64 state[Random::kStateSize];
+  random.GetState(state);
+
+  // A generator restored in the middle of a batch continues the sequence.
+  Random restored(6);
+  restored.SetState(state);
+  for (int i = 0; i < 2 * Random::kUniformBatchSize; i++)
+    EXPECT_EQ(random.Uniform(), restored.Uniform());
+  EXPECT_EQ(random.Next(), restored.Next());
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
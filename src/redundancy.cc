@@ -34,22 +34,23 @@ static const double kMinProportionCollectionWordsInSentenceThatAreNew = 0.67;
 
 namespace topicsum {
 
-bool IsRedundant(const VectorDistribution& summary,
-                 const VectorDistribution& collection,
-                 const VectorDistribution& new_sentence,
+template <typename T>
+bool IsRedundant(const BasicVectorDistribution<T>& summary,
+                 const BasicVectorDistribution<T>& collection,
+                 double top_words_threshold,
+                 const SparseDistribution& new_sentence,
                  string *debug) {
   int num_words_in_sentence = 0;
   int num_collection_words_in_sentence = 0;
   int num_new_collection_words_in_sentence = 0;
 
-  for (int i = 0; i < collection.length; ++i) {
-    if (new_sentence.distribution[i] != 0) {
-      ++num_words_in_sentence;
-      if (collection.distribution[i] > collection.top_words_threshold) {
-        ++num_collection_words_in_sentence;
-        if (summary.distribution[i] == 0)
-          ++num_new_collection_words_in_sentence;
-      }
+  for (int j = 0; j < new_sentence.size(); ++j) {
+    int i = new_sentence.ids[j];
+    ++num_words_in_sentence;
+    if (collection.distribution[i] > top_words_threshold) {
+      ++num_collection_words_in_sentence;
+      if (summary.distribution[i] == 0)
+        ++num_new_collection_words_in_sentence;
     }
   }
 
@@ -69,4 +70,15 @@ bool IsRedundant(const VectorDistribution& summary,
   return false;
 }
 
+template bool IsRedundant(const BasicVectorDistribution<double>& summary,
+                          const BasicVectorDistribution<double>& collection,
+                          double top_words_threshold,
+                          const SparseDistribution& new_sentence,
+                          string* debug);
+template bool IsRedundant(const BasicVectorDistribution<float>& summary,
+                          const BasicVectorDistribution<float>& collection,
+                          double top_words_threshold,
+                          const SparseDistribution& new_sentence,
+                          string* debug);
+
 }  // namespace topicsum
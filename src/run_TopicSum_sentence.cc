@@ -38,7 +38,6 @@ int main(int argc, char** argv) {
 
 	//string input = argv[1];
     //string output = argv[2];
-	srandom(0);
 
 	string path = input;
 	ifstream article_file(path.c_str());
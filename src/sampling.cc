@@ -15,17 +15,14 @@
 
 #include "summarizer/sampling.h"
 
-#include <math.h>
-#include <stdlib.h>
-
-#include "summarizer/scoped_ptr.h"
+#include "summarizer/random.h"
 
 namespace topicsum {
 
-int SampleMulti(const double* distri, int distri_size) {
+int SampleMulti(const double* distri, int distri_size, Random* random) {
   double sum = 0;
   int klass = -1;
-  double x = random() / static_cast<double>(RAND_MAX);
+  double x = random->Uniform();
 
   for (int i = 0; i < distri_size; i++) {
     if (x <= sum + distri[i]) {
@@ -41,9 +38,9 @@ int SampleMulti(const double* distri, int distri_size) {
   return klass;
 }
 
-int SampleUniform(int K) {
+int SampleUniform(int K, Random* random) {
   double u = 1 / static_cast<double>(K);
-  double x = random() / static_cast<double>(RAND_MAX);
+  double x = random->Uniform();
   int sampled = static_cast<int>(x / u);
   return (sampled < K ? sampled : K-1);
 }
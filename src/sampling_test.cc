@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "summarizer/logging.h"
+#include "summarizer/random.h"
 
 namespace topicsum {
 
@@ -24,8 +25,9 @@ static const int kNumberTrials = 10000;
 TEST(Sampling, SampleMulti) {
   double distri[5] = {0.1, 0.1, 0.1, 0.1, 0.5};
   int sampled[5] = {0};
+  Random random(0);
   for (int i = 0; i < kNumberTrials; i++) {
-    int sample = SampleMulti(distri, 5);
+    int sample = SampleMulti(distri, 5, &random);
     sampled[sample]++;
   }
 
@@ -37,8 +39,9 @@ TEST(Sampling, SampleMulti) {
 
 TEST(Sampling, SampleUniform) {
   int sampled[10] = {0};
+  Random random(0);
   for (int i = 0; i < kNumberTrials; i++) {
-    int sample = SampleUniform(10);
+    int sample = SampleUniform(10, &random);
     sampled[sample]++;
   }
 
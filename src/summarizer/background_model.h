@@ -0,0 +1,95 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Pretrained background model of TopicSum, i.e. a distribution over words
+// estimated offline on a large corpus, which the sampler uses as the fixed
+// distribution of the BKG topic instead of learning it from the collection.
+//
+// The model is stored in a binary file (see binary_file.h) holding the sorted
+// vocabulary and the float probabilities of the words, which is mapped in
+// memory and used in place, so that loading a model only pages in the words
+// which are looked up.
+
+#ifndef SUMMARIZER_BACKGROUND_MODEL_H_
+#define SUMMARIZER_BACKGROUND_MODEL_H_
+
+#include <string>
+
+#include "summarizer/binary_file.h"
+#include "summarizer/distribution.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::string;
+
+class BackgroundModel {
+ public:
+  BackgroundModel();
+
+  // Writes the distribution to the model file path. Its values are stored as
+  // float probabilities as they are. unknown_probability is the probability
+  // of each word which is not in the distribution, e.g. of the words removed
+  // by a vocabulary cutoff. Returns false on error.
+  static bool Write(const Distribution& distribution,
+                    double unknown_probability,
+                    const string& path);
+
+  // Returns the model of the file path, which is mapped the first time it is
+  // requested and then shared read-only by all the callers of the process
+  // until it exits. Returns NULL if the file is not a valid model, in which
+  // case the next call tries to map it again. It is thread-safe.
+  static const BackgroundModel* Get(const string& path);
+
+  // Maps the model file path. Returns false if it is not a valid model.
+  bool Open(const string& path);
+
+  // Returns the number of words of the vocabulary.
+  int64 size() const { return num_words_; }
+
+  // Returns the i-th word of the vocabulary in byte order, and its
+  // probability.
+  string word(int64 i) const {
+    return string(chars_ + offsets_[i], offsets_[i + 1] - offsets_[i]);
+  }
+  double probability(int64 i) const { return probabilities_[i]; }
+
+  // Returns the probability of the word, or the probability of the unknown
+  // words if it is not in the vocabulary.
+  double GetProbability(const string& word) const;
+
+  double unknown_probability() const { return unknown_probability_; }
+
+ private:
+  // Returns the index of the word in the vocabulary, or -1.
+  int64 Find(const string& word) const;
+
+  BinaryReader reader_;
+
+  // Vocabulary stored in the mapped file: the i-th word is made of the
+  // characters chars_[offsets_[i]] to chars_[offsets_[i+1]-1].
+  int64 num_words_;
+  const int64* offsets_;
+  const char* chars_;
+  const float* probabilities_;
+  double unknown_probability_;
+
+  BackgroundModel(const BackgroundModel&);
+  void operator=(const BackgroundModel&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_BACKGROUND_MODEL_H_
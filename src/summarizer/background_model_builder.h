@@ -0,0 +1,138 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Builds a background model (see background_model.h) offline from the term
+// frequencies of a large corpus.
+//
+// The tokens are counted in parallel: each thread counts the documents of its
+// share of the files in its own table, and the tables of the threads are
+// merged at the end of each batch of files into the table of the builder.
+// All the tables are split into shards by the hash of the words, so that the
+// shards are merged in parallel without locks. The memory is bounded by
+// pruning the words with the lowest counts from a shard which grows too large
+// (lossy counting), so that the counts of the rare words can be
+// underestimated, but they are usually removed by the vocabulary cutoffs.
+
+#ifndef SUMMARIZER_BACKGROUND_MODEL_BUILDER_H_
+#define SUMMARIZER_BACKGROUND_MODEL_BUILDER_H_
+
+#include <string>
+#include <vector>
+
+#include "summarizer/distribution.h"
+#include "summarizer/hash.h"
+#include "summarizer/scoped_ptr.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::string;
+using std::vector;
+
+class Document;
+class ThreadPool;
+class XmlParser;
+
+class BackgroundModelBuilder {
+ public:
+  // Creates a builder counting the tokens with num_threads threads. Each
+  // table of counts, i.e. the one of the builder and the one of each thread,
+  // keeps at most about max_table_size distinct words.
+  BackgroundModelBuilder(int num_threads, int64 max_table_size);
+
+  ~BackgroundModelBuilder();
+
+  // Counts the tokens of the xml articles of the files, as parsed by
+  // XmlParser. Each thread reads one file at a time, so that the files can be
+  // added in batches of any size. Returns the number of files which could not
+  // be read or parsed, which are skipped.
+  int AddFiles(const vector<string>& paths);
+
+  // Counts the tokens of the document.
+  void AddDocument(const Document& document);
+
+  // Returns the number of tokens counted so far.
+  int64 num_tokens() const { return table_.num_tokens; }
+
+  // Stores in distribution the probabilities of the words counted at least
+  // min_count times, keeping only the max_words most frequent ones if
+  // max_words is positive. The probability of a word is its count divided by
+  // the number of tokens. Returns the probability of the other words, i.e. the
+  // average probability of the words cut by min_count and max_words, or 0 if
+  // no word is cut.
+  double GetDistribution(int64 min_count,
+                         int64 max_words,
+                         Distribution* distribution) const;
+
+  // Writes the model of GetDistribution to the file path. Returns false on
+  // error.
+  bool Write(int64 min_count, int64 max_words, const string& path) const;
+
+ private:
+  class CountTask;
+  class MergeTask;
+
+  typedef hash_map<string, int64> WordCounts;
+
+  // Counts of the words of a shard, and threshold of the pruning of the
+  // shard.
+  struct Shard {
+    Shard() : prune_count(0) {}
+
+    WordCounts counts;
+    int64 prune_count;
+  };
+
+  // Counts of all the words, split into kNumShards shards.
+  struct Table {
+    Table();
+    ~Table();
+
+    // Returns the shard of the word.
+    Shard* shard(const string& word);
+
+    vector<Shard*> shards;
+    int64 num_tokens;
+  };
+
+  // Adds the tokens of the document to table.
+  void CountDocument(const Document& document, Table* table) const;
+
+  // Prunes the words of the lowest counts from the shard until it is at most
+  // half full, if it has more than max_shard_size_ words.
+  void Prune(Shard* shard) const;
+
+  // Maximum number of distinct words of a shard.
+  int64 max_shard_size_;
+
+  int num_threads_;
+  scoped_ptr<ThreadPool> thread_pool_;
+
+  // Parser shared by the threads. It has no state, and libxml2 can parse
+  // concurrently once it has been initialized by the constructor of the
+  // parser.
+  scoped_ptr<XmlParser> xml_parser_;
+
+  // Table of the builder, and tables of the threads.
+  Table table_;
+  vector<Table*> thread_tables_;
+
+  BackgroundModelBuilder(const BackgroundModelBuilder&);
+  void operator=(const BackgroundModelBuilder&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_BACKGROUND_MODEL_BUILDER_H_
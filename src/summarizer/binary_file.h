@@ -0,0 +1,142 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Versioned and checksummed binary files, e.g. the checkpoints of the Gibbs
+// samplers, which are loaded by mapping them in memory.
+//
+// A file starts with a header of 32 bytes: an 8-byte magic string telling its
+// type, the version of its format, the CRC-32 of the payload and the size of
+// the payload, followed by the payload. The payload is a sequence of values
+// and arrays in the native byte order, each of them starting on a multiple of
+// 8 bytes, so that the arrays can be used in place from the mapped file.
+
+#ifndef SUMMARIZER_BINARY_FILE_H_
+#define SUMMARIZER_BINARY_FILE_H_
+
+#include <stddef.h>
+#include <string.h>
+
+#include <string>
+
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::string;
+
+// Returns the CRC-32 (IEEE 802.3) of the size bytes of data.
+uint32 Crc32(const void* data, size_t size);
+
+// Builds the payload of a binary file in memory and writes it to a file.
+class BinaryWriter {
+ public:
+  BinaryWriter() {}
+
+  void WriteInt64(int64 value) { WriteArray(&value, 1); }
+  void WriteUint64(uint64 value) { WriteArray(&value, 1); }
+  void WriteDouble(double value) { WriteArray(&value, 1); }
+
+  // Writes the size of the string followed by its bytes.
+  void WriteString(const string& value);
+
+  // Writes the num_values values as they are in memory. The values must be of
+  // a type without pointers, and the reader must know num_values.
+  template <typename T>
+  void WriteArray(const T* values, int64 num_values) {
+    size_t size = sizeof(T) * num_values;
+    size_t offset = payload_.size();
+    payload_.resize(offset + Align(size));
+    if (size > 0) memcpy(&payload_[offset], values, size);
+  }
+
+  // Writes the header and the payload to the file path. The file is written
+  // under a temporary name first and then renamed, so that an interrupted
+  // write does not leave a truncated file at path. Returns false on error.
+  bool WriteFile(const string& path, const char magic[8], uint32 version)
+      const;
+
+  // Returns the number of bytes rounded up to the alignment of the values.
+  static size_t Align(size_t size) { return (size + 7) & ~7; }
+
+ private:
+  string payload_;
+
+  BinaryWriter(const BinaryWriter&);
+  void operator=(const BinaryWriter&);
+};
+
+// Maps a binary file in memory and reads its payload in the order it was
+// written. The arrays returned by ReadArray point into the mapped file, and
+// stay valid until the reader is destroyed.
+class BinaryReader {
+ public:
+  BinaryReader();
+
+  // Unmaps the file.
+  ~BinaryReader();
+
+  // Maps the file path and checks its header and checksum. Returns false and
+  // logs the reason if the file cannot be read, has another magic string or
+  // version, or is corrupted.
+  bool Open(const string& path, const char magic[8], uint32 version);
+
+  // The functions below read the next value of the payload, and return false
+  // (or NULL) if the payload is too short.
+  bool ReadInt64(int64* value) { return ReadValue(value); }
+  bool ReadUint64(uint64* value) { return ReadValue(value); }
+  bool ReadDouble(double* value) { return ReadValue(value); }
+  bool ReadString(string* value);
+
+  template <typename T>
+  const T* ReadArray(int64 num_values) {
+    if (num_values < 0) return NULL;
+    size_t size = sizeof(T) * num_values;
+    if (size > end_ - position_) return NULL;
+    const T* values = reinterpret_cast<const T*>(data_ + position_);
+    position_ += BinaryWriter::Align(size);
+    if (position_ > end_) position_ = end_;
+    return values;
+  }
+
+  // Returns whether all the payload was read.
+  bool done() const { return position_ == end_; }
+
+ private:
+  template <typename T>
+  bool ReadValue(T* value) {
+    const T* values = ReadArray<T>(1);
+    if (values == NULL) return false;
+    *value = *values;
+    return true;
+  }
+
+  // Unmaps the file, if any.
+  void Close();
+
+  // Mapped file and its size.
+  const char* data_;
+  size_t size_;
+
+  // Offsets of the next value and of the end of the payload in the file.
+  size_t position_;
+  size_t end_;
+
+  BinaryReader(const BinaryReader&);
+  void operator=(const BinaryReader&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_BINARY_FILE_H_
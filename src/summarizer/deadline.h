@@ -0,0 +1,48 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time budget of a computation, measured with a monotonic clock from the
+// creation of the deadline.
+
+#ifndef SUMMARIZER_DEADLINE_H_
+#define SUMMARIZER_DEADLINE_H_
+
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+class Deadline {
+ public:
+  // Creates a deadline which expires budget_ms milliseconds from now. If the
+  // budget is not positive, the deadline never expires.
+  explicit Deadline(int64 budget_ms);
+
+  // Returns whether the budget has been used up.
+  bool Expired() const;
+
+  // Returns the number of milliseconds elapsed since the creation of the
+  // deadline.
+  int64 ElapsedMs() const;
+
+ private:
+  // Returns the current time of the monotonic clock, in microseconds.
+  static int64 NowMicros();
+
+  int64 start_micros_;
+  int64 budget_micros_;
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_DEADLINE_H_
@@ -1,598 +1,568 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: summarizer/distribution.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "summarizer/distribution.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace topicsum {
-
-namespace {
-
-const ::google::protobuf::Descriptor* DistributionEntry_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DistributionEntry_reflection_ = NULL;
-const ::google::protobuf::Descriptor* DistributionProto_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DistributionProto_reflection_ = NULL;
-
-}  // namespace
+PROTOBUF_PRAGMA_INIT_SEG
 
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-void protobuf_AssignDesc_summarizer_2fdistribution_2eproto() {
-  protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "summarizer/distribution.proto");
-  GOOGLE_CHECK(file != NULL);
-  DistributionEntry_descriptor_ = file->message_type(0);
-  static const int DistributionEntry_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionEntry, word_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionEntry, value_),
+namespace topicsum {
+PROTOBUF_CONSTEXPR DistributionEntry::DistributionEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.word_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/0} {}
+struct DistributionEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DistributionEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DistributionEntryDefaultTypeInternal() {}
+  union {
+    DistributionEntry _instance;
   };
-  DistributionEntry_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DistributionEntry_descriptor_,
-      DistributionEntry::default_instance_,
-      DistributionEntry_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionEntry, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionEntry, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DistributionEntry));
-  DistributionProto_descriptor_ = file->message_type(1);
-  static const int DistributionProto_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionProto, entry_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DistributionEntryDefaultTypeInternal _DistributionEntry_default_instance_;
+PROTOBUF_CONSTEXPR DistributionProto::DistributionProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entry_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DistributionProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DistributionProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DistributionProtoDefaultTypeInternal() {}
+  union {
+    DistributionProto _instance;
   };
-  DistributionProto_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DistributionProto_descriptor_,
-      DistributionProto::default_instance_,
-      DistributionProto_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionProto, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DistributionProto, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DistributionProto));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_summarizer_2fdistribution_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DistributionEntry_descriptor_, &DistributionEntry::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DistributionProto_descriptor_, &DistributionProto::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_summarizer_2fdistribution_2eproto() {
-  delete DistributionEntry::default_instance_;
-  delete DistributionEntry_reflection_;
-  delete DistributionProto::default_instance_;
-  delete DistributionProto_reflection_;
-}
-
-void protobuf_AddDesc_summarizer_2fdistribution_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\035summarizer/distribution.proto\022\010topicsu"
-    "m\"0\n\021DistributionEntry\022\014\n\004word\030\001 \002(\t\022\r\n\005"
-    "value\030\002 \001(\001\"\?\n\021DistributionProto\022*\n\005entr"
-    "y\030\001 \003(\0132\033.topicsum.DistributionEntry", 156);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "summarizer/distribution.proto", &protobuf_RegisterTypes);
-  DistributionEntry::default_instance_ = new DistributionEntry();
-  DistributionProto::default_instance_ = new DistributionProto();
-  DistributionEntry::default_instance_->InitAsDefaultInstance();
-  DistributionProto::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_summarizer_2fdistribution_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_summarizer_2fdistribution_2eproto {
-  StaticDescriptorInitializer_summarizer_2fdistribution_2eproto() {
-    protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  }
-} static_descriptor_initializer_summarizer_2fdistribution_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DistributionProtoDefaultTypeInternal _DistributionProto_default_instance_;
+}  // namespace topicsum
+static ::_pb::Metadata file_level_metadata_summarizer_2fdistribution_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_summarizer_2fdistribution_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_summarizer_2fdistribution_2eproto = nullptr;
+
+const uint32_t TableStruct_summarizer_2fdistribution_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::topicsum::DistributionEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::DistributionEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::DistributionEntry, _impl_.word_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::DistributionEntry, _impl_.value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::topicsum::DistributionProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::DistributionProto, _impl_.entry_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::topicsum::DistributionEntry)},
+  { 10, -1, -1, sizeof(::topicsum::DistributionProto)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::topicsum::_DistributionEntry_default_instance_._instance,
+  &::topicsum::_DistributionProto_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_summarizer_2fdistribution_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\035summarizer/distribution.proto\022\010topicsu"
+  "m\"0\n\021DistributionEntry\022\014\n\004word\030\001 \002(\t\022\r\n\005"
+  "value\030\002 \001(\001\"\?\n\021DistributionProto\022*\n\005entr"
+  "y\030\001 \003(\0132\033.topicsum.DistributionEntry"
+  ;
+static ::_pbi::once_flag descriptor_table_summarizer_2fdistribution_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_summarizer_2fdistribution_2eproto = {
+    false, false, 156, descriptor_table_protodef_summarizer_2fdistribution_2eproto,
+    "summarizer/distribution.proto",
+    &descriptor_table_summarizer_2fdistribution_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_summarizer_2fdistribution_2eproto::offsets,
+    file_level_metadata_summarizer_2fdistribution_2eproto, file_level_enum_descriptors_summarizer_2fdistribution_2eproto,
+    file_level_service_descriptors_summarizer_2fdistribution_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_summarizer_2fdistribution_2eproto_getter() {
+  return &descriptor_table_summarizer_2fdistribution_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_summarizer_2fdistribution_2eproto(&descriptor_table_summarizer_2fdistribution_2eproto);
+namespace topicsum {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int DistributionEntry::kWordFieldNumber;
-const int DistributionEntry::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-DistributionEntry::DistributionEntry()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class DistributionEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DistributionEntry>()._impl_._has_bits_);
+  static void set_has_word(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void DistributionEntry::InitAsDefaultInstance() {
+DistributionEntry::DistributionEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.DistributionEntry)
 }
-
 DistributionEntry::DistributionEntry(const DistributionEntry& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DistributionEntry::SharedCtor() {
-  _cached_size_ = 0;
-  word_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DistributionEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.word_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.word_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.word_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_word()) {
+    _this->_impl_.word_.Set(from._internal_word(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.value_ = from._impl_.value_;
+  // @@protoc_insertion_point(copy_constructor:topicsum.DistributionEntry)
+}
+
+inline void DistributionEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.word_){}
+    , decltype(_impl_.value_){0}
+  };
+  _impl_.word_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.word_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DistributionEntry::~DistributionEntry() {
+  // @@protoc_insertion_point(destructor:topicsum.DistributionEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DistributionEntry::SharedDtor() {
-  if (word_ != &::google::protobuf::internal::kEmptyString) {
-    delete word_;
-  }
-  if (this != default_instance_) {
-  }
+inline void DistributionEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.word_.Destroy();
 }
 
 void DistributionEntry::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DistributionEntry::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DistributionEntry_descriptor_;
-}
-
-const DistributionEntry& DistributionEntry::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  return *default_instance_;
-}
-
-DistributionEntry* DistributionEntry::default_instance_ = NULL;
-
-DistributionEntry* DistributionEntry::New() const {
-  return new DistributionEntry;
+  _impl_._cached_size_.Set(size);
 }
 
 void DistributionEntry::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_word()) {
-      if (word_ != &::google::protobuf::internal::kEmptyString) {
-        word_->clear();
-      }
-    }
-    value_ = 0;
+// @@protoc_insertion_point(message_clear_start:topicsum.DistributionEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.word_.ClearNonDefaultToEmpty();
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool DistributionEntry::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.value_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DistributionEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string word = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_word()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->word().data(), this->word().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(17)) goto parse_value;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_word();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.DistributionEntry.word");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional double value = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED64) {
-         parse_value:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &value_)));
-          set_has_value();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_value(&has_bits);
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void DistributionEntry::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DistributionEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.DistributionEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string word = 1;
-  if (has_word()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->word().data(), this->word().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->word(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_word().data(), static_cast<int>(this->_internal_word().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.DistributionEntry.word");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_word(), target);
   }
 
   // optional double value = 2;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->value(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.DistributionEntry)
+  return target;
 }
 
-::google::protobuf::uint8* DistributionEntry::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t DistributionEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.DistributionEntry)
+  size_t total_size = 0;
+
   // required string word = 1;
-  if (has_word()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->word().data(), this->word().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->word(), target);
+  if (_internal_has_word()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_word());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // optional double value = 2;
-  if (has_value()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->value(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 8;
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int DistributionEntry::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DistributionEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DistributionEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DistributionEntry::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required string word = 1;
-    if (has_word()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->word());
-    }
-
-    // optional double value = 2;
-    if (has_value()) {
-      total_size += 1 + 8;
-    }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void DistributionEntry::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DistributionEntry* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DistributionEntry*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void DistributionEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DistributionEntry*>(&to_msg);
+  auto& from = static_cast<const DistributionEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.DistributionEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void DistributionEntry::MergeFrom(const DistributionEntry& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_word()) {
-      set_word(from.word());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_word(from._internal_word());
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.value_ = from._impl_.value_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void DistributionEntry::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DistributionEntry::CopyFrom(const DistributionEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.DistributionEntry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DistributionEntry::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void DistributionEntry::Swap(DistributionEntry* other) {
-  if (other != this) {
-    std::swap(word_, other->word_);
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void DistributionEntry::InternalSwap(DistributionEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.word_, lhs_arena,
+      &other->_impl_.word_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
 }
 
-::google::protobuf::Metadata DistributionEntry::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DistributionEntry_descriptor_;
-  metadata.reflection = DistributionEntry_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata DistributionEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fdistribution_2eproto_getter, &descriptor_table_summarizer_2fdistribution_2eproto_once,
+      file_level_metadata_summarizer_2fdistribution_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int DistributionProto::kEntryFieldNumber;
-#endif  // !_MSC_VER
+class DistributionProto::_Internal {
+ public:
+};
 
-DistributionProto::DistributionProto()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+DistributionProto::DistributionProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.DistributionProto)
 }
-
-void DistributionProto::InitAsDefaultInstance() {
-}
-
 DistributionProto::DistributionProto(const DistributionProto& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DistributionProto::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DistributionProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entry_){from._impl_.entry_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:topicsum.DistributionProto)
+}
+
+inline void DistributionProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entry_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DistributionProto::~DistributionProto() {
+  // @@protoc_insertion_point(destructor:topicsum.DistributionProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DistributionProto::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void DistributionProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entry_.~RepeatedPtrField();
 }
 
 void DistributionProto::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DistributionProto::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DistributionProto_descriptor_;
-}
-
-const DistributionProto& DistributionProto::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  return *default_instance_;
-}
-
-DistributionProto* DistributionProto::default_instance_ = NULL;
-
-DistributionProto* DistributionProto::New() const {
-  return new DistributionProto;
+  _impl_._cached_size_.Set(size);
 }
 
 void DistributionProto::Clear() {
-  entry_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:topicsum.DistributionProto)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entry_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool DistributionProto::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* DistributionProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .topicsum.DistributionEntry entry = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_entry:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_entry()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_entry;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entry(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void DistributionProto::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated .topicsum.DistributionEntry entry = 1;
-  for (int i = 0; i < this->entry_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->entry(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DistributionProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.DistributionProto)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* DistributionProto::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
   // repeated .topicsum.DistributionEntry entry = 1;
-  for (int i = 0; i < this->entry_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->entry(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entry_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entry(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.DistributionProto)
   return target;
 }
 
-int DistributionProto::ByteSize() const {
-  int total_size = 0;
+size_t DistributionProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.DistributionProto)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .topicsum.DistributionEntry entry = 1;
-  total_size += 1 * this->entry_size();
-  for (int i = 0; i < this->entry_size(); i++) {
+  total_size += 1UL * this->_internal_entry_size();
+  for (const auto& msg : this->_impl_.entry_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->entry(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void DistributionProto::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DistributionProto* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DistributionProto*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DistributionProto::MergeFrom(const DistributionProto& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  entry_.MergeFrom(from.entry_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DistributionProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DistributionProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DistributionProto::GetClassData() const { return &_class_data_; }
 
-void DistributionProto::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void DistributionProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DistributionProto*>(&to_msg);
+  auto& from = static_cast<const DistributionProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.DistributionProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entry_.MergeFrom(from._impl_.entry_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DistributionProto::CopyFrom(const DistributionProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.DistributionProto)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DistributionProto::IsInitialized() const {
-
-  for (int i = 0; i < entry_size(); i++) {
-    if (!this->entry(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.entry_))
+    return false;
   return true;
 }
 
-void DistributionProto::Swap(DistributionProto* other) {
-  if (other != this) {
-    entry_.Swap(&other->entry_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void DistributionProto::InternalSwap(DistributionProto* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entry_.InternalSwap(&other->_impl_.entry_);
 }
 
-::google::protobuf::Metadata DistributionProto::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DistributionProto_descriptor_;
-  metadata.reflection = DistributionProto_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata DistributionProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fdistribution_2eproto_getter, &descriptor_table_summarizer_2fdistribution_2eproto_once,
+      file_level_metadata_summarizer_2fdistribution_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace topicsum
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::topicsum::DistributionEntry*
+Arena::CreateMaybeMessage< ::topicsum::DistributionEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::DistributionEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::DistributionProto*
+Arena::CreateMaybeMessage< ::topicsum::DistributionProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::DistributionProto >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
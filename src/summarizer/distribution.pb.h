@@ -1,320 +1,512 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: summarizer/distribution.proto
 
-#ifndef PROTOBUF_summarizer_2fdistribution_2eproto__INCLUDED
-#define PROTOBUF_summarizer_2fdistribution_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_summarizer_2fdistribution_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_summarizer_2fdistribution_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_summarizer_2fdistribution_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_summarizer_2fdistribution_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_summarizer_2fdistribution_2eproto;
 namespace topicsum {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-void protobuf_AssignDesc_summarizer_2fdistribution_2eproto();
-void protobuf_ShutdownFile_summarizer_2fdistribution_2eproto();
-
 class DistributionEntry;
+struct DistributionEntryDefaultTypeInternal;
+extern DistributionEntryDefaultTypeInternal _DistributionEntry_default_instance_;
 class DistributionProto;
+struct DistributionProtoDefaultTypeInternal;
+extern DistributionProtoDefaultTypeInternal _DistributionProto_default_instance_;
+}  // namespace topicsum
+PROTOBUF_NAMESPACE_OPEN
+template<> ::topicsum::DistributionEntry* Arena::CreateMaybeMessage<::topicsum::DistributionEntry>(Arena*);
+template<> ::topicsum::DistributionProto* Arena::CreateMaybeMessage<::topicsum::DistributionProto>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace topicsum {
 
 // ===================================================================
 
-class DistributionEntry : public ::google::protobuf::Message {
+class DistributionEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.DistributionEntry) */ {
  public:
-  DistributionEntry();
-  virtual ~DistributionEntry();
+  inline DistributionEntry() : DistributionEntry(nullptr) {}
+  ~DistributionEntry() override;
+  explicit PROTOBUF_CONSTEXPR DistributionEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DistributionEntry(const DistributionEntry& from);
+  DistributionEntry(DistributionEntry&& from) noexcept
+    : DistributionEntry() {
+    *this = ::std::move(from);
+  }
 
   inline DistributionEntry& operator=(const DistributionEntry& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline DistributionEntry& operator=(DistributionEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DistributionEntry& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DistributionEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DistributionEntry* internal_default_instance() {
+    return reinterpret_cast<const DistributionEntry*>(
+               &_DistributionEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(DistributionEntry* other);
+  friend void swap(DistributionEntry& a, DistributionEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DistributionEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DistributionEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  DistributionEntry* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  DistributionEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DistributionEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DistributionEntry& from);
-  void MergeFrom(const DistributionEntry& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DistributionEntry& from) {
+    DistributionEntry::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DistributionEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.DistributionEntry";
+  }
+  protected:
+  explicit DistributionEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kWordFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
   // required string word = 1;
-  inline bool has_word() const;
-  inline void clear_word();
-  static const int kWordFieldNumber = 1;
-  inline const ::std::string& word() const;
-  inline void set_word(const ::std::string& value);
-  inline void set_word(const char* value);
-  inline void set_word(const char* value, size_t size);
-  inline ::std::string* mutable_word();
-  inline ::std::string* release_word();
-  inline void set_allocated_word(::std::string* word);
+  bool has_word() const;
+  private:
+  bool _internal_has_word() const;
+  public:
+  void clear_word();
+  const std::string& word() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_word(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_word();
+  PROTOBUF_NODISCARD std::string* release_word();
+  void set_allocated_word(std::string* word);
+  private:
+  const std::string& _internal_word() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_word(const std::string& value);
+  std::string* _internal_mutable_word();
+  public:
 
   // optional double value = 2;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 2;
-  inline double value() const;
-  inline void set_value(double value);
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.DistributionEntry)
  private:
-  inline void set_has_word();
-  inline void clear_has_word();
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* word_;
-  double value_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fdistribution_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fdistribution_2eproto();
-
-  void InitAsDefaultInstance();
-  static DistributionEntry* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr word_;
+    double value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fdistribution_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DistributionProto : public ::google::protobuf::Message {
+class DistributionProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.DistributionProto) */ {
  public:
-  DistributionProto();
-  virtual ~DistributionProto();
+  inline DistributionProto() : DistributionProto(nullptr) {}
+  ~DistributionProto() override;
+  explicit PROTOBUF_CONSTEXPR DistributionProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DistributionProto(const DistributionProto& from);
+  DistributionProto(DistributionProto&& from) noexcept
+    : DistributionProto() {
+    *this = ::std::move(from);
+  }
 
   inline DistributionProto& operator=(const DistributionProto& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline DistributionProto& operator=(DistributionProto&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DistributionProto& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DistributionProto& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DistributionProto* internal_default_instance() {
+    return reinterpret_cast<const DistributionProto*>(
+               &_DistributionProto_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(DistributionProto* other);
+  friend void swap(DistributionProto& a, DistributionProto& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DistributionProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DistributionProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  DistributionProto* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  DistributionProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DistributionProto>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DistributionProto& from);
-  void MergeFrom(const DistributionProto& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DistributionProto& from) {
+    DistributionProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DistributionProto* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.DistributionProto";
+  }
+  protected:
+  explicit DistributionProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kEntryFieldNumber = 1,
+  };
   // repeated .topicsum.DistributionEntry entry = 1;
-  inline int entry_size() const;
-  inline void clear_entry();
-  static const int kEntryFieldNumber = 1;
-  inline const ::topicsum::DistributionEntry& entry(int index) const;
-  inline ::topicsum::DistributionEntry* mutable_entry(int index);
-  inline ::topicsum::DistributionEntry* add_entry();
-  inline const ::google::protobuf::RepeatedPtrField< ::topicsum::DistributionEntry >&
-      entry() const;
-  inline ::google::protobuf::RepeatedPtrField< ::topicsum::DistributionEntry >*
+  int entry_size() const;
+  private:
+  int _internal_entry_size() const;
+  public:
+  void clear_entry();
+  ::topicsum::DistributionEntry* mutable_entry(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::DistributionEntry >*
       mutable_entry();
+  private:
+  const ::topicsum::DistributionEntry& _internal_entry(int index) const;
+  ::topicsum::DistributionEntry* _internal_add_entry();
+  public:
+  const ::topicsum::DistributionEntry& entry(int index) const;
+  ::topicsum::DistributionEntry* add_entry();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::DistributionEntry >&
+      entry() const;
 
   // @@protoc_insertion_point(class_scope:topicsum.DistributionProto)
  private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::topicsum::DistributionEntry > entry_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fdistribution_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fdistribution_2eproto();
-
-  void InitAsDefaultInstance();
-  static DistributionProto* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::DistributionEntry > entry_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fdistribution_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // DistributionEntry
 
 // required string word = 1;
+inline bool DistributionEntry::_internal_has_word() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool DistributionEntry::has_word() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_word();
 }
-inline void DistributionEntry::set_has_word() {
-  _has_bits_[0] |= 0x00000001u;
+inline void DistributionEntry::clear_word() {
+  _impl_.word_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void DistributionEntry::clear_has_word() {
-  _has_bits_[0] &= ~0x00000001u;
+inline const std::string& DistributionEntry::word() const {
+  // @@protoc_insertion_point(field_get:topicsum.DistributionEntry.word)
+  return _internal_word();
 }
-inline void DistributionEntry::clear_word() {
-  if (word_ != &::google::protobuf::internal::kEmptyString) {
-    word_->clear();
-  }
-  clear_has_word();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DistributionEntry::set_word(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.word_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.DistributionEntry.word)
 }
-inline const ::std::string& DistributionEntry::word() const {
-  return *word_;
+inline std::string* DistributionEntry::mutable_word() {
+  std::string* _s = _internal_mutable_word();
+  // @@protoc_insertion_point(field_mutable:topicsum.DistributionEntry.word)
+  return _s;
 }
-inline void DistributionEntry::set_word(const ::std::string& value) {
-  set_has_word();
-  if (word_ == &::google::protobuf::internal::kEmptyString) {
-    word_ = new ::std::string;
-  }
-  word_->assign(value);
+inline const std::string& DistributionEntry::_internal_word() const {
+  return _impl_.word_.Get();
 }
-inline void DistributionEntry::set_word(const char* value) {
-  set_has_word();
-  if (word_ == &::google::protobuf::internal::kEmptyString) {
-    word_ = new ::std::string;
-  }
-  word_->assign(value);
+inline void DistributionEntry::_internal_set_word(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.word_.Set(value, GetArenaForAllocation());
 }
-inline void DistributionEntry::set_word(const char* value, size_t size) {
-  set_has_word();
-  if (word_ == &::google::protobuf::internal::kEmptyString) {
-    word_ = new ::std::string;
-  }
-  word_->assign(reinterpret_cast<const char*>(value), size);
+inline std::string* DistributionEntry::_internal_mutable_word() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.word_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* DistributionEntry::mutable_word() {
-  set_has_word();
-  if (word_ == &::google::protobuf::internal::kEmptyString) {
-    word_ = new ::std::string;
+inline std::string* DistributionEntry::release_word() {
+  // @@protoc_insertion_point(field_release:topicsum.DistributionEntry.word)
+  if (!_internal_has_word()) {
+    return nullptr;
   }
-  return word_;
-}
-inline ::std::string* DistributionEntry::release_word() {
-  clear_has_word();
-  if (word_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = word_;
-    word_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.word_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.word_.IsDefault()) {
+    _impl_.word_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void DistributionEntry::set_allocated_word(::std::string* word) {
-  if (word_ != &::google::protobuf::internal::kEmptyString) {
-    delete word_;
-  }
-  if (word) {
-    set_has_word();
-    word_ = word;
+inline void DistributionEntry::set_allocated_word(std::string* word) {
+  if (word != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_word();
-    word_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.word_.SetAllocated(word, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.word_.IsDefault()) {
+    _impl_.word_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.DistributionEntry.word)
 }
 
 // optional double value = 2;
-inline bool DistributionEntry::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void DistributionEntry::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool DistributionEntry::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void DistributionEntry::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool DistributionEntry::has_value() const {
+  return _internal_has_value();
 }
 inline void DistributionEntry::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double DistributionEntry::_internal_value() const {
+  return _impl_.value_;
 }
 inline double DistributionEntry::value() const {
-  return value_;
+  // @@protoc_insertion_point(field_get:topicsum.DistributionEntry.value)
+  return _internal_value();
+}
+inline void DistributionEntry::_internal_set_value(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_ = value;
 }
 inline void DistributionEntry::set_value(double value) {
-  set_has_value();
-  value_ = value;
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:topicsum.DistributionEntry.value)
 }
 
 // -------------------------------------------------------------------
@@ -322,44 +514,56 @@ inline void DistributionEntry::set_value(double value) {
 // DistributionProto
 
 // repeated .topicsum.DistributionEntry entry = 1;
+inline int DistributionProto::_internal_entry_size() const {
+  return _impl_.entry_.size();
+}
 inline int DistributionProto::entry_size() const {
-  return entry_.size();
+  return _internal_entry_size();
 }
 inline void DistributionProto::clear_entry() {
-  entry_.Clear();
+  _impl_.entry_.Clear();
+}
+inline ::topicsum::DistributionEntry* DistributionProto::mutable_entry(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.DistributionProto.entry)
+  return _impl_.entry_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::DistributionEntry >*
+DistributionProto::mutable_entry() {
+  // @@protoc_insertion_point(field_mutable_list:topicsum.DistributionProto.entry)
+  return &_impl_.entry_;
+}
+inline const ::topicsum::DistributionEntry& DistributionProto::_internal_entry(int index) const {
+  return _impl_.entry_.Get(index);
 }
 inline const ::topicsum::DistributionEntry& DistributionProto::entry(int index) const {
-  return entry_.Get(index);
+  // @@protoc_insertion_point(field_get:topicsum.DistributionProto.entry)
+  return _internal_entry(index);
 }
-inline ::topicsum::DistributionEntry* DistributionProto::mutable_entry(int index) {
-  return entry_.Mutable(index);
+inline ::topicsum::DistributionEntry* DistributionProto::_internal_add_entry() {
+  return _impl_.entry_.Add();
 }
 inline ::topicsum::DistributionEntry* DistributionProto::add_entry() {
-  return entry_.Add();
+  ::topicsum::DistributionEntry* _add = _internal_add_entry();
+  // @@protoc_insertion_point(field_add:topicsum.DistributionProto.entry)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::topicsum::DistributionEntry >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::DistributionEntry >&
 DistributionProto::entry() const {
-  return entry_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::topicsum::DistributionEntry >*
-DistributionProto::mutable_entry() {
-  return &entry_;
+  // @@protoc_insertion_point(field_list:topicsum.DistributionProto.entry)
+  return _impl_.entry_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace topicsum
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_summarizer_2fdistribution_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_summarizer_2fdistribution_2eproto
@@ -1,1634 +1,1631 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: summarizer/document.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "summarizer/document.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace topicsum {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Sentence_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Sentence_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Document_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Document_reflection_ = NULL;
-const ::google::protobuf::Descriptor* DocumentCollection_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DocumentCollection_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_summarizer_2fdocument_2eproto() {
-  protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "summarizer/document.proto");
-  GOOGLE_CHECK(file != NULL);
-  Sentence_descriptor_ = file->message_type(0);
-  static const int Sentence_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, raw_content_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, token_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, pos_tag_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, prior_score_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, score_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, source_document_),
+namespace topicsum {
+PROTOBUF_CONSTEXPR Sentence::Sentence(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.token_)*/{}
+  , /*decltype(_impl_.pos_tag_)*/{}
+  , /*decltype(_impl_.raw_content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.source_document_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.prior_score_)*/0} {}
+struct SentenceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SentenceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SentenceDefaultTypeInternal() {}
+  union {
+    Sentence _instance;
   };
-  Sentence_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Sentence_descriptor_,
-      Sentence::default_instance_,
-      Sentence_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Sentence, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Sentence));
-  Document_descriptor_ = file->message_type(1);
-  static const int Document_offsets_[11] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, title_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, description_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, raw_content_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, publication_date_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, sentence_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, num_tokens_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, title_sentence_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, num_title_tokens_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, debug_string_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, dual_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SentenceDefaultTypeInternal _Sentence_default_instance_;
+PROTOBUF_CONSTEXPR Document::Document(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.sentence_)*/{}
+  , /*decltype(_impl_.title_sentence_)*/{}
+  , /*decltype(_impl_.title_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.raw_content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.debug_string_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.publication_date_)*/int64_t{0}
+  , /*decltype(_impl_.num_tokens_)*/int64_t{0}
+  , /*decltype(_impl_.num_title_tokens_)*/int64_t{0}
+  , /*decltype(_impl_.dual_)*/false
+  , /*decltype(_impl_.deadline_exceeded_)*/false} {}
+struct DocumentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DocumentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DocumentDefaultTypeInternal() {}
+  union {
+    Document _instance;
   };
-  Document_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Document_descriptor_,
-      Document::default_instance_,
-      Document_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Document, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Document));
-  DocumentCollection_descriptor_ = file->message_type(2);
-  static const int DocumentCollection_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DocumentCollection, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DocumentCollection, document_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DocumentCollection, num_sentences_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DocumentDefaultTypeInternal _Document_default_instance_;
+PROTOBUF_CONSTEXPR DocumentCollection::DocumentCollection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.document_)*/{}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_sentences_)*/int64_t{0}} {}
+struct DocumentCollectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DocumentCollectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DocumentCollectionDefaultTypeInternal() {}
+  union {
+    DocumentCollection _instance;
   };
-  DocumentCollection_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DocumentCollection_descriptor_,
-      DocumentCollection::default_instance_,
-      DocumentCollection_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DocumentCollection, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DocumentCollection, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DocumentCollection));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_summarizer_2fdocument_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Sentence_descriptor_, &Sentence::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Document_descriptor_, &Document::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DocumentCollection_descriptor_, &DocumentCollection::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_summarizer_2fdocument_2eproto() {
-  delete Sentence::default_instance_;
-  delete Sentence_reflection_;
-  delete Document::default_instance_;
-  delete Document_reflection_;
-  delete DocumentCollection::default_instance_;
-  delete DocumentCollection_reflection_;
-}
-
-void protobuf_AddDesc_summarizer_2fdocument_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\031summarizer/document.proto\022\010topicsum\"|\n"
-    "\010Sentence\022\023\n\013raw_content\030\001 \001(\t\022\r\n\005token\030"
-    "\002 \003(\t\022\017\n\007pos_tag\030\005 \003(\t\022\023\n\013prior_score\030\010 "
-    "\001(\002\022\r\n\005score\030\003 \001(\002\022\027\n\017source_document\030\004 "
-    "\001(\t\"\224\002\n\010Document\022\n\n\002id\030\t \001(\t\022\r\n\005title\030\001 "
-    "\001(\t\022\023\n\013description\030\r \001(\t\022\023\n\013raw_content\030"
-    "\002 \001(\t\022\030\n\020publication_date\030\003 \001(\003\022$\n\010sente"
-    "nce\030\004 \003(\0132\022.topicsum.Sentence\022\022\n\nnum_tok"
-    "ens\030\006 \001(\003\022*\n\016title_sentence\030\013 \003(\0132\022.topi"
-    "csum.Sentence\022\030\n\020num_title_tokens\030\014 \001(\003\022"
-    "\024\n\014debug_string\030\007 \001(\t\022\023\n\004dual\030\010 \001(\010:\005fal"
-    "se\"]\n\022DocumentCollection\022\n\n\002id\030\001 \001(\t\022$\n\010"
-    "document\030\002 \003(\0132\022.topicsum.Document\022\025\n\rnu"
-    "m_sentences\030\003 \001(\003", 537);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "summarizer/document.proto", &protobuf_RegisterTypes);
-  Sentence::default_instance_ = new Sentence();
-  Document::default_instance_ = new Document();
-  DocumentCollection::default_instance_ = new DocumentCollection();
-  Sentence::default_instance_->InitAsDefaultInstance();
-  Document::default_instance_->InitAsDefaultInstance();
-  DocumentCollection::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_summarizer_2fdocument_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_summarizer_2fdocument_2eproto {
-  StaticDescriptorInitializer_summarizer_2fdocument_2eproto() {
-    protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  }
-} static_descriptor_initializer_summarizer_2fdocument_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DocumentCollectionDefaultTypeInternal _DocumentCollection_default_instance_;
+}  // namespace topicsum
+static ::_pb::Metadata file_level_metadata_summarizer_2fdocument_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_summarizer_2fdocument_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_summarizer_2fdocument_2eproto = nullptr;
+
+const uint32_t TableStruct_summarizer_2fdocument_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_.raw_content_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_.token_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_.pos_tag_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_.prior_score_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Sentence, _impl_.source_document_),
+  0,
+  ~0u,
+  ~0u,
+  3,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.title_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.raw_content_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.publication_date_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.sentence_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.num_tokens_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.title_sentence_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.num_title_tokens_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.debug_string_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.dual_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Document, _impl_.deadline_exceeded_),
+  3,
+  0,
+  4,
+  1,
+  5,
+  ~0u,
+  6,
+  ~0u,
+  7,
+  2,
+  8,
+  9,
+  PROTOBUF_FIELD_OFFSET(::topicsum::DocumentCollection, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::DocumentCollection, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::DocumentCollection, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::DocumentCollection, _impl_.document_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::DocumentCollection, _impl_.num_sentences_),
+  0,
+  ~0u,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::topicsum::Sentence)},
+  { 18, 36, -1, sizeof(::topicsum::Document)},
+  { 48, 57, -1, sizeof(::topicsum::DocumentCollection)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::topicsum::_Sentence_default_instance_._instance,
+  &::topicsum::_Document_default_instance_._instance,
+  &::topicsum::_DocumentCollection_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_summarizer_2fdocument_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031summarizer/document.proto\022\010topicsum\"|\n"
+  "\010Sentence\022\023\n\013raw_content\030\001 \001(\t\022\r\n\005token\030"
+  "\002 \003(\t\022\017\n\007pos_tag\030\005 \003(\t\022\023\n\013prior_score\030\010 "
+  "\001(\002\022\r\n\005score\030\003 \001(\002\022\027\n\017source_document\030\004 "
+  "\001(\t\"\266\002\n\010Document\022\n\n\002id\030\t \001(\t\022\r\n\005title\030\001 "
+  "\001(\t\022\023\n\013description\030\r \001(\t\022\023\n\013raw_content\030"
+  "\002 \001(\t\022\030\n\020publication_date\030\003 \001(\003\022$\n\010sente"
+  "nce\030\004 \003(\0132\022.topicsum.Sentence\022\022\n\nnum_tok"
+  "ens\030\006 \001(\003\022*\n\016title_sentence\030\013 \003(\0132\022.topi"
+  "csum.Sentence\022\030\n\020num_title_tokens\030\014 \001(\003\022"
+  "\024\n\014debug_string\030\007 \001(\t\022\023\n\004dual\030\010 \001(\010:\005fal"
+  "se\022 \n\021deadline_exceeded\030\016 \001(\010:\005false\"]\n\022"
+  "DocumentCollection\022\n\n\002id\030\001 \001(\t\022$\n\010docume"
+  "nt\030\002 \003(\0132\022.topicsum.Document\022\025\n\rnum_sent"
+  "ences\030\003 \001(\003"
+  ;
+static ::_pbi::once_flag descriptor_table_summarizer_2fdocument_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_summarizer_2fdocument_2eproto = {
+    false, false, 571, descriptor_table_protodef_summarizer_2fdocument_2eproto,
+    "summarizer/document.proto",
+    &descriptor_table_summarizer_2fdocument_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_summarizer_2fdocument_2eproto::offsets,
+    file_level_metadata_summarizer_2fdocument_2eproto, file_level_enum_descriptors_summarizer_2fdocument_2eproto,
+    file_level_service_descriptors_summarizer_2fdocument_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_summarizer_2fdocument_2eproto_getter() {
+  return &descriptor_table_summarizer_2fdocument_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_summarizer_2fdocument_2eproto(&descriptor_table_summarizer_2fdocument_2eproto);
+namespace topicsum {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Sentence::kRawContentFieldNumber;
-const int Sentence::kTokenFieldNumber;
-const int Sentence::kPosTagFieldNumber;
-const int Sentence::kPriorScoreFieldNumber;
-const int Sentence::kScoreFieldNumber;
-const int Sentence::kSourceDocumentFieldNumber;
-#endif  // !_MSC_VER
-
-Sentence::Sentence()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Sentence::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Sentence>()._impl_._has_bits_);
+  static void set_has_raw_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_prior_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_source_document(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void Sentence::InitAsDefaultInstance() {
+Sentence::Sentence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.Sentence)
 }
-
 Sentence::Sentence(const Sentence& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Sentence::SharedCtor() {
-  _cached_size_ = 0;
-  raw_content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  prior_score_ = 0;
-  score_ = 0;
-  source_document_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Sentence* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.token_){from._impl_.token_}
+    , decltype(_impl_.pos_tag_){from._impl_.pos_tag_}
+    , decltype(_impl_.raw_content_){}
+    , decltype(_impl_.source_document_){}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.prior_score_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.raw_content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_raw_content()) {
+    _this->_impl_.raw_content_.Set(from._internal_raw_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.source_document_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_document_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_source_document()) {
+    _this->_impl_.source_document_.Set(from._internal_source_document(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.score_, &from._impl_.score_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prior_score_) -
+    reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.prior_score_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.Sentence)
+}
+
+inline void Sentence::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.token_){arena}
+    , decltype(_impl_.pos_tag_){arena}
+    , decltype(_impl_.raw_content_){}
+    , decltype(_impl_.source_document_){}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.prior_score_){0}
+  };
+  _impl_.raw_content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.source_document_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_document_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Sentence::~Sentence() {
+  // @@protoc_insertion_point(destructor:topicsum.Sentence)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Sentence::SharedDtor() {
-  if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-    delete raw_content_;
-  }
-  if (source_document_ != &::google::protobuf::internal::kEmptyString) {
-    delete source_document_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Sentence::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.token_.~RepeatedPtrField();
+  _impl_.pos_tag_.~RepeatedPtrField();
+  _impl_.raw_content_.Destroy();
+  _impl_.source_document_.Destroy();
 }
 
 void Sentence::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Sentence::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Sentence_descriptor_;
-}
-
-const Sentence& Sentence::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  return *default_instance_;
-}
-
-Sentence* Sentence::default_instance_ = NULL;
-
-Sentence* Sentence::New() const {
-  return new Sentence;
+  _impl_._cached_size_.Set(size);
 }
 
 void Sentence::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_raw_content()) {
-      if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-        raw_content_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:topicsum.Sentence)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.token_.Clear();
+  _impl_.pos_tag_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.raw_content_.ClearNonDefaultToEmpty();
     }
-    prior_score_ = 0;
-    score_ = 0;
-    if (has_source_document()) {
-      if (source_document_ != &::google::protobuf::internal::kEmptyString) {
-        source_document_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.source_document_.ClearNonDefaultToEmpty();
     }
   }
-  token_.Clear();
-  pos_tag_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.score_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.prior_score_) -
+        reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.prior_score_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Sentence::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Sentence::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string raw_content = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_raw_content()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->raw_content().data(), this->raw_content().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_token;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_raw_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Sentence.raw_content");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated string token = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_token:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_token()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->token(this->token_size() - 1).data(),
-            this->token(this->token_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_token;
-        if (input->ExpectTag(29)) goto parse_score;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_token();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "topicsum.Sentence.token");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional float score = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_score:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &score_)));
-          set_has_score();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_source_document;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string source_document = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_source_document:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_source_document()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->source_document().data(), this->source_document().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_pos_tag;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_source_document();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Sentence.source_document");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated string pos_tag = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pos_tag:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_pos_tag()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->pos_tag(this->pos_tag_size() - 1).data(),
-            this->pos_tag(this->pos_tag_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_pos_tag;
-        if (input->ExpectTag(69)) goto parse_prior_score;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_pos_tag();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "topicsum.Sentence.pos_tag");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional float prior_score = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_prior_score:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &prior_score_)));
-          set_has_prior_score();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_prior_score(&has_bits);
+          _impl_.prior_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Sentence::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Sentence::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.Sentence)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string raw_content = 1;
-  if (has_raw_content()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->raw_content().data(), this->raw_content().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->raw_content(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_raw_content().data(), static_cast<int>(this->_internal_raw_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Sentence.raw_content");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_raw_content(), target);
   }
 
   // repeated string token = 2;
-  for (int i = 0; i < this->token_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->token(i).data(), this->token(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->token(i), output);
+  for (int i = 0, n = this->_internal_token_size(); i < n; i++) {
+    const auto& s = this->_internal_token(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Sentence.token");
+    target = stream->WriteString(2, s, target);
   }
 
   // optional float score = 3;
-  if (has_score()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->score(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_score(), target);
   }
 
   // optional string source_document = 4;
-  if (has_source_document()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->source_document().data(), this->source_document().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->source_document(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_source_document().data(), static_cast<int>(this->_internal_source_document().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Sentence.source_document");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_source_document(), target);
   }
 
   // repeated string pos_tag = 5;
-  for (int i = 0; i < this->pos_tag_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->pos_tag(i).data(), this->pos_tag(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      5, this->pos_tag(i), output);
+  for (int i = 0, n = this->_internal_pos_tag_size(); i < n; i++) {
+    const auto& s = this->_internal_pos_tag(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Sentence.pos_tag");
+    target = stream->WriteString(5, s, target);
   }
 
   // optional float prior_score = 8;
-  if (has_prior_score()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(8, this->prior_score(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_prior_score(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.Sentence)
+  return target;
 }
 
-::google::protobuf::uint8* Sentence::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string raw_content = 1;
-  if (has_raw_content()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->raw_content().data(), this->raw_content().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->raw_content(), target);
-  }
+size_t Sentence::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.Sentence)
+  size_t total_size = 0;
 
-  // repeated string token = 2;
-  for (int i = 0; i < this->token_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->token(i).data(), this->token(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(2, this->token(i), target);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional float score = 3;
-  if (has_score()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->score(), target);
-  }
-
-  // optional string source_document = 4;
-  if (has_source_document()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->source_document().data(), this->source_document().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->source_document(), target);
+  // repeated string token = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.token_.size());
+  for (int i = 0, n = _impl_.token_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.token_.Get(i));
   }
 
   // repeated string pos_tag = 5;
-  for (int i = 0; i < this->pos_tag_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->pos_tag(i).data(), this->pos_tag(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(5, this->pos_tag(i), target);
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.pos_tag_.size());
+  for (int i = 0, n = _impl_.pos_tag_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.pos_tag_.Get(i));
   }
 
-  // optional float prior_score = 8;
-  if (has_prior_score()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(8, this->prior_score(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
-
-int Sentence::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
     // optional string raw_content = 1;
-    if (has_raw_content()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->raw_content());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_raw_content());
     }
 
-    // optional float prior_score = 8;
-    if (has_prior_score()) {
-      total_size += 1 + 4;
+    // optional string source_document = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_source_document());
     }
 
     // optional float score = 3;
-    if (has_score()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 4;
     }
 
-    // optional string source_document = 4;
-    if (has_source_document()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->source_document());
+    // optional float prior_score = 8;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 4;
     }
 
   }
-  // repeated string token = 2;
-  total_size += 1 * this->token_size();
-  for (int i = 0; i < this->token_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->token(i));
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // repeated string pos_tag = 5;
-  total_size += 1 * this->pos_tag_size();
-  for (int i = 0; i < this->pos_tag_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->pos_tag(i));
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Sentence::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Sentence::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Sentence::GetClassData() const { return &_class_data_; }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Sentence::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Sentence* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Sentence*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void Sentence::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Sentence*>(&to_msg);
+  auto& from = static_cast<const Sentence&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.Sentence)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Sentence::MergeFrom(const Sentence& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  token_.MergeFrom(from.token_);
-  pos_tag_.MergeFrom(from.pos_tag_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_raw_content()) {
-      set_raw_content(from.raw_content());
+  _this->_impl_.token_.MergeFrom(from._impl_.token_);
+  _this->_impl_.pos_tag_.MergeFrom(from._impl_.pos_tag_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_raw_content(from._internal_raw_content());
     }
-    if (from.has_prior_score()) {
-      set_prior_score(from.prior_score());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_source_document(from._internal_source_document());
     }
-    if (from.has_score()) {
-      set_score(from.score());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.score_ = from._impl_.score_;
     }
-    if (from.has_source_document()) {
-      set_source_document(from.source_document());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.prior_score_ = from._impl_.prior_score_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Sentence::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Sentence::CopyFrom(const Sentence& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.Sentence)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Sentence::IsInitialized() const {
-
   return true;
 }
 
-void Sentence::Swap(Sentence* other) {
-  if (other != this) {
-    std::swap(raw_content_, other->raw_content_);
-    token_.Swap(&other->token_);
-    pos_tag_.Swap(&other->pos_tag_);
-    std::swap(prior_score_, other->prior_score_);
-    std::swap(score_, other->score_);
-    std::swap(source_document_, other->source_document_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Sentence::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Sentence_descriptor_;
-  metadata.reflection = Sentence_reflection_;
-  return metadata;
+void Sentence::InternalSwap(Sentence* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.token_.InternalSwap(&other->_impl_.token_);
+  _impl_.pos_tag_.InternalSwap(&other->_impl_.pos_tag_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.raw_content_, lhs_arena,
+      &other->_impl_.raw_content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.source_document_, lhs_arena,
+      &other->_impl_.source_document_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Sentence, _impl_.prior_score_)
+      + sizeof(Sentence::_impl_.prior_score_)
+      - PROTOBUF_FIELD_OFFSET(Sentence, _impl_.score_)>(
+          reinterpret_cast<char*>(&_impl_.score_),
+          reinterpret_cast<char*>(&other->_impl_.score_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Sentence::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fdocument_2eproto_getter, &descriptor_table_summarizer_2fdocument_2eproto_once,
+      file_level_metadata_summarizer_2fdocument_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Document::kIdFieldNumber;
-const int Document::kTitleFieldNumber;
-const int Document::kDescriptionFieldNumber;
-const int Document::kRawContentFieldNumber;
-const int Document::kPublicationDateFieldNumber;
-const int Document::kSentenceFieldNumber;
-const int Document::kNumTokensFieldNumber;
-const int Document::kTitleSentenceFieldNumber;
-const int Document::kNumTitleTokensFieldNumber;
-const int Document::kDebugStringFieldNumber;
-const int Document::kDualFieldNumber;
-#endif  // !_MSC_VER
-
-Document::Document()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void Document::InitAsDefaultInstance() {
-}
-
-Document::Document(const Document& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Document::SharedCtor() {
-  _cached_size_ = 0;
-  id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  title_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  description_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  raw_content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  publication_date_ = GOOGLE_LONGLONG(0);
-  num_tokens_ = GOOGLE_LONGLONG(0);
-  num_title_tokens_ = GOOGLE_LONGLONG(0);
-  debug_string_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  dual_ = false;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-Document::~Document() {
-  SharedDtor();
-}
-
-void Document::SharedDtor() {
-  if (id_ != &::google::protobuf::internal::kEmptyString) {
-    delete id_;
+class Document::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Document>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-  if (title_ != &::google::protobuf::internal::kEmptyString) {
-    delete title_;
+  static void set_has_title(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  if (description_ != &::google::protobuf::internal::kEmptyString) {
-    delete description_;
+  static void set_has_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
   }
-  if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-    delete raw_content_;
+  static void set_has_raw_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  if (debug_string_ != &::google::protobuf::internal::kEmptyString) {
-    delete debug_string_;
+  static void set_has_publication_date(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
-  if (this != default_instance_) {
+  static void set_has_num_tokens(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
   }
-}
+  static void set_has_num_title_tokens(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_debug_string(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_dual(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_deadline_exceeded(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
 
-void Document::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+Document::Document(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.Document)
 }
-const ::google::protobuf::Descriptor* Document::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Document_descriptor_;
+Document::Document(const Document& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Document* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sentence_){from._impl_.sentence_}
+    , decltype(_impl_.title_sentence_){from._impl_.title_sentence_}
+    , decltype(_impl_.title_){}
+    , decltype(_impl_.raw_content_){}
+    , decltype(_impl_.debug_string_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.publication_date_){}
+    , decltype(_impl_.num_tokens_){}
+    , decltype(_impl_.num_title_tokens_){}
+    , decltype(_impl_.dual_){}
+    , decltype(_impl_.deadline_exceeded_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_title()) {
+    _this->_impl_.title_.Set(from._internal_title(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.raw_content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_raw_content()) {
+    _this->_impl_.raw_content_.Set(from._internal_raw_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.debug_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.debug_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_debug_string()) {
+    _this->_impl_.debug_string_.Set(from._internal_debug_string(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_id()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_description()) {
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.publication_date_, &from._impl_.publication_date_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deadline_exceeded_) -
+    reinterpret_cast<char*>(&_impl_.publication_date_)) + sizeof(_impl_.deadline_exceeded_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.Document)
+}
+
+inline void Document::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.sentence_){arena}
+    , decltype(_impl_.title_sentence_){arena}
+    , decltype(_impl_.title_){}
+    , decltype(_impl_.raw_content_){}
+    , decltype(_impl_.debug_string_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.publication_date_){int64_t{0}}
+    , decltype(_impl_.num_tokens_){int64_t{0}}
+    , decltype(_impl_.num_title_tokens_){int64_t{0}}
+    , decltype(_impl_.dual_){false}
+    , decltype(_impl_.deadline_exceeded_){false}
+  };
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.raw_content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.debug_string_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.debug_string_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const Document& Document::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  return *default_instance_;
+Document::~Document() {
+  // @@protoc_insertion_point(destructor:topicsum.Document)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Document* Document::default_instance_ = NULL;
+inline void Document::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sentence_.~RepeatedPtrField();
+  _impl_.title_sentence_.~RepeatedPtrField();
+  _impl_.title_.Destroy();
+  _impl_.raw_content_.Destroy();
+  _impl_.debug_string_.Destroy();
+  _impl_.id_.Destroy();
+  _impl_.description_.Destroy();
+}
 
-Document* Document::New() const {
-  return new Document;
+void Document::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Document::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_id()) {
-      if (id_ != &::google::protobuf::internal::kEmptyString) {
-        id_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:topicsum.Document)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sentence_.Clear();
+  _impl_.title_sentence_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.title_.ClearNonDefaultToEmpty();
     }
-    if (has_title()) {
-      if (title_ != &::google::protobuf::internal::kEmptyString) {
-        title_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.raw_content_.ClearNonDefaultToEmpty();
     }
-    if (has_description()) {
-      if (description_ != &::google::protobuf::internal::kEmptyString) {
-        description_->clear();
-      }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.debug_string_.ClearNonDefaultToEmpty();
     }
-    if (has_raw_content()) {
-      if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-        raw_content_->clear();
-      }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.id_.ClearNonDefaultToEmpty();
     }
-    publication_date_ = GOOGLE_LONGLONG(0);
-    num_tokens_ = GOOGLE_LONGLONG(0);
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    num_title_tokens_ = GOOGLE_LONGLONG(0);
-    if (has_debug_string()) {
-      if (debug_string_ != &::google::protobuf::internal::kEmptyString) {
-        debug_string_->clear();
-      }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.description_.ClearNonDefaultToEmpty();
     }
-    dual_ = false;
   }
-  sentence_.Clear();
-  title_sentence_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.publication_date_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_title_tokens_) -
+        reinterpret_cast<char*>(&_impl_.publication_date_)) + sizeof(_impl_.num_title_tokens_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.dual_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.deadline_exceeded_) -
+        reinterpret_cast<char*>(&_impl_.dual_)) + sizeof(_impl_.deadline_exceeded_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Document::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Document::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string title = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_title()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->title().data(), this->title().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_raw_content;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_title();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Document.title");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string raw_content = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_raw_content:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_raw_content()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->raw_content().data(), this->raw_content().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_publication_date;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_raw_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Document.raw_content");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional int64 publication_date = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_publication_date:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &publication_date_)));
-          set_has_publication_date();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_sentence;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_publication_date(&has_bits);
+          _impl_.publication_date_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .topicsum.Sentence sentence = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_sentence:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_sentence()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_sentence;
-        if (input->ExpectTag(48)) goto parse_num_tokens;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_sentence(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional int64 num_tokens = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_num_tokens:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &num_tokens_)));
-          set_has_num_tokens();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_debug_string;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_num_tokens(&has_bits);
+          _impl_.num_tokens_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string debug_string = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_debug_string:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_debug_string()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->debug_string().data(), this->debug_string().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_dual;
-        break;
-      }
-
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_debug_string();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Document.debug_string");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool dual = 8 [default = false];
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_dual:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &dual_)));
-          set_has_dual();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(74)) goto parse_id;
-        break;
-      }
-
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_dual(&has_bits);
+          _impl_.dual_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string id = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_id:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_id()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->id().data(), this->id().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(90)) goto parse_title_sentence;
-        break;
-      }
-
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Document.id");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .topicsum.Sentence title_sentence = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_title_sentence:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_title_sentence()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(90)) goto parse_title_sentence;
-        if (input->ExpectTag(96)) goto parse_num_title_tokens;
-        break;
-      }
-
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_title_sentence(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional int64 num_title_tokens = 12;
-      case 12: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_num_title_tokens:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &num_title_tokens_)));
-          set_has_num_title_tokens();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(106)) goto parse_description;
-        break;
-      }
-
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_num_title_tokens(&has_bits);
+          _impl_.num_title_tokens_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string description = 13;
-      case 13: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_description:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_description()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->description().data(), this->description().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Document.description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool deadline_exceeded = 14 [default = false];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_deadline_exceeded(&has_bits);
+          _impl_.deadline_exceeded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Document::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Document::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.Document)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string title = 1;
-  if (has_title()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->title().data(), this->title().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->title(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Document.title");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_title(), target);
   }
 
   // optional string raw_content = 2;
-  if (has_raw_content()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->raw_content().data(), this->raw_content().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->raw_content(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_raw_content().data(), static_cast<int>(this->_internal_raw_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Document.raw_content");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_raw_content(), target);
   }
 
   // optional int64 publication_date = 3;
-  if (has_publication_date()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->publication_date(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_publication_date(), target);
   }
 
   // repeated .topicsum.Sentence sentence = 4;
-  for (int i = 0; i < this->sentence_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->sentence(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_sentence_size()); i < n; i++) {
+    const auto& repfield = this->_internal_sentence(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional int64 num_tokens = 6;
-  if (has_num_tokens()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(6, this->num_tokens(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_num_tokens(), target);
   }
 
   // optional string debug_string = 7;
-  if (has_debug_string()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->debug_string().data(), this->debug_string().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      7, this->debug_string(), output);
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_debug_string().data(), static_cast<int>(this->_internal_debug_string().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Document.debug_string");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_debug_string(), target);
   }
 
   // optional bool dual = 8 [default = false];
-  if (has_dual()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->dual(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_dual(), target);
   }
 
   // optional string id = 9;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->id().data(), this->id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      9, this->id(), output);
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Document.id");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_id(), target);
   }
 
   // repeated .topicsum.Sentence title_sentence = 11;
-  for (int i = 0; i < this->title_sentence_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->title_sentence(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_title_sentence_size()); i < n; i++) {
+    const auto& repfield = this->_internal_title_sentence(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(11, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional int64 num_title_tokens = 12;
-  if (has_num_title_tokens()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(12, this->num_title_tokens(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(12, this->_internal_num_title_tokens(), target);
   }
 
   // optional string description = 13;
-  if (has_description()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->description().data(), this->description().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      13, this->description(), output);
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Document.description");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_description(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional bool deadline_exceeded = 14 [default = false];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(14, this->_internal_deadline_exceeded(), target);
   }
-}
 
-::google::protobuf::uint8* Document::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string title = 1;
-  if (has_title()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->title().data(), this->title().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->title(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.Document)
+  return target;
+}
 
-  // optional string raw_content = 2;
-  if (has_raw_content()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->raw_content().data(), this->raw_content().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->raw_content(), target);
-  }
+size_t Document::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.Document)
+  size_t total_size = 0;
 
-  // optional int64 publication_date = 3;
-  if (has_publication_date()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->publication_date(), target);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .topicsum.Sentence sentence = 4;
-  for (int i = 0; i < this->sentence_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->sentence(i), target);
-  }
-
-  // optional int64 num_tokens = 6;
-  if (has_num_tokens()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(6, this->num_tokens(), target);
-  }
-
-  // optional string debug_string = 7;
-  if (has_debug_string()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->debug_string().data(), this->debug_string().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        7, this->debug_string(), target);
-  }
-
-  // optional bool dual = 8 [default = false];
-  if (has_dual()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->dual(), target);
-  }
-
-  // optional string id = 9;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->id().data(), this->id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        9, this->id(), target);
+  total_size += 1UL * this->_internal_sentence_size();
+  for (const auto& msg : this->_impl_.sentence_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .topicsum.Sentence title_sentence = 11;
-  for (int i = 0; i < this->title_sentence_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        11, this->title_sentence(i), target);
-  }
-
-  // optional int64 num_title_tokens = 12;
-  if (has_num_title_tokens()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(12, this->num_title_tokens(), target);
-  }
-
-  // optional string description = 13;
-  if (has_description()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->description().data(), this->description().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        13, this->description(), target);
+  total_size += 1UL * this->_internal_title_sentence_size();
+  for (const auto& msg : this->_impl_.title_sentence_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
-
-int Document::ByteSize() const {
-  int total_size = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string title = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_title());
+    }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string id = 9;
-    if (has_id()) {
+    // optional string raw_content = 2;
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->id());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_raw_content());
     }
 
-    // optional string title = 1;
-    if (has_title()) {
+    // optional string debug_string = 7;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->title());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_debug_string());
     }
 
-    // optional string description = 13;
-    if (has_description()) {
+    // optional string id = 9;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->description());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_id());
     }
 
-    // optional string raw_content = 2;
-    if (has_raw_content()) {
+    // optional string description = 13;
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->raw_content());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_description());
     }
 
     // optional int64 publication_date = 3;
-    if (has_publication_date()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->publication_date());
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_publication_date());
     }
 
     // optional int64 num_tokens = 6;
-    if (has_num_tokens()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->num_tokens());
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_num_tokens());
     }
 
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
     // optional int64 num_title_tokens = 12;
-    if (has_num_title_tokens()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->num_title_tokens());
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_num_title_tokens());
     }
 
-    // optional string debug_string = 7;
-    if (has_debug_string()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->debug_string());
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional bool dual = 8 [default = false];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
     }
 
-    // optional bool dual = 8 [default = false];
-    if (has_dual()) {
+    // optional bool deadline_exceeded = 14 [default = false];
+    if (cached_has_bits & 0x00000200u) {
       total_size += 1 + 1;
     }
 
   }
-  // repeated .topicsum.Sentence sentence = 4;
-  total_size += 1 * this->sentence_size();
-  for (int i = 0; i < this->sentence_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->sentence(i));
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // repeated .topicsum.Sentence title_sentence = 11;
-  total_size += 1 * this->title_sentence_size();
-  for (int i = 0; i < this->title_sentence_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->title_sentence(i));
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Document::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Document::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Document::GetClassData() const { return &_class_data_; }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Document::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Document* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Document*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void Document::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Document*>(&to_msg);
+  auto& from = static_cast<const Document&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.Document)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Document::MergeFrom(const Document& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  sentence_.MergeFrom(from.sentence_);
-  title_sentence_.MergeFrom(from.title_sentence_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_id()) {
-      set_id(from.id());
+  _this->_impl_.sentence_.MergeFrom(from._impl_.sentence_);
+  _this->_impl_.title_sentence_.MergeFrom(from._impl_.title_sentence_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_title(from._internal_title());
     }
-    if (from.has_title()) {
-      set_title(from.title());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_raw_content(from._internal_raw_content());
     }
-    if (from.has_description()) {
-      set_description(from.description());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_debug_string(from._internal_debug_string());
     }
-    if (from.has_raw_content()) {
-      set_raw_content(from.raw_content());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_id(from._internal_id());
     }
-    if (from.has_publication_date()) {
-      set_publication_date(from.publication_date());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_description(from._internal_description());
     }
-    if (from.has_num_tokens()) {
-      set_num_tokens(from.num_tokens());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.publication_date_ = from._impl_.publication_date_;
     }
-  }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_num_title_tokens()) {
-      set_num_title_tokens(from.num_title_tokens());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.num_tokens_ = from._impl_.num_tokens_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.num_title_tokens_ = from._impl_.num_title_tokens_;
     }
-    if (from.has_debug_string()) {
-      set_debug_string(from.debug_string());
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.dual_ = from._impl_.dual_;
     }
-    if (from.has_dual()) {
-      set_dual(from.dual());
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.deadline_exceeded_ = from._impl_.deadline_exceeded_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Document::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Document::CopyFrom(const Document& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.Document)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Document::IsInitialized() const {
-
   return true;
 }
 
-void Document::Swap(Document* other) {
-  if (other != this) {
-    std::swap(id_, other->id_);
-    std::swap(title_, other->title_);
-    std::swap(description_, other->description_);
-    std::swap(raw_content_, other->raw_content_);
-    std::swap(publication_date_, other->publication_date_);
-    sentence_.Swap(&other->sentence_);
-    std::swap(num_tokens_, other->num_tokens_);
-    title_sentence_.Swap(&other->title_sentence_);
-    std::swap(num_title_tokens_, other->num_title_tokens_);
-    std::swap(debug_string_, other->debug_string_);
-    std::swap(dual_, other->dual_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Document::InternalSwap(Document* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.sentence_.InternalSwap(&other->_impl_.sentence_);
+  _impl_.title_sentence_.InternalSwap(&other->_impl_.title_sentence_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.title_, lhs_arena,
+      &other->_impl_.title_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.raw_content_, lhs_arena,
+      &other->_impl_.raw_content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.debug_string_, lhs_arena,
+      &other->_impl_.debug_string_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Document, _impl_.deadline_exceeded_)
+      + sizeof(Document::_impl_.deadline_exceeded_)
+      - PROTOBUF_FIELD_OFFSET(Document, _impl_.publication_date_)>(
+          reinterpret_cast<char*>(&_impl_.publication_date_),
+          reinterpret_cast<char*>(&other->_impl_.publication_date_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Document::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fdocument_2eproto_getter, &descriptor_table_summarizer_2fdocument_2eproto_once,
+      file_level_metadata_summarizer_2fdocument_2eproto[1]);
 }
 
-::google::protobuf::Metadata Document::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Document_descriptor_;
-  metadata.reflection = Document_reflection_;
-  return metadata;
-}
-
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int DocumentCollection::kIdFieldNumber;
-const int DocumentCollection::kDocumentFieldNumber;
-const int DocumentCollection::kNumSentencesFieldNumber;
-#endif  // !_MSC_VER
-
-DocumentCollection::DocumentCollection()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class DocumentCollection::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DocumentCollection>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_sentences(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void DocumentCollection::InitAsDefaultInstance() {
+DocumentCollection::DocumentCollection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.DocumentCollection)
 }
-
 DocumentCollection::DocumentCollection(const DocumentCollection& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DocumentCollection::SharedCtor() {
-  _cached_size_ = 0;
-  id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  num_sentences_ = GOOGLE_LONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DocumentCollection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.document_){from._impl_.document_}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.num_sentences_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_id()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.num_sentences_ = from._impl_.num_sentences_;
+  // @@protoc_insertion_point(copy_constructor:topicsum.DocumentCollection)
+}
+
+inline void DocumentCollection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.document_){arena}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.num_sentences_){int64_t{0}}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DocumentCollection::~DocumentCollection() {
+  // @@protoc_insertion_point(destructor:topicsum.DocumentCollection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DocumentCollection::SharedDtor() {
-  if (id_ != &::google::protobuf::internal::kEmptyString) {
-    delete id_;
-  }
-  if (this != default_instance_) {
-  }
+inline void DocumentCollection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.document_.~RepeatedPtrField();
+  _impl_.id_.Destroy();
 }
 
 void DocumentCollection::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DocumentCollection::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DocumentCollection_descriptor_;
-}
-
-const DocumentCollection& DocumentCollection::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  return *default_instance_;
-}
-
-DocumentCollection* DocumentCollection::default_instance_ = NULL;
-
-DocumentCollection* DocumentCollection::New() const {
-  return new DocumentCollection;
+  _impl_._cached_size_.Set(size);
 }
 
 void DocumentCollection::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_id()) {
-      if (id_ != &::google::protobuf::internal::kEmptyString) {
-        id_->clear();
-      }
-    }
-    num_sentences_ = GOOGLE_LONGLONG(0);
-  }
-  document_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool DocumentCollection::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.DocumentCollection)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.document_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.id_.ClearNonDefaultToEmpty();
+  }
+  _impl_.num_sentences_ = int64_t{0};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DocumentCollection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_id()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->id().data(), this->id().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_document;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.DocumentCollection.id");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .topicsum.Document document = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_document:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_document()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_document;
-        if (input->ExpectTag(24)) goto parse_num_sentences;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_document(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional int64 num_sentences = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_num_sentences:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &num_sentences_)));
-          set_has_num_sentences();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_sentences(&has_bits);
+          _impl_.num_sentences_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void DocumentCollection::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DocumentCollection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.DocumentCollection)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string id = 1;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->id().data(), this->id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->id(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.DocumentCollection.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
   }
 
   // repeated .topicsum.Document document = 2;
-  for (int i = 0; i < this->document_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->document(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_document_size()); i < n; i++) {
+    const auto& repfield = this->_internal_document(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional int64 num_sentences = 3;
-  if (has_num_sentences()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->num_sentences(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_num_sentences(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.DocumentCollection)
+  return target;
 }
 
-::google::protobuf::uint8* DocumentCollection::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string id = 1;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->id().data(), this->id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->id(), target);
-  }
+size_t DocumentCollection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.DocumentCollection)
+  size_t total_size = 0;
 
-  // repeated .topicsum.Document document = 2;
-  for (int i = 0; i < this->document_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->document(i), target);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional int64 num_sentences = 3;
-  if (has_num_sentences()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->num_sentences(), target);
+  // repeated .topicsum.Document document = 2;
+  total_size += 1UL * this->_internal_document_size();
+  for (const auto& msg : this->_impl_.document_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
-
-int DocumentCollection::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional string id = 1;
-    if (has_id()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->id());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_id());
     }
 
     // optional int64 num_sentences = 3;
-    if (has_num_sentences()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->num_sentences());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_num_sentences());
     }
 
   }
-  // repeated .topicsum.Document document = 2;
-  total_size += 1 * this->document_size();
-  for (int i = 0; i < this->document_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->document(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DocumentCollection::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DocumentCollection* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DocumentCollection*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DocumentCollection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DocumentCollection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DocumentCollection::GetClassData() const { return &_class_data_; }
+
+
+void DocumentCollection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DocumentCollection*>(&to_msg);
+  auto& from = static_cast<const DocumentCollection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.DocumentCollection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void DocumentCollection::MergeFrom(const DocumentCollection& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  document_.MergeFrom(from.document_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_id()) {
-      set_id(from.id());
+  _this->_impl_.document_.MergeFrom(from._impl_.document_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_id(from._internal_id());
     }
-    if (from.has_num_sentences()) {
-      set_num_sentences(from.num_sentences());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_sentences_ = from._impl_.num_sentences_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void DocumentCollection::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DocumentCollection::CopyFrom(const DocumentCollection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.DocumentCollection)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DocumentCollection::IsInitialized() const {
-
   return true;
 }
 
-void DocumentCollection::Swap(DocumentCollection* other) {
-  if (other != this) {
-    std::swap(id_, other->id_);
-    document_.Swap(&other->document_);
-    std::swap(num_sentences_, other->num_sentences_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void DocumentCollection::InternalSwap(DocumentCollection* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.document_.InternalSwap(&other->_impl_.document_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  swap(_impl_.num_sentences_, other->_impl_.num_sentences_);
 }
 
-::google::protobuf::Metadata DocumentCollection::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DocumentCollection_descriptor_;
-  metadata.reflection = DocumentCollection_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata DocumentCollection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fdocument_2eproto_getter, &descriptor_table_summarizer_2fdocument_2eproto_once,
+      file_level_metadata_summarizer_2fdocument_2eproto[2]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace topicsum
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::topicsum::Sentence*
+Arena::CreateMaybeMessage< ::topicsum::Sentence >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::Sentence >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::Document*
+Arena::CreateMaybeMessage< ::topicsum::Document >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::Document >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::DocumentCollection*
+Arena::CreateMaybeMessage< ::topicsum::DocumentCollection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::DocumentCollection >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,798 +1,1245 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: summarizer/document.proto
 
-#ifndef PROTOBUF_summarizer_2fdocument_2eproto__INCLUDED
-#define PROTOBUF_summarizer_2fdocument_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_summarizer_2fdocument_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_summarizer_2fdocument_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_summarizer_2fdocument_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_summarizer_2fdocument_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_summarizer_2fdocument_2eproto;
 namespace topicsum {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_summarizer_2fdocument_2eproto();
-void protobuf_AssignDesc_summarizer_2fdocument_2eproto();
-void protobuf_ShutdownFile_summarizer_2fdocument_2eproto();
-
-class Sentence;
 class Document;
+struct DocumentDefaultTypeInternal;
+extern DocumentDefaultTypeInternal _Document_default_instance_;
 class DocumentCollection;
+struct DocumentCollectionDefaultTypeInternal;
+extern DocumentCollectionDefaultTypeInternal _DocumentCollection_default_instance_;
+class Sentence;
+struct SentenceDefaultTypeInternal;
+extern SentenceDefaultTypeInternal _Sentence_default_instance_;
+}  // namespace topicsum
+PROTOBUF_NAMESPACE_OPEN
+template<> ::topicsum::Document* Arena::CreateMaybeMessage<::topicsum::Document>(Arena*);
+template<> ::topicsum::DocumentCollection* Arena::CreateMaybeMessage<::topicsum::DocumentCollection>(Arena*);
+template<> ::topicsum::Sentence* Arena::CreateMaybeMessage<::topicsum::Sentence>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace topicsum {
 
 // ===================================================================
 
-class Sentence : public ::google::protobuf::Message {
+class Sentence final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.Sentence) */ {
  public:
-  Sentence();
-  virtual ~Sentence();
+  inline Sentence() : Sentence(nullptr) {}
+  ~Sentence() override;
+  explicit PROTOBUF_CONSTEXPR Sentence(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Sentence(const Sentence& from);
+  Sentence(Sentence&& from) noexcept
+    : Sentence() {
+    *this = ::std::move(from);
+  }
 
   inline Sentence& operator=(const Sentence& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Sentence& operator=(Sentence&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Sentence& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Sentence& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Sentence* internal_default_instance() {
+    return reinterpret_cast<const Sentence*>(
+               &_Sentence_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Sentence* other);
+  friend void swap(Sentence& a, Sentence& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Sentence* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Sentence* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Sentence* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Sentence* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Sentence>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Sentence& from);
-  void MergeFrom(const Sentence& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Sentence& from) {
+    Sentence::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Sentence* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.Sentence";
+  }
+  protected:
+  explicit Sentence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string raw_content = 1;
-  inline bool has_raw_content() const;
-  inline void clear_raw_content();
-  static const int kRawContentFieldNumber = 1;
-  inline const ::std::string& raw_content() const;
-  inline void set_raw_content(const ::std::string& value);
-  inline void set_raw_content(const char* value);
-  inline void set_raw_content(const char* value, size_t size);
-  inline ::std::string* mutable_raw_content();
-  inline ::std::string* release_raw_content();
-  inline void set_allocated_raw_content(::std::string* raw_content);
-
+  enum : int {
+    kTokenFieldNumber = 2,
+    kPosTagFieldNumber = 5,
+    kRawContentFieldNumber = 1,
+    kSourceDocumentFieldNumber = 4,
+    kScoreFieldNumber = 3,
+    kPriorScoreFieldNumber = 8,
+  };
   // repeated string token = 2;
-  inline int token_size() const;
-  inline void clear_token();
-  static const int kTokenFieldNumber = 2;
-  inline const ::std::string& token(int index) const;
-  inline ::std::string* mutable_token(int index);
-  inline void set_token(int index, const ::std::string& value);
-  inline void set_token(int index, const char* value);
-  inline void set_token(int index, const char* value, size_t size);
-  inline ::std::string* add_token();
-  inline void add_token(const ::std::string& value);
-  inline void add_token(const char* value);
-  inline void add_token(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& token() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_token();
+  int token_size() const;
+  private:
+  int _internal_token_size() const;
+  public:
+  void clear_token();
+  const std::string& token(int index) const;
+  std::string* mutable_token(int index);
+  void set_token(int index, const std::string& value);
+  void set_token(int index, std::string&& value);
+  void set_token(int index, const char* value);
+  void set_token(int index, const char* value, size_t size);
+  std::string* add_token();
+  void add_token(const std::string& value);
+  void add_token(std::string&& value);
+  void add_token(const char* value);
+  void add_token(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& token() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_token();
+  private:
+  const std::string& _internal_token(int index) const;
+  std::string* _internal_add_token();
+  public:
 
   // repeated string pos_tag = 5;
-  inline int pos_tag_size() const;
-  inline void clear_pos_tag();
-  static const int kPosTagFieldNumber = 5;
-  inline const ::std::string& pos_tag(int index) const;
-  inline ::std::string* mutable_pos_tag(int index);
-  inline void set_pos_tag(int index, const ::std::string& value);
-  inline void set_pos_tag(int index, const char* value);
-  inline void set_pos_tag(int index, const char* value, size_t size);
-  inline ::std::string* add_pos_tag();
-  inline void add_pos_tag(const ::std::string& value);
-  inline void add_pos_tag(const char* value);
-  inline void add_pos_tag(const char* value, size_t size);
-  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& pos_tag() const;
-  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_pos_tag();
+  int pos_tag_size() const;
+  private:
+  int _internal_pos_tag_size() const;
+  public:
+  void clear_pos_tag();
+  const std::string& pos_tag(int index) const;
+  std::string* mutable_pos_tag(int index);
+  void set_pos_tag(int index, const std::string& value);
+  void set_pos_tag(int index, std::string&& value);
+  void set_pos_tag(int index, const char* value);
+  void set_pos_tag(int index, const char* value, size_t size);
+  std::string* add_pos_tag();
+  void add_pos_tag(const std::string& value);
+  void add_pos_tag(std::string&& value);
+  void add_pos_tag(const char* value);
+  void add_pos_tag(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& pos_tag() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_pos_tag();
+  private:
+  const std::string& _internal_pos_tag(int index) const;
+  std::string* _internal_add_pos_tag();
+  public:
 
-  // optional float prior_score = 8;
-  inline bool has_prior_score() const;
-  inline void clear_prior_score();
-  static const int kPriorScoreFieldNumber = 8;
-  inline float prior_score() const;
-  inline void set_prior_score(float value);
+  // optional string raw_content = 1;
+  bool has_raw_content() const;
+  private:
+  bool _internal_has_raw_content() const;
+  public:
+  void clear_raw_content();
+  const std::string& raw_content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_raw_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_raw_content();
+  PROTOBUF_NODISCARD std::string* release_raw_content();
+  void set_allocated_raw_content(std::string* raw_content);
+  private:
+  const std::string& _internal_raw_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_raw_content(const std::string& value);
+  std::string* _internal_mutable_raw_content();
+  public:
+
+  // optional string source_document = 4;
+  bool has_source_document() const;
+  private:
+  bool _internal_has_source_document() const;
+  public:
+  void clear_source_document();
+  const std::string& source_document() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_source_document(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_source_document();
+  PROTOBUF_NODISCARD std::string* release_source_document();
+  void set_allocated_source_document(std::string* source_document);
+  private:
+  const std::string& _internal_source_document() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source_document(const std::string& value);
+  std::string* _internal_mutable_source_document();
+  public:
 
   // optional float score = 3;
-  inline bool has_score() const;
-  inline void clear_score();
-  static const int kScoreFieldNumber = 3;
-  inline float score() const;
-  inline void set_score(float value);
+  bool has_score() const;
+  private:
+  bool _internal_has_score() const;
+  public:
+  void clear_score();
+  float score() const;
+  void set_score(float value);
+  private:
+  float _internal_score() const;
+  void _internal_set_score(float value);
+  public:
 
-  // optional string source_document = 4;
-  inline bool has_source_document() const;
-  inline void clear_source_document();
-  static const int kSourceDocumentFieldNumber = 4;
-  inline const ::std::string& source_document() const;
-  inline void set_source_document(const ::std::string& value);
-  inline void set_source_document(const char* value);
-  inline void set_source_document(const char* value, size_t size);
-  inline ::std::string* mutable_source_document();
-  inline ::std::string* release_source_document();
-  inline void set_allocated_source_document(::std::string* source_document);
+  // optional float prior_score = 8;
+  bool has_prior_score() const;
+  private:
+  bool _internal_has_prior_score() const;
+  public:
+  void clear_prior_score();
+  float prior_score() const;
+  void set_prior_score(float value);
+  private:
+  float _internal_prior_score() const;
+  void _internal_set_prior_score(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.Sentence)
  private:
-  inline void set_has_raw_content();
-  inline void clear_has_raw_content();
-  inline void set_has_prior_score();
-  inline void clear_has_prior_score();
-  inline void set_has_score();
-  inline void clear_has_score();
-  inline void set_has_source_document();
-  inline void clear_has_source_document();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* raw_content_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> token_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> pos_tag_;
-  float prior_score_;
-  float score_;
-  ::std::string* source_document_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fdocument_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fdocument_2eproto();
-
-  void InitAsDefaultInstance();
-  static Sentence* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> token_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> pos_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr raw_content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_document_;
+    float score_;
+    float prior_score_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fdocument_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Document : public ::google::protobuf::Message {
+class Document final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.Document) */ {
  public:
-  Document();
-  virtual ~Document();
+  inline Document() : Document(nullptr) {}
+  ~Document() override;
+  explicit PROTOBUF_CONSTEXPR Document(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Document(const Document& from);
+  Document(Document&& from) noexcept
+    : Document() {
+    *this = ::std::move(from);
+  }
 
   inline Document& operator=(const Document& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Document& operator=(Document&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Document& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Document& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Document* internal_default_instance() {
+    return reinterpret_cast<const Document*>(
+               &_Document_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Document* other);
+  friend void swap(Document& a, Document& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Document* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Document* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Document* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Document* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Document>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Document& from);
-  void MergeFrom(const Document& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Document& from) {
+    Document::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Document* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.Document";
+  }
+  protected:
+  explicit Document(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string id = 9;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 9;
-  inline const ::std::string& id() const;
-  inline void set_id(const ::std::string& value);
-  inline void set_id(const char* value);
-  inline void set_id(const char* value, size_t size);
-  inline ::std::string* mutable_id();
-  inline ::std::string* release_id();
-  inline void set_allocated_id(::std::string* id);
+  enum : int {
+    kSentenceFieldNumber = 4,
+    kTitleSentenceFieldNumber = 11,
+    kTitleFieldNumber = 1,
+    kRawContentFieldNumber = 2,
+    kDebugStringFieldNumber = 7,
+    kIdFieldNumber = 9,
+    kDescriptionFieldNumber = 13,
+    kPublicationDateFieldNumber = 3,
+    kNumTokensFieldNumber = 6,
+    kNumTitleTokensFieldNumber = 12,
+    kDualFieldNumber = 8,
+    kDeadlineExceededFieldNumber = 14,
+  };
+  // repeated .topicsum.Sentence sentence = 4;
+  int sentence_size() const;
+  private:
+  int _internal_sentence_size() const;
+  public:
+  void clear_sentence();
+  ::topicsum::Sentence* mutable_sentence(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >*
+      mutable_sentence();
+  private:
+  const ::topicsum::Sentence& _internal_sentence(int index) const;
+  ::topicsum::Sentence* _internal_add_sentence();
+  public:
+  const ::topicsum::Sentence& sentence(int index) const;
+  ::topicsum::Sentence* add_sentence();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >&
+      sentence() const;
 
-  // optional string title = 1;
-  inline bool has_title() const;
-  inline void clear_title();
-  static const int kTitleFieldNumber = 1;
-  inline const ::std::string& title() const;
-  inline void set_title(const ::std::string& value);
-  inline void set_title(const char* value);
-  inline void set_title(const char* value, size_t size);
-  inline ::std::string* mutable_title();
-  inline ::std::string* release_title();
-  inline void set_allocated_title(::std::string* title);
+  // repeated .topicsum.Sentence title_sentence = 11;
+  int title_sentence_size() const;
+  private:
+  int _internal_title_sentence_size() const;
+  public:
+  void clear_title_sentence();
+  ::topicsum::Sentence* mutable_title_sentence(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >*
+      mutable_title_sentence();
+  private:
+  const ::topicsum::Sentence& _internal_title_sentence(int index) const;
+  ::topicsum::Sentence* _internal_add_title_sentence();
+  public:
+  const ::topicsum::Sentence& title_sentence(int index) const;
+  ::topicsum::Sentence* add_title_sentence();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >&
+      title_sentence() const;
 
-  // optional string description = 13;
-  inline bool has_description() const;
-  inline void clear_description();
-  static const int kDescriptionFieldNumber = 13;
-  inline const ::std::string& description() const;
-  inline void set_description(const ::std::string& value);
-  inline void set_description(const char* value);
-  inline void set_description(const char* value, size_t size);
-  inline ::std::string* mutable_description();
-  inline ::std::string* release_description();
-  inline void set_allocated_description(::std::string* description);
+  // optional string title = 1;
+  bool has_title() const;
+  private:
+  bool _internal_has_title() const;
+  public:
+  void clear_title();
+  const std::string& title() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_title(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_title();
+  PROTOBUF_NODISCARD std::string* release_title();
+  void set_allocated_title(std::string* title);
+  private:
+  const std::string& _internal_title() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_title(const std::string& value);
+  std::string* _internal_mutable_title();
+  public:
 
   // optional string raw_content = 2;
-  inline bool has_raw_content() const;
-  inline void clear_raw_content();
-  static const int kRawContentFieldNumber = 2;
-  inline const ::std::string& raw_content() const;
-  inline void set_raw_content(const ::std::string& value);
-  inline void set_raw_content(const char* value);
-  inline void set_raw_content(const char* value, size_t size);
-  inline ::std::string* mutable_raw_content();
-  inline ::std::string* release_raw_content();
-  inline void set_allocated_raw_content(::std::string* raw_content);
+  bool has_raw_content() const;
+  private:
+  bool _internal_has_raw_content() const;
+  public:
+  void clear_raw_content();
+  const std::string& raw_content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_raw_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_raw_content();
+  PROTOBUF_NODISCARD std::string* release_raw_content();
+  void set_allocated_raw_content(std::string* raw_content);
+  private:
+  const std::string& _internal_raw_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_raw_content(const std::string& value);
+  std::string* _internal_mutable_raw_content();
+  public:
 
-  // optional int64 publication_date = 3;
-  inline bool has_publication_date() const;
-  inline void clear_publication_date();
-  static const int kPublicationDateFieldNumber = 3;
-  inline ::google::protobuf::int64 publication_date() const;
-  inline void set_publication_date(::google::protobuf::int64 value);
+  // optional string debug_string = 7;
+  bool has_debug_string() const;
+  private:
+  bool _internal_has_debug_string() const;
+  public:
+  void clear_debug_string();
+  const std::string& debug_string() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_debug_string(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_debug_string();
+  PROTOBUF_NODISCARD std::string* release_debug_string();
+  void set_allocated_debug_string(std::string* debug_string);
+  private:
+  const std::string& _internal_debug_string() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_debug_string(const std::string& value);
+  std::string* _internal_mutable_debug_string();
+  public:
 
-  // repeated .topicsum.Sentence sentence = 4;
-  inline int sentence_size() const;
-  inline void clear_sentence();
-  static const int kSentenceFieldNumber = 4;
-  inline const ::topicsum::Sentence& sentence(int index) const;
-  inline ::topicsum::Sentence* mutable_sentence(int index);
-  inline ::topicsum::Sentence* add_sentence();
-  inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >&
-      sentence() const;
-  inline ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >*
-      mutable_sentence();
+  // optional string id = 9;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
 
-  // optional int64 num_tokens = 6;
-  inline bool has_num_tokens() const;
-  inline void clear_num_tokens();
-  static const int kNumTokensFieldNumber = 6;
-  inline ::google::protobuf::int64 num_tokens() const;
-  inline void set_num_tokens(::google::protobuf::int64 value);
+  // optional string description = 13;
+  bool has_description() const;
+  private:
+  bool _internal_has_description() const;
+  public:
+  void clear_description();
+  const std::string& description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_description();
+  PROTOBUF_NODISCARD std::string* release_description();
+  void set_allocated_description(std::string* description);
+  private:
+  const std::string& _internal_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
+  std::string* _internal_mutable_description();
+  public:
 
-  // repeated .topicsum.Sentence title_sentence = 11;
-  inline int title_sentence_size() const;
-  inline void clear_title_sentence();
-  static const int kTitleSentenceFieldNumber = 11;
-  inline const ::topicsum::Sentence& title_sentence(int index) const;
-  inline ::topicsum::Sentence* mutable_title_sentence(int index);
-  inline ::topicsum::Sentence* add_title_sentence();
-  inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >&
-      title_sentence() const;
-  inline ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >*
-      mutable_title_sentence();
+  // optional int64 publication_date = 3;
+  bool has_publication_date() const;
+  private:
+  bool _internal_has_publication_date() const;
+  public:
+  void clear_publication_date();
+  int64_t publication_date() const;
+  void set_publication_date(int64_t value);
+  private:
+  int64_t _internal_publication_date() const;
+  void _internal_set_publication_date(int64_t value);
+  public:
 
-  // optional int64 num_title_tokens = 12;
-  inline bool has_num_title_tokens() const;
-  inline void clear_num_title_tokens();
-  static const int kNumTitleTokensFieldNumber = 12;
-  inline ::google::protobuf::int64 num_title_tokens() const;
-  inline void set_num_title_tokens(::google::protobuf::int64 value);
+  // optional int64 num_tokens = 6;
+  bool has_num_tokens() const;
+  private:
+  bool _internal_has_num_tokens() const;
+  public:
+  void clear_num_tokens();
+  int64_t num_tokens() const;
+  void set_num_tokens(int64_t value);
+  private:
+  int64_t _internal_num_tokens() const;
+  void _internal_set_num_tokens(int64_t value);
+  public:
 
-  // optional string debug_string = 7;
-  inline bool has_debug_string() const;
-  inline void clear_debug_string();
-  static const int kDebugStringFieldNumber = 7;
-  inline const ::std::string& debug_string() const;
-  inline void set_debug_string(const ::std::string& value);
-  inline void set_debug_string(const char* value);
-  inline void set_debug_string(const char* value, size_t size);
-  inline ::std::string* mutable_debug_string();
-  inline ::std::string* release_debug_string();
-  inline void set_allocated_debug_string(::std::string* debug_string);
+  // optional int64 num_title_tokens = 12;
+  bool has_num_title_tokens() const;
+  private:
+  bool _internal_has_num_title_tokens() const;
+  public:
+  void clear_num_title_tokens();
+  int64_t num_title_tokens() const;
+  void set_num_title_tokens(int64_t value);
+  private:
+  int64_t _internal_num_title_tokens() const;
+  void _internal_set_num_title_tokens(int64_t value);
+  public:
 
   // optional bool dual = 8 [default = false];
-  inline bool has_dual() const;
-  inline void clear_dual();
-  static const int kDualFieldNumber = 8;
-  inline bool dual() const;
-  inline void set_dual(bool value);
+  bool has_dual() const;
+  private:
+  bool _internal_has_dual() const;
+  public:
+  void clear_dual();
+  bool dual() const;
+  void set_dual(bool value);
+  private:
+  bool _internal_dual() const;
+  void _internal_set_dual(bool value);
+  public:
+
+  // optional bool deadline_exceeded = 14 [default = false];
+  bool has_deadline_exceeded() const;
+  private:
+  bool _internal_has_deadline_exceeded() const;
+  public:
+  void clear_deadline_exceeded();
+  bool deadline_exceeded() const;
+  void set_deadline_exceeded(bool value);
+  private:
+  bool _internal_deadline_exceeded() const;
+  void _internal_set_deadline_exceeded(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.Document)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_title();
-  inline void clear_has_title();
-  inline void set_has_description();
-  inline void clear_has_description();
-  inline void set_has_raw_content();
-  inline void clear_has_raw_content();
-  inline void set_has_publication_date();
-  inline void clear_has_publication_date();
-  inline void set_has_num_tokens();
-  inline void clear_has_num_tokens();
-  inline void set_has_num_title_tokens();
-  inline void clear_has_num_title_tokens();
-  inline void set_has_debug_string();
-  inline void clear_has_debug_string();
-  inline void set_has_dual();
-  inline void clear_has_dual();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* id_;
-  ::std::string* title_;
-  ::std::string* description_;
-  ::std::string* raw_content_;
-  ::google::protobuf::int64 publication_date_;
-  ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence > sentence_;
-  ::google::protobuf::int64 num_tokens_;
-  ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence > title_sentence_;
-  ::google::protobuf::int64 num_title_tokens_;
-  ::std::string* debug_string_;
-  bool dual_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(11 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fdocument_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fdocument_2eproto();
-
-  void InitAsDefaultInstance();
-  static Document* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence > sentence_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence > title_sentence_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr raw_content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr debug_string_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    int64_t publication_date_;
+    int64_t num_tokens_;
+    int64_t num_title_tokens_;
+    bool dual_;
+    bool deadline_exceeded_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fdocument_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DocumentCollection : public ::google::protobuf::Message {
+class DocumentCollection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.DocumentCollection) */ {
  public:
-  DocumentCollection();
-  virtual ~DocumentCollection();
+  inline DocumentCollection() : DocumentCollection(nullptr) {}
+  ~DocumentCollection() override;
+  explicit PROTOBUF_CONSTEXPR DocumentCollection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DocumentCollection(const DocumentCollection& from);
+  DocumentCollection(DocumentCollection&& from) noexcept
+    : DocumentCollection() {
+    *this = ::std::move(from);
+  }
 
   inline DocumentCollection& operator=(const DocumentCollection& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline DocumentCollection& operator=(DocumentCollection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DocumentCollection& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DocumentCollection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DocumentCollection* internal_default_instance() {
+    return reinterpret_cast<const DocumentCollection*>(
+               &_DocumentCollection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(DocumentCollection* other);
+  friend void swap(DocumentCollection& a, DocumentCollection& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DocumentCollection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DocumentCollection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  DocumentCollection* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  DocumentCollection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DocumentCollection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DocumentCollection& from);
-  void MergeFrom(const DocumentCollection& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DocumentCollection& from) {
+    DocumentCollection::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DocumentCollection* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.DocumentCollection";
+  }
+  protected:
+  explicit DocumentCollection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string id = 1;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 1;
-  inline const ::std::string& id() const;
-  inline void set_id(const ::std::string& value);
-  inline void set_id(const char* value);
-  inline void set_id(const char* value, size_t size);
-  inline ::std::string* mutable_id();
-  inline ::std::string* release_id();
-  inline void set_allocated_id(::std::string* id);
-
+  enum : int {
+    kDocumentFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kNumSentencesFieldNumber = 3,
+  };
   // repeated .topicsum.Document document = 2;
-  inline int document_size() const;
-  inline void clear_document();
-  static const int kDocumentFieldNumber = 2;
-  inline const ::topicsum::Document& document(int index) const;
-  inline ::topicsum::Document* mutable_document(int index);
-  inline ::topicsum::Document* add_document();
-  inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Document >&
-      document() const;
-  inline ::google::protobuf::RepeatedPtrField< ::topicsum::Document >*
+  int document_size() const;
+  private:
+  int _internal_document_size() const;
+  public:
+  void clear_document();
+  ::topicsum::Document* mutable_document(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Document >*
       mutable_document();
+  private:
+  const ::topicsum::Document& _internal_document(int index) const;
+  ::topicsum::Document* _internal_add_document();
+  public:
+  const ::topicsum::Document& document(int index) const;
+  ::topicsum::Document* add_document();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Document >&
+      document() const;
+
+  // optional string id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
 
   // optional int64 num_sentences = 3;
-  inline bool has_num_sentences() const;
-  inline void clear_num_sentences();
-  static const int kNumSentencesFieldNumber = 3;
-  inline ::google::protobuf::int64 num_sentences() const;
-  inline void set_num_sentences(::google::protobuf::int64 value);
+  bool has_num_sentences() const;
+  private:
+  bool _internal_has_num_sentences() const;
+  public:
+  void clear_num_sentences();
+  int64_t num_sentences() const;
+  void set_num_sentences(int64_t value);
+  private:
+  int64_t _internal_num_sentences() const;
+  void _internal_set_num_sentences(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.DocumentCollection)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_num_sentences();
-  inline void clear_has_num_sentences();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* id_;
-  ::google::protobuf::RepeatedPtrField< ::topicsum::Document > document_;
-  ::google::protobuf::int64 num_sentences_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fdocument_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fdocument_2eproto();
-
-  void InitAsDefaultInstance();
-  static DocumentCollection* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Document > document_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    int64_t num_sentences_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fdocument_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Sentence
 
 // optional string raw_content = 1;
-inline bool Sentence::has_raw_content() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Sentence::set_has_raw_content() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Sentence::_internal_has_raw_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Sentence::clear_has_raw_content() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Sentence::has_raw_content() const {
+  return _internal_has_raw_content();
 }
 inline void Sentence::clear_raw_content() {
-  if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-    raw_content_->clear();
-  }
-  clear_has_raw_content();
-}
-inline const ::std::string& Sentence::raw_content() const {
-  return *raw_content_;
-}
-inline void Sentence::set_raw_content(const ::std::string& value) {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  raw_content_->assign(value);
-}
-inline void Sentence::set_raw_content(const char* value) {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  raw_content_->assign(value);
-}
-inline void Sentence::set_raw_content(const char* value, size_t size) {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  raw_content_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Sentence::mutable_raw_content() {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  return raw_content_;
-}
-inline ::std::string* Sentence::release_raw_content() {
-  clear_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.raw_content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Sentence::raw_content() const {
+  // @@protoc_insertion_point(field_get:topicsum.Sentence.raw_content)
+  return _internal_raw_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sentence::set_raw_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.raw_content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.raw_content)
+}
+inline std::string* Sentence::mutable_raw_content() {
+  std::string* _s = _internal_mutable_raw_content();
+  // @@protoc_insertion_point(field_mutable:topicsum.Sentence.raw_content)
+  return _s;
+}
+inline const std::string& Sentence::_internal_raw_content() const {
+  return _impl_.raw_content_.Get();
+}
+inline void Sentence::_internal_set_raw_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.raw_content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sentence::_internal_mutable_raw_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.raw_content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sentence::release_raw_content() {
+  // @@protoc_insertion_point(field_release:topicsum.Sentence.raw_content)
+  if (!_internal_has_raw_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.raw_content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.raw_content_.IsDefault()) {
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sentence::set_allocated_raw_content(std::string* raw_content) {
+  if (raw_content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = raw_content_;
-    raw_content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Sentence::set_allocated_raw_content(::std::string* raw_content) {
-  if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-    delete raw_content_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (raw_content) {
-    set_has_raw_content();
-    raw_content_ = raw_content;
-  } else {
-    clear_has_raw_content();
-    raw_content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.raw_content_.SetAllocated(raw_content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.raw_content_.IsDefault()) {
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Sentence.raw_content)
 }
 
 // repeated string token = 2;
+inline int Sentence::_internal_token_size() const {
+  return _impl_.token_.size();
+}
 inline int Sentence::token_size() const {
-  return token_.size();
+  return _internal_token_size();
 }
 inline void Sentence::clear_token() {
-  token_.Clear();
+  _impl_.token_.Clear();
+}
+inline std::string* Sentence::add_token() {
+  std::string* _s = _internal_add_token();
+  // @@protoc_insertion_point(field_add_mutable:topicsum.Sentence.token)
+  return _s;
+}
+inline const std::string& Sentence::_internal_token(int index) const {
+  return _impl_.token_.Get(index);
 }
-inline const ::std::string& Sentence::token(int index) const {
-  return token_.Get(index);
+inline const std::string& Sentence::token(int index) const {
+  // @@protoc_insertion_point(field_get:topicsum.Sentence.token)
+  return _internal_token(index);
 }
-inline ::std::string* Sentence::mutable_token(int index) {
-  return token_.Mutable(index);
+inline std::string* Sentence::mutable_token(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.Sentence.token)
+  return _impl_.token_.Mutable(index);
 }
-inline void Sentence::set_token(int index, const ::std::string& value) {
-  token_.Mutable(index)->assign(value);
+inline void Sentence::set_token(int index, const std::string& value) {
+  _impl_.token_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.token)
+}
+inline void Sentence::set_token(int index, std::string&& value) {
+  _impl_.token_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.token)
 }
 inline void Sentence::set_token(int index, const char* value) {
-  token_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.token_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:topicsum.Sentence.token)
 }
 inline void Sentence::set_token(int index, const char* value, size_t size) {
-  token_.Mutable(index)->assign(
+  _impl_.token_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:topicsum.Sentence.token)
+}
+inline std::string* Sentence::_internal_add_token() {
+  return _impl_.token_.Add();
 }
-inline ::std::string* Sentence::add_token() {
-  return token_.Add();
+inline void Sentence::add_token(const std::string& value) {
+  _impl_.token_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:topicsum.Sentence.token)
 }
-inline void Sentence::add_token(const ::std::string& value) {
-  token_.Add()->assign(value);
+inline void Sentence::add_token(std::string&& value) {
+  _impl_.token_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:topicsum.Sentence.token)
 }
 inline void Sentence::add_token(const char* value) {
-  token_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.token_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:topicsum.Sentence.token)
 }
 inline void Sentence::add_token(const char* value, size_t size) {
-  token_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.token_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:topicsum.Sentence.token)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 Sentence::token() const {
-  return token_;
+  // @@protoc_insertion_point(field_list:topicsum.Sentence.token)
+  return _impl_.token_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 Sentence::mutable_token() {
-  return &token_;
+  // @@protoc_insertion_point(field_mutable_list:topicsum.Sentence.token)
+  return &_impl_.token_;
 }
 
 // repeated string pos_tag = 5;
+inline int Sentence::_internal_pos_tag_size() const {
+  return _impl_.pos_tag_.size();
+}
 inline int Sentence::pos_tag_size() const {
-  return pos_tag_.size();
+  return _internal_pos_tag_size();
 }
 inline void Sentence::clear_pos_tag() {
-  pos_tag_.Clear();
+  _impl_.pos_tag_.Clear();
 }
-inline const ::std::string& Sentence::pos_tag(int index) const {
-  return pos_tag_.Get(index);
+inline std::string* Sentence::add_pos_tag() {
+  std::string* _s = _internal_add_pos_tag();
+  // @@protoc_insertion_point(field_add_mutable:topicsum.Sentence.pos_tag)
+  return _s;
 }
-inline ::std::string* Sentence::mutable_pos_tag(int index) {
-  return pos_tag_.Mutable(index);
+inline const std::string& Sentence::_internal_pos_tag(int index) const {
+  return _impl_.pos_tag_.Get(index);
 }
-inline void Sentence::set_pos_tag(int index, const ::std::string& value) {
-  pos_tag_.Mutable(index)->assign(value);
+inline const std::string& Sentence::pos_tag(int index) const {
+  // @@protoc_insertion_point(field_get:topicsum.Sentence.pos_tag)
+  return _internal_pos_tag(index);
+}
+inline std::string* Sentence::mutable_pos_tag(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.Sentence.pos_tag)
+  return _impl_.pos_tag_.Mutable(index);
+}
+inline void Sentence::set_pos_tag(int index, const std::string& value) {
+  _impl_.pos_tag_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.pos_tag)
+}
+inline void Sentence::set_pos_tag(int index, std::string&& value) {
+  _impl_.pos_tag_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.pos_tag)
 }
 inline void Sentence::set_pos_tag(int index, const char* value) {
-  pos_tag_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.pos_tag_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:topicsum.Sentence.pos_tag)
 }
 inline void Sentence::set_pos_tag(int index, const char* value, size_t size) {
-  pos_tag_.Mutable(index)->assign(
+  _impl_.pos_tag_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:topicsum.Sentence.pos_tag)
 }
-inline ::std::string* Sentence::add_pos_tag() {
-  return pos_tag_.Add();
+inline std::string* Sentence::_internal_add_pos_tag() {
+  return _impl_.pos_tag_.Add();
 }
-inline void Sentence::add_pos_tag(const ::std::string& value) {
-  pos_tag_.Add()->assign(value);
+inline void Sentence::add_pos_tag(const std::string& value) {
+  _impl_.pos_tag_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:topicsum.Sentence.pos_tag)
+}
+inline void Sentence::add_pos_tag(std::string&& value) {
+  _impl_.pos_tag_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:topicsum.Sentence.pos_tag)
 }
 inline void Sentence::add_pos_tag(const char* value) {
-  pos_tag_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.pos_tag_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:topicsum.Sentence.pos_tag)
 }
 inline void Sentence::add_pos_tag(const char* value, size_t size) {
-  pos_tag_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.pos_tag_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:topicsum.Sentence.pos_tag)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 Sentence::pos_tag() const {
-  return pos_tag_;
+  // @@protoc_insertion_point(field_list:topicsum.Sentence.pos_tag)
+  return _impl_.pos_tag_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 Sentence::mutable_pos_tag() {
-  return &pos_tag_;
+  // @@protoc_insertion_point(field_mutable_list:topicsum.Sentence.pos_tag)
+  return &_impl_.pos_tag_;
 }
 
 // optional float prior_score = 8;
-inline bool Sentence::has_prior_score() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void Sentence::set_has_prior_score() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Sentence::_internal_has_prior_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Sentence::clear_has_prior_score() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool Sentence::has_prior_score() const {
+  return _internal_has_prior_score();
 }
 inline void Sentence::clear_prior_score() {
-  prior_score_ = 0;
-  clear_has_prior_score();
+  _impl_.prior_score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float Sentence::_internal_prior_score() const {
+  return _impl_.prior_score_;
 }
 inline float Sentence::prior_score() const {
-  return prior_score_;
+  // @@protoc_insertion_point(field_get:topicsum.Sentence.prior_score)
+  return _internal_prior_score();
+}
+inline void Sentence::_internal_set_prior_score(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.prior_score_ = value;
 }
 inline void Sentence::set_prior_score(float value) {
-  set_has_prior_score();
-  prior_score_ = value;
+  _internal_set_prior_score(value);
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.prior_score)
 }
 
 // optional float score = 3;
-inline bool Sentence::has_score() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool Sentence::_internal_has_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Sentence::set_has_score() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void Sentence::clear_has_score() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool Sentence::has_score() const {
+  return _internal_has_score();
 }
 inline void Sentence::clear_score() {
-  score_ = 0;
-  clear_has_score();
+  _impl_.score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Sentence::_internal_score() const {
+  return _impl_.score_;
 }
 inline float Sentence::score() const {
-  return score_;
+  // @@protoc_insertion_point(field_get:topicsum.Sentence.score)
+  return _internal_score();
+}
+inline void Sentence::_internal_set_score(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.score_ = value;
 }
 inline void Sentence::set_score(float value) {
-  set_has_score();
-  score_ = value;
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.score)
 }
 
 // optional string source_document = 4;
-inline bool Sentence::has_source_document() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void Sentence::set_has_source_document() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool Sentence::_internal_has_source_document() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Sentence::clear_has_source_document() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool Sentence::has_source_document() const {
+  return _internal_has_source_document();
 }
 inline void Sentence::clear_source_document() {
-  if (source_document_ != &::google::protobuf::internal::kEmptyString) {
-    source_document_->clear();
-  }
-  clear_has_source_document();
-}
-inline const ::std::string& Sentence::source_document() const {
-  return *source_document_;
-}
-inline void Sentence::set_source_document(const ::std::string& value) {
-  set_has_source_document();
-  if (source_document_ == &::google::protobuf::internal::kEmptyString) {
-    source_document_ = new ::std::string;
-  }
-  source_document_->assign(value);
-}
-inline void Sentence::set_source_document(const char* value) {
-  set_has_source_document();
-  if (source_document_ == &::google::protobuf::internal::kEmptyString) {
-    source_document_ = new ::std::string;
-  }
-  source_document_->assign(value);
-}
-inline void Sentence::set_source_document(const char* value, size_t size) {
-  set_has_source_document();
-  if (source_document_ == &::google::protobuf::internal::kEmptyString) {
-    source_document_ = new ::std::string;
-  }
-  source_document_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Sentence::mutable_source_document() {
-  set_has_source_document();
-  if (source_document_ == &::google::protobuf::internal::kEmptyString) {
-    source_document_ = new ::std::string;
-  }
-  return source_document_;
-}
-inline ::std::string* Sentence::release_source_document() {
-  clear_has_source_document();
-  if (source_document_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.source_document_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Sentence::source_document() const {
+  // @@protoc_insertion_point(field_get:topicsum.Sentence.source_document)
+  return _internal_source_document();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Sentence::set_source_document(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.source_document_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Sentence.source_document)
+}
+inline std::string* Sentence::mutable_source_document() {
+  std::string* _s = _internal_mutable_source_document();
+  // @@protoc_insertion_point(field_mutable:topicsum.Sentence.source_document)
+  return _s;
+}
+inline const std::string& Sentence::_internal_source_document() const {
+  return _impl_.source_document_.Get();
+}
+inline void Sentence::_internal_set_source_document(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.source_document_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Sentence::_internal_mutable_source_document() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.source_document_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Sentence::release_source_document() {
+  // @@protoc_insertion_point(field_release:topicsum.Sentence.source_document)
+  if (!_internal_has_source_document()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.source_document_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_document_.IsDefault()) {
+    _impl_.source_document_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Sentence::set_allocated_source_document(std::string* source_document) {
+  if (source_document != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = source_document_;
-    source_document_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Sentence::set_allocated_source_document(::std::string* source_document) {
-  if (source_document_ != &::google::protobuf::internal::kEmptyString) {
-    delete source_document_;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  if (source_document) {
-    set_has_source_document();
-    source_document_ = source_document;
-  } else {
-    clear_has_source_document();
-    source_document_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.source_document_.SetAllocated(source_document, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.source_document_.IsDefault()) {
+    _impl_.source_document_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Sentence.source_document)
 }
 
 // -------------------------------------------------------------------
@@ -800,491 +1247,563 @@ inline void Sentence::set_allocated_source_document(::std::string* source_docume
 // Document
 
 // optional string id = 9;
-inline bool Document::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Document::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Document::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Document::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Document::has_id() const {
+  return _internal_has_id();
 }
 inline void Document::clear_id() {
-  if (id_ != &::google::protobuf::internal::kEmptyString) {
-    id_->clear();
-  }
-  clear_has_id();
-}
-inline const ::std::string& Document::id() const {
-  return *id_;
-}
-inline void Document::set_id(const ::std::string& value) {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  id_->assign(value);
-}
-inline void Document::set_id(const char* value) {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  id_->assign(value);
-}
-inline void Document::set_id(const char* value, size_t size) {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  id_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Document::mutable_id() {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  return id_;
-}
-inline ::std::string* Document::release_id() {
-  clear_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& Document::id() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Document::set_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Document.id)
+}
+inline std::string* Document::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.id)
+  return _s;
+}
+inline const std::string& Document::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void Document::_internal_set_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Document::_internal_mutable_id() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Document::release_id() {
+  // @@protoc_insertion_point(field_release:topicsum.Document.id)
+  if (!_internal_has_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Document::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    ::std::string* temp = id_;
-    id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-}
-inline void Document::set_allocated_id(::std::string* id) {
-  if (id_ != &::google::protobuf::internal::kEmptyString) {
-    delete id_;
-  }
-  if (id) {
-    set_has_id();
-    id_ = id;
-  } else {
-    clear_has_id();
-    id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Document.id)
 }
 
 // optional string title = 1;
-inline bool Document::has_title() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Document::_internal_has_title() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Document::set_has_title() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Document::clear_has_title() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Document::has_title() const {
+  return _internal_has_title();
 }
 inline void Document::clear_title() {
-  if (title_ != &::google::protobuf::internal::kEmptyString) {
-    title_->clear();
-  }
-  clear_has_title();
-}
-inline const ::std::string& Document::title() const {
-  return *title_;
-}
-inline void Document::set_title(const ::std::string& value) {
-  set_has_title();
-  if (title_ == &::google::protobuf::internal::kEmptyString) {
-    title_ = new ::std::string;
-  }
-  title_->assign(value);
-}
-inline void Document::set_title(const char* value) {
-  set_has_title();
-  if (title_ == &::google::protobuf::internal::kEmptyString) {
-    title_ = new ::std::string;
-  }
-  title_->assign(value);
-}
-inline void Document::set_title(const char* value, size_t size) {
-  set_has_title();
-  if (title_ == &::google::protobuf::internal::kEmptyString) {
-    title_ = new ::std::string;
-  }
-  title_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Document::mutable_title() {
-  set_has_title();
-  if (title_ == &::google::protobuf::internal::kEmptyString) {
-    title_ = new ::std::string;
-  }
-  return title_;
-}
-inline ::std::string* Document::release_title() {
-  clear_has_title();
-  if (title_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.title_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Document::title() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.title)
+  return _internal_title();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Document::set_title(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.title_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Document.title)
+}
+inline std::string* Document::mutable_title() {
+  std::string* _s = _internal_mutable_title();
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.title)
+  return _s;
+}
+inline const std::string& Document::_internal_title() const {
+  return _impl_.title_.Get();
+}
+inline void Document::_internal_set_title(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.title_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Document::_internal_mutable_title() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.title_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Document::release_title() {
+  // @@protoc_insertion_point(field_release:topicsum.Document.title)
+  if (!_internal_has_title()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.title_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.title_.IsDefault()) {
+    _impl_.title_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Document::set_allocated_title(std::string* title) {
+  if (title != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = title_;
-    title_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void Document::set_allocated_title(::std::string* title) {
-  if (title_ != &::google::protobuf::internal::kEmptyString) {
-    delete title_;
-  }
-  if (title) {
-    set_has_title();
-    title_ = title;
-  } else {
-    clear_has_title();
-    title_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.title_.SetAllocated(title, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.title_.IsDefault()) {
+    _impl_.title_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Document.title)
 }
 
 // optional string description = 13;
-inline bool Document::has_description() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Document::set_has_description() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Document::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void Document::clear_has_description() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool Document::has_description() const {
+  return _internal_has_description();
 }
 inline void Document::clear_description() {
-  if (description_ != &::google::protobuf::internal::kEmptyString) {
-    description_->clear();
-  }
-  clear_has_description();
-}
-inline const ::std::string& Document::description() const {
-  return *description_;
-}
-inline void Document::set_description(const ::std::string& value) {
-  set_has_description();
-  if (description_ == &::google::protobuf::internal::kEmptyString) {
-    description_ = new ::std::string;
-  }
-  description_->assign(value);
-}
-inline void Document::set_description(const char* value) {
-  set_has_description();
-  if (description_ == &::google::protobuf::internal::kEmptyString) {
-    description_ = new ::std::string;
-  }
-  description_->assign(value);
-}
-inline void Document::set_description(const char* value, size_t size) {
-  set_has_description();
-  if (description_ == &::google::protobuf::internal::kEmptyString) {
-    description_ = new ::std::string;
-  }
-  description_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Document::mutable_description() {
-  set_has_description();
-  if (description_ == &::google::protobuf::internal::kEmptyString) {
-    description_ = new ::std::string;
-  }
-  return description_;
-}
-inline ::std::string* Document::release_description() {
-  clear_has_description();
-  if (description_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& Document::description() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Document::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Document.description)
+}
+inline std::string* Document::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.description)
+  return _s;
+}
+inline const std::string& Document::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void Document::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Document::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Document::release_description() {
+  // @@protoc_insertion_point(field_release:topicsum.Document.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Document::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    ::std::string* temp = description_;
-    description_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Document::set_allocated_description(::std::string* description) {
-  if (description_ != &::google::protobuf::internal::kEmptyString) {
-    delete description_;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  if (description) {
-    set_has_description();
-    description_ = description;
-  } else {
-    clear_has_description();
-    description_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Document.description)
 }
 
 // optional string raw_content = 2;
-inline bool Document::has_raw_content() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void Document::set_has_raw_content() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Document::_internal_has_raw_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Document::clear_has_raw_content() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool Document::has_raw_content() const {
+  return _internal_has_raw_content();
 }
 inline void Document::clear_raw_content() {
-  if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-    raw_content_->clear();
-  }
-  clear_has_raw_content();
-}
-inline const ::std::string& Document::raw_content() const {
-  return *raw_content_;
-}
-inline void Document::set_raw_content(const ::std::string& value) {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  raw_content_->assign(value);
-}
-inline void Document::set_raw_content(const char* value) {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  raw_content_->assign(value);
-}
-inline void Document::set_raw_content(const char* value, size_t size) {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  raw_content_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Document::mutable_raw_content() {
-  set_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    raw_content_ = new ::std::string;
-  }
-  return raw_content_;
-}
-inline ::std::string* Document::release_raw_content() {
-  clear_has_raw_content();
-  if (raw_content_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.raw_content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Document::raw_content() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.raw_content)
+  return _internal_raw_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Document::set_raw_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.raw_content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Document.raw_content)
+}
+inline std::string* Document::mutable_raw_content() {
+  std::string* _s = _internal_mutable_raw_content();
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.raw_content)
+  return _s;
+}
+inline const std::string& Document::_internal_raw_content() const {
+  return _impl_.raw_content_.Get();
+}
+inline void Document::_internal_set_raw_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.raw_content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Document::_internal_mutable_raw_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.raw_content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Document::release_raw_content() {
+  // @@protoc_insertion_point(field_release:topicsum.Document.raw_content)
+  if (!_internal_has_raw_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.raw_content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.raw_content_.IsDefault()) {
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Document::set_allocated_raw_content(std::string* raw_content) {
+  if (raw_content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = raw_content_;
-    raw_content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Document::set_allocated_raw_content(::std::string* raw_content) {
-  if (raw_content_ != &::google::protobuf::internal::kEmptyString) {
-    delete raw_content_;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  if (raw_content) {
-    set_has_raw_content();
-    raw_content_ = raw_content;
-  } else {
-    clear_has_raw_content();
-    raw_content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.raw_content_.SetAllocated(raw_content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.raw_content_.IsDefault()) {
+    _impl_.raw_content_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Document.raw_content)
 }
 
 // optional int64 publication_date = 3;
+inline bool Document::_internal_has_publication_date() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
 inline bool Document::has_publication_date() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_publication_date();
 }
-inline void Document::set_has_publication_date() {
-  _has_bits_[0] |= 0x00000010u;
+inline void Document::clear_publication_date() {
+  _impl_.publication_date_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void Document::clear_has_publication_date() {
-  _has_bits_[0] &= ~0x00000010u;
+inline int64_t Document::_internal_publication_date() const {
+  return _impl_.publication_date_;
 }
-inline void Document::clear_publication_date() {
-  publication_date_ = GOOGLE_LONGLONG(0);
-  clear_has_publication_date();
+inline int64_t Document::publication_date() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.publication_date)
+  return _internal_publication_date();
 }
-inline ::google::protobuf::int64 Document::publication_date() const {
-  return publication_date_;
+inline void Document::_internal_set_publication_date(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.publication_date_ = value;
 }
-inline void Document::set_publication_date(::google::protobuf::int64 value) {
-  set_has_publication_date();
-  publication_date_ = value;
+inline void Document::set_publication_date(int64_t value) {
+  _internal_set_publication_date(value);
+  // @@protoc_insertion_point(field_set:topicsum.Document.publication_date)
 }
 
 // repeated .topicsum.Sentence sentence = 4;
+inline int Document::_internal_sentence_size() const {
+  return _impl_.sentence_.size();
+}
 inline int Document::sentence_size() const {
-  return sentence_.size();
+  return _internal_sentence_size();
 }
 inline void Document::clear_sentence() {
-  sentence_.Clear();
+  _impl_.sentence_.Clear();
+}
+inline ::topicsum::Sentence* Document::mutable_sentence(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.sentence)
+  return _impl_.sentence_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >*
+Document::mutable_sentence() {
+  // @@protoc_insertion_point(field_mutable_list:topicsum.Document.sentence)
+  return &_impl_.sentence_;
+}
+inline const ::topicsum::Sentence& Document::_internal_sentence(int index) const {
+  return _impl_.sentence_.Get(index);
 }
 inline const ::topicsum::Sentence& Document::sentence(int index) const {
-  return sentence_.Get(index);
+  // @@protoc_insertion_point(field_get:topicsum.Document.sentence)
+  return _internal_sentence(index);
 }
-inline ::topicsum::Sentence* Document::mutable_sentence(int index) {
-  return sentence_.Mutable(index);
+inline ::topicsum::Sentence* Document::_internal_add_sentence() {
+  return _impl_.sentence_.Add();
 }
 inline ::topicsum::Sentence* Document::add_sentence() {
-  return sentence_.Add();
+  ::topicsum::Sentence* _add = _internal_add_sentence();
+  // @@protoc_insertion_point(field_add:topicsum.Document.sentence)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >&
 Document::sentence() const {
-  return sentence_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >*
-Document::mutable_sentence() {
-  return &sentence_;
+  // @@protoc_insertion_point(field_list:topicsum.Document.sentence)
+  return _impl_.sentence_;
 }
 
 // optional int64 num_tokens = 6;
+inline bool Document::_internal_has_num_tokens() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool Document::has_num_tokens() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_num_tokens();
 }
-inline void Document::set_has_num_tokens() {
-  _has_bits_[0] |= 0x00000040u;
+inline void Document::clear_num_tokens() {
+  _impl_.num_tokens_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void Document::clear_has_num_tokens() {
-  _has_bits_[0] &= ~0x00000040u;
+inline int64_t Document::_internal_num_tokens() const {
+  return _impl_.num_tokens_;
 }
-inline void Document::clear_num_tokens() {
-  num_tokens_ = GOOGLE_LONGLONG(0);
-  clear_has_num_tokens();
+inline int64_t Document::num_tokens() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.num_tokens)
+  return _internal_num_tokens();
 }
-inline ::google::protobuf::int64 Document::num_tokens() const {
-  return num_tokens_;
+inline void Document::_internal_set_num_tokens(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.num_tokens_ = value;
 }
-inline void Document::set_num_tokens(::google::protobuf::int64 value) {
-  set_has_num_tokens();
-  num_tokens_ = value;
+inline void Document::set_num_tokens(int64_t value) {
+  _internal_set_num_tokens(value);
+  // @@protoc_insertion_point(field_set:topicsum.Document.num_tokens)
 }
 
 // repeated .topicsum.Sentence title_sentence = 11;
+inline int Document::_internal_title_sentence_size() const {
+  return _impl_.title_sentence_.size();
+}
 inline int Document::title_sentence_size() const {
-  return title_sentence_.size();
+  return _internal_title_sentence_size();
 }
 inline void Document::clear_title_sentence() {
-  title_sentence_.Clear();
+  _impl_.title_sentence_.Clear();
+}
+inline ::topicsum::Sentence* Document::mutable_title_sentence(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.title_sentence)
+  return _impl_.title_sentence_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >*
+Document::mutable_title_sentence() {
+  // @@protoc_insertion_point(field_mutable_list:topicsum.Document.title_sentence)
+  return &_impl_.title_sentence_;
+}
+inline const ::topicsum::Sentence& Document::_internal_title_sentence(int index) const {
+  return _impl_.title_sentence_.Get(index);
 }
 inline const ::topicsum::Sentence& Document::title_sentence(int index) const {
-  return title_sentence_.Get(index);
+  // @@protoc_insertion_point(field_get:topicsum.Document.title_sentence)
+  return _internal_title_sentence(index);
 }
-inline ::topicsum::Sentence* Document::mutable_title_sentence(int index) {
-  return title_sentence_.Mutable(index);
+inline ::topicsum::Sentence* Document::_internal_add_title_sentence() {
+  return _impl_.title_sentence_.Add();
 }
 inline ::topicsum::Sentence* Document::add_title_sentence() {
-  return title_sentence_.Add();
+  ::topicsum::Sentence* _add = _internal_add_title_sentence();
+  // @@protoc_insertion_point(field_add:topicsum.Document.title_sentence)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Sentence >&
 Document::title_sentence() const {
-  return title_sentence_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::topicsum::Sentence >*
-Document::mutable_title_sentence() {
-  return &title_sentence_;
+  // @@protoc_insertion_point(field_list:topicsum.Document.title_sentence)
+  return _impl_.title_sentence_;
 }
 
 // optional int64 num_title_tokens = 12;
+inline bool Document::_internal_has_num_title_tokens() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
 inline bool Document::has_num_title_tokens() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+  return _internal_has_num_title_tokens();
 }
-inline void Document::set_has_num_title_tokens() {
-  _has_bits_[0] |= 0x00000100u;
+inline void Document::clear_num_title_tokens() {
+  _impl_.num_title_tokens_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline void Document::clear_has_num_title_tokens() {
-  _has_bits_[0] &= ~0x00000100u;
+inline int64_t Document::_internal_num_title_tokens() const {
+  return _impl_.num_title_tokens_;
 }
-inline void Document::clear_num_title_tokens() {
-  num_title_tokens_ = GOOGLE_LONGLONG(0);
-  clear_has_num_title_tokens();
+inline int64_t Document::num_title_tokens() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.num_title_tokens)
+  return _internal_num_title_tokens();
 }
-inline ::google::protobuf::int64 Document::num_title_tokens() const {
-  return num_title_tokens_;
+inline void Document::_internal_set_num_title_tokens(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.num_title_tokens_ = value;
 }
-inline void Document::set_num_title_tokens(::google::protobuf::int64 value) {
-  set_has_num_title_tokens();
-  num_title_tokens_ = value;
+inline void Document::set_num_title_tokens(int64_t value) {
+  _internal_set_num_title_tokens(value);
+  // @@protoc_insertion_point(field_set:topicsum.Document.num_title_tokens)
 }
 
 // optional string debug_string = 7;
-inline bool Document::has_debug_string() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
+inline bool Document::_internal_has_debug_string() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Document::set_has_debug_string() {
-  _has_bits_[0] |= 0x00000200u;
-}
-inline void Document::clear_has_debug_string() {
-  _has_bits_[0] &= ~0x00000200u;
+inline bool Document::has_debug_string() const {
+  return _internal_has_debug_string();
 }
 inline void Document::clear_debug_string() {
-  if (debug_string_ != &::google::protobuf::internal::kEmptyString) {
-    debug_string_->clear();
+  _impl_.debug_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Document::debug_string() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.debug_string)
+  return _internal_debug_string();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Document::set_debug_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.debug_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Document.debug_string)
+}
+inline std::string* Document::mutable_debug_string() {
+  std::string* _s = _internal_mutable_debug_string();
+  // @@protoc_insertion_point(field_mutable:topicsum.Document.debug_string)
+  return _s;
+}
+inline const std::string& Document::_internal_debug_string() const {
+  return _impl_.debug_string_.Get();
+}
+inline void Document::_internal_set_debug_string(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.debug_string_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Document::_internal_mutable_debug_string() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.debug_string_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Document::release_debug_string() {
+  // @@protoc_insertion_point(field_release:topicsum.Document.debug_string)
+  if (!_internal_has_debug_string()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.debug_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.debug_string_.IsDefault()) {
+    _impl_.debug_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Document::set_allocated_debug_string(std::string* debug_string) {
+  if (debug_string != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  clear_has_debug_string();
+  _impl_.debug_string_.SetAllocated(debug_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.debug_string_.IsDefault()) {
+    _impl_.debug_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Document.debug_string)
 }
-inline const ::std::string& Document::debug_string() const {
-  return *debug_string_;
+
+// optional bool dual = 8 [default = false];
+inline bool Document::_internal_has_dual() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void Document::set_debug_string(const ::std::string& value) {
-  set_has_debug_string();
-  if (debug_string_ == &::google::protobuf::internal::kEmptyString) {
-    debug_string_ = new ::std::string;
-  }
-  debug_string_->assign(value);
+inline bool Document::has_dual() const {
+  return _internal_has_dual();
 }
-inline void Document::set_debug_string(const char* value) {
-  set_has_debug_string();
-  if (debug_string_ == &::google::protobuf::internal::kEmptyString) {
-    debug_string_ = new ::std::string;
-  }
-  debug_string_->assign(value);
+inline void Document::clear_dual() {
+  _impl_.dual_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void Document::set_debug_string(const char* value, size_t size) {
-  set_has_debug_string();
-  if (debug_string_ == &::google::protobuf::internal::kEmptyString) {
-    debug_string_ = new ::std::string;
-  }
-  debug_string_->assign(reinterpret_cast<const char*>(value), size);
+inline bool Document::_internal_dual() const {
+  return _impl_.dual_;
 }
-inline ::std::string* Document::mutable_debug_string() {
-  set_has_debug_string();
-  if (debug_string_ == &::google::protobuf::internal::kEmptyString) {
-    debug_string_ = new ::std::string;
-  }
-  return debug_string_;
+inline bool Document::dual() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.dual)
+  return _internal_dual();
 }
-inline ::std::string* Document::release_debug_string() {
-  clear_has_debug_string();
-  if (debug_string_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = debug_string_;
-    debug_string_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void Document::_internal_set_dual(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.dual_ = value;
 }
-inline void Document::set_allocated_debug_string(::std::string* debug_string) {
-  if (debug_string_ != &::google::protobuf::internal::kEmptyString) {
-    delete debug_string_;
-  }
-  if (debug_string) {
-    set_has_debug_string();
-    debug_string_ = debug_string;
-  } else {
-    clear_has_debug_string();
-    debug_string_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void Document::set_dual(bool value) {
+  _internal_set_dual(value);
+  // @@protoc_insertion_point(field_set:topicsum.Document.dual)
 }
 
-// optional bool dual = 8 [default = false];
-inline bool Document::has_dual() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+// optional bool deadline_exceeded = 14 [default = false];
+inline bool Document::_internal_has_deadline_exceeded() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void Document::set_has_dual() {
-  _has_bits_[0] |= 0x00000400u;
+inline bool Document::has_deadline_exceeded() const {
+  return _internal_has_deadline_exceeded();
 }
-inline void Document::clear_has_dual() {
-  _has_bits_[0] &= ~0x00000400u;
+inline void Document::clear_deadline_exceeded() {
+  _impl_.deadline_exceeded_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void Document::clear_dual() {
-  dual_ = false;
-  clear_has_dual();
+inline bool Document::_internal_deadline_exceeded() const {
+  return _impl_.deadline_exceeded_;
 }
-inline bool Document::dual() const {
-  return dual_;
+inline bool Document::deadline_exceeded() const {
+  // @@protoc_insertion_point(field_get:topicsum.Document.deadline_exceeded)
+  return _internal_deadline_exceeded();
 }
-inline void Document::set_dual(bool value) {
-  set_has_dual();
-  dual_ = value;
+inline void Document::_internal_set_deadline_exceeded(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.deadline_exceeded_ = value;
+}
+inline void Document::set_deadline_exceeded(bool value) {
+  _internal_set_deadline_exceeded(value);
+  // @@protoc_insertion_point(field_set:topicsum.Document.deadline_exceeded)
 }
 
 // -------------------------------------------------------------------
@@ -1292,136 +1811,154 @@ inline void Document::set_dual(bool value) {
 // DocumentCollection
 
 // optional string id = 1;
-inline bool DocumentCollection::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool DocumentCollection::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void DocumentCollection::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void DocumentCollection::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool DocumentCollection::has_id() const {
+  return _internal_has_id();
 }
 inline void DocumentCollection::clear_id() {
-  if (id_ != &::google::protobuf::internal::kEmptyString) {
-    id_->clear();
-  }
-  clear_has_id();
-}
-inline const ::std::string& DocumentCollection::id() const {
-  return *id_;
-}
-inline void DocumentCollection::set_id(const ::std::string& value) {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  id_->assign(value);
-}
-inline void DocumentCollection::set_id(const char* value) {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  id_->assign(value);
-}
-inline void DocumentCollection::set_id(const char* value, size_t size) {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  id_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* DocumentCollection::mutable_id() {
-  set_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    id_ = new ::std::string;
-  }
-  return id_;
-}
-inline ::std::string* DocumentCollection::release_id() {
-  clear_has_id();
-  if (id_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DocumentCollection::id() const {
+  // @@protoc_insertion_point(field_get:topicsum.DocumentCollection.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DocumentCollection::set_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.DocumentCollection.id)
+}
+inline std::string* DocumentCollection::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:topicsum.DocumentCollection.id)
+  return _s;
+}
+inline const std::string& DocumentCollection::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void DocumentCollection::_internal_set_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DocumentCollection::_internal_mutable_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DocumentCollection::release_id() {
+  // @@protoc_insertion_point(field_release:topicsum.DocumentCollection.id)
+  if (!_internal_has_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DocumentCollection::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = id_;
-    id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void DocumentCollection::set_allocated_id(::std::string* id) {
-  if (id_ != &::google::protobuf::internal::kEmptyString) {
-    delete id_;
-  }
-  if (id) {
-    set_has_id();
-    id_ = id;
-  } else {
-    clear_has_id();
-    id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.DocumentCollection.id)
 }
 
 // repeated .topicsum.Document document = 2;
+inline int DocumentCollection::_internal_document_size() const {
+  return _impl_.document_.size();
+}
 inline int DocumentCollection::document_size() const {
-  return document_.size();
+  return _internal_document_size();
 }
 inline void DocumentCollection::clear_document() {
-  document_.Clear();
+  _impl_.document_.Clear();
+}
+inline ::topicsum::Document* DocumentCollection::mutable_document(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.DocumentCollection.document)
+  return _impl_.document_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Document >*
+DocumentCollection::mutable_document() {
+  // @@protoc_insertion_point(field_mutable_list:topicsum.DocumentCollection.document)
+  return &_impl_.document_;
+}
+inline const ::topicsum::Document& DocumentCollection::_internal_document(int index) const {
+  return _impl_.document_.Get(index);
 }
 inline const ::topicsum::Document& DocumentCollection::document(int index) const {
-  return document_.Get(index);
+  // @@protoc_insertion_point(field_get:topicsum.DocumentCollection.document)
+  return _internal_document(index);
 }
-inline ::topicsum::Document* DocumentCollection::mutable_document(int index) {
-  return document_.Mutable(index);
+inline ::topicsum::Document* DocumentCollection::_internal_add_document() {
+  return _impl_.document_.Add();
 }
 inline ::topicsum::Document* DocumentCollection::add_document() {
-  return document_.Add();
+  ::topicsum::Document* _add = _internal_add_document();
+  // @@protoc_insertion_point(field_add:topicsum.DocumentCollection.document)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Document >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Document >&
 DocumentCollection::document() const {
-  return document_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::topicsum::Document >*
-DocumentCollection::mutable_document() {
-  return &document_;
+  // @@protoc_insertion_point(field_list:topicsum.DocumentCollection.document)
+  return _impl_.document_;
 }
 
 // optional int64 num_sentences = 3;
+inline bool DocumentCollection::_internal_has_num_sentences() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool DocumentCollection::has_num_sentences() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_num_sentences();
 }
-inline void DocumentCollection::set_has_num_sentences() {
-  _has_bits_[0] |= 0x00000004u;
+inline void DocumentCollection::clear_num_sentences() {
+  _impl_.num_sentences_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void DocumentCollection::clear_has_num_sentences() {
-  _has_bits_[0] &= ~0x00000004u;
+inline int64_t DocumentCollection::_internal_num_sentences() const {
+  return _impl_.num_sentences_;
 }
-inline void DocumentCollection::clear_num_sentences() {
-  num_sentences_ = GOOGLE_LONGLONG(0);
-  clear_has_num_sentences();
+inline int64_t DocumentCollection::num_sentences() const {
+  // @@protoc_insertion_point(field_get:topicsum.DocumentCollection.num_sentences)
+  return _internal_num_sentences();
 }
-inline ::google::protobuf::int64 DocumentCollection::num_sentences() const {
-  return num_sentences_;
+inline void DocumentCollection::_internal_set_num_sentences(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_sentences_ = value;
 }
-inline void DocumentCollection::set_num_sentences(::google::protobuf::int64 value) {
-  set_has_num_sentences();
-  num_sentences_ = value;
+inline void DocumentCollection::set_num_sentences(int64_t value) {
+  _internal_set_num_sentences(value);
+  // @@protoc_insertion_point(field_set:topicsum.DocumentCollection.num_sentences)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace topicsum
+// -------------------------------------------------------------------
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
 
+// @@protoc_insertion_point(namespace_scope)
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+}  // namespace topicsum
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_summarizer_2fdocument_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_summarizer_2fdocument_2eproto
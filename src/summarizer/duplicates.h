@@ -0,0 +1,97 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Detection of duplicate and near-duplicate sentences.
+//
+// Two sentences are duplicates if they have the same sequence of token ids,
+// and near duplicates if the Jaccard similarity of their sets of token ids is
+// at least a threshold. KLSum scores the sentences as bags of words, so the
+// order of the words does not matter for the latter.
+//
+// The duplicates are found by hashing the sequences of token ids. The
+// candidate near duplicates are found with a MinHash signature of each set of
+// ids, split in bands which are hashed too: the sentences which share the
+// hash of a band are likely to be similar, and their exact Jaccard similarity
+// is then computed. The probability for a pair of sentences with similarity s
+// to share a band is 1 - (1 - s^kMinHashRowsPerBand)^kMinHashBands, e.g. 0.98
+// for s = 0.8 and 0.56 for s = 0.6.
+
+#ifndef SUMMARIZER_DUPLICATES_H_
+#define SUMMARIZER_DUPLICATES_H_
+
+#include <vector>
+
+#include "summarizer/hash.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::vector;
+
+// Number of bands of the MinHash signatures, and number of min-hashes in each
+// band.
+static const int kMinHashBands = 8;
+static const int kMinHashRowsPerBand = 4;
+
+// Computes the MinHash signature of the set of token ids, which must not be
+// empty. The signature contains kMinHashBands * kMinHashRowsPerBand values.
+void ComputeMinHashSignature(const vector<int>& ids, vector<uint64>* signature);
+
+// Returns the Jaccard similarity of two sets of token ids sorted by increasing
+// id, i.e. the size of their intersection divided by the size of their union.
+double JaccardSimilarity(const vector<int>& a, const vector<int>& b);
+
+class DuplicateIndex {
+ public:
+  // Creates an empty index. The sentences whose sets of ids have a Jaccard
+  // similarity of at least min_similarity are near duplicates. If it is
+  // greater than 1, only the exact duplicates are found.
+  explicit DuplicateIndex(double min_similarity);
+
+  ~DuplicateIndex() {}
+
+  // Returns the index, in the order in which they were added, of a sentence of
+  // the index which is a duplicate of the given one, or else of the first one
+  // which is a near duplicate. If there is none, adds the sentence to the
+  // index and returns -1.
+  // The sentence is given as its sequence of token ids, which must not be
+  // empty.
+  int FindOrAdd(const vector<int>& token_ids);
+
+  // Returns the number of sentences in the index.
+  int size() const { return sequences_.size(); }
+
+ private:
+  // Returns a hash of the values.
+  static uint64 HashValues(const uint64* values, int size);
+
+  double min_similarity_;
+
+  // Sequences and sorted sets of ids of the sentences of the index.
+  vector<vector<int> > sequences_;
+  vector<vector<int> > id_sets_;
+
+  // Sentences of the index by hash of their sequence of ids, and by hash of
+  // each band of their signature.
+  hash_map<uint64, vector<int> > sequence_buckets_;
+  hash_map<uint64, vector<int> > band_buckets_[kMinHashBands];
+
+  DuplicateIndex(const DuplicateIndex&);
+  void operator=(const DuplicateIndex&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_DUPLICATES_H_
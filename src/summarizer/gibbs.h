@@ -26,7 +26,10 @@
 #include <utility>
 #include <vector>
 
+#include "summarizer/binary_file.h"
+#include "summarizer/random.h"
 #include "summarizer/scoped_ptr.h"
+#include "summarizer/types.h"
 
 namespace topicsum {
 
@@ -36,6 +39,16 @@ using std::vector;
 
 class GibbsSampler {
  public:
+  // Reason why Train stopped.
+  enum StopReason {
+    // All the iterations were done.
+    MAX_ITERATIONS,
+    // The likelihood converged (see set_convergence).
+    CONVERGED,
+    // The time budget was used up (see set_deadline_ms).
+    DEADLINE_EXCEEDED
+  };
+
   // Initializes Sampler for training. The user needs to specify:
   // - the number of burnin iterations during training
   // - the number of iterations during training
@@ -53,6 +66,16 @@ class GibbsSampler {
         burnin_(burnin),
         lag_(lag),
         track_likelihood_(track_likelihood),
+        deadline_ms_(0),
+        convergence_tolerance_(0),
+        convergence_window_(0),
+        min_iterations_(0),
+        stop_reason_(MAX_ITERATIONS),
+        checkpoint_interval_(0),
+        resume_(false),
+        seed_(0),
+        stream_(0),
+        random_(0),
         iteration_no_(-1),
         sum_count_(0)
         {}
@@ -64,6 +87,64 @@ class GibbsSampler {
   // each iteration.
   void Train();
 
+  // Sets the time budget of Train in milliseconds, or 0 for no budget. When
+  // the budget is used up, the sampling stops after the current iteration and
+  // the parameters are averaged over the samples collected so far. If no
+  // sample has been collected yet, e.g. during the burnin, the parameters are
+  // estimated from the current sample.
+  void set_deadline_ms(int64 deadline_ms) { deadline_ms_ = deadline_ms; }
+
+  // Sets the seed of the random generator and the stream of the seed used by
+  // the sampler, 0 by default. Train restarts the sequence of the seed, so
+  // that the same seed, stream and inputs always give the same topic
+  // assignments. Samplers which run concurrently, e.g. the chains of the same
+  // model, should use different streams of the seed.
+  void set_seed(uint64 seed, uint64 stream) {
+    seed_ = seed;
+    stream_ = stream;
+  }
+
+  // Enables early stopping when the tolerance is positive: Train stops once
+  // at least min_iterations iterations, including the burnin iterations, are
+  // done and the relative change of the likelihood over the last window
+  // estimations of the parameters is below the tolerance, i.e.
+  // |L_n - L_{n-window}| <= tolerance * |L_{n-window}|. The likelihood is then
+  // calculated and recorded at each estimation, even if track_likelihood is
+  // false. The number of iterations is the maximum.
+  void set_convergence(double tolerance, int window, int min_iterations) {
+    convergence_tolerance_ = tolerance;
+    convergence_window_ = window;
+    min_iterations_ = min_iterations;
+  }
+
+  // Saves a checkpoint of the complete state of the sampler to the file path
+  // every interval iterations of Train, including the burnin iterations, and
+  // when Train stops early because its time budget was used up. An interval
+  // of 0 disables the checkpoints. Each checkpoint replaces the previous one.
+  void set_checkpoint(const string& path, int interval) {
+    checkpoint_path_ = path;
+    checkpoint_interval_ = interval;
+  }
+
+  // Restores the state of the sampler from the checkpoint path, which must
+  // have been saved by a sampler of the same type with the same inputs. The
+  // next call to Train then resumes the sampling from the iteration of the
+  // checkpoint instead of starting over, and gives the same result as a run
+  // which was not interrupted, possibly with more iterations. Returns false
+  // if the file cannot be read, is corrupted or does not match the sampler.
+  bool RestoreCheckpoint(const string& path);
+
+  // Returns why the last call to Train stopped.
+  StopReason stop_reason() const { return stop_reason_; }
+
+  // Returns whether the last call to Train stopped before all the iterations
+  // were done because its time budget was used up.
+  bool deadline_exceeded() const { return stop_reason_ == DEADLINE_EXCEEDED; }
+
+  // Returns the number of iterations done by the last call to Train,
+  // including the burnin iterations.
+  int num_done_iterations() const { return iteration_no_; }
+
   // Returns a reference to a vector with the recorded model likelihoods.
   // The result is a pair <iteration_no, likelihood>
   const vector<pair<int, double> >& saved_likelihoods() const;
@@ -97,10 +178,31 @@ class GibbsSampler {
   // Multiplies model parameters to given value.
   virtual void MultiplyParams(double multiplier) = 0;
 
+  // Called at the end of Train once the parameters have been averaged, for
+  // samplers which accumulate them in another form.
+  virtual void FinishParams() {}
+
   // Calculates and returns the likelihood for the current model parameters.
   virtual double CalculateModelLikelihood() const = 0;
 
+  // Writes the state of the deriving sampler to a checkpoint, or returns false
+  // if it does not support checkpoints.
+  virtual bool SaveState(BinaryWriter* /* writer */) const { return false; }
+
+  // Reads the state written by SaveState, once Init has been called. Returns
+  // false if it does not match the sampler.
+  virtual bool RestoreState(BinaryReader* /* reader */) { return false; }
+
+  // Returns the random generator to draw the samples from.
+  Random* random() { return &random_; }
+
  private:
+  // Returns whether the likelihood has converged, for early stopping.
+  bool HasConverged() const;
+
+  // Saves a checkpoint to checkpoint_path_. Returns false on error.
+  bool SaveCheckpoint() const;
+
   // Number of iterations to perform.
   int iterations_;
 
@@ -115,6 +217,29 @@ class GibbsSampler {
   // every time the model parameters have been re-estimated.
   bool track_likelihood_;
 
+  // Time budget of Train in milliseconds, 0 if there is none.
+  int64 deadline_ms_;
+
+  // Parameters of the early stopping, disabled if the tolerance is 0.
+  double convergence_tolerance_;
+  int convergence_window_;
+  int min_iterations_;
+
+  // Why the last call to Train stopped.
+  StopReason stop_reason_;
+
+  // Checkpoints saved by Train, disabled if the interval is 0.
+  string checkpoint_path_;
+  int checkpoint_interval_;
+
+  // Whether the state was restored from a checkpoint for the next Train.
+  bool resume_;
+
+  // Seed and stream of the random generator.
+  uint64 seed_;
+  uint64 stream_;
+  Random random_;
+
   // Current iteration number. The number includes "normal" and "burnin"
   // iterations.
   int iteration_no_;
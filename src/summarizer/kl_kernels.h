@@ -0,0 +1,117 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Numerical kernels used to compute KL divergences.
+//
+// Every kernel is implemented for several instruction sets, and the best one
+// supported by the CPU is selected at runtime. Each implementation comes in
+// two flavors: the precise one calls the C library for every logarithm, while
+// the fast one uses a vectorized polynomial approximation which is accurate to
+// a few units in the last place. Since the calls to the C library cannot be
+// vectorized, the precise kernels computing logarithms are the scalar ones for
+// all instruction sets, and they give the same results. The results of the
+// fast kernels can differ in the last bits, as the sums are also accumulated
+// in a different order.
+
+#ifndef SUMMARIZER_KL_KERNELS_H_
+#define SUMMARIZER_KL_KERNELS_H_
+
+namespace topicsum {
+
+enum KernelIsa {
+  KERNEL_SCALAR = 0,
+  KERNEL_SSE2 = 1,
+  KERNEL_AVX2 = 2,
+  KERNEL_AVX512 = 3,
+
+  // This should always be the last value.
+  NUM_KERNEL_ISAS = 4
+};
+
+struct KLKernels {
+  // Name of the implementation, for debugging and benchmarks.
+  const char* name;
+
+  // Returns \sum_i weights[i] * log1p(values[i] / divisor).
+  double (*weighted_log1p_sum)(const double* weights,
+                               const double* values,
+                               int size,
+                               double divisor);
+
+  // Returns \sum_j weights[ids[j]] * (log1p((base[ids[j]] + values[j]) /
+  // divisor) - log1p(base[ids[j]] / divisor)), i.e. how much the weighted sum
+  // of logarithms increases when the sparse vector (ids, values) is added to
+  // the dense vector base.
+  double (*sparse_log1p_increase)(const int* ids,
+                                  const double* values,
+                                  int size,
+                                  const double* weights,
+                                  const double* base,
+                                  double divisor);
+
+  // Returns KL(a || q) with q_i = ((b_i + c_i) / sum + eps) / (1 + size eps),
+  // reading every vector once. c can be NULL, in which case it is considered
+  // to be zero. The entries where a_i is zero are skipped.
+  double (*kl_divergence)(const double* a,
+                          const double* b,
+                          const double* c,
+                          int size,
+                          double sum,
+                          double smoothing_factor);
+
+  // Adds (resp. subtracts) b to a, and returns the sum of the values of a
+  // after the update.
+  double (*add_vector)(double* a, const double* b, int size);
+  double (*subtract_vector)(double* a, const double* b, int size);
+};
+
+// Returns the best instruction set supported by the CPU.
+KernelIsa GetBestKernelIsa();
+
+// Returns the kernels implemented with the given instruction set, or NULL if
+// it is not supported by the CPU or by the compiler.
+const KLKernels* GetKLKernels(KernelIsa isa, bool fast_log);
+
+// Returns the kernels implemented with the best instruction set.
+const KLKernels& GetBestKLKernels(bool fast_log);
+
+// Sum accumulated with Kahan compensation, used when long sums of floats
+// would otherwise lose too much precision.
+template <typename T>
+class CompensatedSum {
+ public:
+  CompensatedSum() : sum_(0), compensation_(0) {}
+
+  void Add(T value) {
+    T compensated_value = value - compensation_;
+    T new_sum = sum_ + compensated_value;
+    compensation_ = (new_sum - sum_) - compensated_value;
+    sum_ = new_sum;
+  }
+
+  T value() const { return sum_; }
+
+ private:
+  T sum_;
+  T compensation_;
+};
+
+// Scalar versions of the approximations of log and log1p used by the fast
+// kernels. The arguments must be positive and finite, or zero for log1p.
+double FastLog(double x);
+double FastLog1p(double x);
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_KL_KERNELS_H_
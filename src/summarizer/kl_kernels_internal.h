@@ -0,0 +1,78 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Definitions shared by the scalar and the vectorized KL kernels. This header
+// should only be included by the kernel implementations.
+
+#ifndef SUMMARIZER_KL_KERNELS_INTERNAL_H_
+#define SUMMARIZER_KL_KERNELS_INTERNAL_H_
+
+#include "summarizer/kl_kernels.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+namespace internal {
+
+// Bit masks of the IEEE-754 double representation.
+static const uint64 kMantissaMask = ULONGLONG(0x000fffffffffffff);
+static const uint64 kOneBits = ULONGLONG(0x3ff0000000000000);
+
+// Adding the exponent bits to the representation of 2^52 converts them to a
+// double without 64-bit integer conversions, which SSE2 and AVX2 lack.
+static const uint64 kTwoPow52Bits = ULONGLONG(0x4330000000000000);
+static const double kTwoPow52PlusBias = 4503599627370496.0 + 1023;
+
+static const double kSqrt2 = 1.41421356237309504880;
+
+// log(2) split in a high part with trailing zeros and a low part.
+static const double kLn2Hi = 6.93147180369123816490e-01;
+static const double kLn2Lo = 1.90821492927058770002e-10;
+
+// Coefficients 1 / (2k + 1) of the atanh series used to compute log(m) for
+// m in [sqrt(2) / 2, sqrt(2)].
+static const int kNumLogCoefficients = 11;
+static const double kLogCoefficients[kNumLogCoefficients] = {
+  1.0, 1.0 / 3, 1.0 / 5, 1.0 / 7, 1.0 / 9, 1.0 / 11,
+  1.0 / 13, 1.0 / 15, 1.0 / 17, 1.0 / 19, 1.0 / 21
+};
+
+// Precise scalar kernels, see KLKernels.
+double PreciseWeightedLog1pSum(const double* weights,
+                               const double* values,
+                               int size,
+                               double divisor);
+double PreciseSparseLog1pIncrease(const int* ids,
+                                  const double* values,
+                                  int size,
+                                  const double* weights,
+                                  const double* base,
+                                  double divisor);
+double PreciseKLDivergence(const double* a,
+                           const double* b,
+                           const double* c,
+                           int size,
+                           double sum,
+                           double smoothing_factor);
+
+// Returns the best instruction set supported by the CPU and the compiler.
+KernelIsa DetectKernelIsa();
+
+// Returns the vectorized kernels for the given instruction set, or NULL if
+// they were not compiled in.
+const KLKernels* GetVectorKLKernels(KernelIsa isa, bool fast_log);
+
+}  // namespace internal
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_KL_KERNELS_INTERNAL_H_
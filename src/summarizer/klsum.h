@@ -24,52 +24,81 @@
 #ifndef SUMMARIZER_KLSUM_H_
 #define SUMMARIZER_KLSUM_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "summarizer/distribution.h"
 #include "summarizer/document.h"
+#include "summarizer/kl_kernels.h"
 #include "summarizer/postprocessor.h"
 #include "summarizer/scoped_ptr.h"
 #include "summarizer/sum.h"
+#include "summarizer/thread_pool.h"
 
 namespace topicsum {
 
-struct VectorDistribution {
+class Deadline;
+class KLSumWorkspace;
+
+// Adds (resp. subtracts) b to a, and returns the sum of the values of a after
+// the update.
+inline double AddToVector(double* a, const double* b, int size) {
+  return GetBestKLKernels(false).add_vector(a, b, size);
+}
+
+inline double SubtractFromVector(double* a, const double* b, int size) {
+  return GetBestKLKernels(false).subtract_vector(a, b, size);
+}
+
+inline double AddToVector(float* a, const float* b, int size) {
+  CompensatedSum<float> sum;
+  for (int i = 0; i < size; ++i) {
+    a[i] += b[i];
+    sum.Add(a[i]);
+  }
+  return sum.value();
+}
+
+inline double SubtractFromVector(float* a, const float* b, int size) {
+  CompensatedSum<float> sum;
+  for (int i = 0; i < size; ++i) {
+    a[i] -= b[i];
+    sum.Add(a[i]);
+  }
+  return sum.value();
+}
+
+// Dense distribution of words, with values of type T. Using float values
+// halves the memory used by the collection and summary distributions.
+template <typename T>
+struct BasicVectorDistribution {
  public:
-  explicit VectorDistribution(int vocabulary_size)
-      : distribution(new double[vocabulary_size]),
+  explicit BasicVectorDistribution(int vocabulary_size)
+      : distribution(new T[vocabulary_size]),
         length(vocabulary_size),
         sentence(NULL),
         document(NULL) {
     for (int i = 0; i < length; ++i) distribution[i] = 0;
   }
 
-  ~VectorDistribution() {
+  ~BasicVectorDistribution() {
     delete[] distribution;
   }
 
   // Adds values of other vector to current vector and returns the sum of values
   // in updated vector.
-  double AddVector(const VectorDistribution& other) {
-    double sum = 0.0;
-    for (int i = 0; i < length; ++i) {
-      distribution[i] += other.distribution[i];
-      sum += distribution[i];
-    }
-    return sum;
+  double AddVector(const BasicVectorDistribution& other) {
+    return AddToVector(distribution, other.distribution, length);
   }
 
   // Substracts values of other vector to current vector and returns the sum of
   // values in updated vector.
-  double SubstractVector(const VectorDistribution& other) {
-    double sum = 0.0;
-    for (int i = 0; i < length; ++i) {
-      distribution[i] -= other.distribution[i];
-      sum += distribution[i];
-    }
-    return sum;
+  double SubstractVector(const BasicVectorDistribution& other) {
+    return SubtractFromVector(distribution, other.distribution, length);
   }
 
   // Distribution of words in a topic, or in a summary.
-  double* distribution;
+  T* distribution;
 
   // Number of unique tokens in the vocabulary.
   int length;
@@ -80,10 +109,6 @@ struct VectorDistribution {
   // should not be used.
   int num_non_zero;
 
-  // This field is only used for the collection language model. It contains a
-  // weight threshold over which we have the top words in the distribution.
-  double top_words_threshold;
-
   // Sentence and document for which this vector corresponds. This is only
   // used for the sentences in the original documents, not for the collection
   // nor for the summary language models.
@@ -91,6 +116,56 @@ struct VectorDistribution {
   const Document* document;
 };
 
+typedef BasicVectorDistribution<double> VectorDistribution;
+typedef BasicVectorDistribution<float> FloatVectorDistribution;
+
+// Sparse counterpart of VectorDistribution, used to represent the sentences of
+// the collection. Only the tokens with a non-zero value are stored, sorted by
+// increasing token id.
+struct SparseDistribution {
+ public:
+  SparseDistribution()
+      : sum(0),
+        sentence(NULL),
+        document(NULL),
+        multiplicity(1) {}
+
+  // Replaces the content of the distribution with the frequencies of the given
+  // token ids. The vector is sorted in the process.
+  void AssignTokenIds(vector<int>* token_ids) {
+    ids.clear();
+    values.clear();
+    sum = token_ids->size();
+    std::sort(token_ids->begin(), token_ids->end());
+    for (uint i = 0; i < token_ids->size(); ++i) {
+      if (ids.empty() || ids.back() != (*token_ids)[i]) {
+        ids.push_back((*token_ids)[i]);
+        values.push_back(0);
+      }
+      values.back()++;
+    }
+  }
+
+  // Number of tokens with a non-zero value.
+  int size() const { return ids.size(); }
+
+  // Ids of the tokens with a non-zero value, and their values.
+  vector<int> ids;
+  vector<double> values;
+
+  // Sum of all the values.
+  double sum;
+
+  // Sentence and document for which this vector corresponds. When duplicates
+  // are collapsed, they are the first occurrence of the sentence.
+  const Sentence* sentence;
+  const Document* document;
+
+  // Number of sentences of the collection represented by this vector, i.e. 1
+  // plus the number of duplicates collapsed into it.
+  int multiplicity;
+};
+
 class KLSum : public Summarizer {
  public:
   // KLSum minimizes an objective function, kMaxCost defines a large positive
@@ -99,12 +174,9 @@ class KLSum : public Summarizer {
   // For example, if we want to impose that a sentence contains the query entity
   // we can assign to that sentence this value.
   static const float kMaxCost;
-  KLSum() : coll_distri_(NULL),
-            output_debug_(NULL),
-            redundancy_removal_(true),
-            postprocessor_(NULL) {}
+  KLSum();
 
-  virtual ~KLSum() {}
+  virtual ~KLSum();
 
   bool Init(const DocumentCollection& collection,
             const SummarizerOptions& options);
@@ -112,6 +184,13 @@ class KLSum : public Summarizer {
   bool Summarize(const SummaryOptions& options,
                  Document* summary);
 
+  // Summarizes the collection for options.length and for every
+  // options.additional_length, in this order, with a single greedy pass. The
+  // summaries are the same as the ones returned by Summarize for each length.
+  // Returns false if the collection could not be summarized.
+  bool SummarizeMultipleLengths(const SummaryOptions& options,
+                                vector<Document>* summaries);
+
   // Returns whether a collection distribution has already been initialized.
   bool HasCollectionDistribution() {
     return coll_distri_.get() != NULL;
@@ -126,7 +205,7 @@ class KLSum : public Summarizer {
  protected:
   // Calculates the token distribution of the collection provided
   // as an input to the Summarize function. The function is automatically
-  // called by the Summarize.
+  // called by the first call to Summarize after Init.
   // Returns false if an error happened.
   virtual bool CalculateCollectionDistribution(const DocumentCollection& coll);
 
@@ -138,15 +217,85 @@ class KLSum : public Summarizer {
   DocumentCollection collection_;
 
  private:
+  // Summary grown for some of the requested lengths. Defined in klsum.cc.
+  struct SummaryPath;
+
+  // Summarizes the collection for every length, storing the result in the
+  // summary with the same index.
+  bool SummarizeLengths(const SummaryOptions& options,
+                        const vector<SummaryLength>& lengths,
+                        const vector<Document*>& summaries);
+
   // Summarize by selecting one by one the sentences that will be chosen for the
   // summary. Two different strategies are implemented by this function:
   // greedily growing the summary one sentence at a time, or simply ranking the
   // sentences once based on their divergence with the collection distribution.
+  // The candidates are read from the workspace. The summaries of all the
+  // lengths are grown together, until the redundancy removal, whose top words
+  // depend on the length, disagrees on a candidate.
   virtual bool SummarizeIncremental(
-      const DocumentCollection& collection,
-      const SummaryOptions& options,
+      const vector<SummaryLength>& lengths,
       KLSumOptions::OptimizationStrategy strategy,
-      Document* summary);
+      bool generate_debug,
+      const vector<Document*>& summaries);
+
+  // Implementation of SummarizeIncremental, storing the collection and summary
+  // distributions with values of type T.
+  template <typename T>
+  bool SelectSentences(const vector<SummaryLength>& lengths,
+                       KLSumOptions::OptimizationStrategy strategy,
+                       bool generate_debug,
+                       const vector<Document*>& summaries);
+
+  // Ranks the candidates by increasing divergence with the collection, and
+  // adds them in this order to the summaries until their lengths are reached.
+  // The candidates are scored in parallel, and the ranking is only sorted as
+  // far as needed.
+  template <typename T>
+  void RankSentences(const BasicVectorDistribution<T>& collection,
+                     const vector<SummaryLength>& lengths,
+                     bool generate_debug,
+                     const vector<Document*>& summaries);
+
+  // Returns the number of candidates in the first sorted batch of the
+  // ranking, i.e. an estimate of the number of sentences needed to reach the
+  // longest of the lengths.
+  uint RankingBatchSize(const vector<SummaryLength>& lengths) const;
+
+  // Grows the summary of the path until all its lengths are reached. The paths
+  // which diverge from it are appended to forked_paths.
+  template <typename T>
+  void GrowSummaryPath(const BasicVectorDistribution<T>& collection,
+                       const vector<SummaryLength>& lengths,
+                       const vector<double>& top_words_thresholds,
+                       KLSumOptions::OptimizationStrategy strategy,
+                       bool generate_debug,
+                       SummaryPath* path,
+                       vector<SummaryPath*>* forked_paths,
+                       const vector<Document*>& summaries);
+
+  // Adds the candidate with the given index to the summary of the path, unless
+  // it is redundant or filtered out by the postprocessor, and removes it from
+  // the candidates. Returns whether the sentence was added.
+  bool AddCandidate(int index, double score, bool redundant,
+                    const string& redundancy_debug, SummaryPath* path);
+
+  // Stores the summary of the path for the lengths which are reached, or for
+  // all the lengths if all_lengths is true, and removes them from the path.
+  // The number of candidate evaluations is added to their debug output if
+  // add_num_evaluations is true.
+  void FinishLengths(const vector<SummaryLength>& lengths,
+                     bool all_lengths,
+                     bool add_num_evaluations,
+                     SummaryPath* path,
+                     const vector<Document*>& summaries);
+
+  // If the time budget of the current call to Summarize is used up, marks the
+  // summary of the path as incomplete, stores it for all the lengths of the
+  // path and returns true.
+  bool FinishLengthsIfOutOfTime(const vector<SummaryLength>& lengths,
+                                SummaryPath* path,
+                                const vector<Document*>& summaries);
 
   // If there is a postprocessor, invokes it on the sentence before adding it to
   // the summary. Returns a pointer to the added summary sentence if a sentence
@@ -164,9 +313,31 @@ class KLSum : public Summarizer {
   // to be generated.
   string* output_debug_;
 
+  // Time budget of the current call to Summarize, NULL outside of it.
+  const Deadline* deadline_;
+
   bool redundancy_removal_;
   bool sentence_position_;
 
+  // If true, use the lazy greedy queue to select the summary sentences.
+  bool lazy_evaluation_;
+
+  // If true, use the fast approximation of the logarithm.
+  bool fast_log_;
+
+  // Type of the values of the dense distributions.
+  KLSumOptions::Precision precision_;
+
+  // If true, the duplicate candidates are collapsed.
+  bool collapse_duplicates_;
+
+  // Lexicon, candidate sentences and collection vector, built once after each
+  // call to Init and reused by the calls to Summarize.
+  scoped_ptr<KLSumWorkspace> workspace_;
+
+  // Threads used to score the candidate sentences.
+  scoped_ptr<ThreadPool> thread_pool_;
+
   scoped_ptr<Postprocessor> postprocessor_;
 
   KLSumOptions::OptimizationStrategy strategy_;
@@ -0,0 +1,145 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Incremental scoring of the candidate sentences in KLSum.
+//
+// KLSum scores a candidate sentence s given the current summary S as the
+// divergence KL(C || S+s) between the collection distribution C and the
+// smoothed, normalized distribution of S+s:
+//
+//   KL = \sum_{i: c_i > 0} c_i log(c_i / q_i)
+//   q_i = ((S_i + s_i) / N + eps) / (1 + V * eps)
+//
+// where N is the number of tokens in S+s and V the vocabulary size. Expanding
+// the logarithm, all the words that appear neither in S nor in s contribute
+// c_i * log(eps), which does not depend on the candidate. The divergence can
+// then be computed as a constant, minus a term that only depends on the words
+// of S and on N, minus a correction over the words of s. The first term is
+// cached for every candidate length after each update of the summary, so that
+// scoring a candidate only requires to iterate over its non-zero entries.
+//
+// The scorer is templated on the type of the values of the dense collection
+// and summary distributions. With float values, the logarithms are computed
+// in single precision by scalar loops, and the long sums are compensated.
+
+#ifndef SUMMARIZER_KLSUM_SCORER_H_
+#define SUMMARIZER_KLSUM_SCORER_H_
+
+#include <vector>
+
+#include "summarizer/kl_kernels.h"
+#include "summarizer/klsum.h"
+
+namespace topicsum {
+
+using std::vector;
+
+// Returns the divergence KL(distriA || distriB), where distriB is smoothed with
+// the given smoothing factor. This is the dense reference implementation used
+// by KLSum before the incremental scorer was introduced. It uses the precise
+// kernels of the best instruction set.
+double CalculateKLDivergence(const VectorDistribution& distriA,
+                             const VectorDistribution& distriB,
+                             double smoothing_factor);
+
+template <typename T>
+class BasicKLSumScorer {
+ public:
+  // Creates a scorer for an empty summary. The collection distribution has to
+  // be normalized and must outlive the scorer. The kernels are used to compute
+  // the logarithms of the scores when T is double, and they are ignored when T
+  // is float.
+  BasicKLSumScorer(const BasicVectorDistribution<T>& collection,
+                   double smoothing_factor,
+                   const KLKernels& kernels);
+
+  ~BasicKLSumScorer() {}
+
+  // Declares that candidates with the given sum of values will be scored. It
+  // has to be called for every candidate length before calling Score.
+  void AddCandidateLength(double length);
+
+  // Returns the divergence between the collection and the summary obtained
+  // by adding the candidate to the current summary. This function is
+  // thread-compatible: it does not modify the scorer.
+  //
+  // The score is LengthScore(candidate.sum) - Correction(candidate).
+  double Score(const SparseDistribution& candidate) const {
+    return LengthScore(candidate.sum) - Correction(candidate);
+  }
+
+  // Returns the part of the score that only depends on the length of the
+  // candidate, i.e. the divergence obtained if the candidate only contained
+  // words which are not in the collection.
+  double LengthScore(double length) const;
+
+  // Returns the part of the score that depends on the words of the candidate.
+  // It is non-negative, and it can only decrease when sentences are added to
+  // the summary.
+  double Correction(const SparseDistribution& candidate) const;
+
+  // Adds a sentence to the current summary.
+  void AddSentence(const SparseDistribution& sentence);
+
+  // Returns the frequency distribution of words in the current summary.
+  const BasicVectorDistribution<T>& summary() const { return summary_; }
+
+  // Returns the number of tokens in the current summary.
+  double summary_sum() const { return summary_sum_; }
+
+ private:
+  // Recalculates the cached contribution of the summary words for all the
+  // candidate lengths.
+  void UpdateCachedTerms();
+
+  // Returns the contribution of the summary words when the summary is extended
+  // with a candidate containing length tokens.
+  double CalculateSummaryTerm(double length) const;
+
+  // Collection distribution.
+  const BasicVectorDistribution<T>& collection_;
+
+  const KLKernels& kernels_;
+
+  // Smoothing factor applied to the summary distribution.
+  double smoothing_factor_;
+
+  // Part of the divergence which does not depend on the summary.
+  double constant_;
+
+  // Frequency distribution of the words in the summary, and its sum.
+  BasicVectorDistribution<T> summary_;
+  double summary_sum_;
+
+  // Words in the summary which have a non-zero collection value, and their
+  // collection and summary values packed in the same order, so that the
+  // summary terms can be computed with contiguous loads.
+  vector<int> summary_support_;
+  vector<T> support_collection_values_;
+  vector<T> support_summary_values_;
+
+  // Candidate lengths which have been declared, and the cached contribution of
+  // the summary words indexed by candidate length.
+  vector<int> candidate_lengths_;
+  vector<double> summary_terms_;
+
+  BasicKLSumScorer(const BasicKLSumScorer&);
+  void operator=(const BasicKLSumScorer&);
+};
+
+typedef BasicKLSumScorer<double> KLSumScorer;
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_KLSUM_SCORER_H_
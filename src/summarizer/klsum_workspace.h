@@ -0,0 +1,136 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Prepared collection reused by the successive calls to KLSum::Summarize.
+//
+// The lexicon and the sparse distributions of the candidate sentences only
+// depend on the collection, and the dense collection vector only depends on
+// the collection distribution. They are built once, so that summarizing the
+// same collection with several lengths only recomputes the state which
+// depends on the length, i.e. the top words used for redundancy removal and
+// the summary itself.
+
+#ifndef SUMMARIZER_KLSUM_WORKSPACE_H_
+#define SUMMARIZER_KLSUM_WORKSPACE_H_
+
+#include <vector>
+
+#include "summarizer/distribution.h"
+#include "summarizer/document.h"
+#include "summarizer/klsum.h"
+#include "summarizer/lexicon.h"
+#include "summarizer/scoped_ptr.h"
+
+namespace topicsum {
+
+using std::vector;
+
+class Postprocessor;
+
+class KLSumWorkspace {
+ public:
+  // Builds the lexicon and the candidate sentences of the collection. The
+  // sentences without tokens, and the ones which are not valid for the
+  // postprocessor if it is not NULL, are not candidates. The collection must
+  // outlive the workspace.
+  KLSumWorkspace(const DocumentCollection& collection,
+                 const Postprocessor* postprocessor);
+
+  ~KLSumWorkspace();
+
+  // Collapses the candidate sentences which are duplicates or near duplicates
+  // of an earlier candidate into it, increasing its multiplicity. The near
+  // duplicates are the candidates whose sets of tokens have a Jaccard
+  // similarity of at least min_similarity; if it is greater than 1, only the
+  // exact duplicates are collapsed. It must be called before the candidates
+  // are used.
+  void CollapseDuplicates(double min_similarity);
+
+  // Returns the number of candidate sentences before CollapseDuplicates.
+  int num_uncollapsed_sentences() const { return num_uncollapsed_sentences_; }
+
+  // Sets the collection distribution. Only the tokens of the lexicon with a
+  // positive value are kept. Discards the collection vectors built for a
+  // previous distribution.
+  void SetCollectionDistribution(const Distribution& distribution);
+
+  // Returns whether SetCollectionDistribution has been called.
+  bool has_collection_distribution() const {
+    return has_collection_distribution_;
+  }
+
+  // Returns the sum of the values of the collection distribution over the
+  // tokens of the lexicon.
+  double collection_sum() const { return collection_sum_; }
+
+  // Returns the normalized collection vector with values of type T, building
+  // it on the first call. The collection distribution must be set and
+  // non-empty.
+  template <typename T>
+  const BasicVectorDistribution<T>& GetCollectionVector();
+
+  // Returns the threshold over which the values of the collection vector with
+  // values of type T are the num_top_words words with the largest values. The
+  // top words are decided on the double values, so that they do not depend on
+  // T.
+  template <typename T>
+  double GetTopWordsThreshold(int num_top_words) const;
+
+  const Lexicon& lexicon() const { return lexicon_; }
+
+  // Candidate sentences, with the position of each sentence in its document
+  // (starting at 1) and its prior score.
+  const vector<SparseDistribution*>& sentences() const { return sentences_; }
+  const vector<int>& doc_positions() const { return doc_positions_; }
+  const vector<int>& prior_scores() const { return prior_scores_; }
+
+ private:
+  // Returns the cached collection vector with values of the type of the
+  // argument.
+  scoped_ptr<VectorDistribution>* collection_vector(double) {
+    return &collection_vector_;
+  }
+  scoped_ptr<FloatVectorDistribution>* collection_vector(float) {
+    return &float_collection_vector_;
+  }
+
+  Lexicon lexicon_;
+
+  vector<SparseDistribution*> sentences_;
+  vector<int> doc_positions_;
+  vector<int> prior_scores_;
+  int num_uncollapsed_sentences_;
+
+  // Ids and values of the tokens of the lexicon with a positive value in the
+  // collection distribution, and the sum of these values.
+  bool has_collection_distribution_;
+  vector<int> collection_ids_;
+  vector<double> collection_values_;
+  double collection_sum_;
+
+  // Values of the collection distribution sorted by increasing value, before
+  // and after normalization.
+  vector<double> sorted_values_;
+  vector<double> sorted_normalized_values_;
+
+  scoped_ptr<VectorDistribution> collection_vector_;
+  scoped_ptr<FloatVectorDistribution> float_collection_vector_;
+
+  KLSumWorkspace(const KLSumWorkspace&);
+  void operator=(const KLSumWorkspace&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_KLSUM_WORKSPACE_H_
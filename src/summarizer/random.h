@@ -0,0 +1,81 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Seedable pseudo-random number generator owned by its user, e.g. a sampler,
+// so that concurrent users in one process neither share nor lock any global
+// state. It implements xoshiro256** (Blackman and Vigna, 2018), whose state is
+// seeded with splitmix64. The same seed and stream always give the same
+// sequence.
+
+#ifndef SUMMARIZER_RANDOM_H_
+#define SUMMARIZER_RANDOM_H_
+
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+class Random {
+ public:
+  // Creates a generator for the given seed and stream. The streams of a seed
+  // are non-overlapping subsequences of 2^128 values of its sequence, so that
+  // e.g. each thread or chain can use its own stream. Creating the generator
+  // takes a time linear in the stream number.
+  explicit Random(uint64 seed, uint64 stream = 0);
+
+  // Restarts the sequence of the given seed and stream.
+  void Reset(uint64 seed, uint64 stream);
+
+  // Returns the next 64 random bits.
+  uint64 Next();
+
+  // Fills values with num_values doubles drawn uniformly in [0, 1).
+  void FillUniform(double* values, int num_values);
+
+  // Returns the next double drawn uniformly in [0, 1). The values are
+  // generated in batches of kUniformBatchSize.
+  double Uniform() {
+    if (next_uniform_ == kUniformBatchSize) {
+      FillUniform(uniforms_, kUniformBatchSize);
+      next_uniform_ = 0;
+    }
+    return uniforms_[next_uniform_++];
+  }
+
+  static const int kUniformBatchSize = 256;
+
+  // Number of 64-bit words of the state saved by GetState.
+  static const int kStateSize = 4 + kUniformBatchSize + 1;
+
+  // Stores the complete state of the generator in the kStateSize words of
+  // state, including the uniform values of the current batch, so that a
+  // generator restored with SetState continues the same sequence.
+  void GetState(uint64* state) const;
+  void SetState(const uint64* state);
+
+ private:
+  // Advances the state by 2^128 values.
+  void Jump();
+
+  uint64 state_[4];
+
+  // Batch of uniform values, of which the ones from next_uniform_ have not
+  // been returned yet.
+  double uniforms_[kUniformBatchSize];
+  int next_uniform_;
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_RANDOM_H_
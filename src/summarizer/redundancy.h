@@ -23,14 +23,16 @@ namespace topicsum {
 
 // Trivial implementation of redundancy detection. Given the words that
 // have already selected for the summary, the words that are highly relevant
-// in the collection model, and a new sentence, the sentence is considered
-// redundant it if either:
+// in the collection model (the ones with a value over top_words_threshold),
+// and a new sentence, the sentence is considered redundant it if either:
 // - Does not add to the summary enough new collection words.
 // - The percentage of sentence words that are new collection words in the
 //   summary is less than a certain percentage of the sentence.
-bool IsRedundant(const VectorDistribution& summary,
-                 const VectorDistribution& collection,
-                 const VectorDistribution& new_sentence,
+template <typename T>
+bool IsRedundant(const BasicVectorDistribution<T>& summary,
+                 const BasicVectorDistribution<T>& collection,
+                 double top_words_threshold,
+                 const SparseDistribution& new_sentence,
                  string* debug);
 
 }  // namespace topicsum
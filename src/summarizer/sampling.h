@@ -15,21 +15,22 @@
 
 // Functions for generating random values for various types of distributions.
 //
-// Some of these functions depend on the random function in <math.h>, but do not
-// set the seed themselves. So srandom should be called before calling the
-// functions.
+// The functions draw their values from the given generator, so that the
+// callers decide on the seed and do not share any global state.
 
 #ifndef SUMMARIZER_SAMPLING_H_
 #define SUMMARIZER_SAMPLING_H_
 
 namespace topicsum {
 
+class Random;
+
 // Returns a value between 0..K-1, randomly sampled with uniform probability.
-int SampleUniform(int K);
+int SampleUniform(int K, Random* random);
 
 // Returns a value between 0..distri_size-1, sampled from the multinomial
 // distribution distri.
-int SampleMulti(const double* distri, int distri_size);
+int SampleMulti(const double* distri, int distri_size, Random* random);
 
 }  // namespace topicsum
 
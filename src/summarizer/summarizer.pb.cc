@@ -1,2906 +1,3709 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: summarizer/summarizer.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "summarizer/summarizer.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace topicsum {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Article_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Article_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SummaryOptions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SummaryOptions_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SummaryLength_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SummaryLength_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* SummaryLength_LengthUnit_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* GibbsSamplingOptions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  GibbsSamplingOptions_reflection_ = NULL;
-const ::google::protobuf::Descriptor* KLSumOptions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  KLSumOptions_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* KLSumOptions_OptimizationStrategy_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* TopicSumOptions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  TopicSumOptions_reflection_ = NULL;
-const ::google::protobuf::Descriptor* NewsPostProcessorOptions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  NewsPostProcessorOptions_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SummarizerOptions_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SummarizerOptions_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* SummarizerOptions_SummaryType_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto() {
-  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "summarizer/summarizer.proto");
-  GOOGLE_CHECK(file != NULL);
-  Article_descriptor_ = file->message_type(0);
-  static const int Article_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Article, content_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Article, score_),
+namespace topicsum {
+PROTOBUF_CONSTEXPR Article::Article(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.score_)*/{}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ArticleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArticleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArticleDefaultTypeInternal() {}
+  union {
+    Article _instance;
   };
-  Article_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Article_descriptor_,
-      Article::default_instance_,
-      Article_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Article, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Article, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Article));
-  SummaryOptions_descriptor_ = file->message_type(1);
-  static const int SummaryOptions_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryOptions, length_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryOptions, generate_debug_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArticleDefaultTypeInternal _Article_default_instance_;
+PROTOBUF_CONSTEXPR SummaryOptions::SummaryOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.additional_length_)*/{}
+  , /*decltype(_impl_.length_)*/nullptr
+  , /*decltype(_impl_.deadline_ms_)*/int64_t{0}
+  , /*decltype(_impl_.generate_debug_)*/false} {}
+struct SummaryOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SummaryOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SummaryOptionsDefaultTypeInternal() {}
+  union {
+    SummaryOptions _instance;
   };
-  SummaryOptions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SummaryOptions_descriptor_,
-      SummaryOptions::default_instance_,
-      SummaryOptions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryOptions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryOptions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SummaryOptions));
-  SummaryLength_descriptor_ = file->message_type(2);
-  static const int SummaryLength_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryLength, unit_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryLength, length_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SummaryOptionsDefaultTypeInternal _SummaryOptions_default_instance_;
+PROTOBUF_CONSTEXPR SummaryLength::SummaryLength(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.unit_)*/0
+  , /*decltype(_impl_.length_)*/0} {}
+struct SummaryLengthDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SummaryLengthDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SummaryLengthDefaultTypeInternal() {}
+  union {
+    SummaryLength _instance;
   };
-  SummaryLength_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SummaryLength_descriptor_,
-      SummaryLength::default_instance_,
-      SummaryLength_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryLength, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummaryLength, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SummaryLength));
-  SummaryLength_LengthUnit_descriptor_ = SummaryLength_descriptor_->enum_type(0);
-  GibbsSamplingOptions_descriptor_ = file->message_type(3);
-  static const int GibbsSamplingOptions_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GibbsSamplingOptions, iterations_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GibbsSamplingOptions, burnin_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GibbsSamplingOptions, lag_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GibbsSamplingOptions, track_likelihood_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SummaryLengthDefaultTypeInternal _SummaryLength_default_instance_;
+PROTOBUF_CONSTEXPR GibbsSamplingOptions::GibbsSamplingOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.checkpoint_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.deadline_ms_)*/int64_t{0}
+  , /*decltype(_impl_.seed_)*/uint64_t{0u}
+  , /*decltype(_impl_.burnin_)*/0
+  , /*decltype(_impl_.track_likelihood_)*/false
+  , /*decltype(_impl_.resume_from_checkpoint_)*/false
+  , /*decltype(_impl_.convergence_tolerance_)*/0
+  , /*decltype(_impl_.min_iterations_)*/0
+  , /*decltype(_impl_.checkpoint_interval_)*/0
+  , /*decltype(_impl_.num_chains_)*/1
+  , /*decltype(_impl_.iterations_)*/500
+  , /*decltype(_impl_.lag_)*/10
+  , /*decltype(_impl_.num_threads_)*/1
+  , /*decltype(_impl_.convergence_window_)*/5} {}
+struct GibbsSamplingOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GibbsSamplingOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GibbsSamplingOptionsDefaultTypeInternal() {}
+  union {
+    GibbsSamplingOptions _instance;
   };
-  GibbsSamplingOptions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      GibbsSamplingOptions_descriptor_,
-      GibbsSamplingOptions::default_instance_,
-      GibbsSamplingOptions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GibbsSamplingOptions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GibbsSamplingOptions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(GibbsSamplingOptions));
-  KLSumOptions_descriptor_ = file->message_type(4);
-  static const int KLSumOptions_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, optimization_strategy_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, redundancy_removal_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, sentence_position_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, summary_weight_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, prior_weight_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, postprocessor_name_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GibbsSamplingOptionsDefaultTypeInternal _GibbsSamplingOptions_default_instance_;
+PROTOBUF_CONSTEXPR KLSumOptions::KLSumOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.postprocessor_name_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.optimization_strategy_)*/0
+  , /*decltype(_impl_.redundancy_removal_)*/false
+  , /*decltype(_impl_.sentence_position_)*/false
+  , /*decltype(_impl_.lazy_evaluation_)*/false
+  , /*decltype(_impl_.fast_log_)*/false
+  , /*decltype(_impl_.prior_weight_)*/0
+  , /*decltype(_impl_.precision_)*/0
+  , /*decltype(_impl_.collapse_duplicates_)*/false
+  , /*decltype(_impl_.summary_weight_)*/1
+  , /*decltype(_impl_.num_threads_)*/1
+  , /*decltype(_impl_.near_duplicate_similarity_)*/0.8} {}
+struct KLSumOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR KLSumOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~KLSumOptionsDefaultTypeInternal() {}
+  union {
+    KLSumOptions _instance;
   };
-  KLSumOptions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      KLSumOptions_descriptor_,
-      KLSumOptions::default_instance_,
-      KLSumOptions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(KLSumOptions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(KLSumOptions));
-  KLSumOptions_OptimizationStrategy_descriptor_ = KLSumOptions_descriptor_->enum_type(0);
-  TopicSumOptions_descriptor_ = file->message_type(5);
-  static const int TopicSumOptions_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopicSumOptions, gibbs_sampling_options_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopicSumOptions, lambda_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopicSumOptions, gamma_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KLSumOptionsDefaultTypeInternal _KLSumOptions_default_instance_;
+PROTOBUF_CONSTEXPR TopicSumOptions::TopicSumOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.lambda_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gamma_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.background_model_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gibbs_sampling_options_)*/nullptr
+  , /*decltype(_impl_.inference_)*/0
+  , /*decltype(_impl_.cvb0_iterations_)*/50
+  , /*decltype(_impl_.batch_num_threads_)*/1} {}
+struct TopicSumOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopicSumOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopicSumOptionsDefaultTypeInternal() {}
+  union {
+    TopicSumOptions _instance;
   };
-  TopicSumOptions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      TopicSumOptions_descriptor_,
-      TopicSumOptions::default_instance_,
-      TopicSumOptions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopicSumOptions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopicSumOptions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(TopicSumOptions));
-  NewsPostProcessorOptions_descriptor_ = file->message_type(6);
-  static const int NewsPostProcessorOptions_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NewsPostProcessorOptions, min_sentence_length_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NewsPostProcessorOptions, max_sentence_length_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopicSumOptionsDefaultTypeInternal _TopicSumOptions_default_instance_;
+PROTOBUF_CONSTEXPR NewsPostProcessorOptions::NewsPostProcessorOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_sentence_length_)*/0
+  , /*decltype(_impl_.max_sentence_length_)*/0} {}
+struct NewsPostProcessorOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NewsPostProcessorOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NewsPostProcessorOptionsDefaultTypeInternal() {}
+  union {
+    NewsPostProcessorOptions _instance;
   };
-  NewsPostProcessorOptions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      NewsPostProcessorOptions_descriptor_,
-      NewsPostProcessorOptions::default_instance_,
-      NewsPostProcessorOptions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NewsPostProcessorOptions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(NewsPostProcessorOptions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(NewsPostProcessorOptions));
-  SummarizerOptions_descriptor_ = file->message_type(7);
-  static const int SummarizerOptions_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, summary_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, klsum_options_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, topicsum_options_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, article_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, news_postprocessor_options_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NewsPostProcessorOptionsDefaultTypeInternal _NewsPostProcessorOptions_default_instance_;
+PROTOBUF_CONSTEXPR SummarizerOptions::SummarizerOptions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.article_)*/{}
+  , /*decltype(_impl_.klsum_options_)*/nullptr
+  , /*decltype(_impl_.topicsum_options_)*/nullptr
+  , /*decltype(_impl_.news_postprocessor_options_)*/nullptr
+  , /*decltype(_impl_.summary_type_)*/1} {}
+struct SummarizerOptionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SummarizerOptionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SummarizerOptionsDefaultTypeInternal() {}
+  union {
+    SummarizerOptions _instance;
   };
-  SummarizerOptions_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SummarizerOptions_descriptor_,
-      SummarizerOptions::default_instance_,
-      SummarizerOptions_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SummarizerOptions, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SummarizerOptions));
-  SummarizerOptions_SummaryType_descriptor_ = SummarizerOptions_descriptor_->enum_type(0);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_summarizer_2fsummarizer_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Article_descriptor_, &Article::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SummaryOptions_descriptor_, &SummaryOptions::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SummaryLength_descriptor_, &SummaryLength::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    GibbsSamplingOptions_descriptor_, &GibbsSamplingOptions::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    KLSumOptions_descriptor_, &KLSumOptions::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    TopicSumOptions_descriptor_, &TopicSumOptions::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    NewsPostProcessorOptions_descriptor_, &NewsPostProcessorOptions::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SummarizerOptions_descriptor_, &SummarizerOptions::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto() {
-  delete Article::default_instance_;
-  delete Article_reflection_;
-  delete SummaryOptions::default_instance_;
-  delete SummaryOptions_reflection_;
-  delete SummaryLength::default_instance_;
-  delete SummaryLength_reflection_;
-  delete GibbsSamplingOptions::default_instance_;
-  delete GibbsSamplingOptions_reflection_;
-  delete KLSumOptions::default_instance_;
-  delete KLSumOptions_reflection_;
-  delete KLSumOptions::_default_postprocessor_name_;
-  delete TopicSumOptions::default_instance_;
-  delete TopicSumOptions_reflection_;
-  delete TopicSumOptions::_default_lambda_;
-  delete TopicSumOptions::_default_gamma_;
-  delete NewsPostProcessorOptions::default_instance_;
-  delete NewsPostProcessorOptions_reflection_;
-  delete SummarizerOptions::default_instance_;
-  delete SummarizerOptions_reflection_;
-}
-
-void protobuf_AddDesc_summarizer_2fsummarizer_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::topicsum::protobuf_AddDesc_summarizer_2fdocument_2eproto();
-  ::topicsum::protobuf_AddDesc_summarizer_2fdistribution_2eproto();
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\033summarizer/summarizer.proto\022\010topicsum\032"
-    "\031summarizer/document.proto\032\035summarizer/d"
-    "istribution.proto\")\n\007Article\022\017\n\007content\030"
-    "\001 \001(\t\022\r\n\005score\030\002 \003(\002\"X\n\016SummaryOptions\022\'"
-    "\n\006length\030\001 \001(\0132\027.topicsum.SummaryLength\022"
-    "\035\n\016generate_debug\030\010 \001(\010:\005false\"\235\001\n\rSumma"
-    "ryLength\0220\n\004unit\030\001 \002(\0162\".topicsum.Summar"
-    "yLength.LengthUnit\022\016\n\006length\030\002 \002(\005\"J\n\nLe"
-    "ngthUnit\022\r\n\tCHARACTER\020\000\022\t\n\005TOKEN\020\001\022\014\n\010SE"
-    "NTENCE\020\002\022\024\n\020NUM_LENGTH_UNITS\020\003\"t\n\024GibbsS"
-    "amplingOptions\022\027\n\niterations\030\001 \001(\005:\003500\022"
-    "\021\n\006burnin\030\002 \001(\005:\0010\022\017\n\003lag\030\003 \001(\005:\00210\022\037\n\020t"
-    "rack_likelihood\030\004 \001(\010:\005false\"\365\002\n\014KLSumOp"
-    "tions\022_\n\025optimization_strategy\030\001 \001(\0162+.t"
-    "opicsum.KLSumOptions.OptimizationStrateg"
-    "y:\023GREEDY_OPTIMIZATION\022!\n\022redundancy_rem"
-    "oval\030\002 \001(\010:\005false\022 \n\021sentence_position\030\003"
-    " \001(\010:\005false\022\031\n\016summary_weight\030\005 \001(\002:\0011\022\027"
-    "\n\014prior_weight\030\006 \001(\002:\0010\022-\n\022postprocessor"
-    "_name\030\007 \001(\t:\021NewsPostprocessor\"\\\n\024Optimi"
-    "zationStrategy\022\027\n\023GREEDY_OPTIMIZATION\020\000\022"
-    "\024\n\020SENTENCE_RANKING\020\001\022\025\n\021NUM_OPTIMIZATIO"
-    "NS\020\002\"\201\001\n\017TopicSumOptions\022>\n\026gibbs_sampli"
-    "ng_options\030\002 \001(\0132\036.topicsum.GibbsSamplin"
-    "gOptions\022\027\n\006lambda\030\003 \001(\t:\0070.1,1,1\022\025\n\005gam"
-    "ma\030\004 \001(\t:\0061,5,10\"T\n\030NewsPostProcessorOpt"
-    "ions\022\033\n\023min_sentence_length\030\001 \001(\005\022\033\n\023max"
-    "_sentence_length\030\002 \001(\005\"\325\002\n\021SummarizerOpt"
-    "ions\022=\n\014summary_type\030\001 \002(\0162\'.topicsum.Su"
-    "mmarizerOptions.SummaryType\022-\n\rklsum_opt"
-    "ions\030\002 \001(\0132\026.topicsum.KLSumOptions\0223\n\020to"
-    "picsum_options\030\003 \001(\0132\031.topicsum.TopicSum"
-    "Options\022\"\n\007article\030\004 \003(\0132\021.topicsum.Arti"
-    "cle\022F\n\032news_postprocessor_options\030\005 \001(\0132"
-    "\".topicsum.NewsPostProcessorOptions\"1\n\013S"
-    "ummaryType\022\013\n\007GENERIC\020\001\022\t\n\005QUERY\020\002\022\n\n\006UP"
-    "DATE\020\004", 1446);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "summarizer/summarizer.proto", &protobuf_RegisterTypes);
-  Article::default_instance_ = new Article();
-  SummaryOptions::default_instance_ = new SummaryOptions();
-  SummaryLength::default_instance_ = new SummaryLength();
-  GibbsSamplingOptions::default_instance_ = new GibbsSamplingOptions();
-  KLSumOptions::_default_postprocessor_name_ =
-      new ::std::string("NewsPostprocessor", 17);
-  KLSumOptions::default_instance_ = new KLSumOptions();
-  TopicSumOptions::_default_lambda_ =
-      new ::std::string("0.1,1,1", 7);
-  TopicSumOptions::_default_gamma_ =
-      new ::std::string("1,5,10", 6);
-  TopicSumOptions::default_instance_ = new TopicSumOptions();
-  NewsPostProcessorOptions::default_instance_ = new NewsPostProcessorOptions();
-  SummarizerOptions::default_instance_ = new SummarizerOptions();
-  Article::default_instance_->InitAsDefaultInstance();
-  SummaryOptions::default_instance_->InitAsDefaultInstance();
-  SummaryLength::default_instance_->InitAsDefaultInstance();
-  GibbsSamplingOptions::default_instance_->InitAsDefaultInstance();
-  KLSumOptions::default_instance_->InitAsDefaultInstance();
-  TopicSumOptions::default_instance_->InitAsDefaultInstance();
-  NewsPostProcessorOptions::default_instance_->InitAsDefaultInstance();
-  SummarizerOptions::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_summarizer_2fsummarizer_2eproto {
-  StaticDescriptorInitializer_summarizer_2fsummarizer_2eproto() {
-    protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  }
-} static_descriptor_initializer_summarizer_2fsummarizer_2eproto_;
-
-// ===================================================================
-
-#ifndef _MSC_VER
-const int Article::kContentFieldNumber;
-const int Article::kScoreFieldNumber;
-#endif  // !_MSC_VER
-
-Article::Article()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SummarizerOptionsDefaultTypeInternal _SummarizerOptions_default_instance_;
+}  // namespace topicsum
+static ::_pb::Metadata file_level_metadata_summarizer_2fsummarizer_2eproto[8];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_summarizer_2fsummarizer_2eproto[5];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_summarizer_2fsummarizer_2eproto = nullptr;
+
+const uint32_t TableStruct_summarizer_2fsummarizer_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::topicsum::Article, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Article, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::Article, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::Article, _impl_.score_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryOptions, _impl_.length_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryOptions, _impl_.additional_length_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryOptions, _impl_.generate_debug_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryOptions, _impl_.deadline_ms_),
+  0,
+  ~0u,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryLength, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryLength, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryLength, _impl_.unit_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummaryLength, _impl_.length_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.iterations_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.burnin_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.lag_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.track_likelihood_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.deadline_ms_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.seed_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.num_threads_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.convergence_tolerance_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.convergence_window_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.min_iterations_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.checkpoint_path_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.checkpoint_interval_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.resume_from_checkpoint_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::GibbsSamplingOptions, _impl_.num_chains_),
+  10,
+  3,
+  11,
+  4,
+  1,
+  2,
+  12,
+  6,
+  13,
+  7,
+  0,
+  8,
+  5,
+  9,
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.optimization_strategy_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.redundancy_removal_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.sentence_position_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.summary_weight_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.prior_weight_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.postprocessor_name_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.lazy_evaluation_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.num_threads_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.fast_log_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.precision_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.collapse_duplicates_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::KLSumOptions, _impl_.near_duplicate_similarity_),
+  1,
+  2,
+  3,
+  9,
+  6,
+  0,
+  4,
+  10,
+  5,
+  7,
+  8,
+  11,
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.gibbs_sampling_options_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.lambda_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.gamma_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.background_model_path_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.inference_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.cvb0_iterations_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::TopicSumOptions, _impl_.batch_num_threads_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  5,
+  6,
+  PROTOBUF_FIELD_OFFSET(::topicsum::NewsPostProcessorOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::NewsPostProcessorOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::NewsPostProcessorOptions, _impl_.min_sentence_length_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::NewsPostProcessorOptions, _impl_.max_sentence_length_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _impl_.summary_type_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _impl_.klsum_options_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _impl_.topicsum_options_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _impl_.article_),
+  PROTOBUF_FIELD_OFFSET(::topicsum::SummarizerOptions, _impl_.news_postprocessor_options_),
+  3,
+  0,
+  1,
+  ~0u,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::topicsum::Article)},
+  { 10, 20, -1, sizeof(::topicsum::SummaryOptions)},
+  { 24, 32, -1, sizeof(::topicsum::SummaryLength)},
+  { 34, 54, -1, sizeof(::topicsum::GibbsSamplingOptions)},
+  { 68, 86, -1, sizeof(::topicsum::KLSumOptions)},
+  { 98, 111, -1, sizeof(::topicsum::TopicSumOptions)},
+  { 118, 126, -1, sizeof(::topicsum::NewsPostProcessorOptions)},
+  { 128, 139, -1, sizeof(::topicsum::SummarizerOptions)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::topicsum::_Article_default_instance_._instance,
+  &::topicsum::_SummaryOptions_default_instance_._instance,
+  &::topicsum::_SummaryLength_default_instance_._instance,
+  &::topicsum::_GibbsSamplingOptions_default_instance_._instance,
+  &::topicsum::_KLSumOptions_default_instance_._instance,
+  &::topicsum::_TopicSumOptions_default_instance_._instance,
+  &::topicsum::_NewsPostProcessorOptions_default_instance_._instance,
+  &::topicsum::_SummarizerOptions_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_summarizer_2fsummarizer_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\033summarizer/summarizer.proto\022\010topicsum\032"
+  "\031summarizer/document.proto\032\035summarizer/d"
+  "istribution.proto\")\n\007Article\022\017\n\007content\030"
+  "\001 \001(\t\022\r\n\005score\030\002 \003(\002\"\244\001\n\016SummaryOptions\022"
+  "\'\n\006length\030\001 \001(\0132\027.topicsum.SummaryLength"
+  "\0222\n\021additional_length\030\t \003(\0132\027.topicsum.S"
+  "ummaryLength\022\035\n\016generate_debug\030\010 \001(\010:\005fa"
+  "lse\022\026\n\013deadline_ms\030\n \001(\003:\0010\"\235\001\n\rSummaryL"
+  "ength\0220\n\004unit\030\001 \002(\0162\".topicsum.SummaryLe"
+  "ngth.LengthUnit\022\016\n\006length\030\002 \002(\005\"J\n\nLengt"
+  "hUnit\022\r\n\tCHARACTER\020\000\022\t\n\005TOKEN\020\001\022\014\n\010SENTE"
+  "NCE\020\002\022\024\n\020NUM_LENGTH_UNITS\020\003\"\210\003\n\024GibbsSam"
+  "plingOptions\022\027\n\niterations\030\001 \001(\005:\003500\022\021\n"
+  "\006burnin\030\002 \001(\005:\0010\022\017\n\003lag\030\003 \001(\005:\00210\022\037\n\020tra"
+  "ck_likelihood\030\004 \001(\010:\005false\022\026\n\013deadline_m"
+  "s\030\005 \001(\003:\0010\022\017\n\004seed\030\006 \001(\004:\0010\022\026\n\013num_threa"
+  "ds\030\007 \001(\005:\0011\022 \n\025convergence_tolerance\030\010 \001"
+  "(\001:\0010\022\035\n\022convergence_window\030\t \001(\005:\0015\022\031\n\016"
+  "min_iterations\030\n \001(\005:\0010\022\027\n\017checkpoint_pa"
+  "th\030\013 \001(\t\022\036\n\023checkpoint_interval\030\014 \001(\005:\0010"
+  "\022%\n\026resume_from_checkpoint\030\r \001(\010:\005false\022"
+  "\025\n\nnum_chains\030\016 \001(\005:\0011\"\363\004\n\014KLSumOptions\022"
+  "_\n\025optimization_strategy\030\001 \001(\0162+.topicsu"
+  "m.KLSumOptions.OptimizationStrategy:\023GRE"
+  "EDY_OPTIMIZATION\022!\n\022redundancy_removal\030\002"
+  " \001(\010:\005false\022 \n\021sentence_position\030\003 \001(\010:\005"
+  "false\022\031\n\016summary_weight\030\005 \001(\002:\0011\022\027\n\014prio"
+  "r_weight\030\006 \001(\002:\0010\022-\n\022postprocessor_name\030"
+  "\007 \001(\t:\021NewsPostprocessor\022\036\n\017lazy_evaluat"
+  "ion\030\010 \001(\010:\005false\022\026\n\013num_threads\030\t \001(\005:\0011"
+  "\022\027\n\010fast_log\030\n \001(\010:\005false\022;\n\tprecision\030\013"
+  " \001(\0162 .topicsum.KLSumOptions.Precision:\006"
+  "DOUBLE\022\"\n\023collapse_duplicates\030\014 \001(\010:\005fal"
+  "se\022&\n\031near_duplicate_similarity\030\r \001(\001:\0030"
+  ".8\"\\\n\024OptimizationStrategy\022\027\n\023GREEDY_OPT"
+  "IMIZATION\020\000\022\024\n\020SENTENCE_RANKING\020\001\022\025\n\021NUM"
+  "_OPTIMIZATIONS\020\002\"\"\n\tPrecision\022\n\n\006DOUBLE\020"
+  "\000\022\t\n\005FLOAT\020\001\"\316\002\n\017TopicSumOptions\022>\n\026gibb"
+  "s_sampling_options\030\002 \001(\0132\036.topicsum.Gibb"
+  "sSamplingOptions\022\027\n\006lambda\030\003 \001(\t:\0070.1,1,"
+  "1\022\025\n\005gamma\030\004 \001(\t:\0061,5,10\022\035\n\025background_m"
+  "odel_path\030\010 \001(\t\022F\n\tinference\030\t \001(\0162#.top"
+  "icsum.TopicSumOptions.Inference:\016GIBBS_S"
+  "AMPLING\022\033\n\017cvb0_iterations\030\n \001(\005:\00250\022\034\n\021"
+  "batch_num_threads\030\013 \001(\005:\0011\")\n\tInference\022"
+  "\022\n\016GIBBS_SAMPLING\020\000\022\010\n\004CVB0\020\001\"T\n\030NewsPos"
+  "tProcessorOptions\022\033\n\023min_sentence_length"
+  "\030\001 \001(\005\022\033\n\023max_sentence_length\030\002 \001(\005\"\325\002\n\021"
+  "SummarizerOptions\022=\n\014summary_type\030\001 \002(\0162"
+  "\'.topicsum.SummarizerOptions.SummaryType"
+  "\022-\n\rklsum_options\030\002 \001(\0132\026.topicsum.KLSum"
+  "Options\0223\n\020topicsum_options\030\003 \001(\0132\031.topi"
+  "csum.TopicSumOptions\022\"\n\007article\030\004 \003(\0132\021."
+  "topicsum.Article\022F\n\032news_postprocessor_o"
+  "ptions\030\005 \001(\0132\".topicsum.NewsPostProcesso"
+  "rOptions\"1\n\013SummaryType\022\013\n\007GENERIC\020\001\022\t\n\005"
+  "QUERY\020\002\022\n\n\006UPDATE\020\004"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_summarizer_2fsummarizer_2eproto_deps[2] = {
+  &::descriptor_table_summarizer_2fdistribution_2eproto,
+  &::descriptor_table_summarizer_2fdocument_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_summarizer_2fsummarizer_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_summarizer_2fsummarizer_2eproto = {
+    false, false, 2259, descriptor_table_protodef_summarizer_2fsummarizer_2eproto,
+    "summarizer/summarizer.proto",
+    &descriptor_table_summarizer_2fsummarizer_2eproto_once, descriptor_table_summarizer_2fsummarizer_2eproto_deps, 2, 8,
+    schemas, file_default_instances, TableStruct_summarizer_2fsummarizer_2eproto::offsets,
+    file_level_metadata_summarizer_2fsummarizer_2eproto, file_level_enum_descriptors_summarizer_2fsummarizer_2eproto,
+    file_level_service_descriptors_summarizer_2fsummarizer_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_summarizer_2fsummarizer_2eproto_getter() {
+  return &descriptor_table_summarizer_2fsummarizer_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_summarizer_2fsummarizer_2eproto(&descriptor_table_summarizer_2fsummarizer_2eproto);
+namespace topicsum {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SummaryLength_LengthUnit_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_summarizer_2fsummarizer_2eproto);
+  return file_level_enum_descriptors_summarizer_2fsummarizer_2eproto[0];
 }
-
-void Article::InitAsDefaultInstance() {
+bool SummaryLength_LengthUnit_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Article::Article(const Article& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SummaryLength_LengthUnit SummaryLength::CHARACTER;
+constexpr SummaryLength_LengthUnit SummaryLength::TOKEN;
+constexpr SummaryLength_LengthUnit SummaryLength::SENTENCE;
+constexpr SummaryLength_LengthUnit SummaryLength::NUM_LENGTH_UNITS;
+constexpr SummaryLength_LengthUnit SummaryLength::LengthUnit_MIN;
+constexpr SummaryLength_LengthUnit SummaryLength::LengthUnit_MAX;
+constexpr int SummaryLength::LengthUnit_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* KLSumOptions_OptimizationStrategy_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_summarizer_2fsummarizer_2eproto);
+  return file_level_enum_descriptors_summarizer_2fsummarizer_2eproto[1];
 }
-
-void Article::SharedCtor() {
-  _cached_size_ = 0;
-  content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool KLSumOptions_OptimizationStrategy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Article::~Article() {
-  SharedDtor();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions::GREEDY_OPTIMIZATION;
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions::SENTENCE_RANKING;
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions::NUM_OPTIMIZATIONS;
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions::OptimizationStrategy_MIN;
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions::OptimizationStrategy_MAX;
+constexpr int KLSumOptions::OptimizationStrategy_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* KLSumOptions_Precision_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_summarizer_2fsummarizer_2eproto);
+  return file_level_enum_descriptors_summarizer_2fsummarizer_2eproto[2];
 }
-
-void Article::SharedDtor() {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    delete content_;
-  }
-  if (this != default_instance_) {
+bool KLSumOptions_Precision_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
   }
 }
 
-void Article::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr KLSumOptions_Precision KLSumOptions::DOUBLE;
+constexpr KLSumOptions_Precision KLSumOptions::FLOAT;
+constexpr KLSumOptions_Precision KLSumOptions::Precision_MIN;
+constexpr KLSumOptions_Precision KLSumOptions::Precision_MAX;
+constexpr int KLSumOptions::Precision_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TopicSumOptions_Inference_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_summarizer_2fsummarizer_2eproto);
+  return file_level_enum_descriptors_summarizer_2fsummarizer_2eproto[3];
 }
-const ::google::protobuf::Descriptor* Article::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Article_descriptor_;
-}
-
-const Article& Article::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
+bool TopicSumOptions_Inference_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
 
-Article* Article::default_instance_ = NULL;
-
-Article* Article::New() const {
-  return new Article;
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TopicSumOptions_Inference TopicSumOptions::GIBBS_SAMPLING;
+constexpr TopicSumOptions_Inference TopicSumOptions::CVB0;
+constexpr TopicSumOptions_Inference TopicSumOptions::Inference_MIN;
+constexpr TopicSumOptions_Inference TopicSumOptions::Inference_MAX;
+constexpr int TopicSumOptions::Inference_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SummarizerOptions_SummaryType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_summarizer_2fsummarizer_2eproto);
+  return file_level_enum_descriptors_summarizer_2fsummarizer_2eproto[4];
 }
-
-void Article::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_content()) {
-      if (content_ != &::google::protobuf::internal::kEmptyString) {
-        content_->clear();
-      }
-    }
+bool SummarizerOptions_SummaryType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 4:
+      return true;
+    default:
+      return false;
   }
-  score_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
 }
 
-bool Article::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string content = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_content()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->content().data(), this->content().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_score;
-        break;
-      }
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SummarizerOptions_SummaryType SummarizerOptions::GENERIC;
+constexpr SummarizerOptions_SummaryType SummarizerOptions::QUERY;
+constexpr SummarizerOptions_SummaryType SummarizerOptions::UPDATE;
+constexpr SummarizerOptions_SummaryType SummarizerOptions::SummaryType_MIN;
+constexpr SummarizerOptions_SummaryType SummarizerOptions::SummaryType_MAX;
+constexpr int SummarizerOptions::SummaryType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-      // repeated float score = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_score:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 1, 21, input, this->mutable_score())));
-        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
-                   == ::google::protobuf::internal::WireFormatLite::
-                      WIRETYPE_LENGTH_DELIMITED) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, this->mutable_score())));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_score;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+// ===================================================================
+
+class Article::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Article>()._impl_._has_bits_);
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  return true;
-#undef DO_
+};
+
+Article::Article(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.Article)
+}
+Article::Article(const Article& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Article* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.score_){from._impl_.score_}
+    , decltype(_impl_.content_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:topicsum.Article)
+}
+
+inline void Article::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.score_){arena}
+    , decltype(_impl_.content_){}
+  };
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void Article::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string content = 1;
-  if (has_content()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->content().data(), this->content().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->content(), output);
+Article::~Article() {
+  // @@protoc_insertion_point(destructor:topicsum.Article)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // repeated float score = 2;
-  for (int i = 0; i < this->score_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(
-      2, this->score(i), output);
-  }
+inline void Article::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.score_.~RepeatedField();
+  _impl_.content_.Destroy();
+}
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
+void Article::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-::google::protobuf::uint8* Article::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+void Article::Clear() {
+// @@protoc_insertion_point(message_clear_start:topicsum.Article)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.score_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.content_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Article::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string content = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.Article.content");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float score = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_score(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<21>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_score(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Article::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.Article)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string content = 1;
-  if (has_content()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->content().data(), this->content().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->content(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.Article.content");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_content(), target);
   }
 
   // repeated float score = 2;
-  for (int i = 0; i < this->score_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteFloatToArray(2, this->score(i), target);
+  for (int i = 0, n = this->_internal_score_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_score(i), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.Article)
   return target;
 }
 
-int Article::ByteSize() const {
-  int total_size = 0;
+size_t Article::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.Article)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string content = 1;
-    if (has_content()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->content());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  }
   // repeated float score = 2;
   {
-    int data_size = 0;
-    data_size = 4 * this->score_size();
-    total_size += 1 * this->score_size() + data_size;
+    unsigned int count = static_cast<unsigned int>(this->_internal_score_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_score_size());
+    total_size += data_size;
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional string content = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Article::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Article* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Article*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Article::MergeFrom(const Article& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  score_.MergeFrom(from.score_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_content()) {
-      set_content(from.content());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Article::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Article::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Article::GetClassData() const { return &_class_data_; }
 
-void Article::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void Article::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Article*>(&to_msg);
+  auto& from = static_cast<const Article&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.Article)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.score_.MergeFrom(from._impl_.score_);
+  if (from._internal_has_content()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Article::CopyFrom(const Article& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.Article)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Article::IsInitialized() const {
-
   return true;
 }
 
-void Article::Swap(Article* other) {
-  if (other != this) {
-    std::swap(content_, other->content_);
-    score_.Swap(&other->score_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Article::InternalSwap(Article* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.score_.InternalSwap(&other->_impl_.score_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata Article::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Article_descriptor_;
-  metadata.reflection = Article_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Article::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int SummaryOptions::kLengthFieldNumber;
-const int SummaryOptions::kGenerateDebugFieldNumber;
-#endif  // !_MSC_VER
+class SummaryOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SummaryOptions>()._impl_._has_bits_);
+  static const ::topicsum::SummaryLength& length(const SummaryOptions* msg);
+  static void set_has_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_generate_debug(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_deadline_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-SummaryOptions::SummaryOptions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::topicsum::SummaryLength&
+SummaryOptions::_Internal::length(const SummaryOptions* msg) {
+  return *msg->_impl_.length_;
 }
-
-void SummaryOptions::InitAsDefaultInstance() {
-  length_ = const_cast< ::topicsum::SummaryLength*>(&::topicsum::SummaryLength::default_instance());
+SummaryOptions::SummaryOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.SummaryOptions)
 }
-
 SummaryOptions::SummaryOptions(const SummaryOptions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SummaryOptions::SharedCtor() {
-  _cached_size_ = 0;
-  length_ = NULL;
-  generate_debug_ = false;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SummaryOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.additional_length_){from._impl_.additional_length_}
+    , decltype(_impl_.length_){nullptr}
+    , decltype(_impl_.deadline_ms_){}
+    , decltype(_impl_.generate_debug_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_length()) {
+    _this->_impl_.length_ = new ::topicsum::SummaryLength(*from._impl_.length_);
+  }
+  ::memcpy(&_impl_.deadline_ms_, &from._impl_.deadline_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.generate_debug_) -
+    reinterpret_cast<char*>(&_impl_.deadline_ms_)) + sizeof(_impl_.generate_debug_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.SummaryOptions)
+}
+
+inline void SummaryOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.additional_length_){arena}
+    , decltype(_impl_.length_){nullptr}
+    , decltype(_impl_.deadline_ms_){int64_t{0}}
+    , decltype(_impl_.generate_debug_){false}
+  };
 }
 
 SummaryOptions::~SummaryOptions() {
+  // @@protoc_insertion_point(destructor:topicsum.SummaryOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SummaryOptions::SharedDtor() {
-  if (this != default_instance_) {
-    delete length_;
-  }
+inline void SummaryOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.additional_length_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.length_;
 }
 
 void SummaryOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SummaryOptions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SummaryOptions_descriptor_;
-}
-
-const SummaryOptions& SummaryOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-SummaryOptions* SummaryOptions::default_instance_ = NULL;
-
-SummaryOptions* SummaryOptions::New() const {
-  return new SummaryOptions;
+  _impl_._cached_size_.Set(size);
 }
 
 void SummaryOptions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_length()) {
-      if (length_ != NULL) length_->::topicsum::SummaryLength::Clear();
-    }
-    generate_debug_ = false;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SummaryOptions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.SummaryOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.additional_length_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.length_ != nullptr);
+    _impl_.length_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.deadline_ms_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.generate_debug_) -
+        reinterpret_cast<char*>(&_impl_.deadline_ms_)) + sizeof(_impl_.generate_debug_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SummaryOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .topicsum.SummaryLength length = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_length()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_generate_debug;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_length(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool generate_debug = 8 [default = false];
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_generate_debug:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &generate_debug_)));
-          set_has_generate_debug();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SummaryOptions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_generate_debug(&has_bits);
+          _impl_.generate_debug_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .topicsum.SummaryLength additional_length = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_additional_length(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 deadline_ms = 10 [default = 0];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_deadline_ms(&has_bits);
+          _impl_.deadline_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SummaryOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.SummaryOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .topicsum.SummaryLength length = 1;
-  if (has_length()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->length(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::length(this),
+        _Internal::length(this).GetCachedSize(), target, stream);
   }
 
   // optional bool generate_debug = 8 [default = false];
-  if (has_generate_debug()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->generate_debug(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_generate_debug(), target);
   }
-}
 
-::google::protobuf::uint8* SummaryOptions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional .topicsum.SummaryLength length = 1;
-  if (has_length()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->length(), target);
+  // repeated .topicsum.SummaryLength additional_length = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_additional_length_size()); i < n; i++) {
+    const auto& repfield = this->_internal_additional_length(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional bool generate_debug = 8 [default = false];
-  if (has_generate_debug()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->generate_debug(), target);
+  // optional int64 deadline_ms = 10 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_deadline_ms(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.SummaryOptions)
   return target;
 }
 
-int SummaryOptions::ByteSize() const {
-  int total_size = 0;
+size_t SummaryOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.SummaryOptions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .topicsum.SummaryLength additional_length = 9;
+  total_size += 1UL * this->_internal_additional_length_size();
+  for (const auto& msg : this->_impl_.additional_length_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
     // optional .topicsum.SummaryLength length = 1;
-    if (has_length()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->length());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.length_);
+    }
+
+    // optional int64 deadline_ms = 10 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_deadline_ms());
     }
 
     // optional bool generate_debug = 8 [default = false];
-    if (has_generate_debug()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 1;
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SummaryOptions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SummaryOptions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SummaryOptions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SummaryOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SummaryOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SummaryOptions::GetClassData() const { return &_class_data_; }
+
+
+void SummaryOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SummaryOptions*>(&to_msg);
+  auto& from = static_cast<const SummaryOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.SummaryOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SummaryOptions::MergeFrom(const SummaryOptions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_length()) {
-      mutable_length()->::topicsum::SummaryLength::MergeFrom(from.length());
+  _this->_impl_.additional_length_.MergeFrom(from._impl_.additional_length_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_length()->::topicsum::SummaryLength::MergeFrom(
+          from._internal_length());
     }
-    if (from.has_generate_debug()) {
-      set_generate_debug(from.generate_debug());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.deadline_ms_ = from._impl_.deadline_ms_;
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.generate_debug_ = from._impl_.generate_debug_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SummaryOptions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SummaryOptions::CopyFrom(const SummaryOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.SummaryOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SummaryOptions::IsInitialized() const {
-
-  if (has_length()) {
-    if (!this->length().IsInitialized()) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.additional_length_))
+    return false;
+  if (_internal_has_length()) {
+    if (!_impl_.length_->IsInitialized()) return false;
   }
   return true;
 }
 
-void SummaryOptions::Swap(SummaryOptions* other) {
-  if (other != this) {
-    std::swap(length_, other->length_);
-    std::swap(generate_debug_, other->generate_debug_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SummaryOptions::InternalSwap(SummaryOptions* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.additional_length_.InternalSwap(&other->_impl_.additional_length_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SummaryOptions, _impl_.generate_debug_)
+      + sizeof(SummaryOptions::_impl_.generate_debug_)
+      - PROTOBUF_FIELD_OFFSET(SummaryOptions, _impl_.length_)>(
+          reinterpret_cast<char*>(&_impl_.length_),
+          reinterpret_cast<char*>(&other->_impl_.length_));
 }
 
-::google::protobuf::Metadata SummaryOptions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SummaryOptions_descriptor_;
-  metadata.reflection = SummaryOptions_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SummaryOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[1]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* SummaryLength_LengthUnit_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SummaryLength_LengthUnit_descriptor_;
-}
-bool SummaryLength_LengthUnit_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
-      return true;
-    default:
-      return false;
+class SummaryLength::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SummaryLength>()._impl_._has_bits_);
+  static void set_has_unit(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const SummaryLength_LengthUnit SummaryLength::CHARACTER;
-const SummaryLength_LengthUnit SummaryLength::TOKEN;
-const SummaryLength_LengthUnit SummaryLength::SENTENCE;
-const SummaryLength_LengthUnit SummaryLength::NUM_LENGTH_UNITS;
-const SummaryLength_LengthUnit SummaryLength::LengthUnit_MIN;
-const SummaryLength_LengthUnit SummaryLength::LengthUnit_MAX;
-const int SummaryLength::LengthUnit_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int SummaryLength::kUnitFieldNumber;
-const int SummaryLength::kLengthFieldNumber;
-#endif  // !_MSC_VER
-
-SummaryLength::SummaryLength()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  static void set_has_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void SummaryLength::InitAsDefaultInstance() {
+SummaryLength::SummaryLength(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.SummaryLength)
 }
-
 SummaryLength::SummaryLength(const SummaryLength& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SummaryLength::SharedCtor() {
-  _cached_size_ = 0;
-  unit_ = 0;
-  length_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SummaryLength* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.unit_){}
+    , decltype(_impl_.length_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.unit_, &from._impl_.unit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.length_) -
+    reinterpret_cast<char*>(&_impl_.unit_)) + sizeof(_impl_.length_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.SummaryLength)
+}
+
+inline void SummaryLength::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.unit_){0}
+    , decltype(_impl_.length_){0}
+  };
 }
 
 SummaryLength::~SummaryLength() {
+  // @@protoc_insertion_point(destructor:topicsum.SummaryLength)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SummaryLength::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void SummaryLength::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void SummaryLength::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SummaryLength::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SummaryLength_descriptor_;
-}
-
-const SummaryLength& SummaryLength::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-SummaryLength* SummaryLength::default_instance_ = NULL;
-
-SummaryLength* SummaryLength::New() const {
-  return new SummaryLength;
+  _impl_._cached_size_.Set(size);
 }
 
 void SummaryLength::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    unit_ = 0;
-    length_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SummaryLength::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.SummaryLength)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.unit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.length_) -
+        reinterpret_cast<char*>(&_impl_.unit_)) + sizeof(_impl_.length_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SummaryLength::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .topicsum.SummaryLength.LengthUnit unit = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::topicsum::SummaryLength_LengthUnit_IsValid(value)) {
-            set_unit(static_cast< ::topicsum::SummaryLength_LengthUnit >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::topicsum::SummaryLength_LengthUnit_IsValid(val))) {
+            _internal_set_unit(static_cast<::topicsum::SummaryLength_LengthUnit>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_length;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 length = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_length:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &length_)));
-          set_has_length();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SummaryLength::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_length(&has_bits);
+          _impl_.length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SummaryLength::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.SummaryLength)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .topicsum.SummaryLength.LengthUnit unit = 1;
-  if (has_unit()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->unit(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_unit(), target);
   }
 
   // required int32 length = 2;
-  if (has_length()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->length(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_length(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.SummaryLength)
+  return target;
 }
 
-::google::protobuf::uint8* SummaryLength::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .topicsum.SummaryLength.LengthUnit unit = 1;
-  if (has_unit()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->unit(), target);
-  }
+size_t SummaryLength::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:topicsum.SummaryLength)
+  size_t total_size = 0;
 
-  // required int32 length = 2;
-  if (has_length()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->length(), target);
+  if (_internal_has_unit()) {
+    // required .topicsum.SummaryLength.LengthUnit unit = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_unit());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (_internal_has_length()) {
+    // required int32 length = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_length());
   }
-  return target;
-}
 
-int SummaryLength::ByteSize() const {
-  int total_size = 0;
+  return total_size;
+}
+size_t SummaryLength::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.SummaryLength)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required .topicsum.SummaryLength.LengthUnit unit = 1;
-    if (has_unit()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->unit());
-    }
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_unit());
 
     // required int32 length = 2;
-    if (has_length()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->length());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_length());
 
-void SummaryLength::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SummaryLength* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SummaryLength*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SummaryLength::MergeFrom(const SummaryLength& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_unit()) {
-      set_unit(from.unit());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SummaryLength::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SummaryLength::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SummaryLength::GetClassData() const { return &_class_data_; }
+
+
+void SummaryLength::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SummaryLength*>(&to_msg);
+  auto& from = static_cast<const SummaryLength&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.SummaryLength)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.unit_ = from._impl_.unit_;
     }
-    if (from.has_length()) {
-      set_length(from.length());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.length_ = from._impl_.length_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SummaryLength::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SummaryLength::CopyFrom(const SummaryLength& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.SummaryLength)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SummaryLength::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SummaryLength::Swap(SummaryLength* other) {
-  if (other != this) {
-    std::swap(unit_, other->unit_);
-    std::swap(length_, other->length_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SummaryLength::InternalSwap(SummaryLength* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SummaryLength, _impl_.length_)
+      + sizeof(SummaryLength::_impl_.length_)
+      - PROTOBUF_FIELD_OFFSET(SummaryLength, _impl_.unit_)>(
+          reinterpret_cast<char*>(&_impl_.unit_),
+          reinterpret_cast<char*>(&other->_impl_.unit_));
 }
 
-::google::protobuf::Metadata SummaryLength::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SummaryLength_descriptor_;
-  metadata.reflection = SummaryLength_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SummaryLength::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[2]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int GibbsSamplingOptions::kIterationsFieldNumber;
-const int GibbsSamplingOptions::kBurninFieldNumber;
-const int GibbsSamplingOptions::kLagFieldNumber;
-const int GibbsSamplingOptions::kTrackLikelihoodFieldNumber;
-#endif  // !_MSC_VER
-
-GibbsSamplingOptions::GibbsSamplingOptions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class GibbsSamplingOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GibbsSamplingOptions>()._impl_._has_bits_);
+  static void set_has_iterations(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_burnin(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lag(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_track_likelihood(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_deadline_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_seed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_num_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_convergence_tolerance(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_convergence_window(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_min_iterations(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_checkpoint_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_checkpoint_interval(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_resume_from_checkpoint(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_num_chains(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+};
 
-void GibbsSamplingOptions::InitAsDefaultInstance() {
+GibbsSamplingOptions::GibbsSamplingOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.GibbsSamplingOptions)
 }
-
 GibbsSamplingOptions::GibbsSamplingOptions(const GibbsSamplingOptions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void GibbsSamplingOptions::SharedCtor() {
-  _cached_size_ = 0;
-  iterations_ = 500;
-  burnin_ = 0;
-  lag_ = 10;
-  track_likelihood_ = false;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GibbsSamplingOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.checkpoint_path_){}
+    , decltype(_impl_.deadline_ms_){}
+    , decltype(_impl_.seed_){}
+    , decltype(_impl_.burnin_){}
+    , decltype(_impl_.track_likelihood_){}
+    , decltype(_impl_.resume_from_checkpoint_){}
+    , decltype(_impl_.convergence_tolerance_){}
+    , decltype(_impl_.min_iterations_){}
+    , decltype(_impl_.checkpoint_interval_){}
+    , decltype(_impl_.num_chains_){}
+    , decltype(_impl_.iterations_){}
+    , decltype(_impl_.lag_){}
+    , decltype(_impl_.num_threads_){}
+    , decltype(_impl_.convergence_window_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.checkpoint_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.checkpoint_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_checkpoint_path()) {
+    _this->_impl_.checkpoint_path_.Set(from._internal_checkpoint_path(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.deadline_ms_, &from._impl_.deadline_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.convergence_window_) -
+    reinterpret_cast<char*>(&_impl_.deadline_ms_)) + sizeof(_impl_.convergence_window_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.GibbsSamplingOptions)
+}
+
+inline void GibbsSamplingOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.checkpoint_path_){}
+    , decltype(_impl_.deadline_ms_){int64_t{0}}
+    , decltype(_impl_.seed_){uint64_t{0u}}
+    , decltype(_impl_.burnin_){0}
+    , decltype(_impl_.track_likelihood_){false}
+    , decltype(_impl_.resume_from_checkpoint_){false}
+    , decltype(_impl_.convergence_tolerance_){0}
+    , decltype(_impl_.min_iterations_){0}
+    , decltype(_impl_.checkpoint_interval_){0}
+    , decltype(_impl_.num_chains_){1}
+    , decltype(_impl_.iterations_){500}
+    , decltype(_impl_.lag_){10}
+    , decltype(_impl_.num_threads_){1}
+    , decltype(_impl_.convergence_window_){5}
+  };
+  _impl_.checkpoint_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.checkpoint_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GibbsSamplingOptions::~GibbsSamplingOptions() {
+  // @@protoc_insertion_point(destructor:topicsum.GibbsSamplingOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GibbsSamplingOptions::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void GibbsSamplingOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.checkpoint_path_.Destroy();
 }
 
 void GibbsSamplingOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* GibbsSamplingOptions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return GibbsSamplingOptions_descriptor_;
-}
-
-const GibbsSamplingOptions& GibbsSamplingOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-GibbsSamplingOptions* GibbsSamplingOptions::default_instance_ = NULL;
-
-GibbsSamplingOptions* GibbsSamplingOptions::New() const {
-  return new GibbsSamplingOptions;
+  _impl_._cached_size_.Set(size);
 }
 
 void GibbsSamplingOptions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    iterations_ = 500;
-    burnin_ = 0;
-    lag_ = 10;
-    track_likelihood_ = false;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool GibbsSamplingOptions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.GibbsSamplingOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.checkpoint_path_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.deadline_ms_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.min_iterations_) -
+        reinterpret_cast<char*>(&_impl_.deadline_ms_)) + sizeof(_impl_.min_iterations_));
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    _impl_.checkpoint_interval_ = 0;
+    _impl_.num_chains_ = 1;
+    _impl_.iterations_ = 500;
+    _impl_.lag_ = 10;
+    _impl_.num_threads_ = 1;
+    _impl_.convergence_window_ = 5;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GibbsSamplingOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional int32 iterations = 1 [default = 500];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &iterations_)));
-          set_has_iterations();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_burnin;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_iterations(&has_bits);
+          _impl_.iterations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 burnin = 2 [default = 0];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_burnin:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &burnin_)));
-          set_has_burnin();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_lag;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_burnin(&has_bits);
+          _impl_.burnin_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 lag = 3 [default = 10];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_lag:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &lag_)));
-          set_has_lag();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_track_likelihood;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_lag(&has_bits);
+          _impl_.lag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool track_likelihood = 4 [default = false];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_track_likelihood:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &track_likelihood_)));
-          set_has_track_likelihood();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void GibbsSamplingOptions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_track_likelihood(&has_bits);
+          _impl_.track_likelihood_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 deadline_ms = 5 [default = 0];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_deadline_ms(&has_bits);
+          _impl_.deadline_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 seed = 6 [default = 0];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_seed(&has_bits);
+          _impl_.seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_threads = 7 [default = 1];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_num_threads(&has_bits);
+          _impl_.num_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double convergence_tolerance = 8 [default = 0];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_convergence_tolerance(&has_bits);
+          _impl_.convergence_tolerance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 convergence_window = 9 [default = 5];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_convergence_window(&has_bits);
+          _impl_.convergence_window_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 min_iterations = 10 [default = 0];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_min_iterations(&has_bits);
+          _impl_.min_iterations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string checkpoint_path = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_checkpoint_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.GibbsSamplingOptions.checkpoint_path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 checkpoint_interval = 12 [default = 0];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_checkpoint_interval(&has_bits);
+          _impl_.checkpoint_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool resume_from_checkpoint = 13 [default = false];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_resume_from_checkpoint(&has_bits);
+          _impl_.resume_from_checkpoint_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_chains = 14 [default = 1];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_num_chains(&has_bits);
+          _impl_.num_chains_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GibbsSamplingOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.GibbsSamplingOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional int32 iterations = 1 [default = 500];
-  if (has_iterations()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->iterations(), output);
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_iterations(), target);
   }
 
   // optional int32 burnin = 2 [default = 0];
-  if (has_burnin()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->burnin(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_burnin(), target);
   }
 
   // optional int32 lag = 3 [default = 10];
-  if (has_lag()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->lag(), output);
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lag(), target);
   }
 
   // optional bool track_likelihood = 4 [default = false];
-  if (has_track_likelihood()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->track_likelihood(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_track_likelihood(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional int64 deadline_ms = 5 [default = 0];
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_deadline_ms(), target);
   }
-}
 
-::google::protobuf::uint8* GibbsSamplingOptions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional int32 iterations = 1 [default = 500];
-  if (has_iterations()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->iterations(), target);
+  // optional uint64 seed = 6 [default = 0];
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_seed(), target);
   }
 
-  // optional int32 burnin = 2 [default = 0];
-  if (has_burnin()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->burnin(), target);
+  // optional int32 num_threads = 7 [default = 1];
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_num_threads(), target);
   }
 
-  // optional int32 lag = 3 [default = 10];
-  if (has_lag()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->lag(), target);
+  // optional double convergence_tolerance = 8 [default = 0];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_convergence_tolerance(), target);
   }
 
-  // optional bool track_likelihood = 4 [default = false];
-  if (has_track_likelihood()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->track_likelihood(), target);
+  // optional int32 convergence_window = 9 [default = 5];
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_convergence_window(), target);
+  }
+
+  // optional int32 min_iterations = 10 [default = 0];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_min_iterations(), target);
+  }
+
+  // optional string checkpoint_path = 11;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_checkpoint_path().data(), static_cast<int>(this->_internal_checkpoint_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.GibbsSamplingOptions.checkpoint_path");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_checkpoint_path(), target);
+  }
+
+  // optional int32 checkpoint_interval = 12 [default = 0];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_checkpoint_interval(), target);
+  }
+
+  // optional bool resume_from_checkpoint = 13 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_resume_from_checkpoint(), target);
+  }
+
+  // optional int32 num_chains = 14 [default = 1];
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(14, this->_internal_num_chains(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.GibbsSamplingOptions)
   return target;
 }
 
-int GibbsSamplingOptions::ByteSize() const {
-  int total_size = 0;
+size_t GibbsSamplingOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.GibbsSamplingOptions)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 iterations = 1 [default = 500];
-    if (has_iterations()) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string checkpoint_path = 11;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->iterations());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_checkpoint_path());
     }
 
-    // optional int32 burnin = 2 [default = 0];
-    if (has_burnin()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->burnin());
+    // optional int64 deadline_ms = 5 [default = 0];
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_deadline_ms());
     }
 
-    // optional int32 lag = 3 [default = 10];
-    if (has_lag()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->lag());
+    // optional uint64 seed = 6 [default = 0];
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seed());
+    }
+
+    // optional int32 burnin = 2 [default = 0];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_burnin());
     }
 
     // optional bool track_likelihood = 4 [default = false];
-    if (has_track_likelihood()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 + 1;
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional bool resume_from_checkpoint = 13 [default = false];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional double convergence_tolerance = 8 [default = 0];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 min_iterations = 10 [default = 0];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min_iterations());
+    }
 
-void GibbsSamplingOptions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const GibbsSamplingOptions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GibbsSamplingOptions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
-}
+  if (cached_has_bits & 0x00003f00u) {
+    // optional int32 checkpoint_interval = 12 [default = 0];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_checkpoint_interval());
+    }
 
-void GibbsSamplingOptions::MergeFrom(const GibbsSamplingOptions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_iterations()) {
-      set_iterations(from.iterations());
+    // optional int32 num_chains = 14 [default = 1];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_chains());
     }
-    if (from.has_burnin()) {
-      set_burnin(from.burnin());
+
+    // optional int32 iterations = 1 [default = 500];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_iterations());
     }
-    if (from.has_lag()) {
-      set_lag(from.lag());
+
+    // optional int32 lag = 3 [default = 10];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lag());
     }
-    if (from.has_track_likelihood()) {
-      set_track_likelihood(from.track_likelihood());
+
+    // optional int32 num_threads = 7 [default = 1];
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_threads());
+    }
+
+    // optional int32 convergence_window = 9 [default = 5];
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_convergence_window());
     }
+
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GibbsSamplingOptions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GibbsSamplingOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GibbsSamplingOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GibbsSamplingOptions::GetClassData() const { return &_class_data_; }
+
+
+void GibbsSamplingOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GibbsSamplingOptions*>(&to_msg);
+  auto& from = static_cast<const GibbsSamplingOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.GibbsSamplingOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_checkpoint_path(from._internal_checkpoint_path());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.deadline_ms_ = from._impl_.deadline_ms_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.seed_ = from._impl_.seed_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.burnin_ = from._impl_.burnin_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.track_likelihood_ = from._impl_.track_likelihood_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.resume_from_checkpoint_ = from._impl_.resume_from_checkpoint_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.convergence_tolerance_ = from._impl_.convergence_tolerance_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.min_iterations_ = from._impl_.min_iterations_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00003f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.checkpoint_interval_ = from._impl_.checkpoint_interval_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.num_chains_ = from._impl_.num_chains_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.iterations_ = from._impl_.iterations_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.lag_ = from._impl_.lag_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.num_threads_ = from._impl_.num_threads_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.convergence_window_ = from._impl_.convergence_window_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GibbsSamplingOptions::CopyFrom(const GibbsSamplingOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.GibbsSamplingOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool GibbsSamplingOptions::IsInitialized() const {
-
   return true;
 }
 
-void GibbsSamplingOptions::Swap(GibbsSamplingOptions* other) {
-  if (other != this) {
-    std::swap(iterations_, other->iterations_);
-    std::swap(burnin_, other->burnin_);
-    std::swap(lag_, other->lag_);
-    std::swap(track_likelihood_, other->track_likelihood_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void GibbsSamplingOptions::InternalSwap(GibbsSamplingOptions* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.checkpoint_path_, lhs_arena,
+      &other->_impl_.checkpoint_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GibbsSamplingOptions, _impl_.checkpoint_interval_)
+      + sizeof(GibbsSamplingOptions::_impl_.checkpoint_interval_)
+      - PROTOBUF_FIELD_OFFSET(GibbsSamplingOptions, _impl_.deadline_ms_)>(
+          reinterpret_cast<char*>(&_impl_.deadline_ms_),
+          reinterpret_cast<char*>(&other->_impl_.deadline_ms_));
+  swap(_impl_.num_chains_, other->_impl_.num_chains_);
+  swap(_impl_.iterations_, other->_impl_.iterations_);
+  swap(_impl_.lag_, other->_impl_.lag_);
+  swap(_impl_.num_threads_, other->_impl_.num_threads_);
+  swap(_impl_.convergence_window_, other->_impl_.convergence_window_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GibbsSamplingOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[3]);
 }
 
-::google::protobuf::Metadata GibbsSamplingOptions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GibbsSamplingOptions_descriptor_;
-  metadata.reflection = GibbsSamplingOptions_reflection_;
-  return metadata;
-}
-
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* KLSumOptions_OptimizationStrategy_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return KLSumOptions_OptimizationStrategy_descriptor_;
-}
-bool KLSumOptions_OptimizationStrategy_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
+class KLSumOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<KLSumOptions>()._impl_._has_bits_);
+  static void set_has_optimization_strategy(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
-
-#ifndef _MSC_VER
-const KLSumOptions_OptimizationStrategy KLSumOptions::GREEDY_OPTIMIZATION;
-const KLSumOptions_OptimizationStrategy KLSumOptions::SENTENCE_RANKING;
-const KLSumOptions_OptimizationStrategy KLSumOptions::NUM_OPTIMIZATIONS;
-const KLSumOptions_OptimizationStrategy KLSumOptions::OptimizationStrategy_MIN;
-const KLSumOptions_OptimizationStrategy KLSumOptions::OptimizationStrategy_MAX;
-const int KLSumOptions::OptimizationStrategy_ARRAYSIZE;
-#endif  // _MSC_VER
-::std::string* KLSumOptions::_default_postprocessor_name_ = NULL;
-#ifndef _MSC_VER
-const int KLSumOptions::kOptimizationStrategyFieldNumber;
-const int KLSumOptions::kRedundancyRemovalFieldNumber;
-const int KLSumOptions::kSentencePositionFieldNumber;
-const int KLSumOptions::kSummaryWeightFieldNumber;
-const int KLSumOptions::kPriorWeightFieldNumber;
-const int KLSumOptions::kPostprocessorNameFieldNumber;
-#endif  // !_MSC_VER
-
-KLSumOptions::KLSumOptions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  static void set_has_redundancy_removal(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_sentence_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_summary_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_prior_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_postprocessor_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_lazy_evaluation(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_num_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_fast_log(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_precision(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_collapse_duplicates(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_near_duplicate_similarity(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+};
 
-void KLSumOptions::InitAsDefaultInstance() {
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString KLSumOptions::Impl_::_i_give_permission_to_break_this_code_default_postprocessor_name_{{{"NewsPostprocessor", 17}}, {nullptr}};
+KLSumOptions::KLSumOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.KLSumOptions)
 }
-
 KLSumOptions::KLSumOptions(const KLSumOptions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void KLSumOptions::SharedCtor() {
-  _cached_size_ = 0;
-  optimization_strategy_ = 0;
-  redundancy_removal_ = false;
-  sentence_position_ = false;
-  summary_weight_ = 1;
-  prior_weight_ = 0;
-  postprocessor_name_ = const_cast< ::std::string*>(_default_postprocessor_name_);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  KLSumOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.postprocessor_name_){}
+    , decltype(_impl_.optimization_strategy_){}
+    , decltype(_impl_.redundancy_removal_){}
+    , decltype(_impl_.sentence_position_){}
+    , decltype(_impl_.lazy_evaluation_){}
+    , decltype(_impl_.fast_log_){}
+    , decltype(_impl_.prior_weight_){}
+    , decltype(_impl_.precision_){}
+    , decltype(_impl_.collapse_duplicates_){}
+    , decltype(_impl_.summary_weight_){}
+    , decltype(_impl_.num_threads_){}
+    , decltype(_impl_.near_duplicate_similarity_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.postprocessor_name_.InitDefault();
+  if (from._internal_has_postprocessor_name()) {
+    _this->_impl_.postprocessor_name_.Set(from._internal_postprocessor_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.optimization_strategy_, &from._impl_.optimization_strategy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.near_duplicate_similarity_) -
+    reinterpret_cast<char*>(&_impl_.optimization_strategy_)) + sizeof(_impl_.near_duplicate_similarity_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.KLSumOptions)
+}
+
+inline void KLSumOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.postprocessor_name_){}
+    , decltype(_impl_.optimization_strategy_){0}
+    , decltype(_impl_.redundancy_removal_){false}
+    , decltype(_impl_.sentence_position_){false}
+    , decltype(_impl_.lazy_evaluation_){false}
+    , decltype(_impl_.fast_log_){false}
+    , decltype(_impl_.prior_weight_){0}
+    , decltype(_impl_.precision_){0}
+    , decltype(_impl_.collapse_duplicates_){false}
+    , decltype(_impl_.summary_weight_){1}
+    , decltype(_impl_.num_threads_){1}
+    , decltype(_impl_.near_duplicate_similarity_){0.8}
+  };
+  _impl_.postprocessor_name_.InitDefault();
 }
 
 KLSumOptions::~KLSumOptions() {
+  // @@protoc_insertion_point(destructor:topicsum.KLSumOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void KLSumOptions::SharedDtor() {
-  if (postprocessor_name_ != _default_postprocessor_name_) {
-    delete postprocessor_name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void KLSumOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.postprocessor_name_.Destroy();
 }
 
 void KLSumOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* KLSumOptions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return KLSumOptions_descriptor_;
-}
-
-const KLSumOptions& KLSumOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-KLSumOptions* KLSumOptions::default_instance_ = NULL;
-
-KLSumOptions* KLSumOptions::New() const {
-  return new KLSumOptions;
+  _impl_._cached_size_.Set(size);
 }
 
 void KLSumOptions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    optimization_strategy_ = 0;
-    redundancy_removal_ = false;
-    sentence_position_ = false;
-    summary_weight_ = 1;
-    prior_weight_ = 0;
-    if (has_postprocessor_name()) {
-      if (postprocessor_name_ != _default_postprocessor_name_) {
-        postprocessor_name_->assign(*_default_postprocessor_name_);
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool KLSumOptions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.KLSumOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.postprocessor_name_.ClearToDefault(::topicsum::KLSumOptions::Impl_::_i_give_permission_to_break_this_code_default_postprocessor_name_, GetArenaForAllocation());
+     }
+  if (cached_has_bits & 0x000000feu) {
+    ::memset(&_impl_.optimization_strategy_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.precision_) -
+        reinterpret_cast<char*>(&_impl_.optimization_strategy_)) + sizeof(_impl_.precision_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    _impl_.collapse_duplicates_ = false;
+    _impl_.summary_weight_ = 1;
+    _impl_.num_threads_ = 1;
+    _impl_.near_duplicate_similarity_ = 0.8;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* KLSumOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .topicsum.KLSumOptions.OptimizationStrategy optimization_strategy = 1 [default = GREEDY_OPTIMIZATION];
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::topicsum::KLSumOptions_OptimizationStrategy_IsValid(value)) {
-            set_optimization_strategy(static_cast< ::topicsum::KLSumOptions_OptimizationStrategy >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::topicsum::KLSumOptions_OptimizationStrategy_IsValid(val))) {
+            _internal_set_optimization_strategy(static_cast<::topicsum::KLSumOptions_OptimizationStrategy>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_redundancy_removal;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool redundancy_removal = 2 [default = false];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_redundancy_removal:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &redundancy_removal_)));
-          set_has_redundancy_removal();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_sentence_position;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_redundancy_removal(&has_bits);
+          _impl_.redundancy_removal_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool sentence_position = 3 [default = false];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_sentence_position:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &sentence_position_)));
-          set_has_sentence_position();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(45)) goto parse_summary_weight;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_sentence_position(&has_bits);
+          _impl_.sentence_position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float summary_weight = 5 [default = 1];
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_summary_weight:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &summary_weight_)));
-          set_has_summary_weight();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(53)) goto parse_prior_weight;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_summary_weight(&has_bits);
+          _impl_.summary_weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float prior_weight = 6 [default = 0];
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_prior_weight:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &prior_weight_)));
-          set_has_prior_weight();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(58)) goto parse_postprocessor_name;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_prior_weight(&has_bits);
+          _impl_.prior_weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_postprocessor_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_postprocessor_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->postprocessor_name().data(), this->postprocessor_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void KLSumOptions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_postprocessor_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.KLSumOptions.postprocessor_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool lazy_evaluation = 8 [default = false];
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_lazy_evaluation(&has_bits);
+          _impl_.lazy_evaluation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 num_threads = 9 [default = 1];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_num_threads(&has_bits);
+          _impl_.num_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool fast_log = 10 [default = false];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_fast_log(&has_bits);
+          _impl_.fast_log_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .topicsum.KLSumOptions.Precision precision = 11 [default = DOUBLE];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::topicsum::KLSumOptions_Precision_IsValid(val))) {
+            _internal_set_precision(static_cast<::topicsum::KLSumOptions_Precision>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(11, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool collapse_duplicates = 12 [default = false];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_collapse_duplicates(&has_bits);
+          _impl_.collapse_duplicates_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double near_duplicate_similarity = 13 [default = 0.8];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 105)) {
+          _Internal::set_has_near_duplicate_similarity(&has_bits);
+          _impl_.near_duplicate_similarity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* KLSumOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.KLSumOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .topicsum.KLSumOptions.OptimizationStrategy optimization_strategy = 1 [default = GREEDY_OPTIMIZATION];
-  if (has_optimization_strategy()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->optimization_strategy(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_optimization_strategy(), target);
   }
 
   // optional bool redundancy_removal = 2 [default = false];
-  if (has_redundancy_removal()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->redundancy_removal(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_redundancy_removal(), target);
   }
 
   // optional bool sentence_position = 3 [default = false];
-  if (has_sentence_position()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->sentence_position(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_sentence_position(), target);
   }
 
   // optional float summary_weight = 5 [default = 1];
-  if (has_summary_weight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->summary_weight(), output);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_summary_weight(), target);
   }
 
   // optional float prior_weight = 6 [default = 0];
-  if (has_prior_weight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->prior_weight(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_prior_weight(), target);
   }
 
   // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
-  if (has_postprocessor_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->postprocessor_name().data(), this->postprocessor_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      7, this->postprocessor_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_postprocessor_name().data(), static_cast<int>(this->_internal_postprocessor_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.KLSumOptions.postprocessor_name");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_postprocessor_name(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional bool lazy_evaluation = 8 [default = false];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_lazy_evaluation(), target);
   }
-}
 
-::google::protobuf::uint8* KLSumOptions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional .topicsum.KLSumOptions.OptimizationStrategy optimization_strategy = 1 [default = GREEDY_OPTIMIZATION];
-  if (has_optimization_strategy()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->optimization_strategy(), target);
-  }
-
-  // optional bool redundancy_removal = 2 [default = false];
-  if (has_redundancy_removal()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->redundancy_removal(), target);
+  // optional int32 num_threads = 9 [default = 1];
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_num_threads(), target);
   }
 
-  // optional bool sentence_position = 3 [default = false];
-  if (has_sentence_position()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->sentence_position(), target);
+  // optional bool fast_log = 10 [default = false];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_fast_log(), target);
   }
 
-  // optional float summary_weight = 5 [default = 1];
-  if (has_summary_weight()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->summary_weight(), target);
+  // optional .topicsum.KLSumOptions.Precision precision = 11 [default = DOUBLE];
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_precision(), target);
   }
 
-  // optional float prior_weight = 6 [default = 0];
-  if (has_prior_weight()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->prior_weight(), target);
+  // optional bool collapse_duplicates = 12 [default = false];
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_collapse_duplicates(), target);
   }
 
-  // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
-  if (has_postprocessor_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->postprocessor_name().data(), this->postprocessor_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        7, this->postprocessor_name(), target);
+  // optional double near_duplicate_similarity = 13 [default = 0.8];
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(13, this->_internal_near_duplicate_similarity(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.KLSumOptions)
   return target;
 }
 
-int KLSumOptions::ByteSize() const {
-  int total_size = 0;
+size_t KLSumOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.KLSumOptions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_postprocessor_name());
+    }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // optional .topicsum.KLSumOptions.OptimizationStrategy optimization_strategy = 1 [default = GREEDY_OPTIMIZATION];
-    if (has_optimization_strategy()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->optimization_strategy());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_optimization_strategy());
     }
 
     // optional bool redundancy_removal = 2 [default = false];
-    if (has_redundancy_removal()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 1;
     }
 
     // optional bool sentence_position = 3 [default = false];
-    if (has_sentence_position()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 + 1;
     }
 
-    // optional float summary_weight = 5 [default = 1];
-    if (has_summary_weight()) {
-      total_size += 1 + 4;
+    // optional bool lazy_evaluation = 8 [default = false];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool fast_log = 10 [default = false];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
     }
 
     // optional float prior_weight = 6 [default = 0];
-    if (has_prior_weight()) {
+    if (cached_has_bits & 0x00000040u) {
       total_size += 1 + 4;
     }
 
-    // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
-    if (has_postprocessor_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->postprocessor_name());
+    // optional .topicsum.KLSumOptions.Precision precision = 11 [default = DOUBLE];
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_precision());
+    }
+
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional bool collapse_duplicates = 12 [default = false];
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional float summary_weight = 5 [default = 1];
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 4;
+    }
+
+    // optional int32 num_threads = 9 [default = 1];
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_threads());
+    }
+
+    // optional double near_duplicate_similarity = 13 [default = 0.8];
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 8;
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void KLSumOptions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const KLSumOptions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const KLSumOptions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData KLSumOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    KLSumOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*KLSumOptions::GetClassData() const { return &_class_data_; }
 
-void KLSumOptions::MergeFrom(const KLSumOptions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_optimization_strategy()) {
-      set_optimization_strategy(from.optimization_strategy());
+
+void KLSumOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<KLSumOptions*>(&to_msg);
+  auto& from = static_cast<const KLSumOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.KLSumOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_postprocessor_name(from._internal_postprocessor_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.optimization_strategy_ = from._impl_.optimization_strategy_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.redundancy_removal_ = from._impl_.redundancy_removal_;
     }
-    if (from.has_redundancy_removal()) {
-      set_redundancy_removal(from.redundancy_removal());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.sentence_position_ = from._impl_.sentence_position_;
     }
-    if (from.has_sentence_position()) {
-      set_sentence_position(from.sentence_position());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.lazy_evaluation_ = from._impl_.lazy_evaluation_;
     }
-    if (from.has_summary_weight()) {
-      set_summary_weight(from.summary_weight());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.fast_log_ = from._impl_.fast_log_;
     }
-    if (from.has_prior_weight()) {
-      set_prior_weight(from.prior_weight());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.prior_weight_ = from._impl_.prior_weight_;
     }
-    if (from.has_postprocessor_name()) {
-      set_postprocessor_name(from.postprocessor_name());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.precision_ = from._impl_.precision_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void KLSumOptions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.collapse_duplicates_ = from._impl_.collapse_duplicates_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.summary_weight_ = from._impl_.summary_weight_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.num_threads_ = from._impl_.num_threads_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.near_duplicate_similarity_ = from._impl_.near_duplicate_similarity_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void KLSumOptions::CopyFrom(const KLSumOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.KLSumOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool KLSumOptions::IsInitialized() const {
-
   return true;
 }
 
-void KLSumOptions::Swap(KLSumOptions* other) {
-  if (other != this) {
-    std::swap(optimization_strategy_, other->optimization_strategy_);
-    std::swap(redundancy_removal_, other->redundancy_removal_);
-    std::swap(sentence_position_, other->sentence_position_);
-    std::swap(summary_weight_, other->summary_weight_);
-    std::swap(prior_weight_, other->prior_weight_);
-    std::swap(postprocessor_name_, other->postprocessor_name_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata KLSumOptions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = KLSumOptions_descriptor_;
-  metadata.reflection = KLSumOptions_reflection_;
-  return metadata;
+void KLSumOptions::InternalSwap(KLSumOptions* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.postprocessor_name_, lhs_arena,
+      &other->_impl_.postprocessor_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(KLSumOptions, _impl_.collapse_duplicates_)
+      + sizeof(KLSumOptions::_impl_.collapse_duplicates_)
+      - PROTOBUF_FIELD_OFFSET(KLSumOptions, _impl_.optimization_strategy_)>(
+          reinterpret_cast<char*>(&_impl_.optimization_strategy_),
+          reinterpret_cast<char*>(&other->_impl_.optimization_strategy_));
+  swap(_impl_.summary_weight_, other->_impl_.summary_weight_);
+  swap(_impl_.num_threads_, other->_impl_.num_threads_);
+  swap(_impl_.near_duplicate_similarity_, other->_impl_.near_duplicate_similarity_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata KLSumOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[4]);
 }
 
-
 // ===================================================================
 
-::std::string* TopicSumOptions::_default_lambda_ = NULL;
-::std::string* TopicSumOptions::_default_gamma_ = NULL;
-#ifndef _MSC_VER
-const int TopicSumOptions::kGibbsSamplingOptionsFieldNumber;
-const int TopicSumOptions::kLambdaFieldNumber;
-const int TopicSumOptions::kGammaFieldNumber;
-#endif  // !_MSC_VER
+class TopicSumOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TopicSumOptions>()._impl_._has_bits_);
+  static const ::topicsum::GibbsSamplingOptions& gibbs_sampling_options(const TopicSumOptions* msg);
+  static void set_has_gibbs_sampling_options(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lambda(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_gamma(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_background_model_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_inference(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cvb0_iterations(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_batch_num_threads(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
 
-TopicSumOptions::TopicSumOptions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::topicsum::GibbsSamplingOptions&
+TopicSumOptions::_Internal::gibbs_sampling_options(const TopicSumOptions* msg) {
+  return *msg->_impl_.gibbs_sampling_options_;
 }
-
-void TopicSumOptions::InitAsDefaultInstance() {
-  gibbs_sampling_options_ = const_cast< ::topicsum::GibbsSamplingOptions*>(&::topicsum::GibbsSamplingOptions::default_instance());
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_lambda_{{{"0.1,1,1", 7}}, {nullptr}};
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_gamma_{{{"1,5,10", 6}}, {nullptr}};
+TopicSumOptions::TopicSumOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.TopicSumOptions)
 }
-
 TopicSumOptions::TopicSumOptions(const TopicSumOptions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void TopicSumOptions::SharedCtor() {
-  _cached_size_ = 0;
-  gibbs_sampling_options_ = NULL;
-  lambda_ = const_cast< ::std::string*>(_default_lambda_);
-  gamma_ = const_cast< ::std::string*>(_default_gamma_);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TopicSumOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lambda_){}
+    , decltype(_impl_.gamma_){}
+    , decltype(_impl_.background_model_path_){}
+    , decltype(_impl_.gibbs_sampling_options_){nullptr}
+    , decltype(_impl_.inference_){}
+    , decltype(_impl_.cvb0_iterations_){}
+    , decltype(_impl_.batch_num_threads_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lambda_.InitDefault();
+  if (from._internal_has_lambda()) {
+    _this->_impl_.lambda_.Set(from._internal_lambda(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.gamma_.InitDefault();
+  if (from._internal_has_gamma()) {
+    _this->_impl_.gamma_.Set(from._internal_gamma(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.background_model_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.background_model_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_background_model_path()) {
+    _this->_impl_.background_model_path_.Set(from._internal_background_model_path(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_gibbs_sampling_options()) {
+    _this->_impl_.gibbs_sampling_options_ = new ::topicsum::GibbsSamplingOptions(*from._impl_.gibbs_sampling_options_);
+  }
+  ::memcpy(&_impl_.inference_, &from._impl_.inference_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.batch_num_threads_) -
+    reinterpret_cast<char*>(&_impl_.inference_)) + sizeof(_impl_.batch_num_threads_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.TopicSumOptions)
+}
+
+inline void TopicSumOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lambda_){}
+    , decltype(_impl_.gamma_){}
+    , decltype(_impl_.background_model_path_){}
+    , decltype(_impl_.gibbs_sampling_options_){nullptr}
+    , decltype(_impl_.inference_){0}
+    , decltype(_impl_.cvb0_iterations_){50}
+    , decltype(_impl_.batch_num_threads_){1}
+  };
+  _impl_.lambda_.InitDefault();
+  _impl_.gamma_.InitDefault();
+  _impl_.background_model_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.background_model_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 TopicSumOptions::~TopicSumOptions() {
+  // @@protoc_insertion_point(destructor:topicsum.TopicSumOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TopicSumOptions::SharedDtor() {
-  if (lambda_ != _default_lambda_) {
-    delete lambda_;
-  }
-  if (gamma_ != _default_gamma_) {
-    delete gamma_;
-  }
-  if (this != default_instance_) {
-    delete gibbs_sampling_options_;
-  }
+inline void TopicSumOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lambda_.Destroy();
+  _impl_.gamma_.Destroy();
+  _impl_.background_model_path_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.gibbs_sampling_options_;
 }
 
 void TopicSumOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* TopicSumOptions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return TopicSumOptions_descriptor_;
-}
-
-const TopicSumOptions& TopicSumOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-TopicSumOptions* TopicSumOptions::default_instance_ = NULL;
-
-TopicSumOptions* TopicSumOptions::New() const {
-  return new TopicSumOptions;
+  _impl_._cached_size_.Set(size);
 }
 
 void TopicSumOptions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_gibbs_sampling_options()) {
-      if (gibbs_sampling_options_ != NULL) gibbs_sampling_options_->::topicsum::GibbsSamplingOptions::Clear();
-    }
-    if (has_lambda()) {
-      if (lambda_ != _default_lambda_) {
-        lambda_->assign(*_default_lambda_);
-      }
-    }
-    if (has_gamma()) {
-      if (gamma_ != _default_gamma_) {
-        gamma_->assign(*_default_gamma_);
-      }
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool TopicSumOptions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.TopicSumOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.lambda_.ClearToDefault(::topicsum::TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_lambda_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.gamma_.ClearToDefault(::topicsum::TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_gamma_, GetArenaForAllocation());
+       }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.background_model_path_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.gibbs_sampling_options_ != nullptr);
+      _impl_.gibbs_sampling_options_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000070u) {
+    _impl_.inference_ = 0;
+    _impl_.cvb0_iterations_ = 50;
+    _impl_.batch_num_threads_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TopicSumOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_gibbs_sampling_options()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_lambda;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gibbs_sampling_options(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string lambda = 3 [default = "0.1,1,1"];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_lambda:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_lambda()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->lambda().data(), this->lambda().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_gamma;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_lambda();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.TopicSumOptions.lambda");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional string gamma = 4 [default = "1,5,10"];
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_gamma:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_gamma()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->gamma().data(), this->gamma().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void TopicSumOptions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_gamma();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.TopicSumOptions.gamma");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string background_model_path = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_background_model_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "topicsum.TopicSumOptions.background_model_path");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .topicsum.TopicSumOptions.Inference inference = 9 [default = GIBBS_SAMPLING];
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::topicsum::TopicSumOptions_Inference_IsValid(val))) {
+            _internal_set_inference(static_cast<::topicsum::TopicSumOptions_Inference>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(9, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 cvb0_iterations = 10 [default = 50];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_cvb0_iterations(&has_bits);
+          _impl_.cvb0_iterations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 batch_num_threads = 11 [default = 1];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_batch_num_threads(&has_bits);
+          _impl_.batch_num_threads_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TopicSumOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.TopicSumOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
-  if (has_gibbs_sampling_options()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->gibbs_sampling_options(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::gibbs_sampling_options(this),
+        _Internal::gibbs_sampling_options(this).GetCachedSize(), target, stream);
   }
 
   // optional string lambda = 3 [default = "0.1,1,1"];
-  if (has_lambda()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->lambda().data(), this->lambda().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->lambda(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_lambda().data(), static_cast<int>(this->_internal_lambda().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.TopicSumOptions.lambda");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_lambda(), target);
   }
 
   // optional string gamma = 4 [default = "1,5,10"];
-  if (has_gamma()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->gamma().data(), this->gamma().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->gamma(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_gamma().data(), static_cast<int>(this->_internal_gamma().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.TopicSumOptions.gamma");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_gamma(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional string background_model_path = 8;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_background_model_path().data(), static_cast<int>(this->_internal_background_model_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "topicsum.TopicSumOptions.background_model_path");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_background_model_path(), target);
   }
-}
 
-::google::protobuf::uint8* TopicSumOptions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
-  if (has_gibbs_sampling_options()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->gibbs_sampling_options(), target);
+  // optional .topicsum.TopicSumOptions.Inference inference = 9 [default = GIBBS_SAMPLING];
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_inference(), target);
   }
 
-  // optional string lambda = 3 [default = "0.1,1,1"];
-  if (has_lambda()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->lambda().data(), this->lambda().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->lambda(), target);
+  // optional int32 cvb0_iterations = 10 [default = 50];
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_cvb0_iterations(), target);
   }
 
-  // optional string gamma = 4 [default = "1,5,10"];
-  if (has_gamma()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->gamma().data(), this->gamma().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->gamma(), target);
+  // optional int32 batch_num_threads = 11 [default = 1];
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_batch_num_threads(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.TopicSumOptions)
   return target;
 }
 
-int TopicSumOptions::ByteSize() const {
-  int total_size = 0;
+size_t TopicSumOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.TopicSumOptions)
+  size_t total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
-    if (has_gibbs_sampling_options()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->gibbs_sampling_options());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
     // optional string lambda = 3 [default = "0.1,1,1"];
-    if (has_lambda()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->lambda());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_lambda());
     }
 
     // optional string gamma = 4 [default = "1,5,10"];
-    if (has_gamma()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->gamma());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_gamma());
     }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    // optional string background_model_path = 8;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_background_model_path());
+    }
 
-void TopicSumOptions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const TopicSumOptions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const TopicSumOptions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+    // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.gibbs_sampling_options_);
+    }
 
-void TopicSumOptions::MergeFrom(const TopicSumOptions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_gibbs_sampling_options()) {
-      mutable_gibbs_sampling_options()->::topicsum::GibbsSamplingOptions::MergeFrom(from.gibbs_sampling_options());
+    // optional .topicsum.TopicSumOptions.Inference inference = 9 [default = GIBBS_SAMPLING];
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_inference());
     }
-    if (from.has_lambda()) {
-      set_lambda(from.lambda());
+
+    // optional int32 cvb0_iterations = 10 [default = 50];
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_cvb0_iterations());
     }
-    if (from.has_gamma()) {
-      set_gamma(from.gamma());
+
+    // optional int32 batch_num_threads = 11 [default = 1];
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_batch_num_threads());
     }
+
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TopicSumOptions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TopicSumOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TopicSumOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TopicSumOptions::GetClassData() const { return &_class_data_; }
+
+
+void TopicSumOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TopicSumOptions*>(&to_msg);
+  auto& from = static_cast<const TopicSumOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.TopicSumOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_lambda(from._internal_lambda());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_gamma(from._internal_gamma());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_background_model_path(from._internal_background_model_path());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_gibbs_sampling_options()->::topicsum::GibbsSamplingOptions::MergeFrom(
+          from._internal_gibbs_sampling_options());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.inference_ = from._impl_.inference_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cvb0_iterations_ = from._impl_.cvb0_iterations_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.batch_num_threads_ = from._impl_.batch_num_threads_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TopicSumOptions::CopyFrom(const TopicSumOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.TopicSumOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool TopicSumOptions::IsInitialized() const {
-
   return true;
 }
 
-void TopicSumOptions::Swap(TopicSumOptions* other) {
-  if (other != this) {
-    std::swap(gibbs_sampling_options_, other->gibbs_sampling_options_);
-    std::swap(lambda_, other->lambda_);
-    std::swap(gamma_, other->gamma_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata TopicSumOptions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = TopicSumOptions_descriptor_;
-  metadata.reflection = TopicSumOptions_reflection_;
-  return metadata;
+void TopicSumOptions::InternalSwap(TopicSumOptions* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lambda_, lhs_arena,
+      &other->_impl_.lambda_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.gamma_, lhs_arena,
+      &other->_impl_.gamma_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.background_model_path_, lhs_arena,
+      &other->_impl_.background_model_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TopicSumOptions, _impl_.inference_)
+      + sizeof(TopicSumOptions::_impl_.inference_)
+      - PROTOBUF_FIELD_OFFSET(TopicSumOptions, _impl_.gibbs_sampling_options_)>(
+          reinterpret_cast<char*>(&_impl_.gibbs_sampling_options_),
+          reinterpret_cast<char*>(&other->_impl_.gibbs_sampling_options_));
+  swap(_impl_.cvb0_iterations_, other->_impl_.cvb0_iterations_);
+  swap(_impl_.batch_num_threads_, other->_impl_.batch_num_threads_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TopicSumOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int NewsPostProcessorOptions::kMinSentenceLengthFieldNumber;
-const int NewsPostProcessorOptions::kMaxSentenceLengthFieldNumber;
-#endif  // !_MSC_VER
-
-NewsPostProcessorOptions::NewsPostProcessorOptions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class NewsPostProcessorOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NewsPostProcessorOptions>()._impl_._has_bits_);
+  static void set_has_min_sentence_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_sentence_length(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void NewsPostProcessorOptions::InitAsDefaultInstance() {
+NewsPostProcessorOptions::NewsPostProcessorOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.NewsPostProcessorOptions)
 }
-
 NewsPostProcessorOptions::NewsPostProcessorOptions(const NewsPostProcessorOptions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void NewsPostProcessorOptions::SharedCtor() {
-  _cached_size_ = 0;
-  min_sentence_length_ = 0;
-  max_sentence_length_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NewsPostProcessorOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_sentence_length_){}
+    , decltype(_impl_.max_sentence_length_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_sentence_length_, &from._impl_.min_sentence_length_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_sentence_length_) -
+    reinterpret_cast<char*>(&_impl_.min_sentence_length_)) + sizeof(_impl_.max_sentence_length_));
+  // @@protoc_insertion_point(copy_constructor:topicsum.NewsPostProcessorOptions)
+}
+
+inline void NewsPostProcessorOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_sentence_length_){0}
+    , decltype(_impl_.max_sentence_length_){0}
+  };
 }
 
 NewsPostProcessorOptions::~NewsPostProcessorOptions() {
+  // @@protoc_insertion_point(destructor:topicsum.NewsPostProcessorOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void NewsPostProcessorOptions::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void NewsPostProcessorOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void NewsPostProcessorOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* NewsPostProcessorOptions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return NewsPostProcessorOptions_descriptor_;
-}
-
-const NewsPostProcessorOptions& NewsPostProcessorOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-NewsPostProcessorOptions* NewsPostProcessorOptions::default_instance_ = NULL;
-
-NewsPostProcessorOptions* NewsPostProcessorOptions::New() const {
-  return new NewsPostProcessorOptions;
+  _impl_._cached_size_.Set(size);
 }
 
 void NewsPostProcessorOptions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    min_sentence_length_ = 0;
-    max_sentence_length_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool NewsPostProcessorOptions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.NewsPostProcessorOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.min_sentence_length_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_sentence_length_) -
+        reinterpret_cast<char*>(&_impl_.min_sentence_length_)) + sizeof(_impl_.max_sentence_length_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NewsPostProcessorOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional int32 min_sentence_length = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &min_sentence_length_)));
-          set_has_min_sentence_length();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_max_sentence_length;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_min_sentence_length(&has_bits);
+          _impl_.min_sentence_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 max_sentence_length = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_max_sentence_length:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &max_sentence_length_)));
-          set_has_max_sentence_length();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void NewsPostProcessorOptions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional int32 min_sentence_length = 1;
-  if (has_min_sentence_length()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->min_sentence_length(), output);
-  }
-
-  // optional int32 max_sentence_length = 2;
-  if (has_max_sentence_length()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->max_sentence_length(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* NewsPostProcessorOptions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max_sentence_length(&has_bits);
+          _impl_.max_sentence_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NewsPostProcessorOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.NewsPostProcessorOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional int32 min_sentence_length = 1;
-  if (has_min_sentence_length()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->min_sentence_length(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_min_sentence_length(), target);
   }
 
   // optional int32 max_sentence_length = 2;
-  if (has_max_sentence_length()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->max_sentence_length(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_max_sentence_length(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.NewsPostProcessorOptions)
   return target;
 }
 
-int NewsPostProcessorOptions::ByteSize() const {
-  int total_size = 0;
+size_t NewsPostProcessorOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.NewsPostProcessorOptions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional int32 min_sentence_length = 1;
-    if (has_min_sentence_length()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->min_sentence_length());
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_min_sentence_length());
     }
 
     // optional int32 max_sentence_length = 2;
-    if (has_max_sentence_length()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->max_sentence_length());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_sentence_length());
     }
 
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NewsPostProcessorOptions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const NewsPostProcessorOptions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const NewsPostProcessorOptions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NewsPostProcessorOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NewsPostProcessorOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NewsPostProcessorOptions::GetClassData() const { return &_class_data_; }
 
-void NewsPostProcessorOptions::MergeFrom(const NewsPostProcessorOptions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_min_sentence_length()) {
-      set_min_sentence_length(from.min_sentence_length());
+
+void NewsPostProcessorOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NewsPostProcessorOptions*>(&to_msg);
+  auto& from = static_cast<const NewsPostProcessorOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.NewsPostProcessorOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.min_sentence_length_ = from._impl_.min_sentence_length_;
     }
-    if (from.has_max_sentence_length()) {
-      set_max_sentence_length(from.max_sentence_length());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_sentence_length_ = from._impl_.max_sentence_length_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void NewsPostProcessorOptions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NewsPostProcessorOptions::CopyFrom(const NewsPostProcessorOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.NewsPostProcessorOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool NewsPostProcessorOptions::IsInitialized() const {
-
   return true;
 }
 
-void NewsPostProcessorOptions::Swap(NewsPostProcessorOptions* other) {
-  if (other != this) {
-    std::swap(min_sentence_length_, other->min_sentence_length_);
-    std::swap(max_sentence_length_, other->max_sentence_length_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void NewsPostProcessorOptions::InternalSwap(NewsPostProcessorOptions* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NewsPostProcessorOptions, _impl_.max_sentence_length_)
+      + sizeof(NewsPostProcessorOptions::_impl_.max_sentence_length_)
+      - PROTOBUF_FIELD_OFFSET(NewsPostProcessorOptions, _impl_.min_sentence_length_)>(
+          reinterpret_cast<char*>(&_impl_.min_sentence_length_),
+          reinterpret_cast<char*>(&other->_impl_.min_sentence_length_));
 }
 
-::google::protobuf::Metadata NewsPostProcessorOptions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = NewsPostProcessorOptions_descriptor_;
-  metadata.reflection = NewsPostProcessorOptions_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata NewsPostProcessorOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[6]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* SummarizerOptions_SummaryType_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SummarizerOptions_SummaryType_descriptor_;
-}
-bool SummarizerOptions_SummaryType_IsValid(int value) {
-  switch(value) {
-    case 1:
-    case 2:
-    case 4:
-      return true;
-    default:
-      return false;
+class SummarizerOptions::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SummarizerOptions>()._impl_._has_bits_);
+  static void set_has_summary_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-}
-
-#ifndef _MSC_VER
-const SummarizerOptions_SummaryType SummarizerOptions::GENERIC;
-const SummarizerOptions_SummaryType SummarizerOptions::QUERY;
-const SummarizerOptions_SummaryType SummarizerOptions::UPDATE;
-const SummarizerOptions_SummaryType SummarizerOptions::SummaryType_MIN;
-const SummarizerOptions_SummaryType SummarizerOptions::SummaryType_MAX;
-const int SummarizerOptions::SummaryType_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int SummarizerOptions::kSummaryTypeFieldNumber;
-const int SummarizerOptions::kKlsumOptionsFieldNumber;
-const int SummarizerOptions::kTopicsumOptionsFieldNumber;
-const int SummarizerOptions::kArticleFieldNumber;
-const int SummarizerOptions::kNewsPostprocessorOptionsFieldNumber;
-#endif  // !_MSC_VER
+  static const ::topicsum::KLSumOptions& klsum_options(const SummarizerOptions* msg);
+  static void set_has_klsum_options(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::topicsum::TopicSumOptions& topicsum_options(const SummarizerOptions* msg);
+  static void set_has_topicsum_options(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::topicsum::NewsPostProcessorOptions& news_postprocessor_options(const SummarizerOptions* msg);
+  static void set_has_news_postprocessor_options(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000008) ^ 0x00000008) != 0;
+  }
+};
 
-SummarizerOptions::SummarizerOptions()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::topicsum::KLSumOptions&
+SummarizerOptions::_Internal::klsum_options(const SummarizerOptions* msg) {
+  return *msg->_impl_.klsum_options_;
 }
-
-void SummarizerOptions::InitAsDefaultInstance() {
-  klsum_options_ = const_cast< ::topicsum::KLSumOptions*>(&::topicsum::KLSumOptions::default_instance());
-  topicsum_options_ = const_cast< ::topicsum::TopicSumOptions*>(&::topicsum::TopicSumOptions::default_instance());
-  news_postprocessor_options_ = const_cast< ::topicsum::NewsPostProcessorOptions*>(&::topicsum::NewsPostProcessorOptions::default_instance());
+const ::topicsum::TopicSumOptions&
+SummarizerOptions::_Internal::topicsum_options(const SummarizerOptions* msg) {
+  return *msg->_impl_.topicsum_options_;
 }
-
-SummarizerOptions::SummarizerOptions(const SummarizerOptions& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::topicsum::NewsPostProcessorOptions&
+SummarizerOptions::_Internal::news_postprocessor_options(const SummarizerOptions* msg) {
+  return *msg->_impl_.news_postprocessor_options_;
 }
-
-void SummarizerOptions::SharedCtor() {
-  _cached_size_ = 0;
-  summary_type_ = 1;
-  klsum_options_ = NULL;
-  topicsum_options_ = NULL;
-  news_postprocessor_options_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+SummarizerOptions::SummarizerOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:topicsum.SummarizerOptions)
+}
+SummarizerOptions::SummarizerOptions(const SummarizerOptions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SummarizerOptions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.article_){from._impl_.article_}
+    , decltype(_impl_.klsum_options_){nullptr}
+    , decltype(_impl_.topicsum_options_){nullptr}
+    , decltype(_impl_.news_postprocessor_options_){nullptr}
+    , decltype(_impl_.summary_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_klsum_options()) {
+    _this->_impl_.klsum_options_ = new ::topicsum::KLSumOptions(*from._impl_.klsum_options_);
+  }
+  if (from._internal_has_topicsum_options()) {
+    _this->_impl_.topicsum_options_ = new ::topicsum::TopicSumOptions(*from._impl_.topicsum_options_);
+  }
+  if (from._internal_has_news_postprocessor_options()) {
+    _this->_impl_.news_postprocessor_options_ = new ::topicsum::NewsPostProcessorOptions(*from._impl_.news_postprocessor_options_);
+  }
+  _this->_impl_.summary_type_ = from._impl_.summary_type_;
+  // @@protoc_insertion_point(copy_constructor:topicsum.SummarizerOptions)
+}
+
+inline void SummarizerOptions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.article_){arena}
+    , decltype(_impl_.klsum_options_){nullptr}
+    , decltype(_impl_.topicsum_options_){nullptr}
+    , decltype(_impl_.news_postprocessor_options_){nullptr}
+    , decltype(_impl_.summary_type_){1}
+  };
 }
 
 SummarizerOptions::~SummarizerOptions() {
+  // @@protoc_insertion_point(destructor:topicsum.SummarizerOptions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SummarizerOptions::SharedDtor() {
-  if (this != default_instance_) {
-    delete klsum_options_;
-    delete topicsum_options_;
-    delete news_postprocessor_options_;
-  }
+inline void SummarizerOptions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.article_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.klsum_options_;
+  if (this != internal_default_instance()) delete _impl_.topicsum_options_;
+  if (this != internal_default_instance()) delete _impl_.news_postprocessor_options_;
 }
 
 void SummarizerOptions::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SummarizerOptions::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SummarizerOptions_descriptor_;
-}
-
-const SummarizerOptions& SummarizerOptions::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  return *default_instance_;
-}
-
-SummarizerOptions* SummarizerOptions::default_instance_ = NULL;
-
-SummarizerOptions* SummarizerOptions::New() const {
-  return new SummarizerOptions;
+  _impl_._cached_size_.Set(size);
 }
 
 void SummarizerOptions::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    summary_type_ = 1;
-    if (has_klsum_options()) {
-      if (klsum_options_ != NULL) klsum_options_->::topicsum::KLSumOptions::Clear();
-    }
-    if (has_topicsum_options()) {
-      if (topicsum_options_ != NULL) topicsum_options_->::topicsum::TopicSumOptions::Clear();
-    }
-    if (has_news_postprocessor_options()) {
-      if (news_postprocessor_options_ != NULL) news_postprocessor_options_->::topicsum::NewsPostProcessorOptions::Clear();
-    }
-  }
-  article_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SummarizerOptions::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:topicsum.SummarizerOptions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.article_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.klsum_options_ != nullptr);
+      _impl_.klsum_options_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.topicsum_options_ != nullptr);
+      _impl_.topicsum_options_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.news_postprocessor_options_ != nullptr);
+      _impl_.news_postprocessor_options_->Clear();
+    }
+    _impl_.summary_type_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SummarizerOptions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::topicsum::SummarizerOptions_SummaryType_IsValid(value)) {
-            set_summary_type(static_cast< ::topicsum::SummarizerOptions_SummaryType >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::topicsum::SummarizerOptions_SummaryType_IsValid(val))) {
+            _internal_set_summary_type(static_cast<::topicsum::SummarizerOptions_SummaryType>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_klsum_options;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional .topicsum.KLSumOptions klsum_options = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_klsum_options:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_klsum_options()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_topicsum_options;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_klsum_options(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .topicsum.TopicSumOptions topicsum_options = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_topicsum_options:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_topicsum_options()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_article;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_topicsum_options(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .topicsum.Article article = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_article:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_article()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_article;
-        if (input->ExpectTag(42)) goto parse_news_postprocessor_options;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_article(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional .topicsum.NewsPostProcessorOptions news_postprocessor_options = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_news_postprocessor_options:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_news_postprocessor_options()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SummarizerOptions::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_news_postprocessor_options(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SummarizerOptions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:topicsum.SummarizerOptions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
-  if (has_summary_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->summary_type(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_summary_type(), target);
   }
 
   // optional .topicsum.KLSumOptions klsum_options = 2;
-  if (has_klsum_options()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->klsum_options(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::klsum_options(this),
+        _Internal::klsum_options(this).GetCachedSize(), target, stream);
   }
 
   // optional .topicsum.TopicSumOptions topicsum_options = 3;
-  if (has_topicsum_options()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->topicsum_options(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::topicsum_options(this),
+        _Internal::topicsum_options(this).GetCachedSize(), target, stream);
   }
 
   // repeated .topicsum.Article article = 4;
-  for (int i = 0; i < this->article_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->article(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_article_size()); i < n; i++) {
+    const auto& repfield = this->_internal_article(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional .topicsum.NewsPostProcessorOptions news_postprocessor_options = 5;
-  if (has_news_postprocessor_options()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->news_postprocessor_options(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::news_postprocessor_options(this),
+        _Internal::news_postprocessor_options(this).GetCachedSize(), target, stream);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:topicsum.SummarizerOptions)
+  return target;
 }
 
-::google::protobuf::uint8* SummarizerOptions::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
-  if (has_summary_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->summary_type(), target);
-  }
-
-  // optional .topicsum.KLSumOptions klsum_options = 2;
-  if (has_klsum_options()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->klsum_options(), target);
-  }
+size_t SummarizerOptions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:topicsum.SummarizerOptions)
+  size_t total_size = 0;
 
-  // optional .topicsum.TopicSumOptions topicsum_options = 3;
-  if (has_topicsum_options()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->topicsum_options(), target);
+  // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
+  if (_internal_has_summary_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_summary_type());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .topicsum.Article article = 4;
-  for (int i = 0; i < this->article_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->article(i), target);
-  }
-
-  // optional .topicsum.NewsPostProcessorOptions news_postprocessor_options = 5;
-  if (has_news_postprocessor_options()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->news_postprocessor_options(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  total_size += 1UL * this->_internal_article_size();
+  for (const auto& msg : this->_impl_.article_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  return target;
-}
-
-int SummarizerOptions::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
-    if (has_summary_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->summary_type());
-    }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
     // optional .topicsum.KLSumOptions klsum_options = 2;
-    if (has_klsum_options()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->klsum_options());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.klsum_options_);
     }
 
     // optional .topicsum.TopicSumOptions topicsum_options = 3;
-    if (has_topicsum_options()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->topicsum_options());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.topicsum_options_);
     }
 
     // optional .topicsum.NewsPostProcessorOptions news_postprocessor_options = 5;
-    if (has_news_postprocessor_options()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->news_postprocessor_options());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.news_postprocessor_options_);
     }
 
   }
-  // repeated .topicsum.Article article = 4;
-  total_size += 1 * this->article_size();
-  for (int i = 0; i < this->article_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->article(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SummarizerOptions::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SummarizerOptions* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SummarizerOptions*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SummarizerOptions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SummarizerOptions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SummarizerOptions::GetClassData() const { return &_class_data_; }
+
 
-void SummarizerOptions::MergeFrom(const SummarizerOptions& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  article_.MergeFrom(from.article_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_summary_type()) {
-      set_summary_type(from.summary_type());
+void SummarizerOptions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SummarizerOptions*>(&to_msg);
+  auto& from = static_cast<const SummarizerOptions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:topicsum.SummarizerOptions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.article_.MergeFrom(from._impl_.article_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_klsum_options()->::topicsum::KLSumOptions::MergeFrom(
+          from._internal_klsum_options());
     }
-    if (from.has_klsum_options()) {
-      mutable_klsum_options()->::topicsum::KLSumOptions::MergeFrom(from.klsum_options());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_topicsum_options()->::topicsum::TopicSumOptions::MergeFrom(
+          from._internal_topicsum_options());
     }
-    if (from.has_topicsum_options()) {
-      mutable_topicsum_options()->::topicsum::TopicSumOptions::MergeFrom(from.topicsum_options());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_news_postprocessor_options()->::topicsum::NewsPostProcessorOptions::MergeFrom(
+          from._internal_news_postprocessor_options());
     }
-    if (from.has_news_postprocessor_options()) {
-      mutable_news_postprocessor_options()->::topicsum::NewsPostProcessorOptions::MergeFrom(from.news_postprocessor_options());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.summary_type_ = from._impl_.summary_type_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SummarizerOptions::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SummarizerOptions::CopyFrom(const SummarizerOptions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:topicsum.SummarizerOptions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SummarizerOptions::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SummarizerOptions::Swap(SummarizerOptions* other) {
-  if (other != this) {
-    std::swap(summary_type_, other->summary_type_);
-    std::swap(klsum_options_, other->klsum_options_);
-    std::swap(topicsum_options_, other->topicsum_options_);
-    article_.Swap(&other->article_);
-    std::swap(news_postprocessor_options_, other->news_postprocessor_options_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SummarizerOptions::InternalSwap(SummarizerOptions* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.article_.InternalSwap(&other->_impl_.article_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SummarizerOptions, _impl_.news_postprocessor_options_)
+      + sizeof(SummarizerOptions::_impl_.news_postprocessor_options_)
+      - PROTOBUF_FIELD_OFFSET(SummarizerOptions, _impl_.klsum_options_)>(
+          reinterpret_cast<char*>(&_impl_.klsum_options_),
+          reinterpret_cast<char*>(&other->_impl_.klsum_options_));
+  swap(_impl_.summary_type_, other->_impl_.summary_type_);
 }
 
-::google::protobuf::Metadata SummarizerOptions::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SummarizerOptions_descriptor_;
-  metadata.reflection = SummarizerOptions_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SummarizerOptions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_summarizer_2fsummarizer_2eproto_getter, &descriptor_table_summarizer_2fsummarizer_2eproto_once,
+      file_level_metadata_summarizer_2fsummarizer_2eproto[7]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace topicsum
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::topicsum::Article*
+Arena::CreateMaybeMessage< ::topicsum::Article >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::Article >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::SummaryOptions*
+Arena::CreateMaybeMessage< ::topicsum::SummaryOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::SummaryOptions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::SummaryLength*
+Arena::CreateMaybeMessage< ::topicsum::SummaryLength >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::SummaryLength >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::GibbsSamplingOptions*
+Arena::CreateMaybeMessage< ::topicsum::GibbsSamplingOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::GibbsSamplingOptions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::KLSumOptions*
+Arena::CreateMaybeMessage< ::topicsum::KLSumOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::KLSumOptions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::TopicSumOptions*
+Arena::CreateMaybeMessage< ::topicsum::TopicSumOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::TopicSumOptions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::NewsPostProcessorOptions*
+Arena::CreateMaybeMessage< ::topicsum::NewsPostProcessorOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::NewsPostProcessorOptions >(arena);
+}
+template<> PROTOBUF_NOINLINE ::topicsum::SummarizerOptions*
+Arena::CreateMaybeMessage< ::topicsum::SummarizerOptions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::topicsum::SummarizerOptions >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,1162 +1,2451 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: summarizer/summarizer.proto
 
-#ifndef PROTOBUF_summarizer_2fsummarizer_2eproto__INCLUDED
-#define PROTOBUF_summarizer_2fsummarizer_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_summarizer_2fsummarizer_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_summarizer_2fsummarizer_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include "summarizer/document.pb.h"
 #include "summarizer/distribution.pb.h"
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_summarizer_2fsummarizer_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_summarizer_2fsummarizer_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_summarizer_2fsummarizer_2eproto;
 namespace topicsum {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
 class Article;
-class SummaryOptions;
-class SummaryLength;
+struct ArticleDefaultTypeInternal;
+extern ArticleDefaultTypeInternal _Article_default_instance_;
 class GibbsSamplingOptions;
+struct GibbsSamplingOptionsDefaultTypeInternal;
+extern GibbsSamplingOptionsDefaultTypeInternal _GibbsSamplingOptions_default_instance_;
 class KLSumOptions;
-class TopicSumOptions;
+struct KLSumOptionsDefaultTypeInternal;
+extern KLSumOptionsDefaultTypeInternal _KLSumOptions_default_instance_;
 class NewsPostProcessorOptions;
+struct NewsPostProcessorOptionsDefaultTypeInternal;
+extern NewsPostProcessorOptionsDefaultTypeInternal _NewsPostProcessorOptions_default_instance_;
 class SummarizerOptions;
+struct SummarizerOptionsDefaultTypeInternal;
+extern SummarizerOptionsDefaultTypeInternal _SummarizerOptions_default_instance_;
+class SummaryLength;
+struct SummaryLengthDefaultTypeInternal;
+extern SummaryLengthDefaultTypeInternal _SummaryLength_default_instance_;
+class SummaryOptions;
+struct SummaryOptionsDefaultTypeInternal;
+extern SummaryOptionsDefaultTypeInternal _SummaryOptions_default_instance_;
+class TopicSumOptions;
+struct TopicSumOptionsDefaultTypeInternal;
+extern TopicSumOptionsDefaultTypeInternal _TopicSumOptions_default_instance_;
+}  // namespace topicsum
+PROTOBUF_NAMESPACE_OPEN
+template<> ::topicsum::Article* Arena::CreateMaybeMessage<::topicsum::Article>(Arena*);
+template<> ::topicsum::GibbsSamplingOptions* Arena::CreateMaybeMessage<::topicsum::GibbsSamplingOptions>(Arena*);
+template<> ::topicsum::KLSumOptions* Arena::CreateMaybeMessage<::topicsum::KLSumOptions>(Arena*);
+template<> ::topicsum::NewsPostProcessorOptions* Arena::CreateMaybeMessage<::topicsum::NewsPostProcessorOptions>(Arena*);
+template<> ::topicsum::SummarizerOptions* Arena::CreateMaybeMessage<::topicsum::SummarizerOptions>(Arena*);
+template<> ::topicsum::SummaryLength* Arena::CreateMaybeMessage<::topicsum::SummaryLength>(Arena*);
+template<> ::topicsum::SummaryOptions* Arena::CreateMaybeMessage<::topicsum::SummaryOptions>(Arena*);
+template<> ::topicsum::TopicSumOptions* Arena::CreateMaybeMessage<::topicsum::TopicSumOptions>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace topicsum {
 
-enum SummaryLength_LengthUnit {
+enum SummaryLength_LengthUnit : int {
   SummaryLength_LengthUnit_CHARACTER = 0,
   SummaryLength_LengthUnit_TOKEN = 1,
   SummaryLength_LengthUnit_SENTENCE = 2,
   SummaryLength_LengthUnit_NUM_LENGTH_UNITS = 3
 };
 bool SummaryLength_LengthUnit_IsValid(int value);
-const SummaryLength_LengthUnit SummaryLength_LengthUnit_LengthUnit_MIN = SummaryLength_LengthUnit_CHARACTER;
-const SummaryLength_LengthUnit SummaryLength_LengthUnit_LengthUnit_MAX = SummaryLength_LengthUnit_NUM_LENGTH_UNITS;
-const int SummaryLength_LengthUnit_LengthUnit_ARRAYSIZE = SummaryLength_LengthUnit_LengthUnit_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SummaryLength_LengthUnit_descriptor();
-inline const ::std::string& SummaryLength_LengthUnit_Name(SummaryLength_LengthUnit value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SummaryLength_LengthUnit_descriptor(), value);
+constexpr SummaryLength_LengthUnit SummaryLength_LengthUnit_LengthUnit_MIN = SummaryLength_LengthUnit_CHARACTER;
+constexpr SummaryLength_LengthUnit SummaryLength_LengthUnit_LengthUnit_MAX = SummaryLength_LengthUnit_NUM_LENGTH_UNITS;
+constexpr int SummaryLength_LengthUnit_LengthUnit_ARRAYSIZE = SummaryLength_LengthUnit_LengthUnit_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SummaryLength_LengthUnit_descriptor();
+template<typename T>
+inline const std::string& SummaryLength_LengthUnit_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SummaryLength_LengthUnit>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SummaryLength_LengthUnit_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SummaryLength_LengthUnit_descriptor(), enum_t_value);
 }
 inline bool SummaryLength_LengthUnit_Parse(
-    const ::std::string& name, SummaryLength_LengthUnit* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SummaryLength_LengthUnit>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SummaryLength_LengthUnit* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SummaryLength_LengthUnit>(
     SummaryLength_LengthUnit_descriptor(), name, value);
 }
-enum KLSumOptions_OptimizationStrategy {
+enum KLSumOptions_OptimizationStrategy : int {
   KLSumOptions_OptimizationStrategy_GREEDY_OPTIMIZATION = 0,
   KLSumOptions_OptimizationStrategy_SENTENCE_RANKING = 1,
   KLSumOptions_OptimizationStrategy_NUM_OPTIMIZATIONS = 2
 };
 bool KLSumOptions_OptimizationStrategy_IsValid(int value);
-const KLSumOptions_OptimizationStrategy KLSumOptions_OptimizationStrategy_OptimizationStrategy_MIN = KLSumOptions_OptimizationStrategy_GREEDY_OPTIMIZATION;
-const KLSumOptions_OptimizationStrategy KLSumOptions_OptimizationStrategy_OptimizationStrategy_MAX = KLSumOptions_OptimizationStrategy_NUM_OPTIMIZATIONS;
-const int KLSumOptions_OptimizationStrategy_OptimizationStrategy_ARRAYSIZE = KLSumOptions_OptimizationStrategy_OptimizationStrategy_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* KLSumOptions_OptimizationStrategy_descriptor();
-inline const ::std::string& KLSumOptions_OptimizationStrategy_Name(KLSumOptions_OptimizationStrategy value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    KLSumOptions_OptimizationStrategy_descriptor(), value);
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions_OptimizationStrategy_OptimizationStrategy_MIN = KLSumOptions_OptimizationStrategy_GREEDY_OPTIMIZATION;
+constexpr KLSumOptions_OptimizationStrategy KLSumOptions_OptimizationStrategy_OptimizationStrategy_MAX = KLSumOptions_OptimizationStrategy_NUM_OPTIMIZATIONS;
+constexpr int KLSumOptions_OptimizationStrategy_OptimizationStrategy_ARRAYSIZE = KLSumOptions_OptimizationStrategy_OptimizationStrategy_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* KLSumOptions_OptimizationStrategy_descriptor();
+template<typename T>
+inline const std::string& KLSumOptions_OptimizationStrategy_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, KLSumOptions_OptimizationStrategy>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function KLSumOptions_OptimizationStrategy_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    KLSumOptions_OptimizationStrategy_descriptor(), enum_t_value);
 }
 inline bool KLSumOptions_OptimizationStrategy_Parse(
-    const ::std::string& name, KLSumOptions_OptimizationStrategy* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<KLSumOptions_OptimizationStrategy>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, KLSumOptions_OptimizationStrategy* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<KLSumOptions_OptimizationStrategy>(
     KLSumOptions_OptimizationStrategy_descriptor(), name, value);
 }
-enum SummarizerOptions_SummaryType {
+enum KLSumOptions_Precision : int {
+  KLSumOptions_Precision_DOUBLE = 0,
+  KLSumOptions_Precision_FLOAT = 1
+};
+bool KLSumOptions_Precision_IsValid(int value);
+constexpr KLSumOptions_Precision KLSumOptions_Precision_Precision_MIN = KLSumOptions_Precision_DOUBLE;
+constexpr KLSumOptions_Precision KLSumOptions_Precision_Precision_MAX = KLSumOptions_Precision_FLOAT;
+constexpr int KLSumOptions_Precision_Precision_ARRAYSIZE = KLSumOptions_Precision_Precision_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* KLSumOptions_Precision_descriptor();
+template<typename T>
+inline const std::string& KLSumOptions_Precision_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, KLSumOptions_Precision>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function KLSumOptions_Precision_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    KLSumOptions_Precision_descriptor(), enum_t_value);
+}
+inline bool KLSumOptions_Precision_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, KLSumOptions_Precision* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<KLSumOptions_Precision>(
+    KLSumOptions_Precision_descriptor(), name, value);
+}
+enum TopicSumOptions_Inference : int {
+  TopicSumOptions_Inference_GIBBS_SAMPLING = 0,
+  TopicSumOptions_Inference_CVB0 = 1
+};
+bool TopicSumOptions_Inference_IsValid(int value);
+constexpr TopicSumOptions_Inference TopicSumOptions_Inference_Inference_MIN = TopicSumOptions_Inference_GIBBS_SAMPLING;
+constexpr TopicSumOptions_Inference TopicSumOptions_Inference_Inference_MAX = TopicSumOptions_Inference_CVB0;
+constexpr int TopicSumOptions_Inference_Inference_ARRAYSIZE = TopicSumOptions_Inference_Inference_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TopicSumOptions_Inference_descriptor();
+template<typename T>
+inline const std::string& TopicSumOptions_Inference_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TopicSumOptions_Inference>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TopicSumOptions_Inference_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TopicSumOptions_Inference_descriptor(), enum_t_value);
+}
+inline bool TopicSumOptions_Inference_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TopicSumOptions_Inference* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TopicSumOptions_Inference>(
+    TopicSumOptions_Inference_descriptor(), name, value);
+}
+enum SummarizerOptions_SummaryType : int {
   SummarizerOptions_SummaryType_GENERIC = 1,
   SummarizerOptions_SummaryType_QUERY = 2,
   SummarizerOptions_SummaryType_UPDATE = 4
 };
 bool SummarizerOptions_SummaryType_IsValid(int value);
-const SummarizerOptions_SummaryType SummarizerOptions_SummaryType_SummaryType_MIN = SummarizerOptions_SummaryType_GENERIC;
-const SummarizerOptions_SummaryType SummarizerOptions_SummaryType_SummaryType_MAX = SummarizerOptions_SummaryType_UPDATE;
-const int SummarizerOptions_SummaryType_SummaryType_ARRAYSIZE = SummarizerOptions_SummaryType_SummaryType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* SummarizerOptions_SummaryType_descriptor();
-inline const ::std::string& SummarizerOptions_SummaryType_Name(SummarizerOptions_SummaryType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SummarizerOptions_SummaryType_descriptor(), value);
+constexpr SummarizerOptions_SummaryType SummarizerOptions_SummaryType_SummaryType_MIN = SummarizerOptions_SummaryType_GENERIC;
+constexpr SummarizerOptions_SummaryType SummarizerOptions_SummaryType_SummaryType_MAX = SummarizerOptions_SummaryType_UPDATE;
+constexpr int SummarizerOptions_SummaryType_SummaryType_ARRAYSIZE = SummarizerOptions_SummaryType_SummaryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SummarizerOptions_SummaryType_descriptor();
+template<typename T>
+inline const std::string& SummarizerOptions_SummaryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SummarizerOptions_SummaryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SummarizerOptions_SummaryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SummarizerOptions_SummaryType_descriptor(), enum_t_value);
 }
 inline bool SummarizerOptions_SummaryType_Parse(
-    const ::std::string& name, SummarizerOptions_SummaryType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SummarizerOptions_SummaryType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SummarizerOptions_SummaryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SummarizerOptions_SummaryType>(
     SummarizerOptions_SummaryType_descriptor(), name, value);
 }
 // ===================================================================
 
-class Article : public ::google::protobuf::Message {
+class Article final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.Article) */ {
  public:
-  Article();
-  virtual ~Article();
+  inline Article() : Article(nullptr) {}
+  ~Article() override;
+  explicit PROTOBUF_CONSTEXPR Article(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Article(const Article& from);
+  Article(Article&& from) noexcept
+    : Article() {
+    *this = ::std::move(from);
+  }
 
   inline Article& operator=(const Article& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Article& operator=(Article&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Article& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Article& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Article* internal_default_instance() {
+    return reinterpret_cast<const Article*>(
+               &_Article_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Article* other);
+  friend void swap(Article& a, Article& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Article* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Article* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Article* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Article* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Article>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Article& from);
-  void MergeFrom(const Article& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Article& from) {
+    Article::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Article* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.Article";
+  }
+  protected:
+  explicit Article(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional string content = 1;
-  inline bool has_content() const;
-  inline void clear_content();
-  static const int kContentFieldNumber = 1;
-  inline const ::std::string& content() const;
-  inline void set_content(const ::std::string& value);
-  inline void set_content(const char* value);
-  inline void set_content(const char* value, size_t size);
-  inline ::std::string* mutable_content();
-  inline ::std::string* release_content();
-  inline void set_allocated_content(::std::string* content);
-
+  enum : int {
+    kScoreFieldNumber = 2,
+    kContentFieldNumber = 1,
+  };
   // repeated float score = 2;
-  inline int score_size() const;
-  inline void clear_score();
-  static const int kScoreFieldNumber = 2;
-  inline float score(int index) const;
-  inline void set_score(int index, float value);
-  inline void add_score(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
+  int score_size() const;
+  private:
+  int _internal_score_size() const;
+  public:
+  void clear_score();
+  private:
+  float _internal_score(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_score() const;
+  void _internal_add_score(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_score();
+  public:
+  float score(int index) const;
+  void set_score(int index, float value);
+  void add_score(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
       score() const;
-  inline ::google::protobuf::RepeatedField< float >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
       mutable_score();
 
+  // optional string content = 1;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
   // @@protoc_insertion_point(class_scope:topicsum.Article)
  private:
-  inline void set_has_content();
-  inline void clear_has_content();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* content_;
-  ::google::protobuf::RepeatedField< float > score_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static Article* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > score_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SummaryOptions : public ::google::protobuf::Message {
+class SummaryOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.SummaryOptions) */ {
  public:
-  SummaryOptions();
-  virtual ~SummaryOptions();
+  inline SummaryOptions() : SummaryOptions(nullptr) {}
+  ~SummaryOptions() override;
+  explicit PROTOBUF_CONSTEXPR SummaryOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SummaryOptions(const SummaryOptions& from);
+  SummaryOptions(SummaryOptions&& from) noexcept
+    : SummaryOptions() {
+    *this = ::std::move(from);
+  }
 
   inline SummaryOptions& operator=(const SummaryOptions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SummaryOptions& operator=(SummaryOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SummaryOptions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SummaryOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SummaryOptions* internal_default_instance() {
+    return reinterpret_cast<const SummaryOptions*>(
+               &_SummaryOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(SummaryOptions* other);
+  friend void swap(SummaryOptions& a, SummaryOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SummaryOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SummaryOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SummaryOptions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SummaryOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SummaryOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SummaryOptions& from);
-  void MergeFrom(const SummaryOptions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SummaryOptions& from) {
+    SummaryOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SummaryOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.SummaryOptions";
+  }
+  protected:
+  explicit SummaryOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAdditionalLengthFieldNumber = 9,
+    kLengthFieldNumber = 1,
+    kDeadlineMsFieldNumber = 10,
+    kGenerateDebugFieldNumber = 8,
+  };
+  // repeated .topicsum.SummaryLength additional_length = 9;
+  int additional_length_size() const;
+  private:
+  int _internal_additional_length_size() const;
+  public:
+  void clear_additional_length();
+  ::topicsum::SummaryLength* mutable_additional_length(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::SummaryLength >*
+      mutable_additional_length();
+  private:
+  const ::topicsum::SummaryLength& _internal_additional_length(int index) const;
+  ::topicsum::SummaryLength* _internal_add_additional_length();
+  public:
+  const ::topicsum::SummaryLength& additional_length(int index) const;
+  ::topicsum::SummaryLength* add_additional_length();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::SummaryLength >&
+      additional_length() const;
+
   // optional .topicsum.SummaryLength length = 1;
-  inline bool has_length() const;
-  inline void clear_length();
-  static const int kLengthFieldNumber = 1;
-  inline const ::topicsum::SummaryLength& length() const;
-  inline ::topicsum::SummaryLength* mutable_length();
-  inline ::topicsum::SummaryLength* release_length();
-  inline void set_allocated_length(::topicsum::SummaryLength* length);
+  bool has_length() const;
+  private:
+  bool _internal_has_length() const;
+  public:
+  void clear_length();
+  const ::topicsum::SummaryLength& length() const;
+  PROTOBUF_NODISCARD ::topicsum::SummaryLength* release_length();
+  ::topicsum::SummaryLength* mutable_length();
+  void set_allocated_length(::topicsum::SummaryLength* length);
+  private:
+  const ::topicsum::SummaryLength& _internal_length() const;
+  ::topicsum::SummaryLength* _internal_mutable_length();
+  public:
+  void unsafe_arena_set_allocated_length(
+      ::topicsum::SummaryLength* length);
+  ::topicsum::SummaryLength* unsafe_arena_release_length();
+
+  // optional int64 deadline_ms = 10 [default = 0];
+  bool has_deadline_ms() const;
+  private:
+  bool _internal_has_deadline_ms() const;
+  public:
+  void clear_deadline_ms();
+  int64_t deadline_ms() const;
+  void set_deadline_ms(int64_t value);
+  private:
+  int64_t _internal_deadline_ms() const;
+  void _internal_set_deadline_ms(int64_t value);
+  public:
 
   // optional bool generate_debug = 8 [default = false];
-  inline bool has_generate_debug() const;
-  inline void clear_generate_debug();
-  static const int kGenerateDebugFieldNumber = 8;
-  inline bool generate_debug() const;
-  inline void set_generate_debug(bool value);
+  bool has_generate_debug() const;
+  private:
+  bool _internal_has_generate_debug() const;
+  public:
+  void clear_generate_debug();
+  bool generate_debug() const;
+  void set_generate_debug(bool value);
+  private:
+  bool _internal_generate_debug() const;
+  void _internal_set_generate_debug(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.SummaryOptions)
  private:
-  inline void set_has_length();
-  inline void clear_has_length();
-  inline void set_has_generate_debug();
-  inline void clear_has_generate_debug();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::topicsum::SummaryLength* length_;
-  bool generate_debug_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static SummaryOptions* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::SummaryLength > additional_length_;
+    ::topicsum::SummaryLength* length_;
+    int64_t deadline_ms_;
+    bool generate_debug_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SummaryLength : public ::google::protobuf::Message {
+class SummaryLength final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.SummaryLength) */ {
  public:
-  SummaryLength();
-  virtual ~SummaryLength();
+  inline SummaryLength() : SummaryLength(nullptr) {}
+  ~SummaryLength() override;
+  explicit PROTOBUF_CONSTEXPR SummaryLength(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SummaryLength(const SummaryLength& from);
+  SummaryLength(SummaryLength&& from) noexcept
+    : SummaryLength() {
+    *this = ::std::move(from);
+  }
 
   inline SummaryLength& operator=(const SummaryLength& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SummaryLength& operator=(SummaryLength&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SummaryLength& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SummaryLength& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SummaryLength* internal_default_instance() {
+    return reinterpret_cast<const SummaryLength*>(
+               &_SummaryLength_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(SummaryLength* other);
+  friend void swap(SummaryLength& a, SummaryLength& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SummaryLength* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SummaryLength* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SummaryLength* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SummaryLength* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SummaryLength>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SummaryLength& from);
-  void MergeFrom(const SummaryLength& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SummaryLength& from) {
+    SummaryLength::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SummaryLength* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.SummaryLength";
+  }
+  protected:
+  explicit SummaryLength(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef SummaryLength_LengthUnit LengthUnit;
-  static const LengthUnit CHARACTER = SummaryLength_LengthUnit_CHARACTER;
-  static const LengthUnit TOKEN = SummaryLength_LengthUnit_TOKEN;
-  static const LengthUnit SENTENCE = SummaryLength_LengthUnit_SENTENCE;
-  static const LengthUnit NUM_LENGTH_UNITS = SummaryLength_LengthUnit_NUM_LENGTH_UNITS;
+  static constexpr LengthUnit CHARACTER =
+    SummaryLength_LengthUnit_CHARACTER;
+  static constexpr LengthUnit TOKEN =
+    SummaryLength_LengthUnit_TOKEN;
+  static constexpr LengthUnit SENTENCE =
+    SummaryLength_LengthUnit_SENTENCE;
+  static constexpr LengthUnit NUM_LENGTH_UNITS =
+    SummaryLength_LengthUnit_NUM_LENGTH_UNITS;
   static inline bool LengthUnit_IsValid(int value) {
     return SummaryLength_LengthUnit_IsValid(value);
   }
-  static const LengthUnit LengthUnit_MIN =
+  static constexpr LengthUnit LengthUnit_MIN =
     SummaryLength_LengthUnit_LengthUnit_MIN;
-  static const LengthUnit LengthUnit_MAX =
+  static constexpr LengthUnit LengthUnit_MAX =
     SummaryLength_LengthUnit_LengthUnit_MAX;
-  static const int LengthUnit_ARRAYSIZE =
+  static constexpr int LengthUnit_ARRAYSIZE =
     SummaryLength_LengthUnit_LengthUnit_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   LengthUnit_descriptor() {
     return SummaryLength_LengthUnit_descriptor();
   }
-  static inline const ::std::string& LengthUnit_Name(LengthUnit value) {
-    return SummaryLength_LengthUnit_Name(value);
+  template<typename T>
+  static inline const std::string& LengthUnit_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, LengthUnit>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function LengthUnit_Name.");
+    return SummaryLength_LengthUnit_Name(enum_t_value);
   }
-  static inline bool LengthUnit_Parse(const ::std::string& name,
+  static inline bool LengthUnit_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       LengthUnit* value) {
     return SummaryLength_LengthUnit_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUnitFieldNumber = 1,
+    kLengthFieldNumber = 2,
+  };
   // required .topicsum.SummaryLength.LengthUnit unit = 1;
-  inline bool has_unit() const;
-  inline void clear_unit();
-  static const int kUnitFieldNumber = 1;
-  inline ::topicsum::SummaryLength_LengthUnit unit() const;
-  inline void set_unit(::topicsum::SummaryLength_LengthUnit value);
+  bool has_unit() const;
+  private:
+  bool _internal_has_unit() const;
+  public:
+  void clear_unit();
+  ::topicsum::SummaryLength_LengthUnit unit() const;
+  void set_unit(::topicsum::SummaryLength_LengthUnit value);
+  private:
+  ::topicsum::SummaryLength_LengthUnit _internal_unit() const;
+  void _internal_set_unit(::topicsum::SummaryLength_LengthUnit value);
+  public:
 
   // required int32 length = 2;
-  inline bool has_length() const;
-  inline void clear_length();
-  static const int kLengthFieldNumber = 2;
-  inline ::google::protobuf::int32 length() const;
-  inline void set_length(::google::protobuf::int32 value);
+  bool has_length() const;
+  private:
+  bool _internal_has_length() const;
+  public:
+  void clear_length();
+  int32_t length() const;
+  void set_length(int32_t value);
+  private:
+  int32_t _internal_length() const;
+  void _internal_set_length(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.SummaryLength)
  private:
-  inline void set_has_unit();
-  inline void clear_has_unit();
-  inline void set_has_length();
-  inline void clear_has_length();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  int unit_;
-  ::google::protobuf::int32 length_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static SummaryLength* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int unit_;
+    int32_t length_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GibbsSamplingOptions : public ::google::protobuf::Message {
+class GibbsSamplingOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.GibbsSamplingOptions) */ {
  public:
-  GibbsSamplingOptions();
-  virtual ~GibbsSamplingOptions();
+  inline GibbsSamplingOptions() : GibbsSamplingOptions(nullptr) {}
+  ~GibbsSamplingOptions() override;
+  explicit PROTOBUF_CONSTEXPR GibbsSamplingOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GibbsSamplingOptions(const GibbsSamplingOptions& from);
+  GibbsSamplingOptions(GibbsSamplingOptions&& from) noexcept
+    : GibbsSamplingOptions() {
+    *this = ::std::move(from);
+  }
 
   inline GibbsSamplingOptions& operator=(const GibbsSamplingOptions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline GibbsSamplingOptions& operator=(GibbsSamplingOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GibbsSamplingOptions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GibbsSamplingOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GibbsSamplingOptions* internal_default_instance() {
+    return reinterpret_cast<const GibbsSamplingOptions*>(
+               &_GibbsSamplingOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(GibbsSamplingOptions* other);
+  friend void swap(GibbsSamplingOptions& a, GibbsSamplingOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GibbsSamplingOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GibbsSamplingOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  GibbsSamplingOptions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  GibbsSamplingOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GibbsSamplingOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GibbsSamplingOptions& from);
-  void MergeFrom(const GibbsSamplingOptions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GibbsSamplingOptions& from) {
+    GibbsSamplingOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GibbsSamplingOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.GibbsSamplingOptions";
+  }
+  protected:
+  explicit GibbsSamplingOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 iterations = 1 [default = 500];
-  inline bool has_iterations() const;
-  inline void clear_iterations();
-  static const int kIterationsFieldNumber = 1;
-  inline ::google::protobuf::int32 iterations() const;
-  inline void set_iterations(::google::protobuf::int32 value);
+  enum : int {
+    kCheckpointPathFieldNumber = 11,
+    kDeadlineMsFieldNumber = 5,
+    kSeedFieldNumber = 6,
+    kBurninFieldNumber = 2,
+    kTrackLikelihoodFieldNumber = 4,
+    kResumeFromCheckpointFieldNumber = 13,
+    kConvergenceToleranceFieldNumber = 8,
+    kMinIterationsFieldNumber = 10,
+    kCheckpointIntervalFieldNumber = 12,
+    kNumChainsFieldNumber = 14,
+    kIterationsFieldNumber = 1,
+    kLagFieldNumber = 3,
+    kNumThreadsFieldNumber = 7,
+    kConvergenceWindowFieldNumber = 9,
+  };
+  // optional string checkpoint_path = 11;
+  bool has_checkpoint_path() const;
+  private:
+  bool _internal_has_checkpoint_path() const;
+  public:
+  void clear_checkpoint_path();
+  const std::string& checkpoint_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_checkpoint_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_checkpoint_path();
+  PROTOBUF_NODISCARD std::string* release_checkpoint_path();
+  void set_allocated_checkpoint_path(std::string* checkpoint_path);
+  private:
+  const std::string& _internal_checkpoint_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_checkpoint_path(const std::string& value);
+  std::string* _internal_mutable_checkpoint_path();
+  public:
+
+  // optional int64 deadline_ms = 5 [default = 0];
+  bool has_deadline_ms() const;
+  private:
+  bool _internal_has_deadline_ms() const;
+  public:
+  void clear_deadline_ms();
+  int64_t deadline_ms() const;
+  void set_deadline_ms(int64_t value);
+  private:
+  int64_t _internal_deadline_ms() const;
+  void _internal_set_deadline_ms(int64_t value);
+  public:
+
+  // optional uint64 seed = 6 [default = 0];
+  bool has_seed() const;
+  private:
+  bool _internal_has_seed() const;
+  public:
+  void clear_seed();
+  uint64_t seed() const;
+  void set_seed(uint64_t value);
+  private:
+  uint64_t _internal_seed() const;
+  void _internal_set_seed(uint64_t value);
+  public:
 
   // optional int32 burnin = 2 [default = 0];
-  inline bool has_burnin() const;
-  inline void clear_burnin();
-  static const int kBurninFieldNumber = 2;
-  inline ::google::protobuf::int32 burnin() const;
-  inline void set_burnin(::google::protobuf::int32 value);
+  bool has_burnin() const;
+  private:
+  bool _internal_has_burnin() const;
+  public:
+  void clear_burnin();
+  int32_t burnin() const;
+  void set_burnin(int32_t value);
+  private:
+  int32_t _internal_burnin() const;
+  void _internal_set_burnin(int32_t value);
+  public:
+
+  // optional bool track_likelihood = 4 [default = false];
+  bool has_track_likelihood() const;
+  private:
+  bool _internal_has_track_likelihood() const;
+  public:
+  void clear_track_likelihood();
+  bool track_likelihood() const;
+  void set_track_likelihood(bool value);
+  private:
+  bool _internal_track_likelihood() const;
+  void _internal_set_track_likelihood(bool value);
+  public:
+
+  // optional bool resume_from_checkpoint = 13 [default = false];
+  bool has_resume_from_checkpoint() const;
+  private:
+  bool _internal_has_resume_from_checkpoint() const;
+  public:
+  void clear_resume_from_checkpoint();
+  bool resume_from_checkpoint() const;
+  void set_resume_from_checkpoint(bool value);
+  private:
+  bool _internal_resume_from_checkpoint() const;
+  void _internal_set_resume_from_checkpoint(bool value);
+  public:
+
+  // optional double convergence_tolerance = 8 [default = 0];
+  bool has_convergence_tolerance() const;
+  private:
+  bool _internal_has_convergence_tolerance() const;
+  public:
+  void clear_convergence_tolerance();
+  double convergence_tolerance() const;
+  void set_convergence_tolerance(double value);
+  private:
+  double _internal_convergence_tolerance() const;
+  void _internal_set_convergence_tolerance(double value);
+  public:
+
+  // optional int32 min_iterations = 10 [default = 0];
+  bool has_min_iterations() const;
+  private:
+  bool _internal_has_min_iterations() const;
+  public:
+  void clear_min_iterations();
+  int32_t min_iterations() const;
+  void set_min_iterations(int32_t value);
+  private:
+  int32_t _internal_min_iterations() const;
+  void _internal_set_min_iterations(int32_t value);
+  public:
+
+  // optional int32 checkpoint_interval = 12 [default = 0];
+  bool has_checkpoint_interval() const;
+  private:
+  bool _internal_has_checkpoint_interval() const;
+  public:
+  void clear_checkpoint_interval();
+  int32_t checkpoint_interval() const;
+  void set_checkpoint_interval(int32_t value);
+  private:
+  int32_t _internal_checkpoint_interval() const;
+  void _internal_set_checkpoint_interval(int32_t value);
+  public:
+
+  // optional int32 num_chains = 14 [default = 1];
+  bool has_num_chains() const;
+  private:
+  bool _internal_has_num_chains() const;
+  public:
+  void clear_num_chains();
+  int32_t num_chains() const;
+  void set_num_chains(int32_t value);
+  private:
+  int32_t _internal_num_chains() const;
+  void _internal_set_num_chains(int32_t value);
+  public:
+
+  // optional int32 iterations = 1 [default = 500];
+  bool has_iterations() const;
+  private:
+  bool _internal_has_iterations() const;
+  public:
+  void clear_iterations();
+  int32_t iterations() const;
+  void set_iterations(int32_t value);
+  private:
+  int32_t _internal_iterations() const;
+  void _internal_set_iterations(int32_t value);
+  public:
 
   // optional int32 lag = 3 [default = 10];
-  inline bool has_lag() const;
-  inline void clear_lag();
-  static const int kLagFieldNumber = 3;
-  inline ::google::protobuf::int32 lag() const;
-  inline void set_lag(::google::protobuf::int32 value);
+  bool has_lag() const;
+  private:
+  bool _internal_has_lag() const;
+  public:
+  void clear_lag();
+  int32_t lag() const;
+  void set_lag(int32_t value);
+  private:
+  int32_t _internal_lag() const;
+  void _internal_set_lag(int32_t value);
+  public:
 
-  // optional bool track_likelihood = 4 [default = false];
-  inline bool has_track_likelihood() const;
-  inline void clear_track_likelihood();
-  static const int kTrackLikelihoodFieldNumber = 4;
-  inline bool track_likelihood() const;
-  inline void set_track_likelihood(bool value);
+  // optional int32 num_threads = 7 [default = 1];
+  bool has_num_threads() const;
+  private:
+  bool _internal_has_num_threads() const;
+  public:
+  void clear_num_threads();
+  int32_t num_threads() const;
+  void set_num_threads(int32_t value);
+  private:
+  int32_t _internal_num_threads() const;
+  void _internal_set_num_threads(int32_t value);
+  public:
+
+  // optional int32 convergence_window = 9 [default = 5];
+  bool has_convergence_window() const;
+  private:
+  bool _internal_has_convergence_window() const;
+  public:
+  void clear_convergence_window();
+  int32_t convergence_window() const;
+  void set_convergence_window(int32_t value);
+  private:
+  int32_t _internal_convergence_window() const;
+  void _internal_set_convergence_window(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.GibbsSamplingOptions)
  private:
-  inline void set_has_iterations();
-  inline void clear_has_iterations();
-  inline void set_has_burnin();
-  inline void clear_has_burnin();
-  inline void set_has_lag();
-  inline void clear_has_lag();
-  inline void set_has_track_likelihood();
-  inline void clear_has_track_likelihood();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 iterations_;
-  ::google::protobuf::int32 burnin_;
-  ::google::protobuf::int32 lag_;
-  bool track_likelihood_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static GibbsSamplingOptions* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr checkpoint_path_;
+    int64_t deadline_ms_;
+    uint64_t seed_;
+    int32_t burnin_;
+    bool track_likelihood_;
+    bool resume_from_checkpoint_;
+    double convergence_tolerance_;
+    int32_t min_iterations_;
+    int32_t checkpoint_interval_;
+    int32_t num_chains_;
+    int32_t iterations_;
+    int32_t lag_;
+    int32_t num_threads_;
+    int32_t convergence_window_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KLSumOptions : public ::google::protobuf::Message {
+class KLSumOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.KLSumOptions) */ {
  public:
-  KLSumOptions();
-  virtual ~KLSumOptions();
+  inline KLSumOptions() : KLSumOptions(nullptr) {}
+  ~KLSumOptions() override;
+  explicit PROTOBUF_CONSTEXPR KLSumOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   KLSumOptions(const KLSumOptions& from);
+  KLSumOptions(KLSumOptions&& from) noexcept
+    : KLSumOptions() {
+    *this = ::std::move(from);
+  }
 
   inline KLSumOptions& operator=(const KLSumOptions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline KLSumOptions& operator=(KLSumOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const KLSumOptions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const KLSumOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const KLSumOptions* internal_default_instance() {
+    return reinterpret_cast<const KLSumOptions*>(
+               &_KLSumOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(KLSumOptions* other);
+  friend void swap(KLSumOptions& a, KLSumOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(KLSumOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(KLSumOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  KLSumOptions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  KLSumOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KLSumOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const KLSumOptions& from);
-  void MergeFrom(const KLSumOptions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const KLSumOptions& from) {
+    KLSumOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(KLSumOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.KLSumOptions";
+  }
+  protected:
+  explicit KLSumOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef KLSumOptions_OptimizationStrategy OptimizationStrategy;
-  static const OptimizationStrategy GREEDY_OPTIMIZATION = KLSumOptions_OptimizationStrategy_GREEDY_OPTIMIZATION;
-  static const OptimizationStrategy SENTENCE_RANKING = KLSumOptions_OptimizationStrategy_SENTENCE_RANKING;
-  static const OptimizationStrategy NUM_OPTIMIZATIONS = KLSumOptions_OptimizationStrategy_NUM_OPTIMIZATIONS;
+  static constexpr OptimizationStrategy GREEDY_OPTIMIZATION =
+    KLSumOptions_OptimizationStrategy_GREEDY_OPTIMIZATION;
+  static constexpr OptimizationStrategy SENTENCE_RANKING =
+    KLSumOptions_OptimizationStrategy_SENTENCE_RANKING;
+  static constexpr OptimizationStrategy NUM_OPTIMIZATIONS =
+    KLSumOptions_OptimizationStrategy_NUM_OPTIMIZATIONS;
   static inline bool OptimizationStrategy_IsValid(int value) {
     return KLSumOptions_OptimizationStrategy_IsValid(value);
   }
-  static const OptimizationStrategy OptimizationStrategy_MIN =
+  static constexpr OptimizationStrategy OptimizationStrategy_MIN =
     KLSumOptions_OptimizationStrategy_OptimizationStrategy_MIN;
-  static const OptimizationStrategy OptimizationStrategy_MAX =
+  static constexpr OptimizationStrategy OptimizationStrategy_MAX =
     KLSumOptions_OptimizationStrategy_OptimizationStrategy_MAX;
-  static const int OptimizationStrategy_ARRAYSIZE =
+  static constexpr int OptimizationStrategy_ARRAYSIZE =
     KLSumOptions_OptimizationStrategy_OptimizationStrategy_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   OptimizationStrategy_descriptor() {
     return KLSumOptions_OptimizationStrategy_descriptor();
   }
-  static inline const ::std::string& OptimizationStrategy_Name(OptimizationStrategy value) {
-    return KLSumOptions_OptimizationStrategy_Name(value);
+  template<typename T>
+  static inline const std::string& OptimizationStrategy_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OptimizationStrategy>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OptimizationStrategy_Name.");
+    return KLSumOptions_OptimizationStrategy_Name(enum_t_value);
   }
-  static inline bool OptimizationStrategy_Parse(const ::std::string& name,
+  static inline bool OptimizationStrategy_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       OptimizationStrategy* value) {
     return KLSumOptions_OptimizationStrategy_Parse(name, value);
   }
 
+  typedef KLSumOptions_Precision Precision;
+  static constexpr Precision DOUBLE =
+    KLSumOptions_Precision_DOUBLE;
+  static constexpr Precision FLOAT =
+    KLSumOptions_Precision_FLOAT;
+  static inline bool Precision_IsValid(int value) {
+    return KLSumOptions_Precision_IsValid(value);
+  }
+  static constexpr Precision Precision_MIN =
+    KLSumOptions_Precision_Precision_MIN;
+  static constexpr Precision Precision_MAX =
+    KLSumOptions_Precision_Precision_MAX;
+  static constexpr int Precision_ARRAYSIZE =
+    KLSumOptions_Precision_Precision_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Precision_descriptor() {
+    return KLSumOptions_Precision_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Precision_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Precision>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Precision_Name.");
+    return KLSumOptions_Precision_Name(enum_t_value);
+  }
+  static inline bool Precision_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Precision* value) {
+    return KLSumOptions_Precision_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPostprocessorNameFieldNumber = 7,
+    kOptimizationStrategyFieldNumber = 1,
+    kRedundancyRemovalFieldNumber = 2,
+    kSentencePositionFieldNumber = 3,
+    kLazyEvaluationFieldNumber = 8,
+    kFastLogFieldNumber = 10,
+    kPriorWeightFieldNumber = 6,
+    kPrecisionFieldNumber = 11,
+    kCollapseDuplicatesFieldNumber = 12,
+    kSummaryWeightFieldNumber = 5,
+    kNumThreadsFieldNumber = 9,
+    kNearDuplicateSimilarityFieldNumber = 13,
+  };
+  // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
+  bool has_postprocessor_name() const;
+  private:
+  bool _internal_has_postprocessor_name() const;
+  public:
+  void clear_postprocessor_name();
+  const std::string& postprocessor_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_postprocessor_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_postprocessor_name();
+  PROTOBUF_NODISCARD std::string* release_postprocessor_name();
+  void set_allocated_postprocessor_name(std::string* postprocessor_name);
+  private:
+  const std::string& _internal_postprocessor_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_postprocessor_name(const std::string& value);
+  std::string* _internal_mutable_postprocessor_name();
+  public:
+
   // optional .topicsum.KLSumOptions.OptimizationStrategy optimization_strategy = 1 [default = GREEDY_OPTIMIZATION];
-  inline bool has_optimization_strategy() const;
-  inline void clear_optimization_strategy();
-  static const int kOptimizationStrategyFieldNumber = 1;
-  inline ::topicsum::KLSumOptions_OptimizationStrategy optimization_strategy() const;
-  inline void set_optimization_strategy(::topicsum::KLSumOptions_OptimizationStrategy value);
+  bool has_optimization_strategy() const;
+  private:
+  bool _internal_has_optimization_strategy() const;
+  public:
+  void clear_optimization_strategy();
+  ::topicsum::KLSumOptions_OptimizationStrategy optimization_strategy() const;
+  void set_optimization_strategy(::topicsum::KLSumOptions_OptimizationStrategy value);
+  private:
+  ::topicsum::KLSumOptions_OptimizationStrategy _internal_optimization_strategy() const;
+  void _internal_set_optimization_strategy(::topicsum::KLSumOptions_OptimizationStrategy value);
+  public:
 
   // optional bool redundancy_removal = 2 [default = false];
-  inline bool has_redundancy_removal() const;
-  inline void clear_redundancy_removal();
-  static const int kRedundancyRemovalFieldNumber = 2;
-  inline bool redundancy_removal() const;
-  inline void set_redundancy_removal(bool value);
+  bool has_redundancy_removal() const;
+  private:
+  bool _internal_has_redundancy_removal() const;
+  public:
+  void clear_redundancy_removal();
+  bool redundancy_removal() const;
+  void set_redundancy_removal(bool value);
+  private:
+  bool _internal_redundancy_removal() const;
+  void _internal_set_redundancy_removal(bool value);
+  public:
 
   // optional bool sentence_position = 3 [default = false];
-  inline bool has_sentence_position() const;
-  inline void clear_sentence_position();
-  static const int kSentencePositionFieldNumber = 3;
-  inline bool sentence_position() const;
-  inline void set_sentence_position(bool value);
+  bool has_sentence_position() const;
+  private:
+  bool _internal_has_sentence_position() const;
+  public:
+  void clear_sentence_position();
+  bool sentence_position() const;
+  void set_sentence_position(bool value);
+  private:
+  bool _internal_sentence_position() const;
+  void _internal_set_sentence_position(bool value);
+  public:
 
-  // optional float summary_weight = 5 [default = 1];
-  inline bool has_summary_weight() const;
-  inline void clear_summary_weight();
-  static const int kSummaryWeightFieldNumber = 5;
-  inline float summary_weight() const;
-  inline void set_summary_weight(float value);
+  // optional bool lazy_evaluation = 8 [default = false];
+  bool has_lazy_evaluation() const;
+  private:
+  bool _internal_has_lazy_evaluation() const;
+  public:
+  void clear_lazy_evaluation();
+  bool lazy_evaluation() const;
+  void set_lazy_evaluation(bool value);
+  private:
+  bool _internal_lazy_evaluation() const;
+  void _internal_set_lazy_evaluation(bool value);
+  public:
+
+  // optional bool fast_log = 10 [default = false];
+  bool has_fast_log() const;
+  private:
+  bool _internal_has_fast_log() const;
+  public:
+  void clear_fast_log();
+  bool fast_log() const;
+  void set_fast_log(bool value);
+  private:
+  bool _internal_fast_log() const;
+  void _internal_set_fast_log(bool value);
+  public:
 
   // optional float prior_weight = 6 [default = 0];
-  inline bool has_prior_weight() const;
-  inline void clear_prior_weight();
-  static const int kPriorWeightFieldNumber = 6;
-  inline float prior_weight() const;
-  inline void set_prior_weight(float value);
+  bool has_prior_weight() const;
+  private:
+  bool _internal_has_prior_weight() const;
+  public:
+  void clear_prior_weight();
+  float prior_weight() const;
+  void set_prior_weight(float value);
+  private:
+  float _internal_prior_weight() const;
+  void _internal_set_prior_weight(float value);
+  public:
 
-  // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
-  inline bool has_postprocessor_name() const;
-  inline void clear_postprocessor_name();
-  static const int kPostprocessorNameFieldNumber = 7;
-  inline const ::std::string& postprocessor_name() const;
-  inline void set_postprocessor_name(const ::std::string& value);
-  inline void set_postprocessor_name(const char* value);
-  inline void set_postprocessor_name(const char* value, size_t size);
-  inline ::std::string* mutable_postprocessor_name();
-  inline ::std::string* release_postprocessor_name();
-  inline void set_allocated_postprocessor_name(::std::string* postprocessor_name);
+  // optional .topicsum.KLSumOptions.Precision precision = 11 [default = DOUBLE];
+  bool has_precision() const;
+  private:
+  bool _internal_has_precision() const;
+  public:
+  void clear_precision();
+  ::topicsum::KLSumOptions_Precision precision() const;
+  void set_precision(::topicsum::KLSumOptions_Precision value);
+  private:
+  ::topicsum::KLSumOptions_Precision _internal_precision() const;
+  void _internal_set_precision(::topicsum::KLSumOptions_Precision value);
+  public:
+
+  // optional bool collapse_duplicates = 12 [default = false];
+  bool has_collapse_duplicates() const;
+  private:
+  bool _internal_has_collapse_duplicates() const;
+  public:
+  void clear_collapse_duplicates();
+  bool collapse_duplicates() const;
+  void set_collapse_duplicates(bool value);
+  private:
+  bool _internal_collapse_duplicates() const;
+  void _internal_set_collapse_duplicates(bool value);
+  public:
+
+  // optional float summary_weight = 5 [default = 1];
+  bool has_summary_weight() const;
+  private:
+  bool _internal_has_summary_weight() const;
+  public:
+  void clear_summary_weight();
+  float summary_weight() const;
+  void set_summary_weight(float value);
+  private:
+  float _internal_summary_weight() const;
+  void _internal_set_summary_weight(float value);
+  public:
+
+  // optional int32 num_threads = 9 [default = 1];
+  bool has_num_threads() const;
+  private:
+  bool _internal_has_num_threads() const;
+  public:
+  void clear_num_threads();
+  int32_t num_threads() const;
+  void set_num_threads(int32_t value);
+  private:
+  int32_t _internal_num_threads() const;
+  void _internal_set_num_threads(int32_t value);
+  public:
+
+  // optional double near_duplicate_similarity = 13 [default = 0.8];
+  bool has_near_duplicate_similarity() const;
+  private:
+  bool _internal_has_near_duplicate_similarity() const;
+  public:
+  void clear_near_duplicate_similarity();
+  double near_duplicate_similarity() const;
+  void set_near_duplicate_similarity(double value);
+  private:
+  double _internal_near_duplicate_similarity() const;
+  void _internal_set_near_duplicate_similarity(double value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.KLSumOptions)
  private:
-  inline void set_has_optimization_strategy();
-  inline void clear_has_optimization_strategy();
-  inline void set_has_redundancy_removal();
-  inline void clear_has_redundancy_removal();
-  inline void set_has_sentence_position();
-  inline void clear_has_sentence_position();
-  inline void set_has_summary_weight();
-  inline void clear_has_summary_weight();
-  inline void set_has_prior_weight();
-  inline void clear_has_prior_weight();
-  inline void set_has_postprocessor_name();
-  inline void clear_has_postprocessor_name();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  int optimization_strategy_;
-  bool redundancy_removal_;
-  bool sentence_position_;
-  float summary_weight_;
-  float prior_weight_;
-  ::std::string* postprocessor_name_;
-  static ::std::string* _default_postprocessor_name_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static KLSumOptions* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_postprocessor_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr postprocessor_name_;
+    int optimization_strategy_;
+    bool redundancy_removal_;
+    bool sentence_position_;
+    bool lazy_evaluation_;
+    bool fast_log_;
+    float prior_weight_;
+    int precision_;
+    bool collapse_duplicates_;
+    float summary_weight_;
+    int32_t num_threads_;
+    double near_duplicate_similarity_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TopicSumOptions : public ::google::protobuf::Message {
+class TopicSumOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.TopicSumOptions) */ {
  public:
-  TopicSumOptions();
-  virtual ~TopicSumOptions();
+  inline TopicSumOptions() : TopicSumOptions(nullptr) {}
+  ~TopicSumOptions() override;
+  explicit PROTOBUF_CONSTEXPR TopicSumOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TopicSumOptions(const TopicSumOptions& from);
+  TopicSumOptions(TopicSumOptions&& from) noexcept
+    : TopicSumOptions() {
+    *this = ::std::move(from);
+  }
 
   inline TopicSumOptions& operator=(const TopicSumOptions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline TopicSumOptions& operator=(TopicSumOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TopicSumOptions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TopicSumOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TopicSumOptions* internal_default_instance() {
+    return reinterpret_cast<const TopicSumOptions*>(
+               &_TopicSumOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(TopicSumOptions* other);
+  friend void swap(TopicSumOptions& a, TopicSumOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopicSumOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TopicSumOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  TopicSumOptions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TopicSumOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopicSumOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TopicSumOptions& from);
-  void MergeFrom(const TopicSumOptions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TopicSumOptions& from) {
+    TopicSumOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TopicSumOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.TopicSumOptions";
+  }
+  protected:
+  explicit TopicSumOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  // accessors -------------------------------------------------------
+  typedef TopicSumOptions_Inference Inference;
+  static constexpr Inference GIBBS_SAMPLING =
+    TopicSumOptions_Inference_GIBBS_SAMPLING;
+  static constexpr Inference CVB0 =
+    TopicSumOptions_Inference_CVB0;
+  static inline bool Inference_IsValid(int value) {
+    return TopicSumOptions_Inference_IsValid(value);
+  }
+  static constexpr Inference Inference_MIN =
+    TopicSumOptions_Inference_Inference_MIN;
+  static constexpr Inference Inference_MAX =
+    TopicSumOptions_Inference_Inference_MAX;
+  static constexpr int Inference_ARRAYSIZE =
+    TopicSumOptions_Inference_Inference_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Inference_descriptor() {
+    return TopicSumOptions_Inference_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Inference_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Inference>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Inference_Name.");
+    return TopicSumOptions_Inference_Name(enum_t_value);
+  }
+  static inline bool Inference_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Inference* value) {
+    return TopicSumOptions_Inference_Parse(name, value);
+  }
 
-  // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
-  inline bool has_gibbs_sampling_options() const;
-  inline void clear_gibbs_sampling_options();
-  static const int kGibbsSamplingOptionsFieldNumber = 2;
-  inline const ::topicsum::GibbsSamplingOptions& gibbs_sampling_options() const;
-  inline ::topicsum::GibbsSamplingOptions* mutable_gibbs_sampling_options();
-  inline ::topicsum::GibbsSamplingOptions* release_gibbs_sampling_options();
-  inline void set_allocated_gibbs_sampling_options(::topicsum::GibbsSamplingOptions* gibbs_sampling_options);
+  // accessors -------------------------------------------------------
 
+  enum : int {
+    kLambdaFieldNumber = 3,
+    kGammaFieldNumber = 4,
+    kBackgroundModelPathFieldNumber = 8,
+    kGibbsSamplingOptionsFieldNumber = 2,
+    kInferenceFieldNumber = 9,
+    kCvb0IterationsFieldNumber = 10,
+    kBatchNumThreadsFieldNumber = 11,
+  };
   // optional string lambda = 3 [default = "0.1,1,1"];
-  inline bool has_lambda() const;
-  inline void clear_lambda();
-  static const int kLambdaFieldNumber = 3;
-  inline const ::std::string& lambda() const;
-  inline void set_lambda(const ::std::string& value);
-  inline void set_lambda(const char* value);
-  inline void set_lambda(const char* value, size_t size);
-  inline ::std::string* mutable_lambda();
-  inline ::std::string* release_lambda();
-  inline void set_allocated_lambda(::std::string* lambda);
+  bool has_lambda() const;
+  private:
+  bool _internal_has_lambda() const;
+  public:
+  void clear_lambda();
+  const std::string& lambda() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lambda(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lambda();
+  PROTOBUF_NODISCARD std::string* release_lambda();
+  void set_allocated_lambda(std::string* lambda);
+  private:
+  const std::string& _internal_lambda() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lambda(const std::string& value);
+  std::string* _internal_mutable_lambda();
+  public:
 
   // optional string gamma = 4 [default = "1,5,10"];
-  inline bool has_gamma() const;
-  inline void clear_gamma();
-  static const int kGammaFieldNumber = 4;
-  inline const ::std::string& gamma() const;
-  inline void set_gamma(const ::std::string& value);
-  inline void set_gamma(const char* value);
-  inline void set_gamma(const char* value, size_t size);
-  inline ::std::string* mutable_gamma();
-  inline ::std::string* release_gamma();
-  inline void set_allocated_gamma(::std::string* gamma);
+  bool has_gamma() const;
+  private:
+  bool _internal_has_gamma() const;
+  public:
+  void clear_gamma();
+  const std::string& gamma() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_gamma(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_gamma();
+  PROTOBUF_NODISCARD std::string* release_gamma();
+  void set_allocated_gamma(std::string* gamma);
+  private:
+  const std::string& _internal_gamma() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gamma(const std::string& value);
+  std::string* _internal_mutable_gamma();
+  public:
+
+  // optional string background_model_path = 8;
+  bool has_background_model_path() const;
+  private:
+  bool _internal_has_background_model_path() const;
+  public:
+  void clear_background_model_path();
+  const std::string& background_model_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_background_model_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_background_model_path();
+  PROTOBUF_NODISCARD std::string* release_background_model_path();
+  void set_allocated_background_model_path(std::string* background_model_path);
+  private:
+  const std::string& _internal_background_model_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_background_model_path(const std::string& value);
+  std::string* _internal_mutable_background_model_path();
+  public:
+
+  // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
+  bool has_gibbs_sampling_options() const;
+  private:
+  bool _internal_has_gibbs_sampling_options() const;
+  public:
+  void clear_gibbs_sampling_options();
+  const ::topicsum::GibbsSamplingOptions& gibbs_sampling_options() const;
+  PROTOBUF_NODISCARD ::topicsum::GibbsSamplingOptions* release_gibbs_sampling_options();
+  ::topicsum::GibbsSamplingOptions* mutable_gibbs_sampling_options();
+  void set_allocated_gibbs_sampling_options(::topicsum::GibbsSamplingOptions* gibbs_sampling_options);
+  private:
+  const ::topicsum::GibbsSamplingOptions& _internal_gibbs_sampling_options() const;
+  ::topicsum::GibbsSamplingOptions* _internal_mutable_gibbs_sampling_options();
+  public:
+  void unsafe_arena_set_allocated_gibbs_sampling_options(
+      ::topicsum::GibbsSamplingOptions* gibbs_sampling_options);
+  ::topicsum::GibbsSamplingOptions* unsafe_arena_release_gibbs_sampling_options();
+
+  // optional .topicsum.TopicSumOptions.Inference inference = 9 [default = GIBBS_SAMPLING];
+  bool has_inference() const;
+  private:
+  bool _internal_has_inference() const;
+  public:
+  void clear_inference();
+  ::topicsum::TopicSumOptions_Inference inference() const;
+  void set_inference(::topicsum::TopicSumOptions_Inference value);
+  private:
+  ::topicsum::TopicSumOptions_Inference _internal_inference() const;
+  void _internal_set_inference(::topicsum::TopicSumOptions_Inference value);
+  public:
+
+  // optional int32 cvb0_iterations = 10 [default = 50];
+  bool has_cvb0_iterations() const;
+  private:
+  bool _internal_has_cvb0_iterations() const;
+  public:
+  void clear_cvb0_iterations();
+  int32_t cvb0_iterations() const;
+  void set_cvb0_iterations(int32_t value);
+  private:
+  int32_t _internal_cvb0_iterations() const;
+  void _internal_set_cvb0_iterations(int32_t value);
+  public:
+
+  // optional int32 batch_num_threads = 11 [default = 1];
+  bool has_batch_num_threads() const;
+  private:
+  bool _internal_has_batch_num_threads() const;
+  public:
+  void clear_batch_num_threads();
+  int32_t batch_num_threads() const;
+  void set_batch_num_threads(int32_t value);
+  private:
+  int32_t _internal_batch_num_threads() const;
+  void _internal_set_batch_num_threads(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.TopicSumOptions)
  private:
-  inline void set_has_gibbs_sampling_options();
-  inline void clear_has_gibbs_sampling_options();
-  inline void set_has_lambda();
-  inline void clear_has_lambda();
-  inline void set_has_gamma();
-  inline void clear_has_gamma();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::topicsum::GibbsSamplingOptions* gibbs_sampling_options_;
-  ::std::string* lambda_;
-  static ::std::string* _default_lambda_;
-  ::std::string* gamma_;
-  static ::std::string* _default_gamma_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static TopicSumOptions* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_lambda_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lambda_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_gamma_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gamma_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr background_model_path_;
+    ::topicsum::GibbsSamplingOptions* gibbs_sampling_options_;
+    int inference_;
+    int32_t cvb0_iterations_;
+    int32_t batch_num_threads_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NewsPostProcessorOptions : public ::google::protobuf::Message {
+class NewsPostProcessorOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.NewsPostProcessorOptions) */ {
  public:
-  NewsPostProcessorOptions();
-  virtual ~NewsPostProcessorOptions();
+  inline NewsPostProcessorOptions() : NewsPostProcessorOptions(nullptr) {}
+  ~NewsPostProcessorOptions() override;
+  explicit PROTOBUF_CONSTEXPR NewsPostProcessorOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NewsPostProcessorOptions(const NewsPostProcessorOptions& from);
+  NewsPostProcessorOptions(NewsPostProcessorOptions&& from) noexcept
+    : NewsPostProcessorOptions() {
+    *this = ::std::move(from);
+  }
 
   inline NewsPostProcessorOptions& operator=(const NewsPostProcessorOptions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline NewsPostProcessorOptions& operator=(NewsPostProcessorOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const NewsPostProcessorOptions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewsPostProcessorOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NewsPostProcessorOptions* internal_default_instance() {
+    return reinterpret_cast<const NewsPostProcessorOptions*>(
+               &_NewsPostProcessorOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(NewsPostProcessorOptions* other);
+  friend void swap(NewsPostProcessorOptions& a, NewsPostProcessorOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NewsPostProcessorOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NewsPostProcessorOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  NewsPostProcessorOptions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  NewsPostProcessorOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NewsPostProcessorOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NewsPostProcessorOptions& from);
-  void MergeFrom(const NewsPostProcessorOptions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NewsPostProcessorOptions& from) {
+    NewsPostProcessorOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NewsPostProcessorOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.NewsPostProcessorOptions";
+  }
+  protected:
+  explicit NewsPostProcessorOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMinSentenceLengthFieldNumber = 1,
+    kMaxSentenceLengthFieldNumber = 2,
+  };
   // optional int32 min_sentence_length = 1;
-  inline bool has_min_sentence_length() const;
-  inline void clear_min_sentence_length();
-  static const int kMinSentenceLengthFieldNumber = 1;
-  inline ::google::protobuf::int32 min_sentence_length() const;
-  inline void set_min_sentence_length(::google::protobuf::int32 value);
+  bool has_min_sentence_length() const;
+  private:
+  bool _internal_has_min_sentence_length() const;
+  public:
+  void clear_min_sentence_length();
+  int32_t min_sentence_length() const;
+  void set_min_sentence_length(int32_t value);
+  private:
+  int32_t _internal_min_sentence_length() const;
+  void _internal_set_min_sentence_length(int32_t value);
+  public:
 
   // optional int32 max_sentence_length = 2;
-  inline bool has_max_sentence_length() const;
-  inline void clear_max_sentence_length();
-  static const int kMaxSentenceLengthFieldNumber = 2;
-  inline ::google::protobuf::int32 max_sentence_length() const;
-  inline void set_max_sentence_length(::google::protobuf::int32 value);
+  bool has_max_sentence_length() const;
+  private:
+  bool _internal_has_max_sentence_length() const;
+  public:
+  void clear_max_sentence_length();
+  int32_t max_sentence_length() const;
+  void set_max_sentence_length(int32_t value);
+  private:
+  int32_t _internal_max_sentence_length() const;
+  void _internal_set_max_sentence_length(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.NewsPostProcessorOptions)
  private:
-  inline void set_has_min_sentence_length();
-  inline void clear_has_min_sentence_length();
-  inline void set_has_max_sentence_length();
-  inline void clear_has_max_sentence_length();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 min_sentence_length_;
-  ::google::protobuf::int32 max_sentence_length_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static NewsPostProcessorOptions* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t min_sentence_length_;
+    int32_t max_sentence_length_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SummarizerOptions : public ::google::protobuf::Message {
+class SummarizerOptions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:topicsum.SummarizerOptions) */ {
  public:
-  SummarizerOptions();
-  virtual ~SummarizerOptions();
+  inline SummarizerOptions() : SummarizerOptions(nullptr) {}
+  ~SummarizerOptions() override;
+  explicit PROTOBUF_CONSTEXPR SummarizerOptions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SummarizerOptions(const SummarizerOptions& from);
+  SummarizerOptions(SummarizerOptions&& from) noexcept
+    : SummarizerOptions() {
+    *this = ::std::move(from);
+  }
 
   inline SummarizerOptions& operator=(const SummarizerOptions& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SummarizerOptions& operator=(SummarizerOptions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SummarizerOptions& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SummarizerOptions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SummarizerOptions* internal_default_instance() {
+    return reinterpret_cast<const SummarizerOptions*>(
+               &_SummarizerOptions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(SummarizerOptions* other);
+  friend void swap(SummarizerOptions& a, SummarizerOptions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SummarizerOptions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SummarizerOptions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  SummarizerOptions* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SummarizerOptions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SummarizerOptions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SummarizerOptions& from);
-  void MergeFrom(const SummarizerOptions& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SummarizerOptions& from) {
+    SummarizerOptions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SummarizerOptions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "topicsum.SummarizerOptions";
+  }
+  protected:
+  explicit SummarizerOptions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef SummarizerOptions_SummaryType SummaryType;
-  static const SummaryType GENERIC = SummarizerOptions_SummaryType_GENERIC;
-  static const SummaryType QUERY = SummarizerOptions_SummaryType_QUERY;
-  static const SummaryType UPDATE = SummarizerOptions_SummaryType_UPDATE;
+  static constexpr SummaryType GENERIC =
+    SummarizerOptions_SummaryType_GENERIC;
+  static constexpr SummaryType QUERY =
+    SummarizerOptions_SummaryType_QUERY;
+  static constexpr SummaryType UPDATE =
+    SummarizerOptions_SummaryType_UPDATE;
   static inline bool SummaryType_IsValid(int value) {
     return SummarizerOptions_SummaryType_IsValid(value);
   }
-  static const SummaryType SummaryType_MIN =
+  static constexpr SummaryType SummaryType_MIN =
     SummarizerOptions_SummaryType_SummaryType_MIN;
-  static const SummaryType SummaryType_MAX =
+  static constexpr SummaryType SummaryType_MAX =
     SummarizerOptions_SummaryType_SummaryType_MAX;
-  static const int SummaryType_ARRAYSIZE =
+  static constexpr int SummaryType_ARRAYSIZE =
     SummarizerOptions_SummaryType_SummaryType_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   SummaryType_descriptor() {
     return SummarizerOptions_SummaryType_descriptor();
   }
-  static inline const ::std::string& SummaryType_Name(SummaryType value) {
-    return SummarizerOptions_SummaryType_Name(value);
+  template<typename T>
+  static inline const std::string& SummaryType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, SummaryType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function SummaryType_Name.");
+    return SummarizerOptions_SummaryType_Name(enum_t_value);
   }
-  static inline bool SummaryType_Parse(const ::std::string& name,
+  static inline bool SummaryType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       SummaryType* value) {
     return SummarizerOptions_SummaryType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
-  inline bool has_summary_type() const;
-  inline void clear_summary_type();
-  static const int kSummaryTypeFieldNumber = 1;
-  inline ::topicsum::SummarizerOptions_SummaryType summary_type() const;
-  inline void set_summary_type(::topicsum::SummarizerOptions_SummaryType value);
+  enum : int {
+    kArticleFieldNumber = 4,
+    kKlsumOptionsFieldNumber = 2,
+    kTopicsumOptionsFieldNumber = 3,
+    kNewsPostprocessorOptionsFieldNumber = 5,
+    kSummaryTypeFieldNumber = 1,
+  };
+  // repeated .topicsum.Article article = 4;
+  int article_size() const;
+  private:
+  int _internal_article_size() const;
+  public:
+  void clear_article();
+  ::topicsum::Article* mutable_article(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Article >*
+      mutable_article();
+  private:
+  const ::topicsum::Article& _internal_article(int index) const;
+  ::topicsum::Article* _internal_add_article();
+  public:
+  const ::topicsum::Article& article(int index) const;
+  ::topicsum::Article* add_article();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Article >&
+      article() const;
 
   // optional .topicsum.KLSumOptions klsum_options = 2;
-  inline bool has_klsum_options() const;
-  inline void clear_klsum_options();
-  static const int kKlsumOptionsFieldNumber = 2;
-  inline const ::topicsum::KLSumOptions& klsum_options() const;
-  inline ::topicsum::KLSumOptions* mutable_klsum_options();
-  inline ::topicsum::KLSumOptions* release_klsum_options();
-  inline void set_allocated_klsum_options(::topicsum::KLSumOptions* klsum_options);
+  bool has_klsum_options() const;
+  private:
+  bool _internal_has_klsum_options() const;
+  public:
+  void clear_klsum_options();
+  const ::topicsum::KLSumOptions& klsum_options() const;
+  PROTOBUF_NODISCARD ::topicsum::KLSumOptions* release_klsum_options();
+  ::topicsum::KLSumOptions* mutable_klsum_options();
+  void set_allocated_klsum_options(::topicsum::KLSumOptions* klsum_options);
+  private:
+  const ::topicsum::KLSumOptions& _internal_klsum_options() const;
+  ::topicsum::KLSumOptions* _internal_mutable_klsum_options();
+  public:
+  void unsafe_arena_set_allocated_klsum_options(
+      ::topicsum::KLSumOptions* klsum_options);
+  ::topicsum::KLSumOptions* unsafe_arena_release_klsum_options();
 
   // optional .topicsum.TopicSumOptions topicsum_options = 3;
-  inline bool has_topicsum_options() const;
-  inline void clear_topicsum_options();
-  static const int kTopicsumOptionsFieldNumber = 3;
-  inline const ::topicsum::TopicSumOptions& topicsum_options() const;
-  inline ::topicsum::TopicSumOptions* mutable_topicsum_options();
-  inline ::topicsum::TopicSumOptions* release_topicsum_options();
-  inline void set_allocated_topicsum_options(::topicsum::TopicSumOptions* topicsum_options);
-
-  // repeated .topicsum.Article article = 4;
-  inline int article_size() const;
-  inline void clear_article();
-  static const int kArticleFieldNumber = 4;
-  inline const ::topicsum::Article& article(int index) const;
-  inline ::topicsum::Article* mutable_article(int index);
-  inline ::topicsum::Article* add_article();
-  inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Article >&
-      article() const;
-  inline ::google::protobuf::RepeatedPtrField< ::topicsum::Article >*
-      mutable_article();
+  bool has_topicsum_options() const;
+  private:
+  bool _internal_has_topicsum_options() const;
+  public:
+  void clear_topicsum_options();
+  const ::topicsum::TopicSumOptions& topicsum_options() const;
+  PROTOBUF_NODISCARD ::topicsum::TopicSumOptions* release_topicsum_options();
+  ::topicsum::TopicSumOptions* mutable_topicsum_options();
+  void set_allocated_topicsum_options(::topicsum::TopicSumOptions* topicsum_options);
+  private:
+  const ::topicsum::TopicSumOptions& _internal_topicsum_options() const;
+  ::topicsum::TopicSumOptions* _internal_mutable_topicsum_options();
+  public:
+  void unsafe_arena_set_allocated_topicsum_options(
+      ::topicsum::TopicSumOptions* topicsum_options);
+  ::topicsum::TopicSumOptions* unsafe_arena_release_topicsum_options();
 
   // optional .topicsum.NewsPostProcessorOptions news_postprocessor_options = 5;
-  inline bool has_news_postprocessor_options() const;
-  inline void clear_news_postprocessor_options();
-  static const int kNewsPostprocessorOptionsFieldNumber = 5;
-  inline const ::topicsum::NewsPostProcessorOptions& news_postprocessor_options() const;
-  inline ::topicsum::NewsPostProcessorOptions* mutable_news_postprocessor_options();
-  inline ::topicsum::NewsPostProcessorOptions* release_news_postprocessor_options();
-  inline void set_allocated_news_postprocessor_options(::topicsum::NewsPostProcessorOptions* news_postprocessor_options);
+  bool has_news_postprocessor_options() const;
+  private:
+  bool _internal_has_news_postprocessor_options() const;
+  public:
+  void clear_news_postprocessor_options();
+  const ::topicsum::NewsPostProcessorOptions& news_postprocessor_options() const;
+  PROTOBUF_NODISCARD ::topicsum::NewsPostProcessorOptions* release_news_postprocessor_options();
+  ::topicsum::NewsPostProcessorOptions* mutable_news_postprocessor_options();
+  void set_allocated_news_postprocessor_options(::topicsum::NewsPostProcessorOptions* news_postprocessor_options);
+  private:
+  const ::topicsum::NewsPostProcessorOptions& _internal_news_postprocessor_options() const;
+  ::topicsum::NewsPostProcessorOptions* _internal_mutable_news_postprocessor_options();
+  public:
+  void unsafe_arena_set_allocated_news_postprocessor_options(
+      ::topicsum::NewsPostProcessorOptions* news_postprocessor_options);
+  ::topicsum::NewsPostProcessorOptions* unsafe_arena_release_news_postprocessor_options();
+
+  // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
+  bool has_summary_type() const;
+  private:
+  bool _internal_has_summary_type() const;
+  public:
+  void clear_summary_type();
+  ::topicsum::SummarizerOptions_SummaryType summary_type() const;
+  void set_summary_type(::topicsum::SummarizerOptions_SummaryType value);
+  private:
+  ::topicsum::SummarizerOptions_SummaryType _internal_summary_type() const;
+  void _internal_set_summary_type(::topicsum::SummarizerOptions_SummaryType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:topicsum.SummarizerOptions)
  private:
-  inline void set_has_summary_type();
-  inline void clear_has_summary_type();
-  inline void set_has_klsum_options();
-  inline void clear_has_klsum_options();
-  inline void set_has_topicsum_options();
-  inline void clear_has_topicsum_options();
-  inline void set_has_news_postprocessor_options();
-  inline void clear_has_news_postprocessor_options();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::topicsum::KLSumOptions* klsum_options_;
-  ::topicsum::TopicSumOptions* topicsum_options_;
-  ::google::protobuf::RepeatedPtrField< ::topicsum::Article > article_;
-  ::topicsum::NewsPostProcessorOptions* news_postprocessor_options_;
-  int summary_type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_AssignDesc_summarizer_2fsummarizer_2eproto();
-  friend void protobuf_ShutdownFile_summarizer_2fsummarizer_2eproto();
-
-  void InitAsDefaultInstance();
-  static SummarizerOptions* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Article > article_;
+    ::topicsum::KLSumOptions* klsum_options_;
+    ::topicsum::TopicSumOptions* topicsum_options_;
+    ::topicsum::NewsPostProcessorOptions* news_postprocessor_options_;
+    int summary_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_summarizer_2fsummarizer_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Article
 
 // optional string content = 1;
-inline bool Article::has_content() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Article::set_has_content() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Article::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Article::clear_has_content() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Article::has_content() const {
+  return _internal_has_content();
 }
 inline void Article::clear_content() {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    content_->clear();
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Article::content() const {
+  // @@protoc_insertion_point(field_get:topicsum.Article.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Article::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.Article.content)
+}
+inline std::string* Article::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:topicsum.Article.content)
+  return _s;
+}
+inline const std::string& Article::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void Article::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Article::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Article::release_content() {
+  // @@protoc_insertion_point(field_release:topicsum.Article.content)
+  if (!_internal_has_content()) {
+    return nullptr;
   }
-  clear_has_content();
-}
-inline const ::std::string& Article::content() const {
-  return *content_;
-}
-inline void Article::set_content(const ::std::string& value) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
-  }
-  content_->assign(value);
-}
-inline void Article::set_content(const char* value) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
-  }
-  content_->assign(value);
-}
-inline void Article::set_content(const char* value, size_t size) {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
-  content_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* Article::mutable_content() {
-  set_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    content_ = new ::std::string;
-  }
-  return content_;
-}
-inline ::std::string* Article::release_content() {
-  clear_has_content();
-  if (content_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void Article::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = content_;
-    content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Article::set_allocated_content(::std::string* content) {
-  if (content_ != &::google::protobuf::internal::kEmptyString) {
-    delete content_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (content) {
-    set_has_content();
-    content_ = content;
-  } else {
-    clear_has_content();
-    content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.Article.content)
 }
 
 // repeated float score = 2;
+inline int Article::_internal_score_size() const {
+  return _impl_.score_.size();
+}
 inline int Article::score_size() const {
-  return score_.size();
+  return _internal_score_size();
 }
 inline void Article::clear_score() {
-  score_.Clear();
+  _impl_.score_.Clear();
+}
+inline float Article::_internal_score(int index) const {
+  return _impl_.score_.Get(index);
 }
 inline float Article::score(int index) const {
-  return score_.Get(index);
+  // @@protoc_insertion_point(field_get:topicsum.Article.score)
+  return _internal_score(index);
 }
 inline void Article::set_score(int index, float value) {
-  score_.Set(index, value);
+  _impl_.score_.Set(index, value);
+  // @@protoc_insertion_point(field_set:topicsum.Article.score)
+}
+inline void Article::_internal_add_score(float value) {
+  _impl_.score_.Add(value);
 }
 inline void Article::add_score(float value) {
-  score_.Add(value);
+  _internal_add_score(value);
+  // @@protoc_insertion_point(field_add:topicsum.Article.score)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Article::_internal_score() const {
+  return _impl_.score_;
 }
-inline const ::google::protobuf::RepeatedField< float >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 Article::score() const {
-  return score_;
+  // @@protoc_insertion_point(field_list:topicsum.Article.score)
+  return _internal_score();
 }
-inline ::google::protobuf::RepeatedField< float >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Article::_internal_mutable_score() {
+  return &_impl_.score_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 Article::mutable_score() {
-  return &score_;
+  // @@protoc_insertion_point(field_mutable_list:topicsum.Article.score)
+  return _internal_mutable_score();
 }
 
 // -------------------------------------------------------------------
@@ -1164,63 +2453,189 @@ Article::mutable_score() {
 // SummaryOptions
 
 // optional .topicsum.SummaryLength length = 1;
-inline bool SummaryOptions::has_length() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SummaryOptions::set_has_length() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool SummaryOptions::_internal_has_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.length_ != nullptr);
+  return value;
 }
-inline void SummaryOptions::clear_has_length() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SummaryOptions::has_length() const {
+  return _internal_has_length();
 }
 inline void SummaryOptions::clear_length() {
-  if (length_ != NULL) length_->::topicsum::SummaryLength::Clear();
-  clear_has_length();
+  if (_impl_.length_ != nullptr) _impl_.length_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::topicsum::SummaryLength& SummaryOptions::_internal_length() const {
+  const ::topicsum::SummaryLength* p = _impl_.length_;
+  return p != nullptr ? *p : reinterpret_cast<const ::topicsum::SummaryLength&>(
+      ::topicsum::_SummaryLength_default_instance_);
 }
 inline const ::topicsum::SummaryLength& SummaryOptions::length() const {
-  return length_ != NULL ? *length_ : *default_instance_->length_;
+  // @@protoc_insertion_point(field_get:topicsum.SummaryOptions.length)
+  return _internal_length();
 }
-inline ::topicsum::SummaryLength* SummaryOptions::mutable_length() {
-  set_has_length();
-  if (length_ == NULL) length_ = new ::topicsum::SummaryLength;
-  return length_;
+inline void SummaryOptions::unsafe_arena_set_allocated_length(
+    ::topicsum::SummaryLength* length) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.length_);
+  }
+  _impl_.length_ = length;
+  if (length) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:topicsum.SummaryOptions.length)
 }
 inline ::topicsum::SummaryLength* SummaryOptions::release_length() {
-  clear_has_length();
-  ::topicsum::SummaryLength* temp = length_;
-  length_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::topicsum::SummaryLength* temp = _impl_.length_;
+  _impl_.length_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::topicsum::SummaryLength* SummaryOptions::unsafe_arena_release_length() {
+  // @@protoc_insertion_point(field_release:topicsum.SummaryOptions.length)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::topicsum::SummaryLength* temp = _impl_.length_;
+  _impl_.length_ = nullptr;
   return temp;
 }
+inline ::topicsum::SummaryLength* SummaryOptions::_internal_mutable_length() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.length_ == nullptr) {
+    auto* p = CreateMaybeMessage<::topicsum::SummaryLength>(GetArenaForAllocation());
+    _impl_.length_ = p;
+  }
+  return _impl_.length_;
+}
+inline ::topicsum::SummaryLength* SummaryOptions::mutable_length() {
+  ::topicsum::SummaryLength* _msg = _internal_mutable_length();
+  // @@protoc_insertion_point(field_mutable:topicsum.SummaryOptions.length)
+  return _msg;
+}
 inline void SummaryOptions::set_allocated_length(::topicsum::SummaryLength* length) {
-  delete length_;
-  length_ = length;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.length_;
+  }
   if (length) {
-    set_has_length();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(length);
+    if (message_arena != submessage_arena) {
+      length = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, length, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_length();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.length_ = length;
+  // @@protoc_insertion_point(field_set_allocated:topicsum.SummaryOptions.length)
 }
 
-// optional bool generate_debug = 8 [default = false];
-inline bool SummaryOptions::has_generate_debug() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// repeated .topicsum.SummaryLength additional_length = 9;
+inline int SummaryOptions::_internal_additional_length_size() const {
+  return _impl_.additional_length_.size();
+}
+inline int SummaryOptions::additional_length_size() const {
+  return _internal_additional_length_size();
 }
-inline void SummaryOptions::set_has_generate_debug() {
-  _has_bits_[0] |= 0x00000002u;
+inline void SummaryOptions::clear_additional_length() {
+  _impl_.additional_length_.Clear();
 }
-inline void SummaryOptions::clear_has_generate_debug() {
-  _has_bits_[0] &= ~0x00000002u;
+inline ::topicsum::SummaryLength* SummaryOptions::mutable_additional_length(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.SummaryOptions.additional_length)
+  return _impl_.additional_length_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::SummaryLength >*
+SummaryOptions::mutable_additional_length() {
+  // @@protoc_insertion_point(field_mutable_list:topicsum.SummaryOptions.additional_length)
+  return &_impl_.additional_length_;
+}
+inline const ::topicsum::SummaryLength& SummaryOptions::_internal_additional_length(int index) const {
+  return _impl_.additional_length_.Get(index);
+}
+inline const ::topicsum::SummaryLength& SummaryOptions::additional_length(int index) const {
+  // @@protoc_insertion_point(field_get:topicsum.SummaryOptions.additional_length)
+  return _internal_additional_length(index);
+}
+inline ::topicsum::SummaryLength* SummaryOptions::_internal_add_additional_length() {
+  return _impl_.additional_length_.Add();
+}
+inline ::topicsum::SummaryLength* SummaryOptions::add_additional_length() {
+  ::topicsum::SummaryLength* _add = _internal_add_additional_length();
+  // @@protoc_insertion_point(field_add:topicsum.SummaryOptions.additional_length)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::SummaryLength >&
+SummaryOptions::additional_length() const {
+  // @@protoc_insertion_point(field_list:topicsum.SummaryOptions.additional_length)
+  return _impl_.additional_length_;
+}
+
+// optional bool generate_debug = 8 [default = false];
+inline bool SummaryOptions::_internal_has_generate_debug() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SummaryOptions::has_generate_debug() const {
+  return _internal_has_generate_debug();
 }
 inline void SummaryOptions::clear_generate_debug() {
-  generate_debug_ = false;
-  clear_has_generate_debug();
+  _impl_.generate_debug_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool SummaryOptions::_internal_generate_debug() const {
+  return _impl_.generate_debug_;
 }
 inline bool SummaryOptions::generate_debug() const {
-  return generate_debug_;
+  // @@protoc_insertion_point(field_get:topicsum.SummaryOptions.generate_debug)
+  return _internal_generate_debug();
+}
+inline void SummaryOptions::_internal_set_generate_debug(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.generate_debug_ = value;
 }
 inline void SummaryOptions::set_generate_debug(bool value) {
-  set_has_generate_debug();
-  generate_debug_ = value;
+  _internal_set_generate_debug(value);
+  // @@protoc_insertion_point(field_set:topicsum.SummaryOptions.generate_debug)
+}
+
+// optional int64 deadline_ms = 10 [default = 0];
+inline bool SummaryOptions::_internal_has_deadline_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SummaryOptions::has_deadline_ms() const {
+  return _internal_has_deadline_ms();
+}
+inline void SummaryOptions::clear_deadline_ms() {
+  _impl_.deadline_ms_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t SummaryOptions::_internal_deadline_ms() const {
+  return _impl_.deadline_ms_;
+}
+inline int64_t SummaryOptions::deadline_ms() const {
+  // @@protoc_insertion_point(field_get:topicsum.SummaryOptions.deadline_ms)
+  return _internal_deadline_ms();
+}
+inline void SummaryOptions::_internal_set_deadline_ms(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.deadline_ms_ = value;
+}
+inline void SummaryOptions::set_deadline_ms(int64_t value) {
+  _internal_set_deadline_ms(value);
+  // @@protoc_insertion_point(field_set:topicsum.SummaryOptions.deadline_ms)
 }
 
 // -------------------------------------------------------------------
@@ -1228,48 +2643,60 @@ inline void SummaryOptions::set_generate_debug(bool value) {
 // SummaryLength
 
 // required .topicsum.SummaryLength.LengthUnit unit = 1;
-inline bool SummaryLength::has_unit() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SummaryLength::set_has_unit() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool SummaryLength::_internal_has_unit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void SummaryLength::clear_has_unit() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SummaryLength::has_unit() const {
+  return _internal_has_unit();
 }
 inline void SummaryLength::clear_unit() {
-  unit_ = 0;
-  clear_has_unit();
+  _impl_.unit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::topicsum::SummaryLength_LengthUnit SummaryLength::_internal_unit() const {
+  return static_cast< ::topicsum::SummaryLength_LengthUnit >(_impl_.unit_);
 }
 inline ::topicsum::SummaryLength_LengthUnit SummaryLength::unit() const {
-  return static_cast< ::topicsum::SummaryLength_LengthUnit >(unit_);
+  // @@protoc_insertion_point(field_get:topicsum.SummaryLength.unit)
+  return _internal_unit();
 }
-inline void SummaryLength::set_unit(::topicsum::SummaryLength_LengthUnit value) {
+inline void SummaryLength::_internal_set_unit(::topicsum::SummaryLength_LengthUnit value) {
   assert(::topicsum::SummaryLength_LengthUnit_IsValid(value));
-  set_has_unit();
-  unit_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.unit_ = value;
+}
+inline void SummaryLength::set_unit(::topicsum::SummaryLength_LengthUnit value) {
+  _internal_set_unit(value);
+  // @@protoc_insertion_point(field_set:topicsum.SummaryLength.unit)
 }
 
 // required int32 length = 2;
+inline bool SummaryLength::_internal_has_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool SummaryLength::has_length() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_length();
 }
-inline void SummaryLength::set_has_length() {
-  _has_bits_[0] |= 0x00000002u;
+inline void SummaryLength::clear_length() {
+  _impl_.length_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void SummaryLength::clear_has_length() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t SummaryLength::_internal_length() const {
+  return _impl_.length_;
 }
-inline void SummaryLength::clear_length() {
-  length_ = 0;
-  clear_has_length();
+inline int32_t SummaryLength::length() const {
+  // @@protoc_insertion_point(field_get:topicsum.SummaryLength.length)
+  return _internal_length();
 }
-inline ::google::protobuf::int32 SummaryLength::length() const {
-  return length_;
+inline void SummaryLength::_internal_set_length(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.length_ = value;
 }
-inline void SummaryLength::set_length(::google::protobuf::int32 value) {
-  set_has_length();
-  length_ = value;
+inline void SummaryLength::set_length(int32_t value) {
+  _internal_set_length(value);
+  // @@protoc_insertion_point(field_set:topicsum.SummaryLength.length)
 }
 
 // -------------------------------------------------------------------
@@ -1277,91 +2704,435 @@ inline void SummaryLength::set_length(::google::protobuf::int32 value) {
 // GibbsSamplingOptions
 
 // optional int32 iterations = 1 [default = 500];
+inline bool GibbsSamplingOptions::_internal_has_iterations() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
 inline bool GibbsSamplingOptions::has_iterations() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_iterations();
+}
+inline void GibbsSamplingOptions::clear_iterations() {
+  _impl_.iterations_ = 500;
+  _impl_._has_bits_[0] &= ~0x00000400u;
 }
-inline void GibbsSamplingOptions::set_has_iterations() {
-  _has_bits_[0] |= 0x00000001u;
+inline int32_t GibbsSamplingOptions::_internal_iterations() const {
+  return _impl_.iterations_;
 }
-inline void GibbsSamplingOptions::clear_has_iterations() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t GibbsSamplingOptions::iterations() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.iterations)
+  return _internal_iterations();
 }
-inline void GibbsSamplingOptions::clear_iterations() {
-  iterations_ = 500;
-  clear_has_iterations();
+inline void GibbsSamplingOptions::_internal_set_iterations(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.iterations_ = value;
 }
-inline ::google::protobuf::int32 GibbsSamplingOptions::iterations() const {
-  return iterations_;
+inline void GibbsSamplingOptions::set_iterations(int32_t value) {
+  _internal_set_iterations(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.iterations)
 }
-inline void GibbsSamplingOptions::set_iterations(::google::protobuf::int32 value) {
-  set_has_iterations();
-  iterations_ = value;
+
+// optional int32 burnin = 2 [default = 0];
+inline bool GibbsSamplingOptions::_internal_has_burnin() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_burnin() const {
+  return _internal_has_burnin();
+}
+inline void GibbsSamplingOptions::clear_burnin() {
+  _impl_.burnin_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t GibbsSamplingOptions::_internal_burnin() const {
+  return _impl_.burnin_;
+}
+inline int32_t GibbsSamplingOptions::burnin() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.burnin)
+  return _internal_burnin();
+}
+inline void GibbsSamplingOptions::_internal_set_burnin(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.burnin_ = value;
+}
+inline void GibbsSamplingOptions::set_burnin(int32_t value) {
+  _internal_set_burnin(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.burnin)
+}
+
+// optional int32 lag = 3 [default = 10];
+inline bool GibbsSamplingOptions::_internal_has_lag() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_lag() const {
+  return _internal_has_lag();
+}
+inline void GibbsSamplingOptions::clear_lag() {
+  _impl_.lag_ = 10;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t GibbsSamplingOptions::_internal_lag() const {
+  return _impl_.lag_;
+}
+inline int32_t GibbsSamplingOptions::lag() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.lag)
+  return _internal_lag();
+}
+inline void GibbsSamplingOptions::_internal_set_lag(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.lag_ = value;
+}
+inline void GibbsSamplingOptions::set_lag(int32_t value) {
+  _internal_set_lag(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.lag)
+}
+
+// optional bool track_likelihood = 4 [default = false];
+inline bool GibbsSamplingOptions::_internal_has_track_likelihood() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_track_likelihood() const {
+  return _internal_has_track_likelihood();
+}
+inline void GibbsSamplingOptions::clear_track_likelihood() {
+  _impl_.track_likelihood_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool GibbsSamplingOptions::_internal_track_likelihood() const {
+  return _impl_.track_likelihood_;
+}
+inline bool GibbsSamplingOptions::track_likelihood() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.track_likelihood)
+  return _internal_track_likelihood();
+}
+inline void GibbsSamplingOptions::_internal_set_track_likelihood(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.track_likelihood_ = value;
+}
+inline void GibbsSamplingOptions::set_track_likelihood(bool value) {
+  _internal_set_track_likelihood(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.track_likelihood)
+}
+
+// optional int64 deadline_ms = 5 [default = 0];
+inline bool GibbsSamplingOptions::_internal_has_deadline_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_deadline_ms() const {
+  return _internal_has_deadline_ms();
+}
+inline void GibbsSamplingOptions::clear_deadline_ms() {
+  _impl_.deadline_ms_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GibbsSamplingOptions::_internal_deadline_ms() const {
+  return _impl_.deadline_ms_;
+}
+inline int64_t GibbsSamplingOptions::deadline_ms() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.deadline_ms)
+  return _internal_deadline_ms();
+}
+inline void GibbsSamplingOptions::_internal_set_deadline_ms(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.deadline_ms_ = value;
+}
+inline void GibbsSamplingOptions::set_deadline_ms(int64_t value) {
+  _internal_set_deadline_ms(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.deadline_ms)
+}
+
+// optional uint64 seed = 6 [default = 0];
+inline bool GibbsSamplingOptions::_internal_has_seed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_seed() const {
+  return _internal_has_seed();
+}
+inline void GibbsSamplingOptions::clear_seed() {
+  _impl_.seed_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t GibbsSamplingOptions::_internal_seed() const {
+  return _impl_.seed_;
+}
+inline uint64_t GibbsSamplingOptions::seed() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.seed)
+  return _internal_seed();
+}
+inline void GibbsSamplingOptions::_internal_set_seed(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.seed_ = value;
+}
+inline void GibbsSamplingOptions::set_seed(uint64_t value) {
+  _internal_set_seed(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.seed)
+}
+
+// optional int32 num_threads = 7 [default = 1];
+inline bool GibbsSamplingOptions::_internal_has_num_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_num_threads() const {
+  return _internal_has_num_threads();
+}
+inline void GibbsSamplingOptions::clear_num_threads() {
+  _impl_.num_threads_ = 1;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline int32_t GibbsSamplingOptions::_internal_num_threads() const {
+  return _impl_.num_threads_;
+}
+inline int32_t GibbsSamplingOptions::num_threads() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.num_threads)
+  return _internal_num_threads();
+}
+inline void GibbsSamplingOptions::_internal_set_num_threads(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.num_threads_ = value;
+}
+inline void GibbsSamplingOptions::set_num_threads(int32_t value) {
+  _internal_set_num_threads(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.num_threads)
+}
+
+// optional double convergence_tolerance = 8 [default = 0];
+inline bool GibbsSamplingOptions::_internal_has_convergence_tolerance() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_convergence_tolerance() const {
+  return _internal_has_convergence_tolerance();
+}
+inline void GibbsSamplingOptions::clear_convergence_tolerance() {
+  _impl_.convergence_tolerance_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double GibbsSamplingOptions::_internal_convergence_tolerance() const {
+  return _impl_.convergence_tolerance_;
+}
+inline double GibbsSamplingOptions::convergence_tolerance() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.convergence_tolerance)
+  return _internal_convergence_tolerance();
+}
+inline void GibbsSamplingOptions::_internal_set_convergence_tolerance(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.convergence_tolerance_ = value;
+}
+inline void GibbsSamplingOptions::set_convergence_tolerance(double value) {
+  _internal_set_convergence_tolerance(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.convergence_tolerance)
+}
+
+// optional int32 convergence_window = 9 [default = 5];
+inline bool GibbsSamplingOptions::_internal_has_convergence_window() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_convergence_window() const {
+  return _internal_has_convergence_window();
+}
+inline void GibbsSamplingOptions::clear_convergence_window() {
+  _impl_.convergence_window_ = 5;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline int32_t GibbsSamplingOptions::_internal_convergence_window() const {
+  return _impl_.convergence_window_;
+}
+inline int32_t GibbsSamplingOptions::convergence_window() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.convergence_window)
+  return _internal_convergence_window();
+}
+inline void GibbsSamplingOptions::_internal_set_convergence_window(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.convergence_window_ = value;
+}
+inline void GibbsSamplingOptions::set_convergence_window(int32_t value) {
+  _internal_set_convergence_window(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.convergence_window)
+}
+
+// optional int32 min_iterations = 10 [default = 0];
+inline bool GibbsSamplingOptions::_internal_has_min_iterations() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_min_iterations() const {
+  return _internal_has_min_iterations();
+}
+inline void GibbsSamplingOptions::clear_min_iterations() {
+  _impl_.min_iterations_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t GibbsSamplingOptions::_internal_min_iterations() const {
+  return _impl_.min_iterations_;
+}
+inline int32_t GibbsSamplingOptions::min_iterations() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.min_iterations)
+  return _internal_min_iterations();
+}
+inline void GibbsSamplingOptions::_internal_set_min_iterations(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.min_iterations_ = value;
+}
+inline void GibbsSamplingOptions::set_min_iterations(int32_t value) {
+  _internal_set_min_iterations(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.min_iterations)
+}
+
+// optional string checkpoint_path = 11;
+inline bool GibbsSamplingOptions::_internal_has_checkpoint_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GibbsSamplingOptions::has_checkpoint_path() const {
+  return _internal_has_checkpoint_path();
+}
+inline void GibbsSamplingOptions::clear_checkpoint_path() {
+  _impl_.checkpoint_path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GibbsSamplingOptions::checkpoint_path() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.checkpoint_path)
+  return _internal_checkpoint_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GibbsSamplingOptions::set_checkpoint_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.checkpoint_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.checkpoint_path)
+}
+inline std::string* GibbsSamplingOptions::mutable_checkpoint_path() {
+  std::string* _s = _internal_mutable_checkpoint_path();
+  // @@protoc_insertion_point(field_mutable:topicsum.GibbsSamplingOptions.checkpoint_path)
+  return _s;
+}
+inline const std::string& GibbsSamplingOptions::_internal_checkpoint_path() const {
+  return _impl_.checkpoint_path_.Get();
+}
+inline void GibbsSamplingOptions::_internal_set_checkpoint_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.checkpoint_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GibbsSamplingOptions::_internal_mutable_checkpoint_path() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.checkpoint_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GibbsSamplingOptions::release_checkpoint_path() {
+  // @@protoc_insertion_point(field_release:topicsum.GibbsSamplingOptions.checkpoint_path)
+  if (!_internal_has_checkpoint_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.checkpoint_path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkpoint_path_.IsDefault()) {
+    _impl_.checkpoint_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GibbsSamplingOptions::set_allocated_checkpoint_path(std::string* checkpoint_path) {
+  if (checkpoint_path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.checkpoint_path_.SetAllocated(checkpoint_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.checkpoint_path_.IsDefault()) {
+    _impl_.checkpoint_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.GibbsSamplingOptions.checkpoint_path)
 }
 
-// optional int32 burnin = 2 [default = 0];
-inline bool GibbsSamplingOptions::has_burnin() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional int32 checkpoint_interval = 12 [default = 0];
+inline bool GibbsSamplingOptions::_internal_has_checkpoint_interval() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void GibbsSamplingOptions::set_has_burnin() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool GibbsSamplingOptions::has_checkpoint_interval() const {
+  return _internal_has_checkpoint_interval();
 }
-inline void GibbsSamplingOptions::clear_has_burnin() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void GibbsSamplingOptions::clear_checkpoint_interval() {
+  _impl_.checkpoint_interval_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void GibbsSamplingOptions::clear_burnin() {
-  burnin_ = 0;
-  clear_has_burnin();
+inline int32_t GibbsSamplingOptions::_internal_checkpoint_interval() const {
+  return _impl_.checkpoint_interval_;
+}
+inline int32_t GibbsSamplingOptions::checkpoint_interval() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.checkpoint_interval)
+  return _internal_checkpoint_interval();
 }
-inline ::google::protobuf::int32 GibbsSamplingOptions::burnin() const {
-  return burnin_;
+inline void GibbsSamplingOptions::_internal_set_checkpoint_interval(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.checkpoint_interval_ = value;
 }
-inline void GibbsSamplingOptions::set_burnin(::google::protobuf::int32 value) {
-  set_has_burnin();
-  burnin_ = value;
+inline void GibbsSamplingOptions::set_checkpoint_interval(int32_t value) {
+  _internal_set_checkpoint_interval(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.checkpoint_interval)
 }
 
-// optional int32 lag = 3 [default = 10];
-inline bool GibbsSamplingOptions::has_lag() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional bool resume_from_checkpoint = 13 [default = false];
+inline bool GibbsSamplingOptions::_internal_has_resume_from_checkpoint() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void GibbsSamplingOptions::set_has_lag() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool GibbsSamplingOptions::has_resume_from_checkpoint() const {
+  return _internal_has_resume_from_checkpoint();
 }
-inline void GibbsSamplingOptions::clear_has_lag() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void GibbsSamplingOptions::clear_resume_from_checkpoint() {
+  _impl_.resume_from_checkpoint_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void GibbsSamplingOptions::clear_lag() {
-  lag_ = 10;
-  clear_has_lag();
+inline bool GibbsSamplingOptions::_internal_resume_from_checkpoint() const {
+  return _impl_.resume_from_checkpoint_;
+}
+inline bool GibbsSamplingOptions::resume_from_checkpoint() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.resume_from_checkpoint)
+  return _internal_resume_from_checkpoint();
 }
-inline ::google::protobuf::int32 GibbsSamplingOptions::lag() const {
-  return lag_;
+inline void GibbsSamplingOptions::_internal_set_resume_from_checkpoint(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.resume_from_checkpoint_ = value;
 }
-inline void GibbsSamplingOptions::set_lag(::google::protobuf::int32 value) {
-  set_has_lag();
-  lag_ = value;
+inline void GibbsSamplingOptions::set_resume_from_checkpoint(bool value) {
+  _internal_set_resume_from_checkpoint(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.resume_from_checkpoint)
 }
 
-// optional bool track_likelihood = 4 [default = false];
-inline bool GibbsSamplingOptions::has_track_likelihood() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// optional int32 num_chains = 14 [default = 1];
+inline bool GibbsSamplingOptions::_internal_has_num_chains() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void GibbsSamplingOptions::set_has_track_likelihood() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool GibbsSamplingOptions::has_num_chains() const {
+  return _internal_has_num_chains();
 }
-inline void GibbsSamplingOptions::clear_has_track_likelihood() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void GibbsSamplingOptions::clear_num_chains() {
+  _impl_.num_chains_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
-inline void GibbsSamplingOptions::clear_track_likelihood() {
-  track_likelihood_ = false;
-  clear_has_track_likelihood();
+inline int32_t GibbsSamplingOptions::_internal_num_chains() const {
+  return _impl_.num_chains_;
 }
-inline bool GibbsSamplingOptions::track_likelihood() const {
-  return track_likelihood_;
+inline int32_t GibbsSamplingOptions::num_chains() const {
+  // @@protoc_insertion_point(field_get:topicsum.GibbsSamplingOptions.num_chains)
+  return _internal_num_chains();
 }
-inline void GibbsSamplingOptions::set_track_likelihood(bool value) {
-  set_has_track_likelihood();
-  track_likelihood_ = value;
+inline void GibbsSamplingOptions::_internal_set_num_chains(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.num_chains_ = value;
+}
+inline void GibbsSamplingOptions::set_num_chains(int32_t value) {
+  _internal_set_num_chains(value);
+  // @@protoc_insertion_point(field_set:topicsum.GibbsSamplingOptions.num_chains)
 }
 
 // -------------------------------------------------------------------
@@ -1369,184 +3140,372 @@ inline void GibbsSamplingOptions::set_track_likelihood(bool value) {
 // KLSumOptions
 
 // optional .topicsum.KLSumOptions.OptimizationStrategy optimization_strategy = 1 [default = GREEDY_OPTIMIZATION];
-inline bool KLSumOptions::has_optimization_strategy() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void KLSumOptions::set_has_optimization_strategy() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool KLSumOptions::_internal_has_optimization_strategy() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void KLSumOptions::clear_has_optimization_strategy() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool KLSumOptions::has_optimization_strategy() const {
+  return _internal_has_optimization_strategy();
 }
 inline void KLSumOptions::clear_optimization_strategy() {
-  optimization_strategy_ = 0;
-  clear_has_optimization_strategy();
+  _impl_.optimization_strategy_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::topicsum::KLSumOptions_OptimizationStrategy KLSumOptions::_internal_optimization_strategy() const {
+  return static_cast< ::topicsum::KLSumOptions_OptimizationStrategy >(_impl_.optimization_strategy_);
 }
 inline ::topicsum::KLSumOptions_OptimizationStrategy KLSumOptions::optimization_strategy() const {
-  return static_cast< ::topicsum::KLSumOptions_OptimizationStrategy >(optimization_strategy_);
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.optimization_strategy)
+  return _internal_optimization_strategy();
 }
-inline void KLSumOptions::set_optimization_strategy(::topicsum::KLSumOptions_OptimizationStrategy value) {
+inline void KLSumOptions::_internal_set_optimization_strategy(::topicsum::KLSumOptions_OptimizationStrategy value) {
   assert(::topicsum::KLSumOptions_OptimizationStrategy_IsValid(value));
-  set_has_optimization_strategy();
-  optimization_strategy_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.optimization_strategy_ = value;
+}
+inline void KLSumOptions::set_optimization_strategy(::topicsum::KLSumOptions_OptimizationStrategy value) {
+  _internal_set_optimization_strategy(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.optimization_strategy)
 }
 
 // optional bool redundancy_removal = 2 [default = false];
-inline bool KLSumOptions::has_redundancy_removal() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool KLSumOptions::_internal_has_redundancy_removal() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void KLSumOptions::set_has_redundancy_removal() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void KLSumOptions::clear_has_redundancy_removal() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool KLSumOptions::has_redundancy_removal() const {
+  return _internal_has_redundancy_removal();
 }
 inline void KLSumOptions::clear_redundancy_removal() {
-  redundancy_removal_ = false;
-  clear_has_redundancy_removal();
+  _impl_.redundancy_removal_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool KLSumOptions::_internal_redundancy_removal() const {
+  return _impl_.redundancy_removal_;
 }
 inline bool KLSumOptions::redundancy_removal() const {
-  return redundancy_removal_;
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.redundancy_removal)
+  return _internal_redundancy_removal();
+}
+inline void KLSumOptions::_internal_set_redundancy_removal(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.redundancy_removal_ = value;
 }
 inline void KLSumOptions::set_redundancy_removal(bool value) {
-  set_has_redundancy_removal();
-  redundancy_removal_ = value;
+  _internal_set_redundancy_removal(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.redundancy_removal)
 }
 
 // optional bool sentence_position = 3 [default = false];
-inline bool KLSumOptions::has_sentence_position() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void KLSumOptions::set_has_sentence_position() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool KLSumOptions::_internal_has_sentence_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void KLSumOptions::clear_has_sentence_position() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool KLSumOptions::has_sentence_position() const {
+  return _internal_has_sentence_position();
 }
 inline void KLSumOptions::clear_sentence_position() {
-  sentence_position_ = false;
-  clear_has_sentence_position();
+  _impl_.sentence_position_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool KLSumOptions::_internal_sentence_position() const {
+  return _impl_.sentence_position_;
 }
 inline bool KLSumOptions::sentence_position() const {
-  return sentence_position_;
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.sentence_position)
+  return _internal_sentence_position();
+}
+inline void KLSumOptions::_internal_set_sentence_position(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.sentence_position_ = value;
 }
 inline void KLSumOptions::set_sentence_position(bool value) {
-  set_has_sentence_position();
-  sentence_position_ = value;
+  _internal_set_sentence_position(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.sentence_position)
 }
 
 // optional float summary_weight = 5 [default = 1];
-inline bool KLSumOptions::has_summary_weight() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool KLSumOptions::_internal_has_summary_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
 }
-inline void KLSumOptions::set_has_summary_weight() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void KLSumOptions::clear_has_summary_weight() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool KLSumOptions::has_summary_weight() const {
+  return _internal_has_summary_weight();
 }
 inline void KLSumOptions::clear_summary_weight() {
-  summary_weight_ = 1;
-  clear_has_summary_weight();
+  _impl_.summary_weight_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline float KLSumOptions::_internal_summary_weight() const {
+  return _impl_.summary_weight_;
 }
 inline float KLSumOptions::summary_weight() const {
-  return summary_weight_;
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.summary_weight)
+  return _internal_summary_weight();
+}
+inline void KLSumOptions::_internal_set_summary_weight(float value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.summary_weight_ = value;
 }
 inline void KLSumOptions::set_summary_weight(float value) {
-  set_has_summary_weight();
-  summary_weight_ = value;
+  _internal_set_summary_weight(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.summary_weight)
 }
 
 // optional float prior_weight = 6 [default = 0];
-inline bool KLSumOptions::has_prior_weight() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void KLSumOptions::set_has_prior_weight() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool KLSumOptions::_internal_has_prior_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void KLSumOptions::clear_has_prior_weight() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool KLSumOptions::has_prior_weight() const {
+  return _internal_has_prior_weight();
 }
 inline void KLSumOptions::clear_prior_weight() {
-  prior_weight_ = 0;
-  clear_has_prior_weight();
+  _impl_.prior_weight_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline float KLSumOptions::_internal_prior_weight() const {
+  return _impl_.prior_weight_;
 }
 inline float KLSumOptions::prior_weight() const {
-  return prior_weight_;
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.prior_weight)
+  return _internal_prior_weight();
+}
+inline void KLSumOptions::_internal_set_prior_weight(float value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.prior_weight_ = value;
 }
 inline void KLSumOptions::set_prior_weight(float value) {
-  set_has_prior_weight();
-  prior_weight_ = value;
+  _internal_set_prior_weight(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.prior_weight)
 }
 
 // optional string postprocessor_name = 7 [default = "NewsPostprocessor"];
-inline bool KLSumOptions::has_postprocessor_name() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool KLSumOptions::_internal_has_postprocessor_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void KLSumOptions::set_has_postprocessor_name() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void KLSumOptions::clear_has_postprocessor_name() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool KLSumOptions::has_postprocessor_name() const {
+  return _internal_has_postprocessor_name();
 }
 inline void KLSumOptions::clear_postprocessor_name() {
-  if (postprocessor_name_ != _default_postprocessor_name_) {
-    postprocessor_name_->assign(*_default_postprocessor_name_);
+  _impl_.postprocessor_name_.ClearToDefault(::topicsum::KLSumOptions::Impl_::_i_give_permission_to_break_this_code_default_postprocessor_name_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& KLSumOptions::postprocessor_name() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.postprocessor_name)
+  if (_impl_.postprocessor_name_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_postprocessor_name_.get();
+  return _internal_postprocessor_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void KLSumOptions::set_postprocessor_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.postprocessor_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.postprocessor_name)
+}
+inline std::string* KLSumOptions::mutable_postprocessor_name() {
+  std::string* _s = _internal_mutable_postprocessor_name();
+  // @@protoc_insertion_point(field_mutable:topicsum.KLSumOptions.postprocessor_name)
+  return _s;
+}
+inline const std::string& KLSumOptions::_internal_postprocessor_name() const {
+  return _impl_.postprocessor_name_.Get();
+}
+inline void KLSumOptions::_internal_set_postprocessor_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.postprocessor_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* KLSumOptions::_internal_mutable_postprocessor_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.postprocessor_name_.Mutable(::topicsum::KLSumOptions::Impl_::_i_give_permission_to_break_this_code_default_postprocessor_name_, GetArenaForAllocation());
+}
+inline std::string* KLSumOptions::release_postprocessor_name() {
+  // @@protoc_insertion_point(field_release:topicsum.KLSumOptions.postprocessor_name)
+  if (!_internal_has_postprocessor_name()) {
+    return nullptr;
   }
-  clear_has_postprocessor_name();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.postprocessor_name_.Release();
+  return p;
 }
-inline const ::std::string& KLSumOptions::postprocessor_name() const {
-  return *postprocessor_name_;
-}
-inline void KLSumOptions::set_postprocessor_name(const ::std::string& value) {
-  set_has_postprocessor_name();
-  if (postprocessor_name_ == _default_postprocessor_name_) {
-    postprocessor_name_ = new ::std::string;
+inline void KLSumOptions::set_allocated_postprocessor_name(std::string* postprocessor_name) {
+  if (postprocessor_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  postprocessor_name_->assign(value);
+  _impl_.postprocessor_name_.SetAllocated(postprocessor_name, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:topicsum.KLSumOptions.postprocessor_name)
 }
-inline void KLSumOptions::set_postprocessor_name(const char* value) {
-  set_has_postprocessor_name();
-  if (postprocessor_name_ == _default_postprocessor_name_) {
-    postprocessor_name_ = new ::std::string;
-  }
-  postprocessor_name_->assign(value);
+
+// optional bool lazy_evaluation = 8 [default = false];
+inline bool KLSumOptions::_internal_has_lazy_evaluation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void KLSumOptions::set_postprocessor_name(const char* value, size_t size) {
-  set_has_postprocessor_name();
-  if (postprocessor_name_ == _default_postprocessor_name_) {
-    postprocessor_name_ = new ::std::string;
-  }
-  postprocessor_name_->assign(reinterpret_cast<const char*>(value), size);
+inline bool KLSumOptions::has_lazy_evaluation() const {
+  return _internal_has_lazy_evaluation();
 }
-inline ::std::string* KLSumOptions::mutable_postprocessor_name() {
-  set_has_postprocessor_name();
-  if (postprocessor_name_ == _default_postprocessor_name_) {
-    postprocessor_name_ = new ::std::string(*_default_postprocessor_name_);
-  }
-  return postprocessor_name_;
+inline void KLSumOptions::clear_lazy_evaluation() {
+  _impl_.lazy_evaluation_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::std::string* KLSumOptions::release_postprocessor_name() {
-  clear_has_postprocessor_name();
-  if (postprocessor_name_ == _default_postprocessor_name_) {
-    return NULL;
-  } else {
-    ::std::string* temp = postprocessor_name_;
-    postprocessor_name_ = const_cast< ::std::string*>(_default_postprocessor_name_);
-    return temp;
-  }
+inline bool KLSumOptions::_internal_lazy_evaluation() const {
+  return _impl_.lazy_evaluation_;
 }
-inline void KLSumOptions::set_allocated_postprocessor_name(::std::string* postprocessor_name) {
-  if (postprocessor_name_ != _default_postprocessor_name_) {
-    delete postprocessor_name_;
-  }
-  if (postprocessor_name) {
-    set_has_postprocessor_name();
-    postprocessor_name_ = postprocessor_name;
-  } else {
-    clear_has_postprocessor_name();
-    postprocessor_name_ = const_cast< ::std::string*>(_default_postprocessor_name_);
-  }
+inline bool KLSumOptions::lazy_evaluation() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.lazy_evaluation)
+  return _internal_lazy_evaluation();
+}
+inline void KLSumOptions::_internal_set_lazy_evaluation(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.lazy_evaluation_ = value;
+}
+inline void KLSumOptions::set_lazy_evaluation(bool value) {
+  _internal_set_lazy_evaluation(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.lazy_evaluation)
+}
+
+// optional int32 num_threads = 9 [default = 1];
+inline bool KLSumOptions::_internal_has_num_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool KLSumOptions::has_num_threads() const {
+  return _internal_has_num_threads();
+}
+inline void KLSumOptions::clear_num_threads() {
+  _impl_.num_threads_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline int32_t KLSumOptions::_internal_num_threads() const {
+  return _impl_.num_threads_;
+}
+inline int32_t KLSumOptions::num_threads() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.num_threads)
+  return _internal_num_threads();
+}
+inline void KLSumOptions::_internal_set_num_threads(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.num_threads_ = value;
+}
+inline void KLSumOptions::set_num_threads(int32_t value) {
+  _internal_set_num_threads(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.num_threads)
+}
+
+// optional bool fast_log = 10 [default = false];
+inline bool KLSumOptions::_internal_has_fast_log() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool KLSumOptions::has_fast_log() const {
+  return _internal_has_fast_log();
+}
+inline void KLSumOptions::clear_fast_log() {
+  _impl_.fast_log_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool KLSumOptions::_internal_fast_log() const {
+  return _impl_.fast_log_;
+}
+inline bool KLSumOptions::fast_log() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.fast_log)
+  return _internal_fast_log();
+}
+inline void KLSumOptions::_internal_set_fast_log(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.fast_log_ = value;
+}
+inline void KLSumOptions::set_fast_log(bool value) {
+  _internal_set_fast_log(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.fast_log)
+}
+
+// optional .topicsum.KLSumOptions.Precision precision = 11 [default = DOUBLE];
+inline bool KLSumOptions::_internal_has_precision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool KLSumOptions::has_precision() const {
+  return _internal_has_precision();
+}
+inline void KLSumOptions::clear_precision() {
+  _impl_.precision_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::topicsum::KLSumOptions_Precision KLSumOptions::_internal_precision() const {
+  return static_cast< ::topicsum::KLSumOptions_Precision >(_impl_.precision_);
+}
+inline ::topicsum::KLSumOptions_Precision KLSumOptions::precision() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.precision)
+  return _internal_precision();
+}
+inline void KLSumOptions::_internal_set_precision(::topicsum::KLSumOptions_Precision value) {
+  assert(::topicsum::KLSumOptions_Precision_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.precision_ = value;
+}
+inline void KLSumOptions::set_precision(::topicsum::KLSumOptions_Precision value) {
+  _internal_set_precision(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.precision)
+}
+
+// optional bool collapse_duplicates = 12 [default = false];
+inline bool KLSumOptions::_internal_has_collapse_duplicates() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool KLSumOptions::has_collapse_duplicates() const {
+  return _internal_has_collapse_duplicates();
+}
+inline void KLSumOptions::clear_collapse_duplicates() {
+  _impl_.collapse_duplicates_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool KLSumOptions::_internal_collapse_duplicates() const {
+  return _impl_.collapse_duplicates_;
+}
+inline bool KLSumOptions::collapse_duplicates() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.collapse_duplicates)
+  return _internal_collapse_duplicates();
+}
+inline void KLSumOptions::_internal_set_collapse_duplicates(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.collapse_duplicates_ = value;
+}
+inline void KLSumOptions::set_collapse_duplicates(bool value) {
+  _internal_set_collapse_duplicates(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.collapse_duplicates)
+}
+
+// optional double near_duplicate_similarity = 13 [default = 0.8];
+inline bool KLSumOptions::_internal_has_near_duplicate_similarity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool KLSumOptions::has_near_duplicate_similarity() const {
+  return _internal_has_near_duplicate_similarity();
+}
+inline void KLSumOptions::clear_near_duplicate_similarity() {
+  _impl_.near_duplicate_similarity_ = 0.8;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline double KLSumOptions::_internal_near_duplicate_similarity() const {
+  return _impl_.near_duplicate_similarity_;
+}
+inline double KLSumOptions::near_duplicate_similarity() const {
+  // @@protoc_insertion_point(field_get:topicsum.KLSumOptions.near_duplicate_similarity)
+  return _internal_near_duplicate_similarity();
+}
+inline void KLSumOptions::_internal_set_near_duplicate_similarity(double value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.near_duplicate_similarity_ = value;
+}
+inline void KLSumOptions::set_near_duplicate_similarity(double value) {
+  _internal_set_near_duplicate_similarity(value);
+  // @@protoc_insertion_point(field_set:topicsum.KLSumOptions.near_duplicate_similarity)
 }
 
 // -------------------------------------------------------------------
@@ -1554,181 +3513,364 @@ inline void KLSumOptions::set_allocated_postprocessor_name(::std::string* postpr
 // TopicSumOptions
 
 // optional .topicsum.GibbsSamplingOptions gibbs_sampling_options = 2;
-inline bool TopicSumOptions::has_gibbs_sampling_options() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TopicSumOptions::_internal_has_gibbs_sampling_options() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.gibbs_sampling_options_ != nullptr);
+  return value;
 }
-inline void TopicSumOptions::set_has_gibbs_sampling_options() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TopicSumOptions::clear_has_gibbs_sampling_options() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TopicSumOptions::has_gibbs_sampling_options() const {
+  return _internal_has_gibbs_sampling_options();
 }
 inline void TopicSumOptions::clear_gibbs_sampling_options() {
-  if (gibbs_sampling_options_ != NULL) gibbs_sampling_options_->::topicsum::GibbsSamplingOptions::Clear();
-  clear_has_gibbs_sampling_options();
+  if (_impl_.gibbs_sampling_options_ != nullptr) _impl_.gibbs_sampling_options_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::topicsum::GibbsSamplingOptions& TopicSumOptions::_internal_gibbs_sampling_options() const {
+  const ::topicsum::GibbsSamplingOptions* p = _impl_.gibbs_sampling_options_;
+  return p != nullptr ? *p : reinterpret_cast<const ::topicsum::GibbsSamplingOptions&>(
+      ::topicsum::_GibbsSamplingOptions_default_instance_);
 }
 inline const ::topicsum::GibbsSamplingOptions& TopicSumOptions::gibbs_sampling_options() const {
-  return gibbs_sampling_options_ != NULL ? *gibbs_sampling_options_ : *default_instance_->gibbs_sampling_options_;
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.gibbs_sampling_options)
+  return _internal_gibbs_sampling_options();
 }
-inline ::topicsum::GibbsSamplingOptions* TopicSumOptions::mutable_gibbs_sampling_options() {
-  set_has_gibbs_sampling_options();
-  if (gibbs_sampling_options_ == NULL) gibbs_sampling_options_ = new ::topicsum::GibbsSamplingOptions;
-  return gibbs_sampling_options_;
+inline void TopicSumOptions::unsafe_arena_set_allocated_gibbs_sampling_options(
+    ::topicsum::GibbsSamplingOptions* gibbs_sampling_options) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gibbs_sampling_options_);
+  }
+  _impl_.gibbs_sampling_options_ = gibbs_sampling_options;
+  if (gibbs_sampling_options) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:topicsum.TopicSumOptions.gibbs_sampling_options)
 }
 inline ::topicsum::GibbsSamplingOptions* TopicSumOptions::release_gibbs_sampling_options() {
-  clear_has_gibbs_sampling_options();
-  ::topicsum::GibbsSamplingOptions* temp = gibbs_sampling_options_;
-  gibbs_sampling_options_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::topicsum::GibbsSamplingOptions* temp = _impl_.gibbs_sampling_options_;
+  _impl_.gibbs_sampling_options_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::topicsum::GibbsSamplingOptions* TopicSumOptions::unsafe_arena_release_gibbs_sampling_options() {
+  // @@protoc_insertion_point(field_release:topicsum.TopicSumOptions.gibbs_sampling_options)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::topicsum::GibbsSamplingOptions* temp = _impl_.gibbs_sampling_options_;
+  _impl_.gibbs_sampling_options_ = nullptr;
   return temp;
 }
+inline ::topicsum::GibbsSamplingOptions* TopicSumOptions::_internal_mutable_gibbs_sampling_options() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.gibbs_sampling_options_ == nullptr) {
+    auto* p = CreateMaybeMessage<::topicsum::GibbsSamplingOptions>(GetArenaForAllocation());
+    _impl_.gibbs_sampling_options_ = p;
+  }
+  return _impl_.gibbs_sampling_options_;
+}
+inline ::topicsum::GibbsSamplingOptions* TopicSumOptions::mutable_gibbs_sampling_options() {
+  ::topicsum::GibbsSamplingOptions* _msg = _internal_mutable_gibbs_sampling_options();
+  // @@protoc_insertion_point(field_mutable:topicsum.TopicSumOptions.gibbs_sampling_options)
+  return _msg;
+}
 inline void TopicSumOptions::set_allocated_gibbs_sampling_options(::topicsum::GibbsSamplingOptions* gibbs_sampling_options) {
-  delete gibbs_sampling_options_;
-  gibbs_sampling_options_ = gibbs_sampling_options;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gibbs_sampling_options_;
+  }
   if (gibbs_sampling_options) {
-    set_has_gibbs_sampling_options();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gibbs_sampling_options);
+    if (message_arena != submessage_arena) {
+      gibbs_sampling_options = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gibbs_sampling_options, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_gibbs_sampling_options();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.gibbs_sampling_options_ = gibbs_sampling_options;
+  // @@protoc_insertion_point(field_set_allocated:topicsum.TopicSumOptions.gibbs_sampling_options)
 }
 
 // optional string lambda = 3 [default = "0.1,1,1"];
-inline bool TopicSumOptions::has_lambda() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TopicSumOptions::set_has_lambda() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TopicSumOptions::_internal_has_lambda() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TopicSumOptions::clear_has_lambda() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TopicSumOptions::has_lambda() const {
+  return _internal_has_lambda();
 }
 inline void TopicSumOptions::clear_lambda() {
-  if (lambda_ != _default_lambda_) {
-    lambda_->assign(*_default_lambda_);
+  _impl_.lambda_.ClearToDefault(::topicsum::TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_lambda_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TopicSumOptions::lambda() const {
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.lambda)
+  if (_impl_.lambda_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_lambda_.get();
+  return _internal_lambda();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TopicSumOptions::set_lambda(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.lambda_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.TopicSumOptions.lambda)
+}
+inline std::string* TopicSumOptions::mutable_lambda() {
+  std::string* _s = _internal_mutable_lambda();
+  // @@protoc_insertion_point(field_mutable:topicsum.TopicSumOptions.lambda)
+  return _s;
+}
+inline const std::string& TopicSumOptions::_internal_lambda() const {
+  return _impl_.lambda_.Get();
+}
+inline void TopicSumOptions::_internal_set_lambda(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lambda_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TopicSumOptions::_internal_mutable_lambda() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.lambda_.Mutable(::topicsum::TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_lambda_, GetArenaForAllocation());
+}
+inline std::string* TopicSumOptions::release_lambda() {
+  // @@protoc_insertion_point(field_release:topicsum.TopicSumOptions.lambda)
+  if (!_internal_has_lambda()) {
+    return nullptr;
   }
-  clear_has_lambda();
-}
-inline const ::std::string& TopicSumOptions::lambda() const {
-  return *lambda_;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.lambda_.Release();
+  return p;
 }
-inline void TopicSumOptions::set_lambda(const ::std::string& value) {
-  set_has_lambda();
-  if (lambda_ == _default_lambda_) {
-    lambda_ = new ::std::string;
+inline void TopicSumOptions::set_allocated_lambda(std::string* lambda) {
+  if (lambda != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  lambda_->assign(value);
+  _impl_.lambda_.SetAllocated(lambda, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:topicsum.TopicSumOptions.lambda)
 }
-inline void TopicSumOptions::set_lambda(const char* value) {
-  set_has_lambda();
-  if (lambda_ == _default_lambda_) {
-    lambda_ = new ::std::string;
-  }
-  lambda_->assign(value);
+
+// optional string gamma = 4 [default = "1,5,10"];
+inline bool TopicSumOptions::_internal_has_gamma() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TopicSumOptions::set_lambda(const char* value, size_t size) {
-  set_has_lambda();
-  if (lambda_ == _default_lambda_) {
-    lambda_ = new ::std::string;
-  }
-  lambda_->assign(reinterpret_cast<const char*>(value), size);
+inline bool TopicSumOptions::has_gamma() const {
+  return _internal_has_gamma();
 }
-inline ::std::string* TopicSumOptions::mutable_lambda() {
-  set_has_lambda();
-  if (lambda_ == _default_lambda_) {
-    lambda_ = new ::std::string(*_default_lambda_);
+inline void TopicSumOptions::clear_gamma() {
+  _impl_.gamma_.ClearToDefault(::topicsum::TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_gamma_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TopicSumOptions::gamma() const {
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.gamma)
+  if (_impl_.gamma_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_gamma_.get();
+  return _internal_gamma();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TopicSumOptions::set_gamma(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.gamma_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.TopicSumOptions.gamma)
+}
+inline std::string* TopicSumOptions::mutable_gamma() {
+  std::string* _s = _internal_mutable_gamma();
+  // @@protoc_insertion_point(field_mutable:topicsum.TopicSumOptions.gamma)
+  return _s;
+}
+inline const std::string& TopicSumOptions::_internal_gamma() const {
+  return _impl_.gamma_.Get();
+}
+inline void TopicSumOptions::_internal_set_gamma(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.gamma_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TopicSumOptions::_internal_mutable_gamma() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.gamma_.Mutable(::topicsum::TopicSumOptions::Impl_::_i_give_permission_to_break_this_code_default_gamma_, GetArenaForAllocation());
+}
+inline std::string* TopicSumOptions::release_gamma() {
+  // @@protoc_insertion_point(field_release:topicsum.TopicSumOptions.gamma)
+  if (!_internal_has_gamma()) {
+    return nullptr;
   }
-  return lambda_;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.gamma_.Release();
+  return p;
 }
-inline ::std::string* TopicSumOptions::release_lambda() {
-  clear_has_lambda();
-  if (lambda_ == _default_lambda_) {
-    return NULL;
+inline void TopicSumOptions::set_allocated_gamma(std::string* gamma) {
+  if (gamma != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = lambda_;
-    lambda_ = const_cast< ::std::string*>(_default_lambda_);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.gamma_.SetAllocated(gamma, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:topicsum.TopicSumOptions.gamma)
+}
+
+// optional string background_model_path = 8;
+inline bool TopicSumOptions::_internal_has_background_model_path() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TopicSumOptions::has_background_model_path() const {
+  return _internal_has_background_model_path();
+}
+inline void TopicSumOptions::clear_background_model_path() {
+  _impl_.background_model_path_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& TopicSumOptions::background_model_path() const {
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.background_model_path)
+  return _internal_background_model_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TopicSumOptions::set_background_model_path(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.background_model_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:topicsum.TopicSumOptions.background_model_path)
+}
+inline std::string* TopicSumOptions::mutable_background_model_path() {
+  std::string* _s = _internal_mutable_background_model_path();
+  // @@protoc_insertion_point(field_mutable:topicsum.TopicSumOptions.background_model_path)
+  return _s;
+}
+inline const std::string& TopicSumOptions::_internal_background_model_path() const {
+  return _impl_.background_model_path_.Get();
+}
+inline void TopicSumOptions::_internal_set_background_model_path(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.background_model_path_.Set(value, GetArenaForAllocation());
 }
-inline void TopicSumOptions::set_allocated_lambda(::std::string* lambda) {
-  if (lambda_ != _default_lambda_) {
-    delete lambda_;
+inline std::string* TopicSumOptions::_internal_mutable_background_model_path() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.background_model_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TopicSumOptions::release_background_model_path() {
+  // @@protoc_insertion_point(field_release:topicsum.TopicSumOptions.background_model_path)
+  if (!_internal_has_background_model_path()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.background_model_path_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_model_path_.IsDefault()) {
+    _impl_.background_model_path_.Set("", GetArenaForAllocation());
   }
-  if (lambda) {
-    set_has_lambda();
-    lambda_ = lambda;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TopicSumOptions::set_allocated_background_model_path(std::string* background_model_path) {
+  if (background_model_path != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_lambda();
-    lambda_ = const_cast< ::std::string*>(_default_lambda_);
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.background_model_path_.SetAllocated(background_model_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.background_model_path_.IsDefault()) {
+    _impl_.background_model_path_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:topicsum.TopicSumOptions.background_model_path)
 }
 
-// optional string gamma = 4 [default = "1,5,10"];
-inline bool TopicSumOptions::has_gamma() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// optional .topicsum.TopicSumOptions.Inference inference = 9 [default = GIBBS_SAMPLING];
+inline bool TopicSumOptions::_internal_has_inference() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void TopicSumOptions::set_has_gamma() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TopicSumOptions::has_inference() const {
+  return _internal_has_inference();
 }
-inline void TopicSumOptions::clear_has_gamma() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void TopicSumOptions::clear_inference() {
+  _impl_.inference_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void TopicSumOptions::clear_gamma() {
-  if (gamma_ != _default_gamma_) {
-    gamma_->assign(*_default_gamma_);
-  }
-  clear_has_gamma();
+inline ::topicsum::TopicSumOptions_Inference TopicSumOptions::_internal_inference() const {
+  return static_cast< ::topicsum::TopicSumOptions_Inference >(_impl_.inference_);
 }
-inline const ::std::string& TopicSumOptions::gamma() const {
-  return *gamma_;
+inline ::topicsum::TopicSumOptions_Inference TopicSumOptions::inference() const {
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.inference)
+  return _internal_inference();
 }
-inline void TopicSumOptions::set_gamma(const ::std::string& value) {
-  set_has_gamma();
-  if (gamma_ == _default_gamma_) {
-    gamma_ = new ::std::string;
-  }
-  gamma_->assign(value);
+inline void TopicSumOptions::_internal_set_inference(::topicsum::TopicSumOptions_Inference value) {
+  assert(::topicsum::TopicSumOptions_Inference_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.inference_ = value;
 }
-inline void TopicSumOptions::set_gamma(const char* value) {
-  set_has_gamma();
-  if (gamma_ == _default_gamma_) {
-    gamma_ = new ::std::string;
-  }
-  gamma_->assign(value);
+inline void TopicSumOptions::set_inference(::topicsum::TopicSumOptions_Inference value) {
+  _internal_set_inference(value);
+  // @@protoc_insertion_point(field_set:topicsum.TopicSumOptions.inference)
 }
-inline void TopicSumOptions::set_gamma(const char* value, size_t size) {
-  set_has_gamma();
-  if (gamma_ == _default_gamma_) {
-    gamma_ = new ::std::string;
-  }
-  gamma_->assign(reinterpret_cast<const char*>(value), size);
+
+// optional int32 cvb0_iterations = 10 [default = 50];
+inline bool TopicSumOptions::_internal_has_cvb0_iterations() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline ::std::string* TopicSumOptions::mutable_gamma() {
-  set_has_gamma();
-  if (gamma_ == _default_gamma_) {
-    gamma_ = new ::std::string(*_default_gamma_);
-  }
-  return gamma_;
+inline bool TopicSumOptions::has_cvb0_iterations() const {
+  return _internal_has_cvb0_iterations();
 }
-inline ::std::string* TopicSumOptions::release_gamma() {
-  clear_has_gamma();
-  if (gamma_ == _default_gamma_) {
-    return NULL;
-  } else {
-    ::std::string* temp = gamma_;
-    gamma_ = const_cast< ::std::string*>(_default_gamma_);
-    return temp;
-  }
+inline void TopicSumOptions::clear_cvb0_iterations() {
+  _impl_.cvb0_iterations_ = 50;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void TopicSumOptions::set_allocated_gamma(::std::string* gamma) {
-  if (gamma_ != _default_gamma_) {
-    delete gamma_;
-  }
-  if (gamma) {
-    set_has_gamma();
-    gamma_ = gamma;
-  } else {
-    clear_has_gamma();
-    gamma_ = const_cast< ::std::string*>(_default_gamma_);
-  }
+inline int32_t TopicSumOptions::_internal_cvb0_iterations() const {
+  return _impl_.cvb0_iterations_;
+}
+inline int32_t TopicSumOptions::cvb0_iterations() const {
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.cvb0_iterations)
+  return _internal_cvb0_iterations();
+}
+inline void TopicSumOptions::_internal_set_cvb0_iterations(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cvb0_iterations_ = value;
+}
+inline void TopicSumOptions::set_cvb0_iterations(int32_t value) {
+  _internal_set_cvb0_iterations(value);
+  // @@protoc_insertion_point(field_set:topicsum.TopicSumOptions.cvb0_iterations)
+}
+
+// optional int32 batch_num_threads = 11 [default = 1];
+inline bool TopicSumOptions::_internal_has_batch_num_threads() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool TopicSumOptions::has_batch_num_threads() const {
+  return _internal_has_batch_num_threads();
+}
+inline void TopicSumOptions::clear_batch_num_threads() {
+  _impl_.batch_num_threads_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int32_t TopicSumOptions::_internal_batch_num_threads() const {
+  return _impl_.batch_num_threads_;
+}
+inline int32_t TopicSumOptions::batch_num_threads() const {
+  // @@protoc_insertion_point(field_get:topicsum.TopicSumOptions.batch_num_threads)
+  return _internal_batch_num_threads();
+}
+inline void TopicSumOptions::_internal_set_batch_num_threads(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.batch_num_threads_ = value;
+}
+inline void TopicSumOptions::set_batch_num_threads(int32_t value) {
+  _internal_set_batch_num_threads(value);
+  // @@protoc_insertion_point(field_set:topicsum.TopicSumOptions.batch_num_threads)
 }
 
 // -------------------------------------------------------------------
@@ -1736,47 +3878,59 @@ inline void TopicSumOptions::set_allocated_gamma(::std::string* gamma) {
 // NewsPostProcessorOptions
 
 // optional int32 min_sentence_length = 1;
+inline bool NewsPostProcessorOptions::_internal_has_min_sentence_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool NewsPostProcessorOptions::has_min_sentence_length() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_min_sentence_length();
 }
-inline void NewsPostProcessorOptions::set_has_min_sentence_length() {
-  _has_bits_[0] |= 0x00000001u;
+inline void NewsPostProcessorOptions::clear_min_sentence_length() {
+  _impl_.min_sentence_length_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void NewsPostProcessorOptions::clear_has_min_sentence_length() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t NewsPostProcessorOptions::_internal_min_sentence_length() const {
+  return _impl_.min_sentence_length_;
 }
-inline void NewsPostProcessorOptions::clear_min_sentence_length() {
-  min_sentence_length_ = 0;
-  clear_has_min_sentence_length();
+inline int32_t NewsPostProcessorOptions::min_sentence_length() const {
+  // @@protoc_insertion_point(field_get:topicsum.NewsPostProcessorOptions.min_sentence_length)
+  return _internal_min_sentence_length();
 }
-inline ::google::protobuf::int32 NewsPostProcessorOptions::min_sentence_length() const {
-  return min_sentence_length_;
+inline void NewsPostProcessorOptions::_internal_set_min_sentence_length(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.min_sentence_length_ = value;
 }
-inline void NewsPostProcessorOptions::set_min_sentence_length(::google::protobuf::int32 value) {
-  set_has_min_sentence_length();
-  min_sentence_length_ = value;
+inline void NewsPostProcessorOptions::set_min_sentence_length(int32_t value) {
+  _internal_set_min_sentence_length(value);
+  // @@protoc_insertion_point(field_set:topicsum.NewsPostProcessorOptions.min_sentence_length)
 }
 
 // optional int32 max_sentence_length = 2;
+inline bool NewsPostProcessorOptions::_internal_has_max_sentence_length() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool NewsPostProcessorOptions::has_max_sentence_length() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_max_sentence_length();
 }
-inline void NewsPostProcessorOptions::set_has_max_sentence_length() {
-  _has_bits_[0] |= 0x00000002u;
+inline void NewsPostProcessorOptions::clear_max_sentence_length() {
+  _impl_.max_sentence_length_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void NewsPostProcessorOptions::clear_has_max_sentence_length() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t NewsPostProcessorOptions::_internal_max_sentence_length() const {
+  return _impl_.max_sentence_length_;
 }
-inline void NewsPostProcessorOptions::clear_max_sentence_length() {
-  max_sentence_length_ = 0;
-  clear_has_max_sentence_length();
+inline int32_t NewsPostProcessorOptions::max_sentence_length() const {
+  // @@protoc_insertion_point(field_get:topicsum.NewsPostProcessorOptions.max_sentence_length)
+  return _internal_max_sentence_length();
 }
-inline ::google::protobuf::int32 NewsPostProcessorOptions::max_sentence_length() const {
-  return max_sentence_length_;
+inline void NewsPostProcessorOptions::_internal_set_max_sentence_length(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.max_sentence_length_ = value;
 }
-inline void NewsPostProcessorOptions::set_max_sentence_length(::google::protobuf::int32 value) {
-  set_has_max_sentence_length();
-  max_sentence_length_ = value;
+inline void NewsPostProcessorOptions::set_max_sentence_length(int32_t value) {
+  _internal_set_max_sentence_length(value);
+  // @@protoc_insertion_point(field_set:topicsum.NewsPostProcessorOptions.max_sentence_length)
 }
 
 // -------------------------------------------------------------------
@@ -1784,193 +3938,397 @@ inline void NewsPostProcessorOptions::set_max_sentence_length(::google::protobuf
 // SummarizerOptions
 
 // required .topicsum.SummarizerOptions.SummaryType summary_type = 1;
-inline bool SummarizerOptions::has_summary_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool SummarizerOptions::_internal_has_summary_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void SummarizerOptions::set_has_summary_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void SummarizerOptions::clear_has_summary_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SummarizerOptions::has_summary_type() const {
+  return _internal_has_summary_type();
 }
 inline void SummarizerOptions::clear_summary_type() {
-  summary_type_ = 1;
-  clear_has_summary_type();
+  _impl_.summary_type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::topicsum::SummarizerOptions_SummaryType SummarizerOptions::_internal_summary_type() const {
+  return static_cast< ::topicsum::SummarizerOptions_SummaryType >(_impl_.summary_type_);
 }
 inline ::topicsum::SummarizerOptions_SummaryType SummarizerOptions::summary_type() const {
-  return static_cast< ::topicsum::SummarizerOptions_SummaryType >(summary_type_);
+  // @@protoc_insertion_point(field_get:topicsum.SummarizerOptions.summary_type)
+  return _internal_summary_type();
 }
-inline void SummarizerOptions::set_summary_type(::topicsum::SummarizerOptions_SummaryType value) {
+inline void SummarizerOptions::_internal_set_summary_type(::topicsum::SummarizerOptions_SummaryType value) {
   assert(::topicsum::SummarizerOptions_SummaryType_IsValid(value));
-  set_has_summary_type();
-  summary_type_ = value;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.summary_type_ = value;
+}
+inline void SummarizerOptions::set_summary_type(::topicsum::SummarizerOptions_SummaryType value) {
+  _internal_set_summary_type(value);
+  // @@protoc_insertion_point(field_set:topicsum.SummarizerOptions.summary_type)
 }
 
 // optional .topicsum.KLSumOptions klsum_options = 2;
-inline bool SummarizerOptions::has_klsum_options() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SummarizerOptions::set_has_klsum_options() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool SummarizerOptions::_internal_has_klsum_options() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.klsum_options_ != nullptr);
+  return value;
 }
-inline void SummarizerOptions::clear_has_klsum_options() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool SummarizerOptions::has_klsum_options() const {
+  return _internal_has_klsum_options();
 }
 inline void SummarizerOptions::clear_klsum_options() {
-  if (klsum_options_ != NULL) klsum_options_->::topicsum::KLSumOptions::Clear();
-  clear_has_klsum_options();
+  if (_impl_.klsum_options_ != nullptr) _impl_.klsum_options_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::topicsum::KLSumOptions& SummarizerOptions::_internal_klsum_options() const {
+  const ::topicsum::KLSumOptions* p = _impl_.klsum_options_;
+  return p != nullptr ? *p : reinterpret_cast<const ::topicsum::KLSumOptions&>(
+      ::topicsum::_KLSumOptions_default_instance_);
 }
 inline const ::topicsum::KLSumOptions& SummarizerOptions::klsum_options() const {
-  return klsum_options_ != NULL ? *klsum_options_ : *default_instance_->klsum_options_;
+  // @@protoc_insertion_point(field_get:topicsum.SummarizerOptions.klsum_options)
+  return _internal_klsum_options();
 }
-inline ::topicsum::KLSumOptions* SummarizerOptions::mutable_klsum_options() {
-  set_has_klsum_options();
-  if (klsum_options_ == NULL) klsum_options_ = new ::topicsum::KLSumOptions;
-  return klsum_options_;
+inline void SummarizerOptions::unsafe_arena_set_allocated_klsum_options(
+    ::topicsum::KLSumOptions* klsum_options) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.klsum_options_);
+  }
+  _impl_.klsum_options_ = klsum_options;
+  if (klsum_options) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:topicsum.SummarizerOptions.klsum_options)
 }
 inline ::topicsum::KLSumOptions* SummarizerOptions::release_klsum_options() {
-  clear_has_klsum_options();
-  ::topicsum::KLSumOptions* temp = klsum_options_;
-  klsum_options_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::topicsum::KLSumOptions* temp = _impl_.klsum_options_;
+  _impl_.klsum_options_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::topicsum::KLSumOptions* SummarizerOptions::unsafe_arena_release_klsum_options() {
+  // @@protoc_insertion_point(field_release:topicsum.SummarizerOptions.klsum_options)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::topicsum::KLSumOptions* temp = _impl_.klsum_options_;
+  _impl_.klsum_options_ = nullptr;
+  return temp;
+}
+inline ::topicsum::KLSumOptions* SummarizerOptions::_internal_mutable_klsum_options() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.klsum_options_ == nullptr) {
+    auto* p = CreateMaybeMessage<::topicsum::KLSumOptions>(GetArenaForAllocation());
+    _impl_.klsum_options_ = p;
+  }
+  return _impl_.klsum_options_;
+}
+inline ::topicsum::KLSumOptions* SummarizerOptions::mutable_klsum_options() {
+  ::topicsum::KLSumOptions* _msg = _internal_mutable_klsum_options();
+  // @@protoc_insertion_point(field_mutable:topicsum.SummarizerOptions.klsum_options)
+  return _msg;
+}
 inline void SummarizerOptions::set_allocated_klsum_options(::topicsum::KLSumOptions* klsum_options) {
-  delete klsum_options_;
-  klsum_options_ = klsum_options;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.klsum_options_;
+  }
   if (klsum_options) {
-    set_has_klsum_options();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(klsum_options);
+    if (message_arena != submessage_arena) {
+      klsum_options = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, klsum_options, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_klsum_options();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.klsum_options_ = klsum_options;
+  // @@protoc_insertion_point(field_set_allocated:topicsum.SummarizerOptions.klsum_options)
 }
 
 // optional .topicsum.TopicSumOptions topicsum_options = 3;
-inline bool SummarizerOptions::has_topicsum_options() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool SummarizerOptions::_internal_has_topicsum_options() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.topicsum_options_ != nullptr);
+  return value;
 }
-inline void SummarizerOptions::set_has_topicsum_options() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void SummarizerOptions::clear_has_topicsum_options() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool SummarizerOptions::has_topicsum_options() const {
+  return _internal_has_topicsum_options();
 }
 inline void SummarizerOptions::clear_topicsum_options() {
-  if (topicsum_options_ != NULL) topicsum_options_->::topicsum::TopicSumOptions::Clear();
-  clear_has_topicsum_options();
+  if (_impl_.topicsum_options_ != nullptr) _impl_.topicsum_options_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::topicsum::TopicSumOptions& SummarizerOptions::_internal_topicsum_options() const {
+  const ::topicsum::TopicSumOptions* p = _impl_.topicsum_options_;
+  return p != nullptr ? *p : reinterpret_cast<const ::topicsum::TopicSumOptions&>(
+      ::topicsum::_TopicSumOptions_default_instance_);
 }
 inline const ::topicsum::TopicSumOptions& SummarizerOptions::topicsum_options() const {
-  return topicsum_options_ != NULL ? *topicsum_options_ : *default_instance_->topicsum_options_;
+  // @@protoc_insertion_point(field_get:topicsum.SummarizerOptions.topicsum_options)
+  return _internal_topicsum_options();
 }
-inline ::topicsum::TopicSumOptions* SummarizerOptions::mutable_topicsum_options() {
-  set_has_topicsum_options();
-  if (topicsum_options_ == NULL) topicsum_options_ = new ::topicsum::TopicSumOptions;
-  return topicsum_options_;
+inline void SummarizerOptions::unsafe_arena_set_allocated_topicsum_options(
+    ::topicsum::TopicSumOptions* topicsum_options) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.topicsum_options_);
+  }
+  _impl_.topicsum_options_ = topicsum_options;
+  if (topicsum_options) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:topicsum.SummarizerOptions.topicsum_options)
 }
 inline ::topicsum::TopicSumOptions* SummarizerOptions::release_topicsum_options() {
-  clear_has_topicsum_options();
-  ::topicsum::TopicSumOptions* temp = topicsum_options_;
-  topicsum_options_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::topicsum::TopicSumOptions* temp = _impl_.topicsum_options_;
+  _impl_.topicsum_options_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::topicsum::TopicSumOptions* SummarizerOptions::unsafe_arena_release_topicsum_options() {
+  // @@protoc_insertion_point(field_release:topicsum.SummarizerOptions.topicsum_options)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::topicsum::TopicSumOptions* temp = _impl_.topicsum_options_;
+  _impl_.topicsum_options_ = nullptr;
   return temp;
 }
+inline ::topicsum::TopicSumOptions* SummarizerOptions::_internal_mutable_topicsum_options() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.topicsum_options_ == nullptr) {
+    auto* p = CreateMaybeMessage<::topicsum::TopicSumOptions>(GetArenaForAllocation());
+    _impl_.topicsum_options_ = p;
+  }
+  return _impl_.topicsum_options_;
+}
+inline ::topicsum::TopicSumOptions* SummarizerOptions::mutable_topicsum_options() {
+  ::topicsum::TopicSumOptions* _msg = _internal_mutable_topicsum_options();
+  // @@protoc_insertion_point(field_mutable:topicsum.SummarizerOptions.topicsum_options)
+  return _msg;
+}
 inline void SummarizerOptions::set_allocated_topicsum_options(::topicsum::TopicSumOptions* topicsum_options) {
-  delete topicsum_options_;
-  topicsum_options_ = topicsum_options;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.topicsum_options_;
+  }
   if (topicsum_options) {
-    set_has_topicsum_options();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(topicsum_options);
+    if (message_arena != submessage_arena) {
+      topicsum_options = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, topicsum_options, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_topicsum_options();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.topicsum_options_ = topicsum_options;
+  // @@protoc_insertion_point(field_set_allocated:topicsum.SummarizerOptions.topicsum_options)
 }
 
 // repeated .topicsum.Article article = 4;
+inline int SummarizerOptions::_internal_article_size() const {
+  return _impl_.article_.size();
+}
 inline int SummarizerOptions::article_size() const {
-  return article_.size();
+  return _internal_article_size();
 }
 inline void SummarizerOptions::clear_article() {
-  article_.Clear();
+  _impl_.article_.Clear();
+}
+inline ::topicsum::Article* SummarizerOptions::mutable_article(int index) {
+  // @@protoc_insertion_point(field_mutable:topicsum.SummarizerOptions.article)
+  return _impl_.article_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Article >*
+SummarizerOptions::mutable_article() {
+  // @@protoc_insertion_point(field_mutable_list:topicsum.SummarizerOptions.article)
+  return &_impl_.article_;
+}
+inline const ::topicsum::Article& SummarizerOptions::_internal_article(int index) const {
+  return _impl_.article_.Get(index);
 }
 inline const ::topicsum::Article& SummarizerOptions::article(int index) const {
-  return article_.Get(index);
+  // @@protoc_insertion_point(field_get:topicsum.SummarizerOptions.article)
+  return _internal_article(index);
 }
-inline ::topicsum::Article* SummarizerOptions::mutable_article(int index) {
-  return article_.Mutable(index);
+inline ::topicsum::Article* SummarizerOptions::_internal_add_article() {
+  return _impl_.article_.Add();
 }
 inline ::topicsum::Article* SummarizerOptions::add_article() {
-  return article_.Add();
+  ::topicsum::Article* _add = _internal_add_article();
+  // @@protoc_insertion_point(field_add:topicsum.SummarizerOptions.article)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::topicsum::Article >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::topicsum::Article >&
 SummarizerOptions::article() const {
-  return article_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::topicsum::Article >*
-SummarizerOptions::mutable_article() {
-  return &article_;
+  // @@protoc_insertion_point(field_list:topicsum.SummarizerOptions.article)
+  return _impl_.article_;
 }
 
 // optional .topicsum.NewsPostProcessorOptions news_postprocessor_options = 5;
-inline bool SummarizerOptions::has_news_postprocessor_options() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool SummarizerOptions::_internal_has_news_postprocessor_options() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.news_postprocessor_options_ != nullptr);
+  return value;
 }
-inline void SummarizerOptions::set_has_news_postprocessor_options() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void SummarizerOptions::clear_has_news_postprocessor_options() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool SummarizerOptions::has_news_postprocessor_options() const {
+  return _internal_has_news_postprocessor_options();
 }
 inline void SummarizerOptions::clear_news_postprocessor_options() {
-  if (news_postprocessor_options_ != NULL) news_postprocessor_options_->::topicsum::NewsPostProcessorOptions::Clear();
-  clear_has_news_postprocessor_options();
+  if (_impl_.news_postprocessor_options_ != nullptr) _impl_.news_postprocessor_options_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::topicsum::NewsPostProcessorOptions& SummarizerOptions::_internal_news_postprocessor_options() const {
+  const ::topicsum::NewsPostProcessorOptions* p = _impl_.news_postprocessor_options_;
+  return p != nullptr ? *p : reinterpret_cast<const ::topicsum::NewsPostProcessorOptions&>(
+      ::topicsum::_NewsPostProcessorOptions_default_instance_);
 }
 inline const ::topicsum::NewsPostProcessorOptions& SummarizerOptions::news_postprocessor_options() const {
-  return news_postprocessor_options_ != NULL ? *news_postprocessor_options_ : *default_instance_->news_postprocessor_options_;
+  // @@protoc_insertion_point(field_get:topicsum.SummarizerOptions.news_postprocessor_options)
+  return _internal_news_postprocessor_options();
 }
-inline ::topicsum::NewsPostProcessorOptions* SummarizerOptions::mutable_news_postprocessor_options() {
-  set_has_news_postprocessor_options();
-  if (news_postprocessor_options_ == NULL) news_postprocessor_options_ = new ::topicsum::NewsPostProcessorOptions;
-  return news_postprocessor_options_;
+inline void SummarizerOptions::unsafe_arena_set_allocated_news_postprocessor_options(
+    ::topicsum::NewsPostProcessorOptions* news_postprocessor_options) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.news_postprocessor_options_);
+  }
+  _impl_.news_postprocessor_options_ = news_postprocessor_options;
+  if (news_postprocessor_options) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:topicsum.SummarizerOptions.news_postprocessor_options)
 }
 inline ::topicsum::NewsPostProcessorOptions* SummarizerOptions::release_news_postprocessor_options() {
-  clear_has_news_postprocessor_options();
-  ::topicsum::NewsPostProcessorOptions* temp = news_postprocessor_options_;
-  news_postprocessor_options_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::topicsum::NewsPostProcessorOptions* temp = _impl_.news_postprocessor_options_;
+  _impl_.news_postprocessor_options_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::topicsum::NewsPostProcessorOptions* SummarizerOptions::unsafe_arena_release_news_postprocessor_options() {
+  // @@protoc_insertion_point(field_release:topicsum.SummarizerOptions.news_postprocessor_options)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::topicsum::NewsPostProcessorOptions* temp = _impl_.news_postprocessor_options_;
+  _impl_.news_postprocessor_options_ = nullptr;
   return temp;
 }
+inline ::topicsum::NewsPostProcessorOptions* SummarizerOptions::_internal_mutable_news_postprocessor_options() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.news_postprocessor_options_ == nullptr) {
+    auto* p = CreateMaybeMessage<::topicsum::NewsPostProcessorOptions>(GetArenaForAllocation());
+    _impl_.news_postprocessor_options_ = p;
+  }
+  return _impl_.news_postprocessor_options_;
+}
+inline ::topicsum::NewsPostProcessorOptions* SummarizerOptions::mutable_news_postprocessor_options() {
+  ::topicsum::NewsPostProcessorOptions* _msg = _internal_mutable_news_postprocessor_options();
+  // @@protoc_insertion_point(field_mutable:topicsum.SummarizerOptions.news_postprocessor_options)
+  return _msg;
+}
 inline void SummarizerOptions::set_allocated_news_postprocessor_options(::topicsum::NewsPostProcessorOptions* news_postprocessor_options) {
-  delete news_postprocessor_options_;
-  news_postprocessor_options_ = news_postprocessor_options;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.news_postprocessor_options_;
+  }
   if (news_postprocessor_options) {
-    set_has_news_postprocessor_options();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(news_postprocessor_options);
+    if (message_arena != submessage_arena) {
+      news_postprocessor_options = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, news_postprocessor_options, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_news_postprocessor_options();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.news_postprocessor_options_ = news_postprocessor_options;
+  // @@protoc_insertion_point(field_set_allocated:topicsum.SummarizerOptions.news_postprocessor_options)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace topicsum
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::topicsum::SummaryLength_LengthUnit> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::topicsum::SummaryLength_LengthUnit>() {
   return ::topicsum::SummaryLength_LengthUnit_descriptor();
 }
+template <> struct is_proto_enum< ::topicsum::KLSumOptions_OptimizationStrategy> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::topicsum::KLSumOptions_OptimizationStrategy>() {
   return ::topicsum::KLSumOptions_OptimizationStrategy_descriptor();
 }
+template <> struct is_proto_enum< ::topicsum::KLSumOptions_Precision> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::topicsum::KLSumOptions_Precision>() {
+  return ::topicsum::KLSumOptions_Precision_descriptor();
+}
+template <> struct is_proto_enum< ::topicsum::TopicSumOptions_Inference> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::topicsum::TopicSumOptions_Inference>() {
+  return ::topicsum::TopicSumOptions_Inference_descriptor();
+}
+template <> struct is_proto_enum< ::topicsum::SummarizerOptions_SummaryType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::topicsum::SummarizerOptions_SummaryType>() {
   return ::topicsum::SummarizerOptions_SummaryType_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_summarizer_2fsummarizer_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_summarizer_2fsummarizer_2eproto
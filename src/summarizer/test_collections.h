@@ -0,0 +1,45 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Builds the collections of the test data shared by the tests of the TopicSum
+// inference engines and summarizers.
+
+#ifndef SUMMARIZER_TEST_COLLECTIONS_H_
+#define SUMMARIZER_TEST_COLLECTIONS_H_
+
+#include <vector>
+
+#include "summarizer/document.pb.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::vector;
+
+// Appends the toy collections testdata/toycol1 and testdata/toycol2 to cols.
+// The caller takes ownership of the collections, whose ids are their paths.
+void BuildToyCollections(vector<const DocumentCollection*>* cols);
+
+// Appends the real collections testdata/realcol1 to testdata/realcol3, of 4
+// documents each, to cols. The caller takes ownership of the collections,
+// whose ids are their paths.
+void BuildRealCollections(vector<const DocumentCollection*>* cols);
+
+// Deletes the collections and clears cols.
+void DeleteCollections(vector<const DocumentCollection*>* cols);
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_TEST_COLLECTIONS_H_
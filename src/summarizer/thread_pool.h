@@ -0,0 +1,92 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A minimal pool of threads used to split loops over independent items.
+//
+// The work is described by a ParallelTask, which is split into shards. All
+// the shards of a task are processed before ThreadPool::Run returns, and the
+// calling thread processes shards too, so that a pool with a single thread
+// does not start any thread and simply runs the shards in order.
+
+#ifndef SUMMARIZER_THREAD_POOL_H_
+#define SUMMARIZER_THREAD_POOL_H_
+
+#include <pthread.h>
+
+#include <vector>
+
+namespace topicsum {
+
+using std::vector;
+
+// A unit of work which can be split into shards processed concurrently.
+class ParallelTask {
+ public:
+  virtual ~ParallelTask() {}
+
+  // Processes the given shard. This function is called concurrently for
+  // different shards, so the shards must not write to shared state.
+  virtual void Run(int shard) = 0;
+};
+
+class ThreadPool {
+ public:
+  // Creates a pool running tasks with num_threads threads, including the
+  // thread calling Run.
+  explicit ThreadPool(int num_threads);
+
+  ~ThreadPool();
+
+  int num_threads() const { return num_threads_; }
+
+  // Runs task->Run(shard) for all the shards in [0, num_shards) and returns
+  // when all of them are done. Only one task can be run at a time.
+  void Run(int num_shards, ParallelTask* task);
+
+  // Returns the range [*begin, *end) of the given shard when num_items items
+  // are split into num_shards contiguous shards of almost equal size.
+  static void GetShardRange(int num_items, int num_shards, int shard,
+                            int* begin, int* end);
+
+ private:
+  // Entry point of the worker threads.
+  static void* WorkerMain(void* pool);
+
+  // Waits for tasks and processes their shards until the pool is destroyed.
+  void WorkerLoop();
+
+  // Processes shards of the current task until all of them have been taken.
+  void ProcessShards();
+
+  int num_threads_;
+  vector<pthread_t> workers_;
+
+  // The following fields are protected by mutex_.
+  pthread_mutex_t mutex_;
+  pthread_cond_t task_available_;
+  pthread_cond_t task_done_;
+  ParallelTask* task_;
+  int num_shards_;
+  int next_shard_;
+  int num_pending_shards_;
+  int task_generation_;
+  bool stopping_;
+
+  ThreadPool(const ThreadPool&);
+  void operator=(const ThreadPool&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_THREAD_POOL_H_
@@ -26,7 +26,7 @@
 
 #include "summarizer/klsum.h"
 #include "summarizer/scoped_ptr.h"
-#include "summarizer/topicsumgibbs.h"
+#include "summarizer/topicsum_chains.h"
 
 namespace topicsum {
 
@@ -48,8 +48,26 @@ class TopicSum : public KLSum {
   // collections.
   virtual bool CalculateCollectionDistribution(const DocumentCollection& col);
 
+  // Adds the documents to the collection, and updates the collection
+  // distribution by folding them into the trained model for the given number
+  // of iterations (see TopicSumModel::FoldIn), which is much faster than
+  // training it again. All the documents added since Init are folded in
+  // together. The next call to Summarize summarizes the whole collection.
+  // Returns false if the number of iterations is not positive or the inference
+  // engine does not support it.
+  bool AddDocuments(const DocumentCollection& documents, int iterations);
+
  private:
-  scoped_ptr<TopicSumGibbsSampler> gibbs_sampler_;
+  // Chains of the inference engine trained on the collection.
+  scoped_ptr<TopicSumChains> chains_;
+
+  // Options given to Init.
+  SummarizerOptions options_;
+
+  // Documents added to the collection since Init, and the collection
+  // distribution updated with them.
+  DocumentCollection added_documents_;
+  scoped_ptr<Distribution> folded_distri_;
 
   TopicSum(const TopicSum&);
   void operator=(const TopicSum&);
@@ -0,0 +1,83 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Summarizes many clusters of documents with a single TopicSum model trained
+// jointly on all of them, instead of one model per cluster: the clusters share
+// the BKG topic, and each of them has its own COL topic, whose distribution is
+// used by KLSum to summarize it. Training the joint model once avoids the
+// setup and the sampling of a model per cluster, and the background is
+// estimated on more data.
+//
+// Example:
+//   TopicSumBatch batch;
+//   if (!batch.Init(clusters, options)) ...
+//   vector<Document> summaries;
+//   if (!batch.Summarize(summary_options, &summaries)) ...
+
+#ifndef SUMMARIZER_TOPICSUM_BATCH_H_
+#define SUMMARIZER_TOPICSUM_BATCH_H_
+
+#include <string>
+#include <vector>
+
+#include "summarizer/document.pb.h"
+#include "summarizer/scoped_ptr.h"
+#include "summarizer/summarizer.pb.h"
+#include "summarizer/topicsum_chains.h"
+
+namespace topicsum {
+
+using std::string;
+using std::vector;
+
+class TopicSumBatch {
+ public:
+  TopicSumBatch() {}
+  ~TopicSumBatch() {}
+
+  // Trains the model on the clusters, which must outlive this object, with
+  // the TopicSum options. Returns false if it could not be trained.
+  bool Init(const vector<const DocumentCollection*>& clusters,
+            const SummarizerOptions& options);
+
+  // Summarizes each cluster with KLSum and the options of Init, and stores
+  // the summary of the i-th cluster in (*summaries)[i]. The clusters are
+  // summarized in parallel by TopicSumOptions::batch_num_threads threads.
+  // Returns false if a cluster could not be summarized, with the error of
+  // the first one in last_error_message.
+  bool Summarize(const SummaryOptions& options, vector<Document>* summaries);
+
+  // Returns the last error message generated during the initialization or
+  // the summarization.
+  const string& last_error_message() const { return last_error_message_; }
+
+  // Returns the chains of the model trained on the clusters.
+  const TopicSumChains& chains() const { return *chains_; }
+
+ private:
+  class ClusterSummarizer;
+  class SummarizeTask;
+
+  vector<const DocumentCollection*> clusters_;
+  SummarizerOptions options_;
+  scoped_ptr<TopicSumChains> chains_;
+  string last_error_message_;
+
+  TopicSumBatch(const TopicSumBatch&);
+  void operator=(const TopicSumBatch&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_TOPICSUM_BATCH_H_
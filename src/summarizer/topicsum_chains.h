@@ -0,0 +1,96 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Estimates the TopicSum model of a set of collections with one or several
+// chains of the inference engine selected by the options (see
+// TopicSumOptions and GibbsSamplingOptions::num_chains), and returns the
+// distributions of the COL topics of the collections averaged over the
+// chains. It is shared by TopicSum, which trains a model on the collection to
+// summarize, and TopicSumBatch, which trains a joint model on many clusters.
+
+#ifndef SUMMARIZER_TOPICSUM_CHAINS_H_
+#define SUMMARIZER_TOPICSUM_CHAINS_H_
+
+#include <string>
+#include <vector>
+
+#include "summarizer/distribution.h"
+#include "summarizer/document.pb.h"
+#include "summarizer/scoped_ptr.h"
+#include "summarizer/summarizer.pb.h"
+#include "summarizer/topicsum_corpus.h"
+#include "summarizer/topicsum_model.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+using std::string;
+using std::vector;
+
+class TopicSumChains {
+ public:
+  TopicSumChains() : seed_(0) {}
+  ~TopicSumChains();
+
+  // Trains the chains on the collections, which must outlive this object.
+  // The chains are trained concurrently, each on its own thread. Returns
+  // false and sets error_message if the options are invalid or if the
+  // background model or a checkpoint could not be loaded.
+  bool Train(const vector<const DocumentCollection*>& collections,
+             const TopicSumOptions& options,
+             string* error_message);
+
+  // Returns the messages on how the training of the chains ended, e.g. when
+  // they converged before the maximum number of iterations, for the debug
+  // output of the summaries.
+  const string& debug_string() const { return debug_string_; }
+
+  int num_chains() const { return models_.size(); }
+  const TopicSumModel& chain(int i) const { return *models_[i]; }
+
+  // Stores in wd the distribution of the COL topic of the collection colid,
+  // which is the average of the ones estimated by the chains. Since these are
+  // normalized, the average is too. It can be called concurrently.
+  void GetCollectionDistribution(int colid, Distribution* wd) const;
+
+  // Folds the documents into the collection colid of each chain (see
+  // TopicSumModel::FoldIn), with the generator of the seed of the options
+  // and of the stream of the chain, and stores in wd the average of the
+  // updated distributions of the COL topic. Returns false if the inference
+  // engine does not support it.
+  bool FoldIn(int colid, const DocumentCollection& documents, int iterations,
+              Distribution* wd) const;
+
+ private:
+  // Deletes the inference engines of the chains.
+  void Clear();
+
+  // Tokenized collections, shared by the chains.
+  scoped_ptr<TopicSumCorpus> corpus_;
+
+  // Inference engines of the chains. Owned.
+  vector<TopicSumModel*> models_;
+
+  string debug_string_;
+
+  // Seed of the chains.
+  uint64 seed_;
+
+  TopicSumChains(const TopicSumChains&);
+  void operator=(const TopicSumChains&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_TOPICSUM_CHAINS_H_
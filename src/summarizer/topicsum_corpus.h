@@ -0,0 +1,116 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Tokenized training collections of TopicSum, built once and shared
+// read-only by the inference engines of the model, e.g. the chains of the
+// Gibbs sampler.
+//
+// The token ids are stored in compressed sparse row layout so that the
+// engines never look up the lexicon. The ids of all the tokens are stored
+// contiguously, in the order of the collections, documents and sentences. The
+// tokens of the i-th sentence of the corpus are token_ids()[s[i]] to
+// token_ids()[s[i+1]-1] where s = sentence_offsets(), and in the same way the
+// sentences of the j-th document of the corpus are indexed by
+// document_offsets() and the documents of the c-th collection by
+// collection_offsets().
+//
+// The sorted ids of the distinct words of each document are stored in the
+// same layout: the words of the j-th document are document_word_ids()[o[j]]
+// to document_word_ids()[o[j+1]-1] where o = document_word_offsets(). The
+// index of each token among them is stored in token_document_words(), indexed
+// like token_ids().
+
+#ifndef SUMMARIZER_TOPICSUM_CORPUS_H_
+#define SUMMARIZER_TOPICSUM_CORPUS_H_
+
+#include <vector>
+
+#include "summarizer/background_model.h"
+#include "summarizer/distribution.h"
+#include "summarizer/document.pb.h"
+#include "summarizer/lexicon.h"
+
+namespace topicsum {
+
+using std::vector;
+
+class TopicSumCorpus {
+ public:
+  // Builds the corpus of the collections. If background is not NULL, its
+  // words are added to the lexicon after the ones of the collections.
+  TopicSumCorpus(const vector<const DocumentCollection*>& collections,
+                 const Distribution* background);
+
+  const vector<const DocumentCollection*>& collections() const {
+    return collections_;
+  }
+  const Lexicon& lexicon() const { return lexicon_; }
+
+  int num_collections() const { return collection_offsets_.size() - 1; }
+  int num_documents() const { return document_offsets_.size() - 1; }
+  int num_sentences() const { return sentence_offsets_.size() - 1; }
+  int num_tokens() const { return token_ids_.size(); }
+  int num_words() const { return lexicon_.size(); }
+  int num_document_words() const { return document_word_ids_.size(); }
+
+  const int* token_ids() const { return Data(token_ids_); }
+  const int* sentence_offsets() const { return &sentence_offsets_[0]; }
+  const int* document_offsets() const { return &document_offsets_[0]; }
+  const int* collection_offsets() const { return &collection_offsets_[0]; }
+  const int* document_word_ids() const { return Data(document_word_ids_); }
+  const int* document_word_offsets() const {
+    return &document_word_offsets_[0];
+  }
+  const int* token_document_words() const {
+    return Data(token_document_words_);
+  }
+
+  // Returns the index in document_word_ids() of the word wordid of the
+  // document doc_index, or -1 if it does not occur in the document.
+  int FindDocumentWord(int doc_index, int wordid) const;
+
+  // Stores in probabilities the num_words() probabilities of the words of the
+  // lexicon in the fixed background, given as a distribution if
+  // background_model is NULL, or as a pretrained model. They are normalized
+  // if their sum is positive and is not 1.
+  void GetBackgroundProbabilities(const Distribution* background,
+                                  const BackgroundModel* background_model,
+                                  double* probabilities) const;
+
+ private:
+  // Returns the values of the vector, or NULL if it is empty.
+  static const int* Data(const vector<int>& values) {
+    return values.empty() ? NULL : &values[0];
+  }
+
+  vector<const DocumentCollection*> collections_;
+  Lexicon lexicon_;
+
+  vector<int> token_ids_;
+  vector<int> sentence_offsets_;
+  vector<int> document_offsets_;
+  vector<int> collection_offsets_;
+
+  vector<int> document_word_ids_;
+  vector<int> document_word_offsets_;
+  vector<int> token_document_words_;
+
+  TopicSumCorpus(const TopicSumCorpus&);
+  void operator=(const TopicSumCorpus&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_TOPICSUM_CORPUS_H_
@@ -0,0 +1,93 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Interface of the inference engines of the TopicSum model, which estimate
+// the BKG, COL and DOC topics of the training collections with an iterative
+// algorithm run by GibbsSampler::Train: Gibbs sampling (see topicsumgibbs.h)
+// or collapsed variational Bayes (see topicsumcvb0.h).
+
+#ifndef SUMMARIZER_TOPICSUM_MODEL_H_
+#define SUMMARIZER_TOPICSUM_MODEL_H_
+
+#include <string>
+
+#include "summarizer/background_model.h"
+#include "summarizer/distribution.h"
+#include "summarizer/document.pb.h"
+#include "summarizer/gibbs.h"
+#include "summarizer/random.h"
+#include "summarizer/topicsum_corpus.h"
+
+namespace topicsum {
+
+using std::string;
+
+class TopicSumModel : public GibbsSampler {
+ public:
+  TopicSumModel(int iterations, int burnin, int lag, bool track_likelihood)
+      : GibbsSampler(iterations, burnin, lag, track_likelihood) {}
+
+  virtual ~TopicSumModel() {}
+
+  // Sets a pretrained background model used as the fixed distribution of the
+  // BKG topic, instead of the background given to the constructor. The model
+  // must outlive the engine.
+  virtual void set_background_model(const BackgroundModel* model) = 0;
+
+  // Shares the tokenized training collections, instead of building them in
+  // Init, e.g. between several chains trained with different seeds. The
+  // corpus must be built from the collections given to the engine, with the
+  // background distribution given to the constructor if it is not NULL, and
+  // must outlive the engine.
+  virtual void set_corpus(const TopicSumCorpus* corpus) = 0;
+
+  // Returns the probability distribution of words estimated for the topic of
+  // the collection colid. The result is stored in wd.
+  virtual void GetCollectionDistribution(int colid,
+                                         Distribution* wd) const = 0;
+
+  // Returns the posterior probability distribution of words in collections,
+  // i.e. the probability of belong to a specific collection given that we
+  // have seen the word.
+  //
+  // Returns false if the term is not in the vocabulary.
+  virtual bool GetPosteriorDistribution(string term,
+                                        Distribution* cd) const = 0;
+
+  // Returns the probability distributions of words estimated in the BKG topic.
+  virtual void GetBackgroundDistribution(Distribution* wd) const = 0;
+
+  // Folds new documents into the collection colid of the trained model:
+  // infers the topics of their tokens for the given number of iterations,
+  // given the topics of the training tokens, which do not change, and stores
+  // in wd the distribution of the COL topic of the collection updated with
+  // them. The words which are not in the training collections are added to
+  // the vocabulary. The model is not modified, so that several sets of
+  // documents can be folded in concurrently, with their own generator.
+  // Returns false if the engine does not support it.
+  virtual bool FoldIn(int /* colid */,
+                      const DocumentCollection& /* documents */,
+                      int /* iterations */, Random* /* random */,
+                      Distribution* /* wd */) const {
+    return false;
+  }
+
+ private:
+  TopicSumModel(const TopicSumModel&);
+  void operator=(const TopicSumModel&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_TOPICSUM_MODEL_H_
@@ -0,0 +1,200 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Implements the zero-order collapsed variational Bayes (CVB0) inference of
+// the parameters of TopicSum, an alternative to the Gibbs sampler of
+// topicsumgibbs.h on the same BKG/COL/DOC model (Asuncion et al., On
+// Smoothing and Inference for Topic Models, UAI 2009).
+//
+// Instead of sampling a topic for each token, CVB0 keeps a distribution over
+// the topics of each token, and the counts of the model are the expected
+// counts under these distributions. An iteration updates the distribution of
+// each token in turn, from the expected counts without the token itself:
+//   q(k) ~ (N_kw + lambda_k) / (N_k + W * lambda_k) * (N_sk + gamma_k)
+// where N_kw is the count of the word w in the topic k (BKG, COL of the
+// collection or DOC of the document of the token), N_k the number of words in
+// the topic and N_sk the number of words of the sentence in the topic. The
+// updates are deterministic given the random initial distributions, and
+// usually converge in a few tens of iterations instead of hundreds of
+// samples.
+
+#ifndef SUMMARIZER_TOPICSUMCVB0_H_
+#define SUMMARIZER_TOPICSUMCVB0_H_
+
+#include <string>
+#include <vector>
+
+#include "summarizer/background_model.h"
+#include "summarizer/distribution.h"
+#include "summarizer/document.pb.h"
+#include "summarizer/lexicon.h"
+#include "summarizer/scoped_ptr.h"
+#include "summarizer/topicsum_corpus.h"
+#include "summarizer/topicsum_model.h"
+
+namespace topicsum {
+
+class TopicSumCVB0 : public TopicSumModel {
+ public:
+  // Creates a TopicSumCVB0 running the given number of iterations. The other
+  // arguments are the ones of TopicSumGibbsSampler. The parameters are
+  // estimated after each iteration, from the current expected counts.
+  TopicSumCVB0(int iterations,
+               bool track_likelihood,
+               double lambda[3],
+               double gamma[3],
+               const vector<const DocumentCollection*>& collections,
+               const Distribution* background);
+
+  virtual ~TopicSumCVB0();
+
+  // Only the words of the training collections are looked up in the
+  // background model, and their probabilities are normalized over them.
+  virtual void set_background_model(const BackgroundModel* model) {
+    background_model_ = model;
+  }
+
+  virtual void set_corpus(const TopicSumCorpus* corpus) { corpus_ = corpus; }
+
+  virtual void GetCollectionDistribution(int colid,
+                                         Distribution* wd) const;
+  virtual bool GetPosteriorDistribution(string term,
+                                        Distribution* cd) const;
+  virtual void GetBackgroundDistribution(Distribution* wd) const;
+
+  // Returns the distributions over the topics of all the tokens, K values per
+  // token, in the order of the collections, documents, sentences and tokens
+  // of the training collections.
+  const double* GetTopicDistributions() const { return Q_; }
+
+  const Lexicon& GetLexicon() { return *lexicon_; }
+
+  // Prints information on the engine and the currently trained model.
+  virtual string PrintSamplerInfo();
+
+ protected:
+  // Allocates the expected counts and the distributions of the tokens.
+  virtual void Init();
+
+  // Draws random distributions over the topics of the tokens.
+  virtual void DoInitialAssignment();
+
+  // Updates the distribution of each token.
+  virtual void DoIteration();
+
+  // The parameters are not accumulated over the iterations like the samples
+  // of the Gibbs sampler, since the expected counts converge. They are
+  // computed on the fly from the current counts by phi_B(), phi_C(), phi_D()
+  // and psi(), so that these functions have nothing to do.
+  virtual void CalculateParams() {}
+  virtual void MultiplyParams(double /* multiplier */) {}
+
+  // Calculates and returns the likelihood of the current parameters.
+  virtual double CalculateModelLikelihood() const;
+
+ private:
+  // Returns the number of documents of the collection colid.
+  int num_documents(int colid) const {
+    return collection_offsets_[colid + 1] - collection_offsets_[colid];
+  }
+
+  // Returns the number of sentences of the document with the given index among
+  // all the documents of the corpus.
+  int num_sentences(int doc_index) const {
+    return document_offsets_[doc_index + 1] - document_offsets_[doc_index];
+  }
+
+  // Returns the current value of the parameters, i.e. phi for the BKG topic,
+  // the COL topic colid and the DOC topic of the word doc_word of the
+  // document doc_index, and psi for the sentence sent_index.
+  double phi_B(int wordid) const {
+    if (fixed_background()) return phi_B_[wordid];
+    return (NWB_[wordid] + lambda_[0]) / (NB_ + W_ * lambda_[0]);
+  }
+  double phi_C(int colid, int wordid) const {
+    return (NWC_[colid * W_ + wordid] + lambda_[1])
+        / (NC_[colid] + W_ * lambda_[1]);
+  }
+  double phi_D(int doc_index, int doc_word) const {
+    return (NWD_[doc_word] + lambda_[2]) / (ND_[doc_index] + W_ * lambda_[2]);
+  }
+  double psi(int sent_index, int k) const {
+    int sentence_size = sentence_offsets_[sent_index + 1]
+        - sentence_offsets_[sent_index];
+    return (NZS_[sent_index * K_ + k] + gamma_[k])
+        / (sentence_size + gamma_sum_);
+  }
+
+  // Returns whether the distribution of the BKG topic is fixed.
+  bool fixed_background() const {
+    return background_ != NULL || background_model_ != NULL;
+  }
+
+  // Number of topics per sentence: BKG, COL and DOC.
+  static const int K_ = 3;
+
+  // Hyper-parameters of the topics and of the sentences, and their sums.
+  double lambda_[3];
+  double gamma_[3];
+  double gamma_sum_;
+
+  // Numbers of collections, documents, sentences, words and tokens.
+  int C_;
+  int D_;
+  int S_;
+  int W_;
+  int AW_;
+
+  // The expected counts, laid out like the counts of TopicSumGibbsSampler in
+  // a single arena, followed by the distributions over the topics of the
+  // tokens in Q_, K_ values per token. If the background is fixed, NWB_ and
+  // NB_ hold the constant pseudo-counts which give its weight in the
+  // sentences, and phi_B_ the fixed distribution.
+  scoped_array<double> arena_;
+  double* NWB_;
+  double* NWC_;
+  double* NWD_;
+  double NB_;
+  double* NC_;
+  double* ND_;
+  double* NZS_;
+  double* Q_;
+  double* phi_B_;
+
+  // Training collections.
+  vector<const DocumentCollection*> training_cols_;
+
+  // Tokenized training collections, shared by set_corpus or built by the
+  // first call to Init, and their lexicon and arrays (see TopicSumCorpus).
+  scoped_ptr<TopicSumCorpus> own_corpus_;
+  const TopicSumCorpus* corpus_;
+  const Lexicon* lexicon_;
+  const int* token_ids_;
+  const int* sentence_offsets_;
+  const int* document_offsets_;
+  const int* collection_offsets_;
+  const int* token_document_words_;
+
+  // If not null, a fixed background distribution, given as a distribution or
+  // as a pretrained model.
+  const Distribution* background_;
+  const BackgroundModel* background_model_;
+
+  TopicSumCVB0(const TopicSumCVB0&);
+  void operator=(const TopicSumCVB0&);
+};
+
+}  // namespace topicsum
+
+#endif  // SUMMARIZER_TOPICSUMCVB0_H_
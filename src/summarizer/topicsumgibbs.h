@@ -28,15 +28,20 @@
 #include <string>
 #include <vector>
 
+#include "summarizer/background_model.h"
 #include "summarizer/distribution.h"
 #include "summarizer/document.pb.h"
-#include "summarizer/gibbs.h"
 #include "summarizer/lexicon.h"
+#include "summarizer/random.h"
 #include "summarizer/scoped_ptr.h"
+#include "summarizer/topicsum_corpus.h"
+#include "summarizer/topicsum_model.h"
 
 namespace topicsum {
 
-class TopicSumGibbsSampler : public GibbsSampler {
+class ThreadPool;
+
+class TopicSumGibbsSampler : public TopicSumModel {
  public:
   // Creates a TopicSumGibbsSampler.
   // The TopicSum specific parameters are:
@@ -56,28 +61,45 @@ class TopicSumGibbsSampler : public GibbsSampler {
                        const Distribution* background);
 
   // Destroys the TopicSumGibbsSampler.
-  virtual ~TopicSumGibbsSampler() { Reset(); }
-
-  // Returns the probability distribution of words estimated for the topic of
-  // the collection colid. The result is stored in wd.
-  void GetCollectionDistribution(int colid,
-                                 Distribution* wd) const;
-
-  // Returns the posterior probability distribution of words in collections,
-  // i.e. the probability of belong to a specific collection given that we
-  // have seen the word.
-  //
-  // Returns false if the term is not in the vocabulary.
-  bool GetPosteriorDistribution(string term,
-                                Distribution* cd) const;
-
-  // Returns the probability distributions of words estimated in the BKG topic.
-  void GetBackgroundDistribution(Distribution* wd) const;
-
-  // Returns the topic assignments for all the words.
-  int**** GetTopicAssignments() { return lastZ_; }
-
-  const Lexicon& GetLexicon() { return *lexicon_.get(); }
+  virtual ~TopicSumGibbsSampler();
+
+  // Sets the number of threads sampling the documents, 1 by default. With
+  // several threads, the documents are split into shards sampled in parallel
+  // with approximate distributed Gibbs sampling (AD-LDA, Newman et al. 2009):
+  // during an iteration, each shard samples with its own copy of the counts
+  // of the BKG and COL topics, and the changes of all the shards are merged
+  // at the end of the iteration. The counts of the DOC topics and of the
+  // sentences are only used by the shard of their document. The samples only
+  // depend on the seed and on the number of threads.
+  void set_num_threads(int num_threads) { num_threads_ = num_threads; }
+
+  // Only the words of the training collections are looked up in the
+  // background model, and their probabilities are normalized over them.
+  virtual void set_background_model(const BackgroundModel* model) {
+    background_model_ = model;
+  }
+
+  virtual void set_corpus(const TopicSumCorpus* corpus) { corpus_ = corpus; }
+
+  virtual void GetCollectionDistribution(int colid,
+                                         Distribution* wd) const;
+  virtual bool GetPosteriorDistribution(string term,
+                                        Distribution* cd) const;
+  virtual void GetBackgroundDistribution(Distribution* wd) const;
+
+  // Samples the topics of the tokens of the new documents for the given
+  // number of sweeps, on top of the expected counts of the training tokens
+  // given the estimated parameters, and returns the distribution of the COL
+  // topic averaged over the sweeps of the second half.
+  virtual bool FoldIn(int colid, const DocumentCollection& documents,
+                      int iterations, Random* random,
+                      Distribution* wd) const;
+
+  // Returns the topic assignments for all the words, in the order of the
+  // collections, documents, sentences and tokens of the training collections.
+  const int* GetTopicAssignments() const { return lastZ_; }
+
+  const Lexicon& GetLexicon() { return *lexicon_; }
 
   // Prints information on the sampler and the currently trained model.
   virtual string PrintSamplerInfo();
@@ -109,40 +131,131 @@ class TopicSumGibbsSampler : public GibbsSampler {
   // class?
   virtual void MultiplyParams(double multiplier);
 
+  // Materializes the final parameters from the accumulated ones.
+  virtual void FinishParams();
+
   // Calculates and returns the likelihood based on the current values of the
   // estimated parameters.
   virtual double CalculateModelLikelihood() const;
 
+  // Writes the sizes, the hyper-parameters and the lexicon of the model,
+  // which RestoreState checks, followed by the random generators of the
+  // shards and the arenas of the counters and of the parameters.
+  virtual bool SaveState(BinaryWriter* writer) const;
+  virtual bool RestoreState(BinaryReader* reader);
+
  private:
+  class MergeTask;
+  class SweepTask;
+
+  // Counts of the topics shared by all the documents, i.e. the BKG topic and
+  // the COL topics, with the same layout as NWB_, NWC_, NB_ and NC_. They are
+  // the counts of the sampler, or the copy of a shard in parallel mode, which
+  // only holds the COL topics of its collections: NWC and NC then start with
+  // the collection begin_col.
+  struct SharedCounts {
+    int* NWB;
+    int* NWC;
+    int* NB;
+    int* NC;
+    int begin_col;
+  };
+
+  // Documents [begin_doc, end_doc) of the collections [begin_col, end_col)
+  // sampled in parallel by a thread, with their own random generator and copy
+  // of the shared counts of these collections. The counts of the words are
+  // stored in word_counts as NWB_ and the rows of NWC_ of the collections, and
+  // the numbers of words in topic_counts as NB_ and NC_.
+  struct Shard {
+    Shard() : begin_doc(0), end_doc(0), begin_col(0), end_col(0), random(0) {}
+
+    int begin_doc;
+    int end_doc;
+    int begin_col;
+    int end_col;
+    Random random;
+    vector<int> word_counts;
+    vector<int> topic_counts;
+    SharedCounts counts;
+  };
+
   // Destroys data structures created on the heap used by the sampler.
   void Reset();
 
-  // Calculates the likelihood of sentence identified by a triplet
-  // [colid, docid, sentid].
-  double CalculateSentenceLikelihood(int colid, int docid, int sentid) const;
-
+  // Splits the documents into shards of about the same number of tokens, for
+  // the parallel mode.
+  void InitShards();
+
+  // Returns the counts of the sampler.
+  SharedCounts GetSharedCounts() {
+    SharedCounts counts = { NWB_, NWC_, &NB_, NC_, 0 };
+    return counts;
+  }
+
+  // Samples new topics for the tokens of the documents [begin_doc, end_doc),
+  // with the given shared counts and random generator.
+  void SampleDocuments(int begin_doc, int end_doc, SharedCounts* counts,
+                       Random* random);
+
+  // Implements SampleDocuments, for a fixed or learned background.
+  template <bool kFixedBackground>
+  void SampleDocumentsKernel(int begin_doc, int end_doc, SharedCounts* counts,
+                             Random* random);
+
+  // Returns the number of documents of the collection colid.
+  int num_documents(int colid) const {
+    return collection_offsets_[colid + 1] - collection_offsets_[colid];
+  }
+
+  // Returns the number of sentences of the document with the given index among
+  // all the documents of the corpus.
+  int num_sentences(int doc_index) const {
+    return document_offsets_[doc_index + 1] - document_offsets_[doc_index];
+  }
+
+  // Calculates the likelihood of the sentence with the given index among all
+  // the sentences of the corpus, in the document doc_index of the collection
+  // colid.
+  double CalculateSentenceLikelihood(int colid, int doc_index,
+                                     int sent_index) const;
+
+
+  // Return the current value of the parameters, i.e. phi for the BKG topic,
+  // the COL topic colid and the DOC topic of the word doc_word of the
+  // document doc_index, and psi for the sentence sent_index.
+  double phi_B(int wordid) const {
+    if (fixed_background()) return phi_B_[wordid];
+    return params_scale_ * (phi_B_[wordid] + lambda_[0] * sum_inv_B_);
+  }
+  double phi_C(int colid, int wordid) const {
+    return params_scale_ * (phi_C_[colid * W_ + wordid]
+                            + lambda_[1] * sum_inv_C_[colid]);
+  }
+  double phi_D(int doc_index, int doc_word) const {
+    return params_scale_ * (phi_D_[doc_word]
+                            + lambda_[2] * sum_inv_D_[doc_index]);
+  }
+  double psi(int sent_index, int k) const {
+    return params_scale_ * (psi_[sent_index * K_ + k]
+                            + gamma_[k] * sum_inv_S_[sent_index]);
+  }
+
+  // Returns whether the distribution of the BKG topic is fixed.
+  bool fixed_background() const {
+    return background_ != NULL || background_model_ != NULL;
+  }
 
   // Implements the Increment function used in the Gibbs Sampling algorithm.
-  void IncrementCounters(int colid,
-                         int docid,
-                         int sentid,
-                         int wordid,
-                         int topic);
-
-  // Implements the Decrement function used in the Gibbs Sampling algorithm.
-  void DecrementCounters(int colid,
-                         int docid,
-                         int sentid,
+  // doc_word is the index of the word among the distinct words of the
+  // documents (see TopicSumCorpus::document_word_ids).
+  void IncrementCounters(SharedCounts* counts,
+                         int colid,
+                         int doc_index,
+                         int sent_index,
                          int wordid,
+                         int doc_word,
                          int topic);
 
-  // Generates the distribution (P(z_i=j|z_{-i}, w))_j and stores it in distri.
-  void GenerateConditionalDistribution(int colid,
-                                       int docid,
-                                       int sentid,
-                                       int wordid,
-                                       double* distri);
-
  private:
   // The following are the hyperparameters for the algorithm. In
   // TopicSum there are several Dirichlet distributions: the topic assignment
@@ -183,17 +296,32 @@ class TopicSumGibbsSampler : public GibbsSampler {
   // Total number of words (non-unique tokens).
   int AW_;
 
-  // Size of each sentence in each document and collection.
-  int*** NS_;
+  // The counters and the parameters below are stored contiguously in two
+  // arenas allocated by Init, and indexed by the collection id, or by the
+  // index of the document or the sentence among all the ones of the corpus
+  // (see the offsets below). The distributions over words are stored in rows
+  // of W_ values and the distributions over topics in rows of K_ values, e.g.
+  // the count of the word w in the COL topic of the collection c is
+  // NWC_[c * W_ + w]. The distributions of the DOC topics are sparse, and
+  // only store the words of their document, in the order of
+  // TopicSumCorpus::document_word_ids.
+  scoped_array<int> count_arena_;
+  scoped_array<double> param_arena_;
+  int64 num_counts_;
+  int64 num_params_;
+
+  // Size of each sentence.
+  int* NS_;
 
   // Frequency distribution of words in the BKG topic.
   int* NWB_;
 
   // Frequency distribution of words in each COL topic.
-  int** NWC_;
+  int* NWC_;
 
-  // Frequency distribution of words in each DOC topic.
-  int*** NWD_;
+  // Frequency distribution of words in each DOC topic, indexed like the
+  // words of the documents.
+  int* NWD_;
 
   // Number of words in the BKG topic.
   int NB_;
@@ -202,35 +330,79 @@ class TopicSumGibbsSampler : public GibbsSampler {
   int* NC_;
 
   // Numbers of words in each DOC topic.
-  int** ND_;
+  int* ND_;
 
   // Frequency distribution of words in each topic for each sentence.
-  // COLID -> DOCID -> SENTID -> TOPIC PROPORTION
-  int**** NZS_;
+  int* NZS_;
+
+  // The parameters are accumulated lazily over the samples, e.g. for phi of
+  // the BKG topic:
+  //   sum_s (NWB_s[w] + lambda_[0]) / (NB_s + W_ * lambda_[0])
+  //     = sum_s NWB_s[w] * inv_s + lambda_[0] * sum_s inv_s
+  // where inv_s = 1 / (NB_s + W_ * lambda_[0]). The arrays of the parameters
+  // below store the first sum, which only changes for the words with a
+  // non-zero count, and sum_inv_B_, sum_inv_C_, sum_inv_D_ and sum_inv_S_
+  // store the second one for each topic and sentence. The parameters are
+  // multiplied by params_scale_, so that MultiplyParams does not visit them.
+  // The values are returned by phi_B(), phi_C(), phi_D() and psi(), and
+  // FinishParams stores the final values in the arrays.
+  double params_scale_;
+  double sum_inv_B_;
+  double* sum_inv_C_;
+  double* sum_inv_D_;
+  double* sum_inv_S_;
 
   // Probability distribution of words in the BKG topic.
   double* phi_B_;
 
   // Probability distribution of words in each COL topic.
-  double** phi_C_;
+  double* phi_C_;
 
-  // Probability distribution of words in each DOC topic.
-  double*** phi_D_;
+  // Probability distribution of words in each DOC topic, indexed like the
+  // words of the documents. The probabilities of the words which are not in the
+  // document are not stored, since they only depend on the number of words
+  // in the topic and on lambda.
+  double* phi_D_;
 
   // Probability distribution of topics for each sentence.
-  double**** psi_;
-
-  // Dictionnary of words in the training collections.
-  scoped_ptr<Lexicon> lexicon_;
+  double* psi_;
 
   // Training collections.
   vector<const DocumentCollection*> training_cols_;
 
-  // Last sampled assignment.
-  int**** lastZ_;
-
-  // If not null, a fixed background distribution.
+  // Tokenized training collections, shared by set_corpus or built by the
+  // first call to Init, and their lexicon and arrays (see TopicSumCorpus),
+  // e.g. the tokens of the i-th sentence of the corpus are
+  // token_ids_[sentence_offsets_[i]] to token_ids_[sentence_offsets_[i+1]-1].
+  // The index of each token among the distinct words of its document, which
+  // index the DOC topics, is stored in token_document_words_.
+  scoped_ptr<TopicSumCorpus> own_corpus_;
+  const TopicSumCorpus* corpus_;
+  const Lexicon* lexicon_;
+  const int* token_ids_;
+  const int* sentence_offsets_;
+  const int* document_offsets_;
+  const int* collection_offsets_;
+  const int* document_word_offsets_;
+  const int* token_document_words_;
+
+  // Last sampled assignment of each token, indexed like token_ids_.
+  int* lastZ_;
+
+  // Number of threads sampling the documents, and the pool and the shards
+  // used if there are several of them.
+  int num_threads_;
+  scoped_ptr<ThreadPool> thread_pool_;
+  vector<Shard*> shards_;
+
+  // Range [first, end) of the shards holding the COL topic of each
+  // collection, which are contiguous since the shards are.
+  vector<pair<int, int> > collection_shards_;
+
+  // If not null, a fixed background distribution, given as a distribution or
+  // as a pretrained model.
   const Distribution* background_;
+  const BackgroundModel* background_model_;
 
   TopicSumGibbsSampler(const TopicSumGibbsSampler&);
   void operator=(const TopicSumGibbsSampler&);
@@ -75,13 +75,13 @@ TEST_F(TopicSummarizerTest, TestArticle1) {
   string summary;
   sum.Summarize(sum_options, &summary);
 
-  EXPECT_EQ("The company has formally said that Windows 7 won't ship "
-            "until early 2010, but the January release of a beta disk is the "
-            "latest sign that Windows 7 could debut in late 2009. To avoid a "
-            "repeat of those problems, Microsoft earlier this year ordered "
-            "computer and other hardware makers to begin testing their devices "
-            "on Windows 7 as soon as the first beta version becomes "
-            "available.", summary);
+  EXPECT_EQ("To avoid a repeat of those problems, Microsoft earlier this year "
+            "ordered computer and other hardware makers to begin testing "
+            "their devices on Windows 7 as soon as the first beta version "
+            "becomes available. The company has formally said that Windows 7 "
+            "won't ship until early 2010, but the January release of a beta "
+            "disk is the latest sign that Windows 7 could debut in late "
+            "2009.", summary);
 }
 
 }  // namespace topicsum
@@ -0,0 +1,69 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/test_collections.h"
+
+#include <string>
+
+#include "summarizer/file.h"
+#include "summarizer/xml_parser.h"
+
+namespace topicsum {
+
+using std::string;
+
+namespace {
+
+// Names of the documents of the test collections.
+const char* kDocuments[] = { "d1.xml", "d2.xml", "d3.xml", "d4.xml" };
+
+// Reads the first num_documents documents of the directory path into a new
+// collection appended to cols.
+void BuildCollection(const string& path, int num_documents,
+                     vector<const DocumentCollection*>* cols) {
+  XmlParser xml_parser;
+  DocumentCollection* col = new DocumentCollection();
+  col->set_id(path);
+  for (int d = 0; d < num_documents; d++) {
+    string file;
+    File::ReadFileToStringOrDie(path + kDocuments[d], &file);
+    xml_parser.ParseDocument(file, col->add_document());
+  }
+  cols->push_back(col);
+}
+
+}  // unnamed namespace
+
+void BuildToyCollections(vector<const DocumentCollection*>* cols) {
+  BuildCollection(DATADIR "testdata/toycol1/", 2, cols);
+  BuildCollection(DATADIR "testdata/toycol2/", 3, cols);
+}
+
+void BuildRealCollections(vector<const DocumentCollection*>* cols) {
+  BuildCollection(DATADIR "testdata/realcol1/", 4, cols);
+  BuildCollection(DATADIR "testdata/realcol2/", 4, cols);
+  BuildCollection(DATADIR "testdata/realcol3/", 4, cols);
+}
+
+void DeleteCollections(vector<const DocumentCollection*>* cols) {
+  for (vector<const DocumentCollection*>::iterator it = cols->begin();
+       it != cols->end();
+       ++it) {
+    delete *it;
+  }
+  cols->clear();
+}
+
+}  // namespace topicsum
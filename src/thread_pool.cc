@@ -0,0 +1,136 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/thread_pool.h"
+
+#include "summarizer/logging.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+ThreadPool::ThreadPool(int num_threads)
+    : num_threads_(num_threads < 1 ? 1 : num_threads),
+      task_(NULL),
+      num_shards_(0),
+      next_shard_(0),
+      num_pending_shards_(0),
+      task_generation_(0),
+      stopping_(false) {
+  CHECK_EQ(0, pthread_mutex_init(&mutex_, NULL));
+  CHECK_EQ(0, pthread_cond_init(&task_available_, NULL));
+  CHECK_EQ(0, pthread_cond_init(&task_done_, NULL));
+
+  // The calling thread is one of the threads of the pool.
+  workers_.resize(num_threads_ - 1);
+  for (uint i = 0; i < workers_.size(); ++i)
+    CHECK_EQ(0, pthread_create(&workers_[i], NULL, &WorkerMain, this));
+}
+
+ThreadPool::~ThreadPool() {
+  pthread_mutex_lock(&mutex_);
+  stopping_ = true;
+  pthread_cond_broadcast(&task_available_);
+  pthread_mutex_unlock(&mutex_);
+
+  for (uint i = 0; i < workers_.size(); ++i)
+    pthread_join(workers_[i], NULL);
+
+  pthread_cond_destroy(&task_done_);
+  pthread_cond_destroy(&task_available_);
+  pthread_mutex_destroy(&mutex_);
+}
+
+void ThreadPool::Run(int num_shards, ParallelTask* task) {
+  CHECK(task != NULL);
+  if (workers_.empty() || num_shards <= 1) {
+    for (int shard = 0; shard < num_shards; ++shard)
+      task->Run(shard);
+    return;
+  }
+
+  pthread_mutex_lock(&mutex_);
+  CHECK(task_ == NULL) << "ThreadPool::Run is not reentrant.";
+  task_ = task;
+  num_shards_ = num_shards;
+  next_shard_ = 0;
+  num_pending_shards_ = num_shards;
+  ++task_generation_;
+  pthread_cond_broadcast(&task_available_);
+  pthread_mutex_unlock(&mutex_);
+
+  ProcessShards();
+
+  pthread_mutex_lock(&mutex_);
+  while (num_pending_shards_ > 0)
+    pthread_cond_wait(&task_done_, &mutex_);
+  task_ = NULL;
+  pthread_mutex_unlock(&mutex_);
+}
+
+void ThreadPool::GetShardRange(int num_items, int num_shards, int shard,
+                               int* begin, int* end) {
+  DCHECK_GT(num_shards, 0);
+  DCHECK_GE(shard, 0);
+  DCHECK_LT(shard, num_shards);
+  int shard_size = num_items / num_shards;
+  int remainder = num_items % num_shards;
+
+  // The first remainder shards get one more item.
+  *begin = shard * shard_size + (shard < remainder ? shard : remainder);
+  *end = *begin + shard_size + (shard < remainder ? 1 : 0);
+}
+
+void* ThreadPool::WorkerMain(void* pool) {
+  static_cast<ThreadPool*>(pool)->WorkerLoop();
+  return NULL;
+}
+
+void ThreadPool::WorkerLoop() {
+  int last_generation = 0;
+  for (;;) {
+    pthread_mutex_lock(&mutex_);
+    while (!stopping_ && task_generation_ == last_generation)
+      pthread_cond_wait(&task_available_, &mutex_);
+    if (stopping_) {
+      pthread_mutex_unlock(&mutex_);
+      return;
+    }
+    last_generation = task_generation_;
+    pthread_mutex_unlock(&mutex_);
+
+    ProcessShards();
+  }
+}
+
+void ThreadPool::ProcessShards() {
+  for (;;) {
+    pthread_mutex_lock(&mutex_);
+    if (task_ == NULL || next_shard_ >= num_shards_) {
+      pthread_mutex_unlock(&mutex_);
+      return;
+    }
+    ParallelTask* task = task_;
+    int shard = next_shard_++;
+    pthread_mutex_unlock(&mutex_);
+
+    task->Run(shard);
+
+    pthread_mutex_lock(&mutex_);
+    if (--num_pending_shards_ == 0)
+      pthread_cond_signal(&task_done_);
+    pthread_mutex_unlock(&mutex_);
+  }
+}
+
+}  // namespace topicsum
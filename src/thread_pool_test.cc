@@ -0,0 +1,101 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/thread_pool.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "summarizer/types.h"
+
+namespace topicsum {
+
+namespace {
+
+// Writes the square of every item of its shards.
+class SquareTask : public ParallelTask {
+ public:
+  SquareTask(int num_items, int num_shards)
+      : num_shards_(num_shards),
+        squares_(num_items, -1),
+        num_runs_(num_items, 0) {}
+
+  virtual void Run(int shard) {
+    int begin, end;
+    ThreadPool::GetShardRange(squares_.size(), num_shards_, shard,
+                              &begin, &end);
+    for (int i = begin; i < end; ++i) {
+      squares_[i] = i * i;
+      ++num_runs_[i];
+    }
+  }
+
+  const vector<int>& squares() const { return squares_; }
+  const vector<int>& num_runs() const { return num_runs_; }
+
+ private:
+  int num_shards_;
+  vector<int> squares_;
+  vector<int> num_runs_;
+};
+
+void RunSquareTask(ThreadPool* pool, int num_items, int num_shards) {
+  SquareTask task(num_items, num_shards);
+  pool->Run(num_shards, &task);
+  for (int i = 0; i < num_items; ++i) {
+    EXPECT_EQ(i * i, task.squares()[i]);
+    EXPECT_EQ(1, task.num_runs()[i]);
+  }
+}
+
+}  // unnamed namespace
+
+TEST(ThreadPool, GetShardRange) {
+  int num_items = 0;
+  int previous_end = 0;
+  for (int shard = 0; shard < 4; ++shard) {
+    int begin, end;
+    ThreadPool::GetShardRange(10, 4, shard, &begin, &end);
+    EXPECT_EQ(previous_end, begin);
+    EXPECT_GE(end - begin, 2);
+    EXPECT_LE(end - begin, 3);
+    num_items += end - begin;
+    previous_end = end;
+  }
+  EXPECT_EQ(10, num_items);
+}
+
+TEST(ThreadPool, SingleThread) {
+  ThreadPool pool(1);
+  EXPECT_EQ(1, pool.num_threads());
+  RunSquareTask(&pool, 100, 7);
+}
+
+TEST(ThreadPool, MultipleThreads) {
+  ThreadPool pool(4);
+  EXPECT_EQ(4, pool.num_threads());
+
+  // The pool can be reused for several tasks.
+  for (int i = 0; i < 50; ++i)
+    RunSquareTask(&pool, 1000, 16);
+  RunSquareTask(&pool, 3, 3);
+  RunSquareTask(&pool, 0, 0);
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -15,64 +15,32 @@
 
 #include "summarizer/topicsum.h"
 
-#include <sstream>
-
-#include "summarizer/sum.h"
-#include "summarizer/topicsumgibbs.h"
+#include "summarizer/logging.h"
 
 namespace topicsum {
 
-using std::ostringstream;
-
 bool TopicSum::Init(const DocumentCollection& collection,
                     const SummarizerOptions& options) {
   collection_ = collection;
+  options_ = options;
+  added_documents_.Clear();
+  folded_distri_.reset(NULL);
 
   // Init KLSum
   if (!KLSum::Init(collection_, options)) {
     return false;
   }
 
-  scoped_array<double> lambda;
-  scoped_array<double> gamma;
-  int lambda_size = 0;
-  int gamma_size = 0;
-
-  SummarizerUtils::ParseStringVectorAsDoubleVector(
-      options.topicsum_options().lambda(), &lambda, &lambda_size);
-
-  if (!lambda_size == 3) {
-    last_error_message_ = "Hyper-parameter lambda expects exactly 3 values";
-    return false;
-  }
-
-  SummarizerUtils::ParseStringVectorAsDoubleVector(
-      options.topicsum_options().gamma(), &gamma, &gamma_size);
-
-  if (!gamma_size == 3) {
-    last_error_message_ = "Hyper-parameter gamma expects exactly 3 values";
-    return false;
-  }
-
-  // Create the sampler.
-  const GibbsSamplingOptions& gibbs_options =
-      options.topicsum_options().gibbs_sampling_options();
-
+  // Train the model.
   vector<const DocumentCollection*> training_cols;
   training_cols.push_back(&collection_);
 
-  gibbs_sampler_.reset(
-      new TopicSumGibbsSampler(gibbs_options.iterations(),
-                               gibbs_options.burnin(),
-                               gibbs_options.lag(),
-                               gibbs_options.track_likelihood(),
-                               lambda.get(),
-                               gamma.get(),
-                               training_cols,
-                               NULL));
-
-  // Run the sampler.
-  gibbs_sampler_.get()->Train();
+  chains_.reset(new TopicSumChains);
+  if (!chains_->Train(training_cols, options.topicsum_options(),
+                      &last_error_message_)) {
+    return false;
+  }
+  GetDebugString()->append(chains_->debug_string());
 
   return true;
 }
@@ -81,8 +49,40 @@ bool TopicSum::CalculateCollectionDistribution(
     const DocumentCollection& collection) {
   // Get the collection distribution from the collection.
   coll_distri_.reset(new Distribution);
-  gibbs_sampler_->GetCollectionDistribution(0, coll_distri_.get());
+  if (folded_distri_.get() != NULL) {
+    *coll_distri_ = *folded_distri_;
+  } else {
+    chains_->GetCollectionDistribution(0, coll_distri_.get());
+  }
   return true;
 }
 
+bool TopicSum::AddDocuments(const DocumentCollection& documents,
+                            int iterations) {
+  CHECK(chains_.get() != NULL) << "Init must be called before AddDocuments";
+  if (iterations <= 0) {
+    last_error_message_ = "The number of iterations must be positive";
+    return false;
+  }
+  DocumentCollection added_documents = added_documents_;
+  for (int i = 0; i < documents.document_size(); i++)
+    added_documents.add_document()->CopyFrom(documents.document(i));
+
+  scoped_ptr<Distribution> distribution(new Distribution);
+  if (!chains_->FoldIn(0, added_documents, iterations, distribution.get())) {
+    last_error_message_ =
+        "The inference engine does not support adding documents";
+    return false;
+  }
+  added_documents_.Swap(&added_documents);
+  folded_distri_.reset(distribution.release());
+
+  // Initialize KLSum again on the whole collection, so that the new
+  // sentences are candidates, and the collection distribution is calculated
+  // again.
+  for (int i = 0; i < documents.document_size(); i++)
+    collection_.add_document()->CopyFrom(documents.document(i));
+  return KLSum::Init(collection_, options_);
+}
+
 }  // namespace topicsum
@@ -0,0 +1,120 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/topicsum_batch.h"
+
+#include <sstream>
+
+#include "summarizer/klsum.h"
+#include "summarizer/logging.h"
+#include "summarizer/thread_pool.h"
+
+namespace topicsum {
+
+using std::ostringstream;
+
+// KLSum summarizer of a cluster, whose collection distribution is the one of
+// its COL topic in the joint model.
+class TopicSumBatch::ClusterSummarizer : public KLSum {
+ public:
+  ClusterSummarizer(const TopicSumChains* chains, int colid)
+      : chains_(chains), colid_(colid) {}
+
+  bool Init(const DocumentCollection& collection,
+            const SummarizerOptions& options) {
+    if (!KLSum::Init(collection, options))
+      return false;
+    GetDebugString()->append(chains_->debug_string());
+    return true;
+  }
+
+ protected:
+  virtual bool CalculateCollectionDistribution(
+      const DocumentCollection& /* collection */) {
+    coll_distri_.reset(new Distribution);
+    chains_->GetCollectionDistribution(colid_, coll_distri_.get());
+    return true;
+  }
+
+ private:
+  const TopicSumChains* chains_;
+  int colid_;
+};
+
+// Summarizes each cluster with its own summarizer, which is only alive while
+// the cluster is summarized.
+class TopicSumBatch::SummarizeTask : public ParallelTask {
+ public:
+  SummarizeTask(const TopicSumBatch* batch, const SummaryOptions* options,
+                vector<Document>* summaries, vector<string>* errors)
+      : batch_(batch), options_(options), summaries_(summaries),
+        errors_(errors) {}
+
+  virtual void Run(int colid) {
+    ClusterSummarizer summarizer(batch_->chains_.get(), colid);
+    if (!summarizer.Init(*batch_->clusters_[colid], batch_->options_) ||
+        !summarizer.Summarize(*options_, &(*summaries_)[colid])) {
+      (*errors_)[colid] = summarizer.last_error_message();
+      if ((*errors_)[colid].empty())
+        (*errors_)[colid] = "Unknown error";
+    }
+  }
+
+ private:
+  const TopicSumBatch* batch_;
+  const SummaryOptions* options_;
+  vector<Document>* summaries_;
+  vector<string>* errors_;
+};
+
+bool TopicSumBatch::Init(const vector<const DocumentCollection*>& clusters,
+                         const SummarizerOptions& options) {
+  clusters_ = clusters;
+  options_ = options;
+  last_error_message_.clear();
+  if (clusters_.empty()) {
+    last_error_message_ = "No cluster to summarize";
+    return false;
+  }
+
+  chains_.reset(new TopicSumChains);
+  return chains_->Train(clusters_, options_.topicsum_options(),
+                        &last_error_message_);
+}
+
+bool TopicSumBatch::Summarize(const SummaryOptions& options,
+                              vector<Document>* summaries) {
+  CHECK(summaries != NULL);
+  CHECK(chains_.get() != NULL) << "Init must be called before Summarize";
+  int num_clusters = clusters_.size();
+  summaries->clear();
+  summaries->resize(num_clusters);
+  vector<string> errors(num_clusters);
+
+  ThreadPool thread_pool(options_.topicsum_options().batch_num_threads());
+  SummarizeTask task(this, &options, summaries, &errors);
+  thread_pool.Run(num_clusters, &task);
+
+  for (int c = 0; c < num_clusters; c++) {
+    if (!errors[c].empty()) {
+      ostringstream oss;
+      oss << "Could not summarize the cluster " << c << ": " << errors[c];
+      last_error_message_ = oss.str();
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace topicsum
@@ -0,0 +1,140 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/topicsum_batch.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "summarizer/document.h"
+#include "summarizer/logging.h"
+#include "summarizer/test_collections.h"
+#include "summarizer/topicsum.h"
+
+namespace topicsum {
+
+using std::fstream;
+using std::ios;
+
+class TopicSumBatchTest : public testing::Test {
+ public:
+  virtual void SetUp() {
+    // The clusters are the three real collections of the TopicSum tests.
+    BuildRealCollections(&clusters_);
+
+    TopicSumOptions* topicsum_options = options_.mutable_topicsum_options();
+    topicsum_options->set_lambda("0.1,1,1");
+    topicsum_options->set_gamma("1,5,10");
+    GibbsSamplingOptions* gibbs_options =
+        topicsum_options->mutable_gibbs_sampling_options();
+    gibbs_options->set_iterations(200);
+    gibbs_options->set_lag(10);
+    gibbs_options->set_seed(0);
+    options_.mutable_klsum_options()->set_postprocessor_name(
+        "TestPostprocessor");
+
+    SummaryLength* length = sum_options_.mutable_length();
+    length->set_length(30);
+    length->set_unit(SummaryLength::TOKEN);
+  }
+
+  virtual void TearDown() {
+    DeleteCollections(&clusters_);
+  }
+
+ protected:
+  vector<const DocumentCollection*> clusters_;
+  SummarizerOptions options_;
+  SummaryOptions sum_options_;
+};
+
+TEST_F(TopicSumBatchTest, Summarize) {
+  TopicSumBatch batch;
+  ASSERT_TRUE(batch.Init(clusters_, options_));
+  vector<Document> summaries;
+  ASSERT_TRUE(batch.Summarize(sum_options_, &summaries));
+  ASSERT_EQ(clusters_.size(), summaries.size());
+  for (uint c = 0; c < summaries.size(); c++) {
+    LOG(INFO) << DocumentUtils::ToString(summaries[c]);
+    EXPECT_LT(0, summaries[c].sentence_size());
+  }
+  EXPECT_NE(DocumentUtils::ToString(summaries[0]),
+            DocumentUtils::ToString(summaries[1]));
+
+  // The summaries do not depend on the number of threads.
+  options_.mutable_topicsum_options()->set_batch_num_threads(3);
+  TopicSumBatch parallel;
+  ASSERT_TRUE(parallel.Init(clusters_, options_));
+  vector<Document> parallel_summaries;
+  ASSERT_TRUE(parallel.Summarize(sum_options_, &parallel_summaries));
+  ASSERT_EQ(summaries.size(), parallel_summaries.size());
+  for (uint c = 0; c < summaries.size(); c++) {
+    EXPECT_EQ(DocumentUtils::ToString(summaries[c]),
+              DocumentUtils::ToString(parallel_summaries[c]));
+  }
+}
+
+// A batch of a single cluster is the same as TopicSum.
+TEST_F(TopicSumBatchTest, SingleCluster) {
+  string path = DATADIR "testdata/singledoc";
+  fstream in(path.c_str(), ios::in | ios::binary);
+  DocumentCollection collection;
+  ASSERT_TRUE(collection.ParseFromIstream(&in));
+  sum_options_.set_generate_debug(true);
+
+  TopicSum topicsum;
+  ASSERT_TRUE(topicsum.Init(collection, options_));
+  Document summary;
+  ASSERT_TRUE(topicsum.Summarize(sum_options_, &summary));
+
+  TopicSumBatch batch;
+  vector<const DocumentCollection*> clusters(1, &collection);
+  ASSERT_TRUE(batch.Init(clusters, options_));
+  vector<Document> summaries;
+  ASSERT_TRUE(batch.Summarize(sum_options_, &summaries));
+  ASSERT_EQ(1, summaries.size());
+  EXPECT_EQ(DocumentUtils::ToString(summary),
+            DocumentUtils::ToString(summaries[0]));
+  EXPECT_EQ(summary.debug_string(), summaries[0].debug_string());
+}
+
+TEST_F(TopicSumBatchTest, Errors) {
+  TopicSumBatch empty;
+  EXPECT_FALSE(empty.Init(vector<const DocumentCollection*>(), options_));
+
+  options_.mutable_topicsum_options()->set_lambda("0.1,1");
+  TopicSumBatch invalid;
+  EXPECT_FALSE(invalid.Init(clusters_, options_));
+  EXPECT_EQ("Hyper-parameter lambda expects exactly 3 values",
+            invalid.last_error_message());
+
+  // Summaries in a unit that KLSum does not support.
+  options_.mutable_topicsum_options()->set_lambda("0.1,1,1");
+  TopicSumBatch batch;
+  ASSERT_TRUE(batch.Init(clusters_, options_));
+  sum_options_.mutable_length()->set_unit(SummaryLength::CHARACTER);
+  vector<Document> summaries;
+  EXPECT_FALSE(batch.Summarize(sum_options_, &summaries));
+  EXPECT_EQ(0, batch.last_error_message().find(
+      "Could not summarize the cluster 0: "));
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/topicsum_chains.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "summarizer/background_model.h"
+#include "summarizer/logging.h"
+#include "summarizer/sum.h"
+#include "summarizer/thread_pool.h"
+#include "summarizer/topicsumcvb0.h"
+#include "summarizer/topicsumgibbs.h"
+
+namespace topicsum {
+
+using std::max;
+using std::ostringstream;
+
+namespace {
+
+// Trains the inference engine of each chain.
+class TrainTask : public ParallelTask {
+ public:
+  explicit TrainTask(vector<TopicSumModel*>* models) : models_(models) {}
+
+  virtual void Run(int chain) {
+    (*models_)[chain]->Train();
+  }
+
+ private:
+  vector<TopicSumModel*>* models_;
+};
+
+}  // namespace
+
+TopicSumChains::~TopicSumChains() {
+  Clear();
+}
+
+bool TopicSumChains::Train(const vector<const DocumentCollection*>& collections,
+                           const TopicSumOptions& options,
+                           string* error_message) {
+  Clear();
+  debug_string_.clear();
+
+  scoped_array<double> lambda;
+  scoped_array<double> gamma;
+  int lambda_size = 0;
+  int gamma_size = 0;
+
+  SummarizerUtils::ParseStringVectorAsDoubleVector(
+      options.lambda(), &lambda, &lambda_size);
+
+  if (lambda_size != 3) {
+    *error_message = "Hyper-parameter lambda expects exactly 3 values";
+    return false;
+  }
+
+  SummarizerUtils::ParseStringVectorAsDoubleVector(
+      options.gamma(), &gamma, &gamma_size);
+
+  if (gamma_size != 3) {
+    *error_message = "Hyper-parameter gamma expects exactly 3 values";
+    return false;
+  }
+
+  const GibbsSamplingOptions& gibbs_options = options.gibbs_sampling_options();
+  seed_ = gibbs_options.seed();
+
+  bool cvb0 = options.inference() == TopicSumOptions::CVB0;
+  if (cvb0 && (gibbs_options.checkpoint_interval() > 0 ||
+               gibbs_options.resume_from_checkpoint())) {
+    *error_message = "The CVB0 inference does not support checkpoints";
+    return false;
+  }
+
+  const BackgroundModel* background_model = NULL;
+  if (options.has_background_model_path()) {
+    const string& path = options.background_model_path();
+    background_model = BackgroundModel::Get(path);
+    if (background_model == NULL) {
+      *error_message = "Could not load the background model " + path;
+      return false;
+    }
+  }
+
+  // Create the inference engines of the chains, which share the tokenized
+  // collections.
+  corpus_.reset(new TopicSumCorpus(collections, NULL));
+  int num_chains = max(1, gibbs_options.num_chains());
+  for (int chain = 0; chain < num_chains; chain++) {
+    TopicSumModel* model;
+    if (cvb0) {
+      model = new TopicSumCVB0(options.cvb0_iterations(),
+                               gibbs_options.track_likelihood(),
+                               lambda.get(),
+                               gamma.get(),
+                               collections,
+                               NULL);
+    } else {
+      TopicSumGibbsSampler* sampler =
+          new TopicSumGibbsSampler(gibbs_options.iterations(),
+                                   gibbs_options.burnin(),
+                                   gibbs_options.lag(),
+                                   gibbs_options.track_likelihood(),
+                                   lambda.get(),
+                                   gamma.get(),
+                                   collections,
+                                   NULL);
+      sampler->set_num_threads(gibbs_options.num_threads());
+      model = sampler;
+    }
+    models_.push_back(model);
+
+    model->set_corpus(corpus_.get());
+    model->set_background_model(background_model);
+    model->set_deadline_ms(gibbs_options.deadline_ms());
+    model->set_seed(gibbs_options.seed(), chain);
+    model->set_convergence(gibbs_options.convergence_tolerance(),
+                           gibbs_options.convergence_window(),
+                           gibbs_options.min_iterations());
+
+    string checkpoint_path = gibbs_options.checkpoint_path();
+    if (num_chains > 1) {
+      ostringstream oss;
+      oss << checkpoint_path << "." << chain;
+      checkpoint_path = oss.str();
+    }
+    model->set_checkpoint(checkpoint_path, gibbs_options.checkpoint_interval());
+    if (gibbs_options.resume_from_checkpoint() &&
+        !model->RestoreCheckpoint(checkpoint_path)) {
+      *error_message = "Could not resume from the checkpoint " +
+                       checkpoint_path;
+      return false;
+    }
+  }
+
+  // Run the inference of the chains concurrently.
+  ThreadPool thread_pool(num_chains);
+  TrainTask train_task(&models_);
+  thread_pool.Run(num_chains, &train_task);
+
+  const char* inference = cvb0 ? "CVB0 inference" : "Gibbs sampling";
+  for (int chain = 0; chain < num_chains; chain++) {
+    const TopicSumModel* model = models_[chain];
+    ostringstream oss;
+    oss << "\n" << inference;
+    if (num_chains > 1)
+      oss << " of chain " << chain;
+    if (model->stop_reason() == GibbsSampler::DEADLINE_EXCEEDED) {
+      oss << " deadline exceeded after ";
+    } else if (model->stop_reason() == GibbsSampler::CONVERGED) {
+      oss << " converged after ";
+    } else {
+      continue;
+    }
+    oss << model->num_done_iterations() << " iterations.";
+    debug_string_.append(oss.str());
+  }
+
+  return true;
+}
+
+void TopicSumChains::GetCollectionDistribution(int colid,
+                                               Distribution* wd) const {
+  CHECK(!models_.empty());
+  if (models_.size() == 1) {
+    models_[0]->GetCollectionDistribution(colid, wd);
+    return;
+  }
+  double weight = 1.0 / models_.size();
+  for (uint chain = 0; chain < models_.size(); chain++) {
+    Distribution distribution;
+    models_[chain]->GetCollectionDistribution(colid, &distribution);
+    for (Distribution::const_iterator it = distribution.begin();
+         it != distribution.end(); ++it) {
+      (*wd)[it->first] += weight * it->second;
+    }
+  }
+}
+
+bool TopicSumChains::FoldIn(int colid, const DocumentCollection& documents,
+                            int iterations, Distribution* wd) const {
+  CHECK(!models_.empty());
+  double weight = 1.0 / models_.size();
+  for (uint chain = 0; chain < models_.size(); chain++) {
+    Random random(seed_, chain);
+    Distribution distribution;
+    if (!models_[chain]->FoldIn(colid, documents, iterations, &random,
+                                &distribution)) {
+      return false;
+    }
+    for (Distribution::const_iterator it = distribution.begin();
+         it != distribution.end(); ++it) {
+      (*wd)[it->first] += weight * it->second;
+    }
+  }
+  return true;
+}
+
+void TopicSumChains::Clear() {
+  for (uint chain = 0; chain < models_.size(); chain++)
+    delete models_[chain];
+  models_.clear();
+}
+
+}  // namespace topicsum
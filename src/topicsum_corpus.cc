@@ -0,0 +1,116 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "summarizer/topicsum_corpus.h"
+
+#include <algorithm>
+
+namespace topicsum {
+
+using std::lower_bound;
+using std::sort;
+using std::unique;
+
+TopicSumCorpus::TopicSumCorpus(
+    const vector<const DocumentCollection*>& collections,
+    const Distribution* background)
+    : collections_(collections) {
+  // Initialize word dictionary with all the words from all documents in all
+  // collections. At the same time, store the token ids and the offsets of the
+  // sentences, documents and collections.
+  sentence_offsets_.assign(1, 0);
+  document_offsets_.assign(1, 0);
+  collection_offsets_.assign(1, 0);
+  for (uint c = 0; c < collections_.size(); c++) {
+    const DocumentCollection& col = *collections_[c];
+    for (int d = 0; d < col.document_size(); d++) {
+      const Document& doc = col.document(d);
+      for (int s = 0; s < doc.sentence_size(); s++) {
+        const Sentence& sent = doc.sentence(s);
+        for (int w = 0; w < sent.token_size(); w++) {
+          const string& word = sent.token(w);
+          token_ids_.push_back(lexicon_.add_token(word));
+        }
+        sentence_offsets_.push_back(token_ids_.size());
+      }
+      document_offsets_.push_back(sentence_offsets_.size() - 1);
+    }
+    collection_offsets_.push_back(document_offsets_.size() - 1);
+  }
+
+  // If a background was provided, add the background words to the lexicon.
+  if (background != NULL) {
+    for (Distribution::const_iterator cit = background->begin();
+         cit != background->end(); ++cit) {
+      lexicon_.add_token(cit->first);
+    }
+  }
+
+  // Collect the distinct words of each document, and the index of each token
+  // among them.
+  document_word_offsets_.assign(1, 0);
+  token_document_words_.resize(token_ids_.size());
+  for (int d = 0; d < num_documents(); d++) {
+    int first_token = sentence_offsets_[document_offsets_[d]];
+    int end_token = sentence_offsets_[document_offsets_[d + 1]];
+    vector<int>::iterator first_word = document_word_ids_.insert(
+        document_word_ids_.end(),
+        token_ids_.begin() + first_token,
+        token_ids_.begin() + end_token);
+    sort(first_word, document_word_ids_.end());
+    document_word_ids_.erase(unique(first_word, document_word_ids_.end()),
+                             document_word_ids_.end());
+    document_word_offsets_.push_back(document_word_ids_.size());
+    for (int i = first_token; i < end_token; i++)
+      token_document_words_[i] = FindDocumentWord(d, token_ids_[i]);
+  }
+}
+
+int TopicSumCorpus::FindDocumentWord(int doc_index, int wordid) const {
+  vector<int>::const_iterator begin =
+      document_word_ids_.begin() + document_word_offsets_[doc_index];
+  vector<int>::const_iterator end =
+      document_word_ids_.begin() + document_word_offsets_[doc_index + 1];
+  vector<int>::const_iterator it = lower_bound(begin, end, wordid);
+  if (it == end || *it != wordid) return -1;
+  return it - document_word_ids_.begin();
+}
+
+void TopicSumCorpus::GetBackgroundProbabilities(
+    const Distribution* background, const BackgroundModel* background_model,
+    double* probabilities) const {
+  int num_words = lexicon_.size();
+  double sum = 0.0;
+  if (background_model != NULL) {
+    for (int i = 0; i < num_words; ++i) {
+      probabilities[i] = background_model->GetProbability(lexicon_.id2token(i));
+      sum += probabilities[i];
+    }
+  } else {
+    for (int i = 0; i < num_words; ++i)
+      probabilities[i] = 0.0;
+    for (Distribution::const_iterator cit = background->begin();
+         cit != background->end(); ++cit) {
+      probabilities[lexicon_.token2id(cit->first)] = cit->second;
+      sum += cit->second;
+    }
+  }
+  if (sum != 1.0 && sum > 0) {
+    for (int i = 0; i < num_words; ++i)
+      probabilities[i] /= sum;
+  }
+}
+
+}  // namespace topicsum
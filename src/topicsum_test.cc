@@ -15,11 +15,16 @@
 
 #include "summarizer/topicsum.h"
 
+#include <math.h>
+#include <stdio.h>
+
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "summarizer/background_model.h"
 #include "summarizer/distribution.h"
 #include "summarizer/distribution.pb.h"
 #include "summarizer/document.h"
@@ -32,6 +37,7 @@ namespace topicsum {
 
 using std::fstream;
 using std::ios;
+using std::istringstream;
 
 class TopicSumTest : public testing::Test {
  public:
@@ -42,9 +48,6 @@ class TopicSumTest : public testing::Test {
     // summarization techniques we use the same input. However the Gibbs sampler
     // has been tested with multiple collections (see topicsumgibbs_test.cc).
 
-    // Reset seed. Necessary to be able to reproduce the experiments.
-    srandom(0);
-
     // Read collection
     string path = DATADIR "testdata/singledoc";
     fstream in(path.c_str(), ios::in | ios::binary);
@@ -70,6 +73,8 @@ class TopicSumTest : public testing::Test {
     gibbsoptions->set_burnin(0);
     gibbsoptions->set_lag(100);
     gibbsoptions->set_track_likelihood(true);
+    // Fixed seed. Necessary to be able to reproduce the experiments.
+    gibbsoptions->set_seed(0);
 
     //Create summary options
     sum_options_.Clear();
@@ -113,7 +118,131 @@ TEST_F(TopicSumTest, Summarize) {
   EXPECT_FALSE(summary.debug_string().empty());
   EXPECT_NE(summary.debug_string().find("Collection distribution"),
             string::npos);
-  EXPECT_NE(summary.debug_string().find("it\t0.0082"), string::npos);
+  EXPECT_NE(summary.debug_string().find("it\t0.0054"), string::npos);
+}
+
+TEST_F(TopicSumTest, BackgroundModel) {
+  // A background model of frequent words of the collection.
+  Distribution background;
+  background["the"] = 0.5;
+  background["of"] = 0.25;
+  background["said"] = 0.25;
+  const char kPath[] = "topicsum_test_background.tmp";
+  ASSERT_TRUE(BackgroundModel::Write(background, 1e-6, kPath));
+  options_.mutable_topicsum_options()->set_background_model_path(kPath);
+
+  TopicSum topicsum;
+  ASSERT_TRUE(topicsum.Init(collection_, options_));
+  Document summary;
+  ASSERT_TRUE(topicsum.Summarize(sum_options_, &summary));
+  EXPECT_FALSE(DocumentUtils::ToString(summary).empty());
+  remove(kPath);
+
+  options_.mutable_topicsum_options()->set_background_model_path(
+      "nonexistent_background_model");
+  TopicSum missing;
+  EXPECT_FALSE(missing.Init(collection_, options_));
+}
+
+TEST_F(TopicSumTest, Chains) {
+  TopicSum one_chain;
+  ASSERT_TRUE(one_chain.Init(collection_, options_));
+  Document summary;
+  ASSERT_TRUE(one_chain.Summarize(sum_options_, &summary));
+  ASSERT_TRUE(one_chain.HasCollectionDistribution());
+
+  GibbsSamplingOptions* gibbs_options = options_.mutable_topicsum_options()
+      ->mutable_gibbs_sampling_options();
+  gibbs_options->set_num_chains(3);
+  TopicSum chains;
+  ASSERT_TRUE(chains.Init(collection_, options_));
+  ASSERT_TRUE(chains.Summarize(sum_options_, &summary));
+  EXPECT_FALSE(DocumentUtils::ToString(summary).empty());
+  ASSERT_TRUE(chains.HasCollectionDistribution());
+
+  // The average of the chains is a distribution, different from the one of
+  // the first chain alone.
+  const Distribution& average = chains.GetCollectionDistribution();
+  const Distribution& first = one_chain.GetCollectionDistribution();
+  double sum = 0;
+  double difference = 0;
+  for (Distribution::const_iterator it = average.begin();
+       it != average.end(); ++it) {
+    sum += it->second;
+    Distribution::const_iterator first_it = first.find(it->first);
+    difference += fabs(it->second -
+                       (first_it == first.end() ? 0 : first_it->second));
+  }
+  EXPECT_NEAR(1.0, sum, 1e-9);
+  EXPECT_LT(0, difference);
+}
+
+TEST_F(TopicSumTest, AddDocuments) {
+  TopicSum topicsum;
+  ASSERT_TRUE(topicsum.Init(collection_, options_));
+  Document summary;
+  ASSERT_TRUE(topicsum.Summarize(sum_options_, &summary));
+  Distribution trained = topicsum.GetCollectionDistribution();
+
+  // A new document about the zones of platinum found by technigen.
+  DocumentCollection documents;
+  Document* document = documents.add_document();
+  const char* kSentences[] = {
+    "technigen platinum corp said new drilling found more platinum",
+    "the platinum and palladium zones of technigen extend to the north",
+  };
+  for (uint s = 0; s < ARRAYSIZE(kSentences); s++) {
+    Sentence* sentence = document->add_sentence();
+    sentence->set_raw_content(kSentences[s]);
+    istringstream tokens(kSentences[s]);
+    string token;
+    while (tokens >> token)
+      sentence->add_token(token);
+  }
+
+  ASSERT_TRUE(topicsum.AddDocuments(documents, 20));
+  ASSERT_TRUE(topicsum.Summarize(sum_options_, &summary));
+  EXPECT_FALSE(DocumentUtils::ToString(summary).empty());
+  Distribution folded = topicsum.GetCollectionDistribution();
+  EXPECT_LT(trained.find("platinum")->second, folded.find("platinum")->second);
+  EXPECT_LT(0, folded.find("north")->second);
+  EXPECT_TRUE(trained.find("north") == trained.end());
+
+  // The documents added next are folded in with the previous ones.
+  ASSERT_TRUE(topicsum.AddDocuments(documents, 20));
+  ASSERT_TRUE(topicsum.Summarize(sum_options_, &summary));
+  EXPECT_LT(folded.find("platinum")->second,
+            topicsum.GetCollectionDistribution().find("platinum")->second);
+
+  // The number of iterations must be positive.
+  EXPECT_FALSE(topicsum.AddDocuments(documents, 0));
+  EXPECT_FALSE(topicsum.last_error_message().empty());
+
+  // CVB0 does not support it.
+  options_.mutable_topicsum_options()->set_inference(TopicSumOptions::CVB0);
+  TopicSum cvb0;
+  ASSERT_TRUE(cvb0.Init(collection_, options_));
+  EXPECT_FALSE(cvb0.AddDocuments(documents, 20));
+}
+
+TEST_F(TopicSumTest, CVB0) {
+  options_.mutable_topicsum_options()->set_inference(TopicSumOptions::CVB0);
+  GibbsSamplingOptions* gibbs_options = options_.mutable_topicsum_options()
+      ->mutable_gibbs_sampling_options();
+  gibbs_options->set_convergence_tolerance(1e-5);
+
+  TopicSum topicsum;
+  ASSERT_TRUE(topicsum.Init(collection_, options_));
+  Document summary;
+  ASSERT_TRUE(topicsum.Summarize(sum_options_, &summary));
+  EXPECT_FALSE(DocumentUtils::ToString(summary).empty());
+  EXPECT_NE(summary.debug_string().find("CVB0 inference converged"),
+            string::npos);
+
+  // The CVB0 inference does not support checkpoints.
+  gibbs_options->set_checkpoint_interval(10);
+  TopicSum checkpoints;
+  EXPECT_FALSE(checkpoints.Init(collection_, options_));
 }
 
 }  // namespace topicsum
@@ -0,0 +1,316 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/topicsumcvb0.h"
+
+#include <math.h>
+
+#include <sstream>
+
+#include "summarizer/logging.h"
+
+namespace topicsum {
+
+using std::make_pair;
+
+TopicSumCVB0::TopicSumCVB0(
+    int iterations,
+    bool track_likelihood,
+    double lambda[3],
+    double gamma[3],
+    const vector<const DocumentCollection*>& collections,
+    const Distribution* background)
+    : TopicSumModel(iterations, 0, 1, track_likelihood),
+      C_(0),
+      D_(0),
+      S_(0),
+      W_(0),
+      AW_(0),
+      NWB_(NULL),
+      NWC_(NULL),
+      NWD_(NULL),
+      NB_(0),
+      NC_(NULL),
+      ND_(NULL),
+      NZS_(NULL),
+      Q_(NULL),
+      phi_B_(NULL),
+      training_cols_(collections),
+      corpus_(NULL),
+      lexicon_(NULL),
+      token_ids_(NULL),
+      sentence_offsets_(NULL),
+      document_offsets_(NULL),
+      collection_offsets_(NULL),
+      token_document_words_(NULL),
+      background_(background),
+      background_model_(NULL) {
+  gamma_sum_ = 0;
+  for (int k = 0; k < K_; k++) {
+    lambda_[k] = lambda[k];
+    gamma_[k] = gamma[k];
+    gamma_sum_ += gamma_[k];
+  }
+}
+
+TopicSumCVB0::~TopicSumCVB0() {
+}
+
+void TopicSumCVB0::Init() {
+  // Tokenize the collections the first time, like TopicSumGibbsSampler.
+  if (corpus_ == NULL) {
+    own_corpus_.reset(new TopicSumCorpus(
+        training_cols_, background_model_ == NULL ? background_ : NULL));
+    corpus_ = own_corpus_.get();
+  }
+  lexicon_ = &corpus_->lexicon();
+  token_ids_ = corpus_->token_ids();
+  sentence_offsets_ = corpus_->sentence_offsets();
+  document_offsets_ = corpus_->document_offsets();
+  collection_offsets_ = corpus_->collection_offsets();
+  token_document_words_ = corpus_->token_document_words();
+
+  C_ = corpus_->num_collections();
+  D_ = corpus_->num_documents();
+  S_ = corpus_->num_sentences();
+  W_ = corpus_->num_words();
+  AW_ = corpus_->num_tokens();
+  int num_document_words = corpus_->num_document_words();
+
+  int64 size = static_cast<int64>(W_)        // NWB_
+      + static_cast<int64>(C_) * W_          // NWC_
+      + num_document_words                   // NWD_
+      + C_                                   // NC_
+      + D_                                   // ND_
+      + static_cast<int64>(S_) * K_          // NZS_
+      + static_cast<int64>(AW_) * K_         // Q_
+      + W_;                                  // phi_B_
+  arena_.reset(new double[size]());
+  NWB_ = arena_.get();
+  NWC_ = NWB_ + W_;
+  NWD_ = NWC_ + static_cast<int64>(C_) * W_;
+  NC_ = NWD_ + num_document_words;
+  ND_ = NC_ + C_;
+  NZS_ = ND_ + D_;
+  Q_ = NZS_ + static_cast<int64>(S_) * K_;
+  phi_B_ = Q_ + static_cast<int64>(AW_) * K_;
+  NB_ = 0;
+
+  // The pseudo-counts of a fixed background are the ones of the Gibbs
+  // sampler, so that both engines give it the same weight.
+  if (fixed_background()) {
+    corpus_->GetBackgroundProbabilities(background_, background_model_, phi_B_);
+    double background_prior = gamma_[0] / gamma_sum_;
+    for (int w = 0; w < W_; w++) {
+      int frequency = static_cast<int>(phi_B_[w] * AW_ * background_prior);
+      if (frequency > 0) {
+        NWB_[w] = frequency;
+        NB_ += frequency;
+      }
+    }
+  }
+}
+
+void TopicSumCVB0::DoInitialAssignment() {
+  bool fixed = fixed_background();
+  for (int c = 0; c < C_; c++) {
+    for (int doc_index = collection_offsets_[c];
+         doc_index < collection_offsets_[c + 1];
+         doc_index++) {
+      for (int sent_index = document_offsets_[doc_index];
+           sent_index < document_offsets_[doc_index + 1];
+           sent_index++) {
+        for (int i = sentence_offsets_[sent_index];
+             i < sentence_offsets_[sent_index + 1];
+             i++) {
+          double* q = Q_ + static_cast<int64>(i) * K_;
+          double sum = 0;
+          for (int k = 0; k < K_; k++) {
+            // Keep the initial distributions away from zero, so that no
+            // topic is ruled out before the first update.
+            q[k] = 0.1 + random()->Uniform();
+            sum += q[k];
+          }
+          for (int k = 0; k < K_; k++)
+            q[k] /= sum;
+
+          if (!fixed) {
+            NWB_[token_ids_[i]] += q[0];
+            NB_ += q[0];
+          }
+          NWC_[c * W_ + token_ids_[i]] += q[1];
+          NC_[c] += q[1];
+          NWD_[token_document_words_[i]] += q[2];
+          ND_[doc_index] += q[2];
+          for (int k = 0; k < K_; k++)
+            NZS_[sent_index * K_ + k] += q[k];
+        }
+      }
+    }
+  }
+}
+
+void TopicSumCVB0::DoIteration() {
+  // The counts of a fixed background are constant.
+  int first_topic = fixed_background() ? 1 : 0;
+  double W_lambda[K_];
+  for (int k = 0; k < K_; k++)
+    W_lambda[k] = W_ * lambda_[k];
+
+  for (int c = 0; c < C_; c++) {
+    double* NWC = NWC_ + c * W_;
+    for (int doc_index = collection_offsets_[c];
+         doc_index < collection_offsets_[c + 1];
+         doc_index++) {
+      double* N[K_] = { &NB_, NC_ + c, ND_ + doc_index };
+      for (int sent_index = document_offsets_[doc_index];
+           sent_index < document_offsets_[doc_index + 1];
+           sent_index++) {
+        double* NZS = NZS_ + sent_index * K_;
+        for (int i = sentence_offsets_[sent_index];
+             i < sentence_offsets_[sent_index + 1];
+             i++) {
+          double* q = Q_ + static_cast<int64>(i) * K_;
+          double* NW[K_] = { NWB_ + token_ids_[i], NWC + token_ids_[i],
+                             NWD_ + token_document_words_[i] };
+
+          // Compute the distribution given the counts without the token.
+          double p[K_];
+          double sum = 0;
+          for (int k = 0; k < K_; k++) {
+            double nw = *NW[k];
+            double n = *N[k];
+            if (k >= first_topic) {
+              nw -= q[k];
+              n -= q[k];
+            }
+            p[k] = (nw + lambda_[k]) / (n + W_lambda[k])
+                * (NZS[k] - q[k] + gamma_[k]);
+            sum += p[k];
+          }
+
+          // Replace the contribution of the token to the counts.
+          double inv_sum = 1 / sum;
+          for (int k = 0; k < K_; k++) {
+            double new_q = p[k] * inv_sum;
+            double delta = new_q - q[k];
+            if (k >= first_topic) {
+              *NW[k] += delta;
+              *N[k] += delta;
+            }
+            NZS[k] += delta;
+            q[k] = new_q;
+          }
+        }
+      }
+    }
+  }
+}
+
+double TopicSumCVB0::CalculateModelLikelihood() const {
+  double modlike = 0;
+  for (int c = 0; c < C_; c++) {
+    for (int doc_index = collection_offsets_[c];
+         doc_index < collection_offsets_[c + 1];
+         doc_index++) {
+      for (int sent_index = document_offsets_[doc_index];
+           sent_index < document_offsets_[doc_index + 1];
+           sent_index++) {
+        double psi_B = psi(sent_index, 0);
+        double psi_C = psi(sent_index, 1);
+        double psi_D = psi(sent_index, 2);
+        for (int i = sentence_offsets_[sent_index];
+             i < sentence_offsets_[sent_index + 1];
+             i++) {
+          double wordlike = phi_B(token_ids_[i]) * psi_B
+              + phi_C(c, token_ids_[i]) * psi_C
+              + phi_D(doc_index, token_document_words_[i]) * psi_D;
+          if (wordlike > 0)
+            modlike += log(wordlike);
+        }
+      }
+    }
+  }
+  return modlike;
+}
+
+void TopicSumCVB0::GetCollectionDistribution(int colid,
+                                             Distribution* wd) const {
+  CHECK_GE(colid, 0);
+  CHECK_LT(colid, C_);
+  CHECK(wd);
+
+  for (int w = 0; w < W_; w++) {
+    double v = phi_C(colid, w);
+    if (v > 0)
+      wd->insert(make_pair(lexicon_->id2token(w), v));
+  }
+
+  NormalizeDistribution(wd);
+}
+
+bool TopicSumCVB0::GetPosteriorDistribution(string term,
+                                            Distribution* cd) const {
+  if (!lexicon_->has_token(term)) return false;
+  int termid = lexicon_->token2id(term);
+
+  // Expected numbers of occurrences of the term in the BKG topic, in each COL
+  // topic and in all the DOC topics.
+  cd->insert(make_pair("background", NWB_[termid]));
+  for (int c = 0; c < C_; c++)
+    cd->insert(make_pair(training_cols_[c]->id(), NWC_[c * W_ + termid]));
+  double total_doc_frequency = 0;
+  for (int d = 0; d < D_; d++) {
+    int doc_word = corpus_->FindDocumentWord(d, termid);
+    if (doc_word != -1)
+      total_doc_frequency += NWD_[doc_word];
+  }
+  cd->insert(make_pair("document", total_doc_frequency));
+
+  NormalizeDistribution(cd);
+  return true;
+}
+
+void TopicSumCVB0::GetBackgroundDistribution(Distribution* wd) const {
+  CHECK(wd);
+  wd->clear();
+
+  for (int w = 0; w < W_; w++) {
+    double v = phi_B(w);
+    if (v > 0)
+      wd->insert(make_pair(lexicon_->id2token(w), v));
+  }
+
+  NormalizeDistribution(wd);
+}
+
+string TopicSumCVB0::PrintSamplerInfo() {
+  std::ostringstream oss;
+
+  oss << GibbsSampler::PrintSamplerInfo();
+
+  oss << "Inference: CVB0\n";
+  oss << "Model hyper-parameters: \n";
+  oss << "\tlambda (BG / COL / DOC): \n";
+  for (int k = 0; k < K_; k++)
+    oss << "\t\t" << lambda_[k] << "\n";
+
+  oss << "\tgamma (BG / COL / DOC): \n";
+  for (int k = 0; k < K_; k++)
+    oss << "\t\t" << gamma_[k] << "\n";
+
+  return oss.str();
+}
+
+}  // namespace topicsum
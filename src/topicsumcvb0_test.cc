@@ -0,0 +1,161 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "summarizer/topicsumcvb0.h"
+
+#include <math.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "summarizer/logging.h"
+#include "summarizer/test_collections.h"
+#include "summarizer/topicsumgibbs.h"
+
+namespace topicsum {
+
+class TopicSumCVB0Test : public testing::Test {
+ protected:
+  virtual void TearDown() {
+    topicsum_.reset(NULL);
+    DeleteCollections(&cols_);
+  }
+
+  // Trains the model on the toy collections, with the hyper-parameters of
+  // the toy tests of the Gibbs sampler (see topicsumgibbs_test.cc).
+  void TrainToy(int num_iterations, Distribution* background) {
+    BuildToyCollections(&cols_);
+    double lambda[3] = {.1, .1, .1};
+    double gamma[3] = {2, 3, 0};
+    topicsum_.reset(new TopicSumCVB0(num_iterations, true, lambda, gamma,
+                                     cols_, background));
+    topicsum_->set_seed(0, 0);
+    topicsum_->Train();
+  }
+
+  vector<const DocumentCollection*> cols_;
+  scoped_ptr<TopicSumCVB0> topicsum_;
+};
+
+TEST_F(TopicSumCVB0Test, GetCollectionDistribution) {
+  TrainToy(50, NULL  /* no predefined background */);
+  Distribution distri;
+  topicsum_->GetCollectionDistribution(0, &distri);
+  EXPECT_LT(0.1, distri["iphone"]);
+  EXPECT_LT(0.1, distri["ipad"]);
+  EXPECT_LT(0.1, distri["company"]);
+  EXPECT_GT(0.1, distri["banana"]);
+  distri.clear();
+  topicsum_->GetCollectionDistribution(1, &distri);
+  EXPECT_LT(0.1, distri["banana"]);
+  EXPECT_LT(0.1, distri["fruit"]);
+  EXPECT_GT(0.1, distri["iphone"]);
+
+  // The posterior of a word specific to a collection is concentrated on it.
+  distri.clear();
+  EXPECT_TRUE(topicsum_->GetPosteriorDistribution("iphone", &distri));
+  EXPECT_LT(0.9, distri[cols_[0]->id()]);
+  distri.clear();
+  EXPECT_FALSE(topicsum_->GetPosteriorDistribution("notfound", &distri));
+}
+
+TEST_F(TopicSumCVB0Test, FixedBackground) {
+  // As with the Gibbs sampler, 'apple' is forced out of the background, so it
+  // is assigned to both collection distributions.
+  Distribution background;
+  background["the"] = 0.5;
+  background["and"] = 0.5;
+  TrainToy(50, &background);
+
+  Distribution distri;
+  topicsum_->GetBackgroundDistribution(&distri);
+  EXPECT_DOUBLE_EQ(0.5, distri["the"]);
+  EXPECT_DOUBLE_EQ(0.5, distri["and"]);
+  EXPECT_EQ(0, distri["apple"]);
+
+  distri.clear();
+  topicsum_->GetCollectionDistribution(0, &distri);
+  EXPECT_LT(0.2, distri["apple"]);
+  EXPECT_LT(0.1, distri["iphone"]);
+  distri.clear();
+  topicsum_->GetCollectionDistribution(1, &distri);
+  EXPECT_LT(0.2, distri["apple"]);
+  EXPECT_LT(0.1, distri["banana"]);
+
+  distri.clear();
+  topicsum_->GetPosteriorDistribution("the", &distri);
+  EXPECT_LT(0.9, distri["background"]);
+}
+
+// The updates are deterministic, and the likelihood of the real collections
+// converges in a few tens of iterations, to a value close to the one of the
+// Gibbs sampler with many more iterations.
+TEST(TopicSumCVB0, RealCollectionsTraining) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  vector<pair<int, double> > likelihoods[2];
+  for (int run = 0; run < 2; run++) {
+    TopicSumCVB0 topicsum(50, true, lambda, gamma, cols, NULL);
+    topicsum.set_seed(0, 0);
+    topicsum.Train();
+    likelihoods[run] = topicsum.saved_likelihoods();
+  }
+  ASSERT_EQ(50, likelihoods[0].size());
+  EXPECT_TRUE(likelihoods[0] == likelihoods[1]);
+  for (uint i = 0; i < likelihoods[0].size(); i++) {
+    LOG(INFO) << "Iteration " << likelihoods[0][i].first
+              << ": " << likelihoods[0][i].second;
+  }
+  double last = likelihoods[0].back().second;
+  EXPECT_LT(likelihoods[0][0].second, last);
+  EXPECT_NEAR(last, likelihoods[0][40].second, 1e-3 * fabs(last));
+
+  TopicSumGibbsSampler gibbs(1000, 100, 100, true, lambda, gamma, cols, NULL);
+  gibbs.set_seed(0, 0);
+  gibbs.Train();
+  double gibbs_last = gibbs.saved_likelihoods().back().second;
+  EXPECT_NEAR(gibbs_last, last, 0.01 * fabs(gibbs_last));
+
+  DeleteCollections(&cols);
+}
+
+TEST(TopicSumCVB0, EarlyStopping) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  TopicSumCVB0 topicsum(1000, false, lambda, gamma, cols, NULL);
+  topicsum.set_seed(0, 0);
+  topicsum.set_convergence(1e-4, 5, 0);
+  topicsum.Train();
+  EXPECT_EQ(GibbsSampler::CONVERGED, topicsum.stop_reason());
+  EXPECT_GT(200, topicsum.num_done_iterations());
+
+  Distribution distri;
+  topicsum.GetCollectionDistribution(0, &distri);
+  EXPECT_LT(0, distri.size());
+
+  DeleteCollections(&cols);
+}
+
+}  // namespace topicsum
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -21,9 +21,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
+#include "summarizer/binary_file.h"
 #include "summarizer/logging.h"
 #include "summarizer/sampling.h"
 #include "summarizer/scoped_ptr.h"
+#include "summarizer/thread_pool.h"
 
 namespace topicsum {
 
@@ -31,10 +35,91 @@ using std::fixed;
 using std::ios;
 using std::left;
 using std::make_pair;
+using std::max;
 using std::setfill;
 using std::setiosflags;
 using std::setprecision;
 using std::setw;
+using std::upper_bound;
+
+namespace {
+
+// Number of shards per thread in parallel mode. Having more shards than
+// threads balances the load when the documents of some shards take longer to
+// sample, at the cost of a copy of the counts of the BKG topic per shard.
+const int kShardsPerThread = 4;
+
+}  // namespace
+
+// Samples the documents of each shard.
+class TopicSumGibbsSampler::SweepTask : public ParallelTask {
+ public:
+  explicit SweepTask(TopicSumGibbsSampler* sampler) : sampler_(sampler) {}
+
+  virtual void Run(int shard_index) {
+    TopicSumGibbsSampler* s = sampler_;
+    Shard* shard = s->shards_[shard_index];
+
+    // Start from the counts at the beginning of the iteration, of the BKG
+    // topic and of the COL topics of the collections of the shard.
+    int* word_counts = &shard->word_counts[0];
+    std::copy(s->NWB_, s->NWB_ + s->W_, word_counts);
+    std::copy(s->NWC_ + static_cast<int64>(shard->begin_col) * s->W_,
+              s->NWC_ + static_cast<int64>(shard->end_col) * s->W_,
+              word_counts + s->W_);
+    shard->topic_counts[0] = s->NB_;
+    for (int c = shard->begin_col; c < shard->end_col; c++)
+      shard->topic_counts[c - shard->begin_col + 1] = s->NC_[c];
+
+    s->SampleDocuments(shard->begin_doc, shard->end_doc, &shard->counts,
+                       &shard->random);
+  }
+
+ private:
+  TopicSumGibbsSampler* sampler_;
+};
+
+// Adds the changes of the shared counts of word ids made by the shards to the
+// counts of the sampler. The task is split into ranges of the counts, and the
+// counts of a COL topic are only read from the shards of its collection.
+class TopicSumGibbsSampler::MergeTask : public ParallelTask {
+ public:
+  MergeTask(TopicSumGibbsSampler* sampler, int num_shards)
+      : sampler_(sampler),
+        num_shards_(num_shards) {}
+
+  virtual void Run(int shard) {
+    TopicSumGibbsSampler* s = sampler_;
+    int begin, end;
+    ThreadPool::GetShardRange(s->W_ + s->C_ * s->W_, num_shards_, shard,
+                              &begin, &end);
+    int i = begin;
+    while (i < end) {
+      // Row of the counts: the BKG topic, or the COL topic row - 1.
+      int row = i / s->W_;
+      int row_end = std::min(end, (row + 1) * s->W_);
+      int first_shard = 0;
+      int end_shard = s->shards_.size();
+      if (row > 0) {
+        first_shard = s->collection_shards_[row - 1].first;
+        end_shard = s->collection_shards_[row - 1].second;
+      }
+      for (; i < row_end; i++) {
+        int count = s->NWB_[i];
+        for (int j = first_shard; j < end_shard; j++) {
+          const Shard* shard = s->shards_[j];
+          int offset = row > 0 ? shard->begin_col * s->W_ : 0;
+          count += shard->word_counts[i - offset] - s->NWB_[i];
+        }
+        s->NWB_[i] = count;
+      }
+    }
+  }
+
+ private:
+  TopicSumGibbsSampler* sampler_;
+  int num_shards_;
+};
 
 TopicSumGibbsSampler::TopicSumGibbsSampler(
     int iterations,
@@ -45,7 +130,9 @@ TopicSumGibbsSampler::TopicSumGibbsSampler(
     double gamma[3],
     const vector<const DocumentCollection*>& collections,
     const Distribution* background)
-    : GibbsSampler(iterations, burnin, lag, track_likelihood),
+    : TopicSumModel(iterations, burnin, lag, track_likelihood),
+      num_counts_(0),
+      num_params_(0),
       NS_(NULL),
       NWB_(NULL),
       NWC_(NULL),
@@ -53,13 +140,28 @@ TopicSumGibbsSampler::TopicSumGibbsSampler(
       NC_(NULL),
       ND_(NULL),
       NZS_(NULL),
+      params_scale_(1),
+      sum_inv_B_(0),
+      sum_inv_C_(NULL),
+      sum_inv_D_(NULL),
+      sum_inv_S_(NULL),
       phi_B_(NULL),
       phi_C_(NULL),
       phi_D_(NULL),
       psi_(NULL),
       training_cols_(collections),
+      corpus_(NULL),
+      lexicon_(NULL),
+      token_ids_(NULL),
+      sentence_offsets_(NULL),
+      document_offsets_(NULL),
+      collection_offsets_(NULL),
+      document_word_offsets_(NULL),
+      token_document_words_(NULL),
       lastZ_(NULL),
-      background_(background) {
+      num_threads_(1),
+      background_(background),
+      background_model_(NULL) {
   // Copy the hyper-parameters and calculate their sums.
   lambda_sum_ = 0;
   gamma_sum_ = 0;
@@ -70,109 +172,25 @@ TopicSumGibbsSampler::TopicSumGibbsSampler(
     lambda_sum_ += lambda_[k];
     gamma_sum_ += gamma_[k];
   }
+}
 
-  lexicon_.reset(new Lexicon);
+TopicSumGibbsSampler::~TopicSumGibbsSampler() {
+  Reset();
 }
 
 void TopicSumGibbsSampler::Reset() {
-  if (NS_) {
-    for (int c = 0; c < C_; c++) {
-      int num_docs = training_cols_[c]->document_size();
-      for (int d = 0; d < num_docs; d++)
-        delete[] NS_[c][d];
-      delete[] NS_[c];
-    }
-    delete[] NS_;
-  }
-
-  if (NWB_)
-    delete[] NWB_;
-
-  if (NWC_) {
-    for (int c = 0; c < C_; c++)
-      delete[] NWC_[c];
-    delete[] NWC_;
-  }
-
-  if (NWD_) {
-    for (int c = 0; c < C_; c++) {
-      int num_docs =  training_cols_[c]->document_size();
-      for (int d = 0; d < num_docs; d++)
-        delete[] NWD_[c][d];
-      delete[] NWD_[c];
-    }
-    delete[] NWD_;
-  }
-
-  if (NC_)
-    delete[] NC_;
-
-  if (ND_) {
-    for (int c = 0; c < C_; c++)
-      delete[] ND_[c];
-    delete[] ND_;
-  }
-
-  if (NZS_) {
-    for (int c = 0; c < C_; c++) {
-      int num_docs =  training_cols_[c]->document_size();
-      for (int d = 0; d < num_docs; d++) {
-        int num_sents = training_cols_[c]->document(d).sentence_size();
-        for (int s = 0; s < num_sents; s++)
-          delete[] NZS_[c][d][s];
-        delete[] NZS_[c][d];
-      }
-      delete[] NZS_[c];
-    }
-    delete[] NZS_;
-  }
-
-  if (phi_B_)
-    delete[] phi_B_;
-
-  if (phi_C_) {
-    for (int c = 0; c < C_; c++)
-      delete[] phi_C_[c];
-    delete[] phi_C_;
-  }
-
-  if (phi_D_) {
-    for (int c = 0; c < C_; c++) {
-      int num_docs =  training_cols_[c]->document_size();
-      for (int d = 0; d < num_docs; d++)
-        delete[] phi_D_[c][d];
-      delete[] phi_D_[c];
-    }
-    delete[] phi_D_;
-  }
-
-  if (psi_) {
-    for (int c = 0; c < C_; c++) {
-      int num_docs =  training_cols_[c]->document_size();
-      for (int d = 0; d < num_docs; d++) {
-        int num_sents = training_cols_[c]->document(d).sentence_size();
-        for (int s = 0; s < num_sents; s++)
-          delete[] psi_[c][d][s];
-        delete[] psi_[c][d];
-      }
-      delete[] psi_[c];
-    }
-    delete[] psi_;
+  for (vector<Shard*>::iterator it = shards_.begin();
+       it != shards_.end();
+       ++it) {
+    delete *it;
   }
+  shards_.clear();
+  collection_shards_.clear();
 
-  if (lastZ_) {
-    for (int c = 0; c < C_; c++) {
-      int num_docs =  training_cols_[c]->document_size();
-      for (int d = 0; d < num_docs; d++) {
-        int num_sents = training_cols_[c]->document(d).sentence_size();
-        for (int s = 0; s < num_sents; s++)
-          delete[] lastZ_[c][d][s];
-        delete[] lastZ_[c][d];
-      }
-      delete[] lastZ_[c];
-    }
-    delete[] lastZ_;
-  }
+  count_arena_.reset(NULL);
+  param_arena_.reset(NULL);
+  num_counts_ = 0;
+  num_params_ = 0;
 
   NS_ = NULL;
   NWB_ = NULL;
@@ -181,6 +199,9 @@ void TopicSumGibbsSampler::Reset() {
   NC_ = NULL;
   ND_ = NULL;
   NZS_ = NULL;
+  sum_inv_C_ = NULL;
+  sum_inv_D_ = NULL;
+  sum_inv_S_ = NULL;
   phi_B_ = NULL;
   phi_C_ = NULL;
   phi_D_ = NULL;
@@ -191,157 +212,88 @@ void TopicSumGibbsSampler::Reset() {
 void TopicSumGibbsSampler::Init() {
   Reset();
 
-  // Determine number of collections.
-  C_ = training_cols_.size();
-
-  // Initialize word dictionary with all the words from all documents in all
-  // collections. At the same time, count the number of words.
-  AW_ = 0;
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        const Sentence& sent = doc.sentence(s);
-        for (int w = 0; w < sent.token_size(); w++) {
-          const string& word = sent.token(w);
-          lexicon_->add_token(word);
-          ++AW_;
-        }
-      }
-    }
-  }
-
-  // If a background was provided, add the background words to the lexicon.
-  if (background_ != NULL) {
-    for (Distribution::const_iterator cit = background_->begin();
-         cit != background_->end(); ++cit) {
-      lexicon_->add_token(cit->first);
-    }
-  }
-
-  // Determine vocabulary size.
-  W_ = lexicon_->size();
-
-  // Determine number of documents.
-  D_ = 0;
-  for (int c = 0; c < C_; c++)
-    D_ += training_cols_[c]->document_size();
-
-  // Determine total number of sentences.
-  S_ = 0;
-  for (int c = 0; c < C_; c++)
-    for (int d = 0 ; d < training_cols_[c]->document_size() ; d++)
-      S_ += training_cols_[c]->document(d).sentence_size();
-
-  // Allocate memory to store the size of all the sentences.
-  // Note that the sentence sizes will be initialized in DoInitialAssignment.
-  NS_ = new int**[C_]();
-  for (int c = 0; c < C_; c++) {
-    int num_docs =  training_cols_[c]->document_size();
-    NS_[c] = new int*[num_docs]();
-    for (int d = 0; d < num_docs; d++) {
-      int num_sents = training_cols_[c]->document(d).sentence_size();
-      NS_[c][d] = new int[num_sents]();
-    }
-  }
-
-  // Allocate memory to store the topics distributions and initialize all
-  // values to zero. The only exception is the background distribution, that
-  // can come as given.
-  phi_B_ = new double[W_]();
-
-  phi_C_ = new double*[C_]();
-  for (int c = 0; c < C_; c++)
-    phi_C_[c] = new double[W_]();
-
-  phi_D_ = new double**[C_]();
-  for (int c = 0; c < C_; c++) {
-    int num_docs =  training_cols_[c]->document_size();
-    phi_D_[c] = new double*[num_docs]();
-    for (int d = 0; d < num_docs; d++)
-      phi_D_[c][d] = new double[W_]();
-  }
-
-  // Allocate memory to store the initialize sentence topic-assignment and
-  // initialize all values to zero.
-  psi_ = new double***[C_]();
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    psi_[c] = new double**[col.document_size()]();
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      psi_[c][d] = new double*[doc.sentence_size()]();
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        psi_[c][d][s] = new double[3]();
-      }
-    }
-  }
-
-  // Allocate memory to store the counters and initialize all values to zero.
-  NWB_ = new int[W_]();
-  NWC_ = new int*[C_]();
-  for (int c = 0; c < C_; c++)
-    NWC_[c] = new int[W_]();
-
-  NWD_ = new int**[C_]();
-  for (int c = 0; c < C_; c++) {
-    NWD_[c] = new int*[training_cols_[c]->document_size()]();
-    for (int d = 0; d < training_cols_[c]->document_size(); d++)
-      NWD_[c][d] = new int[W_]();
+  // Tokenize the collections the first time, unless they were shared by
+  // set_corpus. If a background was provided, its words are added to the
+  // lexicon. The words of a model are not added, since its vocabulary can be
+  // much larger than the one of the collections.
+  if (corpus_ == NULL) {
+    own_corpus_.reset(new TopicSumCorpus(
+        training_cols_, background_model_ == NULL ? background_ : NULL));
+    corpus_ = own_corpus_.get();
   }
-
+  lexicon_ = &corpus_->lexicon();
+  token_ids_ = corpus_->token_ids();
+  sentence_offsets_ = corpus_->sentence_offsets();
+  document_offsets_ = corpus_->document_offsets();
+  collection_offsets_ = corpus_->collection_offsets();
+  document_word_offsets_ = corpus_->document_word_offsets();
+  token_document_words_ = corpus_->token_document_words();
+
+  // Determine the numbers of collections, documents, sentences, words and
+  // tokens.
+  C_ = corpus_->num_collections();
+  D_ = corpus_->num_documents();
+  S_ = corpus_->num_sentences();
+  W_ = corpus_->num_words();
+  AW_ = corpus_->num_tokens();
+  int num_document_words = corpus_->num_document_words();
+
+  // Allocate the counters, the last assignments and the parameters in two
+  // arenas, one for the integers and one for the doubles, and initialize all
+  // the values to zero. The tables are laid out one after the other, each of
+  // them being indexed by collection, document, sentence or token index (and
+  // by word id or topic in the innermost dimension), except for the sparse
+  // DOC topics which are indexed like the words of the documents. The only
+  // values which are not zero are the ones of the background distribution,
+  // that can come as given. Note that the sentence sizes will be initialized
+  // in DoInitialAssignment.
+  int64 num_counts = static_cast<int64>(W_)  // NWB_
+      + static_cast<int64>(C_) * W_          // NWC_
+      + num_document_words                   // NWD_
+      + C_                                   // NC_
+      + D_                                   // ND_
+      + S_                                   // NS_
+      + static_cast<int64>(S_) * K_          // NZS_
+      + AW_;                                 // lastZ_
+  count_arena_.reset(new int[num_counts]());
+  num_counts_ = num_counts;
+  // NWC_ follows NWB_, so that the parallel mode copies and merges all the
+  // counts of the words in the shared topics at once.
+  NWB_ = count_arena_.get();
+  NWC_ = NWB_ + W_;
+  NWD_ = NWC_ + static_cast<int64>(C_) * W_;
+  NC_ = NWD_ + num_document_words;
+  ND_ = NC_ + C_;
+  NS_ = ND_ + D_;
+  NZS_ = NS_ + S_;
+  lastZ_ = NZS_ + static_cast<int64>(S_) * K_;
   NB_ = 0;
-  NC_ = new int[C_]();
-  ND_ = new int*[C_]();
-  for (int c = 0; c < C_; c++)
-    ND_[c] = new int[training_cols_[c]->document_size()]();
 
-  NZS_ = new int***[C_]();
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    NZS_[c] = new int**[col.document_size()]();
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      NZS_[c][d] = new int*[doc.sentence_size()]();
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        NZS_[c][d][s] = new int[3]();
-      }
-    }
-  }
-
-  // Allocate memory to store the last assignments and initialize all values to
-  // zero.
-  lastZ_ = new int***[C_]();
-  for (int c = 0 ; c < C_ ; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    lastZ_[c] = new int**[col.document_size()]();
-    for (int d = 0 ; d < col.document_size() ; d++) {
-      const Document& doc = col.document(d);
-      lastZ_[c][d] = new int*[doc.sentence_size()]();
-      for (int s = 0 ; s < doc.sentence_size() ; s++) {
-        const Sentence& sent = doc.sentence(s);
-        lastZ_[c][d][s] = new int[sent.token_size()]();
-      }
-    }
-  }
+  int64 num_params = static_cast<int64>(W_)  // phi_B_
+      + static_cast<int64>(C_) * W_          // phi_C_
+      + num_document_words                   // phi_D_
+      + static_cast<int64>(S_) * K_          // psi_
+      + C_                                   // sum_inv_C_
+      + D_                                   // sum_inv_D_
+      + S_;                                  // sum_inv_S_
+  param_arena_.reset(new double[num_params]());
+  num_params_ = num_params;
+  phi_B_ = param_arena_.get();
+  phi_C_ = phi_B_ + W_;
+  phi_D_ = phi_C_ + static_cast<int64>(C_) * W_;
+  psi_ = phi_D_ + num_document_words;
+  sum_inv_C_ = psi_ + static_cast<int64>(S_) * K_;
+  sum_inv_D_ = sum_inv_C_ + C_;
+  sum_inv_S_ = sum_inv_D_ + D_;
+  params_scale_ = 1;
+  sum_inv_B_ = 0;
 
   // If a background distribution was provided, initialize the variables.
-  if (background_ != NULL) {
+  if (fixed_background()) {
     double background_prior = gamma_[0] / gamma_sum_;
 
-    // Initialize the probability distribution and normalize it if needed.
-    double background_sum = 0.0;
-    for (Distribution::const_iterator cit = background_->begin();
-         cit != background_->end(); ++cit) {
-      int word_id = lexicon_->token2id(cit->first);
-      phi_B_[word_id] = cit->second;
-      background_sum += cit->second;
-    }
-    if (background_sum != 1.0) {
-      for (int i = 0; i < W_; ++i)
-        phi_B_[i] /= background_sum;
-    }
+    // Initialize the probability distribution, normalized if needed.
+    corpus_->GetBackgroundProbabilities(background_, background_model_, phi_B_);
 
     // Initialize the frequency distributions.
     for (int i = 0; i < W_; ++i) {
@@ -352,6 +304,63 @@ void TopicSumGibbsSampler::Init() {
       }
     }
   }
+
+  if (num_threads_ > 1 && AW_ > 0)
+    InitShards();
+}
+
+void TopicSumGibbsSampler::InitShards() {
+  if (thread_pool_.get() == NULL ||
+      thread_pool_->num_threads() != num_threads_) {
+    thread_pool_.reset(new ThreadPool(num_threads_));
+  }
+
+  int num_shards = std::min(D_, num_threads_ * kShardsPerThread);
+  collection_shards_.assign(C_, make_pair(0, 0));
+  int begin_doc = 0;
+  for (int i = 0; i < num_shards; i++) {
+    // The shard ends with the first document reaching its share of the
+    // tokens, leaving at least one document to each of the following shards.
+    int64 end_token = static_cast<int64>(AW_) * (i + 1) / num_shards;
+    int end_doc = begin_doc + 1;
+    if (i == num_shards - 1) {
+      end_doc = D_;
+    } else {
+      while (end_doc < D_ - (num_shards - i - 1) &&
+             sentence_offsets_[document_offsets_[end_doc]] < end_token) {
+        end_doc++;
+      }
+    }
+
+    Shard* shard = new Shard;
+    shard->begin_doc = begin_doc;
+    shard->end_doc = end_doc;
+    shard->begin_col = upper_bound(collection_offsets_,
+                                   collection_offsets_ + C_ + 1,
+                                   begin_doc) - collection_offsets_ - 1;
+    shard->end_col = upper_bound(collection_offsets_,
+                                 collection_offsets_ + C_ + 1,
+                                 end_doc - 1) - collection_offsets_;
+    for (int c = shard->begin_col; c < shard->end_col; c++) {
+      if (collection_shards_[c].first == collection_shards_[c].second)
+        collection_shards_[c].first = i;
+      collection_shards_[c].second = i + 1;
+    }
+    // The generators of the shards are seeded from the one of the sampler, so
+    // that the samples only depend on its seed.
+    shard->random.Reset(random()->Next(), 0);
+    int num_cols = shard->end_col - shard->begin_col;
+    shard->word_counts.resize(W_ + static_cast<int64>(num_cols) * W_);
+    shard->topic_counts.resize(1 + num_cols);
+    shard->counts.NWB = &shard->word_counts[0];
+    shard->counts.NWC = &shard->word_counts[W_];
+    shard->counts.NB = &shard->topic_counts[0];
+    shard->counts.NC = &shard->topic_counts[1];
+    shard->counts.begin_col = shard->begin_col;
+    shards_.push_back(shard);
+
+    begin_doc = end_doc;
+  }
 }
 
 string TopicSumGibbsSampler::PrintSamplerInfo() {
@@ -394,25 +403,28 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
     oss << setfill(' ') << setw(20) << "Count\n";
 
     for (int w = 0; w < W_; w++) {
-      if (NWC_[c][w] > 0) {
+      if (NWC_[c * W_ + w] > 0) {
         oss << setfill(' ') << setw(20) << lexicon_->id2token(w);
-        oss << setfill(' ') << setw(20) << NWC_[c][w];
+        oss << setfill(' ') << setw(20) << NWC_[c * W_ + w];
         oss << "\n";
       }
     }
   }
 
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
+    for (int d = 0; d < num_documents(c); d++) {
+      int doc_index = collection_offsets_[c] + d;
       oss << "Count of words in the DOC Topic: " << d << " COL: " << c << "\n";
       oss << setfill(' ') << setw(20) << "Word";
       oss << setfill(' ') << setw(20) << "Count\n";
 
-      for (int w = 0; w < W_; w++) {
-        if (NWD_[c][d][w] > 0) {
-          oss << setfill(' ') << setw(20) << lexicon_->id2token(w);
-          oss << setfill(' ') << setw(20) << NWD_[c][d][w];
+      for (int i = document_word_offsets_[doc_index];
+           i < document_word_offsets_[doc_index + 1];
+           i++) {
+        if (NWD_[i] > 0) {
+          oss << setfill(' ') << setw(20)
+              << lexicon_->id2token(corpus_->document_word_ids()[i]);
+          oss << setfill(' ') << setw(20) << NWD_[i];
           oss << "\n";
         }
       }
@@ -430,10 +442,9 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
   }
 
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
+    for (int d = 0; d < num_documents(c); d++) {
       oss << "Total words in the DOC Topic " << d << " of COL " << c << ": ";
-      oss << ND_[c][d];
+      oss << ND_[collection_offsets_[c] + d];
       oss << "\n";
     }
   }
@@ -449,7 +460,7 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
   for (int w = 0; w < W_; w++) {
     oss << setfill(' ') << setw(20) << lexicon_->id2token(w);
     oss << setfill(' ') << setw(20);
-    oss << fixed << setprecision(2) << phi_B_[w];
+    oss << fixed << setprecision(2) << phi_B(w);
     oss << "\n";
   }
 
@@ -463,7 +474,7 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
     for (int w = 0; w < W_; w++) {
       oss << setfill(' ') << setw(20) << lexicon_->id2token(w);
       oss << setfill(' ') << setw(20);
-      oss << fixed << setprecision(2) << phi_C_[c][w];
+      oss << fixed << setprecision(2) << phi_C(c, w);
       oss << "\n";
     }
     oss << "\n";
@@ -478,17 +489,17 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
   oss << "\n";
 
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
+    for (int d = 0; d < num_documents(c); d++) {
+      int doc_index = collection_offsets_[c] + d;
+      for (int s = 0; s < num_sentences(doc_index); s++) {
+        int sent_index = document_offsets_[doc_index] + s;
         oss << c << "-" << d << "-" << setw(30) << left << s;
         for (int k = 0; k < K_; k++)
           oss << setfill(' ')
               << setw(10)
               << fixed
               << setprecision(2)
-              << psi_[c][d][s][k];
+              << psi(sent_index, k);
         oss << "\n";
       }
     }
@@ -500,16 +511,16 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
   oss << "\n";
 
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        const Sentence& sent = doc.sentence(s);
+    for (int d = 0; d < num_documents(c); d++) {
+      int doc_index = collection_offsets_[c] + d;
+      for (int s = 0; s < num_sentences(doc_index); s++) {
+        int sent_index = document_offsets_[doc_index] + s;
         oss << c << "-" << d << "-" << setw(30) << left << s;
-        string topic_list;
-        for (int w = 0; w < sent.token_size(); w++) {
-          const string& word = sent.token(w);
-          int last_topic = lastZ_[c][d][s][w];
+        for (int i = sentence_offsets_[sent_index];
+             i < sentence_offsets_[sent_index + 1];
+             i++) {
+          const string& word = lexicon_->id2token(token_ids_[i]);
+          int last_topic = lastZ_[i];
 
           oss << word.c_str() << ":" << last_topic << " ";
         }
@@ -522,99 +533,41 @@ string TopicSumGibbsSampler::PrintSamplingIterationInfo() {
 }
 
 
-void TopicSumGibbsSampler::GenerateConditionalDistribution(
-    int colid,
-    int docid,
-    int sentid,
-    int wordid,
-    double* distri) {
-  // Frequency distributions of words in topic k.
-  int* NWZ = NULL;
-  // Total number of words in topic k.
-  int NZ = 0;
-  // Probability of choosing topic k.
-  double pk;
-  double sum = 0;
-
-  // Generates the distribution (P(z_i=j|z_{-i}, w))_j and stores it in distri.
-  // We use the following formula to estimate that probability:
-  // p(z_i=j|z_{-i},w) & \propto &
-  //        \frac{n_{-i,j}^{w} + \lambda_j}
-  //             {\sum_{w'} (n_{-i,j}^{w'} + \lambda_j)}
-  //        .
-  //        \frac{n_{-i,j}^{(cds)} + \gamma_j}
-  //             {\sum_{k} ( n_{-i,k}^{(cds)} + \gamma_k)}
-  //
-  // n_{-i,j} in the formula means the number of words assigned to topic j,
-  // except the current word.
-  // In the main Train() function DecrementCounters has been called before
-  // invoking this function, so the words taking into account already exclude
-  // the current one.
-
-  for (int k = 0; k < K_; k++) {
-    if (k == 0) {
-      NWZ = NWB_;
-      NZ = NB_;
-    } else if (k == 1) {
-      NWZ = NWC_[colid];
-      NZ = NC_[colid];
-    } else if (k == 2) {
-      NWZ = NWD_[colid][docid];
-      NZ = ND_[colid][docid];
-    } else {
-      LOG(FATAL) << "In TopicSum, a word can only be generated from one of "
-                 << "three topics: background, collection or document.";
-    }
-    CHECK(NWZ != NULL);
-    pk = (NWZ[wordid] + lambda_[k])
-      * (NZS_[colid][docid][sentid][k] + gamma_[k])
-      / ((NZ + W_ * lambda_[k]) * (NS_[colid][docid][sentid] + gamma_sum_));
-    distri[k] = pk;
-    sum += pk;
-  }
-
-  // One must normalize, because previous equations are only proportional
-  // to the true probability.
-  if (sum) {
-    for (int k = 0; k < K_; k++)
-      distri[k] /= sum;
-  }
-}
-
 double TopicSumGibbsSampler::CalculateModelLikelihood() const {
   double modlike = 0;
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        modlike += CalculateSentenceLikelihood(c, d, s);
+    for (int d = 0; d < num_documents(c); d++) {
+      int doc_index = collection_offsets_[c] + d;
+      for (int s = 0; s < num_sentences(doc_index); s++) {
+        int sent_index = document_offsets_[doc_index] + s;
+        modlike += CalculateSentenceLikelihood(c, doc_index, sent_index);
       }
     }
   }
   return modlike;
 }
 
-double TopicSumGibbsSampler::CalculateSentenceLikelihood(int colid,
-                                                         int docid,
-                                                         int sentid) const {
+double TopicSumGibbsSampler::CalculateSentenceLikelihood(
+    int colid, int doc_index, int sent_index) const {
   double sentlike = 0;
+  double psi_B = psi(sent_index, 0);
+  double psi_C = psi(sent_index, 1);
+  double psi_D = psi(sent_index, 2);
 
-  const Sentence& sent =
-    (*training_cols_[colid]).document(docid).sentence(sentid);
-
-  for (int w = 0; w < sent.token_size(); w++) {
-    int wordid = lexicon_->token2id(sent.token(w));
+  for (int i = sentence_offsets_[sent_index];
+       i < sentence_offsets_[sent_index + 1];
+       i++) {
+    int wordid = token_ids_[i];
 
     double wordlike = 0;
     // Add likelihood of the word to be generated by the BKG.
-    wordlike += phi_B_[wordid] * psi_[colid][docid][sentid][0];
+    wordlike += phi_B(wordid) * psi_B;
 
     // Add likelihood of the word to be generated by the COL.
-    wordlike += phi_C_[colid][wordid] * psi_[colid][docid][sentid][1];
+    wordlike += phi_C(colid, wordid) * psi_C;
 
     // Add likelihood of the word to be generated by the DOC.
-    wordlike += phi_D_[colid][docid][wordid] * psi_[colid][docid][sentid][2];
+    wordlike += phi_D(doc_index, token_document_words_[i]) * psi_D;
 
     if (wordlike > 0)
       sentlike += log(wordlike);
@@ -622,6 +575,89 @@ double TopicSumGibbsSampler::CalculateSentenceLikelihood(int colid,
   return sentlike;
 }
 
+bool TopicSumGibbsSampler::SaveState(BinaryWriter* writer) const {
+  int64 sizes[] = { K_, C_, D_, S_, W_, AW_,
+                    static_cast<int64>(corpus_->num_document_words()),
+                    num_counts_, num_params_ };
+  writer->WriteArray(sizes, ARRAYSIZE(sizes));
+  writer->WriteArray(lambda_, K_);
+  writer->WriteArray(gamma_, K_);
+  for (int w = 0; w < W_; w++)
+    writer->WriteString(lexicon_->id2token(w));
+  writer->WriteUint64(
+      AW_ > 0 ? Crc32(token_ids_, sizeof(token_ids_[0]) * AW_) : 0);
+
+  writer->WriteInt64(shards_.size());
+  uint64 random_state[Random::kStateSize];
+  for (uint i = 0; i < shards_.size(); i++) {
+    shards_[i]->random.GetState(random_state);
+    writer->WriteArray(random_state, Random::kStateSize);
+  }
+
+  writer->WriteInt64(NB_);
+  writer->WriteDouble(params_scale_);
+  writer->WriteDouble(sum_inv_B_);
+  writer->WriteArray(count_arena_.get(), num_counts_);
+  writer->WriteArray(param_arena_.get(), num_params_);
+  return true;
+}
+
+bool TopicSumGibbsSampler::RestoreState(BinaryReader* reader) {
+  // Check that the checkpoint was saved for the same model and inputs.
+  int64 sizes[] = { K_, C_, D_, S_, W_, AW_,
+                    static_cast<int64>(corpus_->num_document_words()),
+                    num_counts_, num_params_ };
+  const int64* saved_sizes = reader->ReadArray<int64>(ARRAYSIZE(sizes));
+  if (saved_sizes == NULL ||
+      !std::equal(sizes, sizes + ARRAYSIZE(sizes), saved_sizes)) {
+    return false;
+  }
+  const double* saved_lambda = reader->ReadArray<double>(K_);
+  const double* saved_gamma = reader->ReadArray<double>(K_);
+  if (saved_lambda == NULL || !std::equal(lambda_, lambda_ + K_, saved_lambda)
+      || saved_gamma == NULL || !std::equal(gamma_, gamma_ + K_, saved_gamma)) {
+    return false;
+  }
+  string token;
+  for (int w = 0; w < W_; w++) {
+    if (!reader->ReadString(&token) || token != lexicon_->id2token(w))
+      return false;
+  }
+  uint64 crc;
+  if (!reader->ReadUint64(&crc) ||
+      crc != (AW_ > 0 ?
+              Crc32(token_ids_, sizeof(token_ids_[0]) * AW_) : 0)) {
+    return false;
+  }
+
+  // The shards depend on the number of threads.
+  int64 num_shards;
+  if (!reader->ReadInt64(&num_shards) ||
+      num_shards != static_cast<int64>(shards_.size())) {
+    return false;
+  }
+  for (uint i = 0; i < shards_.size(); i++) {
+    const uint64* random_state =
+        reader->ReadArray<uint64>(Random::kStateSize);
+    if (random_state == NULL) return false;
+    shards_[i]->random.SetState(random_state);
+  }
+
+  int64 NB;
+  if (!reader->ReadInt64(&NB) ||
+      !reader->ReadDouble(&params_scale_) ||
+      !reader->ReadDouble(&sum_inv_B_)) {
+    return false;
+  }
+  NB_ = NB;
+  const int* counts = reader->ReadArray<int>(num_counts_);
+  const double* params = reader->ReadArray<double>(num_params_);
+  if (counts == NULL || params == NULL) return false;
+  std::copy(counts, counts + num_counts_, count_arena_.get());
+  std::copy(params, params + num_params_, param_arena_.get());
+  return true;
+}
+
 void TopicSumGibbsSampler::GetCollectionDistribution(int colid,
                                                      Distribution* wd) const {
   CHECK_GE(colid, 0);
@@ -629,7 +665,7 @@ void TopicSumGibbsSampler::GetCollectionDistribution(int colid,
   CHECK(wd);
 
   for (int w = 0; w < W_; w++) {
-    double v = phi_C_[colid][w];
+    double v = phi_C(colid, w);
     if (v > 0) {
       const string& word = lexicon_->id2token(w);
       wd->insert(pair<string, double>(word, v));
@@ -650,17 +686,16 @@ bool TopicSumGibbsSampler::GetPosteriorDistribution(string term,
   // Number of times that this term is assigned to each of the collection
   // distributions.
   for (int c = 0; c < C_; c++) {
-    cd->insert(make_pair(training_cols_[c]->id(), NWC_[c][termid]));
+    cd->insert(make_pair(training_cols_[c]->id(), NWC_[c * W_ + termid]));
   }
 
   // Number of times that this term is assigned to any of the document-specific
   // distributions.
   int total_doc_frequency = 0;
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      total_doc_frequency += NWD_[c][d][termid];
-    }
+  for (int d = 0; d < D_; d++) {
+    int doc_word = corpus_->FindDocumentWord(d, termid);
+    if (doc_word != -1)
+      total_doc_frequency += NWD_[doc_word];
   }
   cd->insert(make_pair("document", total_doc_frequency));
 
@@ -673,7 +708,7 @@ void TopicSumGibbsSampler::GetBackgroundDistribution(Distribution* wd) const {
   wd->clear();
 
   for (int w = 0; w < W_; w++) {
-    double v = phi_B_[w];
+    double v = phi_B(w);
     if (v > 0) {
       const string& word = lexicon_->id2token(w);
       wd->insert(pair<string, double>(word, v));
@@ -683,148 +718,309 @@ void TopicSumGibbsSampler::GetBackgroundDistribution(Distribution* wd) const {
   NormalizeDistribution(wd);
 }
 
-void TopicSumGibbsSampler::MultiplyParams(double multiplier) {
-  // Update psi.
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        for (int k = 0; k < K_; k++)
-          psi_[c][d][s][k] *= multiplier;
-      }
+bool TopicSumGibbsSampler::FoldIn(int colid,
+                                  const DocumentCollection& documents,
+                                  int iterations,
+                                  Random* random,
+                                  Distribution* wd) const {
+  CHECK_GE(colid, 0);
+  CHECK_LT(colid, C_);
+  CHECK_LT(0, iterations);
+  CHECK(wd);
+
+  // Tokenize the new documents, and map the ids of their words to the ones of
+  // the training lexicon. The words which are not in it get new ids from W_,
+  // and num_words is the size of the extended vocabulary.
+  vector<const DocumentCollection*> new_cols(1, &documents);
+  TopicSumCorpus corpus(new_cols, NULL);
+  const Lexicon& new_lexicon = corpus.lexicon();
+  int num_new_words = corpus.num_words();
+  vector<int> word_ids(num_new_words);
+  int num_words = W_;
+  for (int w = 0; w < num_new_words; w++) {
+    const string& word = new_lexicon.id2token(w);
+    word_ids[w] = lexicon_->has_token(word) ? lexicon_->token2id(word)
+                                            : num_words++;
+  }
+
+  // Counts of the training tokens in the BKG and COL topics. Instead of the
+  // counts of the last sample, which are noisy, they are the expected counts
+  // given the estimated parameters, e.g. phi_C(colid, w) * (NC_[colid] +
+  // W_ * lambda_[1]) - lambda_[1] for the COL topic, so that folding in no
+  // document gives the estimated distribution. A fixed background keeps its
+  // pseudo-counts.
+  bool fixed = fixed_background();
+  vector<double> trained_NWB(W_);
+  vector<double> trained_NWC(W_);
+  double trained_NB = 0;
+  double trained_NC = 0;
+  double scale_B = NB_ + W_ * lambda_[0];
+  double scale_C = NC_[colid] + W_ * lambda_[1];
+  for (int w = 0; w < W_; w++) {
+    trained_NWB[w] = fixed ? NWB_[w]
+                           : max(0.0, phi_B(w) * scale_B - lambda_[0]);
+    trained_NWC[w] = max(0.0, phi_C(colid, w) * scale_C - lambda_[1]);
+    trained_NB += trained_NWB[w];
+    trained_NC += trained_NWC[w];
+  }
+
+  // Counts of the new tokens, which are added to the ones of the training
+  // tokens for the BKG and COL topics. The words of the BKG and COL topics
+  // are indexed like the new lexicon.
+  int num_tokens = corpus.num_tokens();
+  vector<int> z(num_tokens);
+  vector<int> NWB(num_new_words, 0);
+  vector<int> NWC(num_new_words, 0);
+  vector<int> NWD(corpus.num_document_words(), 0);
+  vector<int> ND(corpus.num_documents(), 0);
+  vector<int> NZS(static_cast<int64>(corpus.num_sentences()) * K_, 0);
+  int NB = 0;
+  int NC = 0;
+  vector<double> base_NWB(num_new_words, 0.0);
+  vector<double> base_NWC(num_new_words, 0.0);
+  for (int w = 0; w < num_new_words; w++) {
+    if (word_ids[w] < W_) {
+      base_NWB[w] = trained_NWB[word_ids[w]];
+      base_NWC[w] = trained_NWC[word_ids[w]];
     }
   }
 
-  // Update phi for BKG.
-  if (background_ == NULL) {
+  // The new words get the pseudo-counts of the background model too, scaled
+  // like the ones of the training words in Init, so that they can be assigned
+  // to the fixed background.
+  if (background_model_ != NULL && num_words > W_) {
+    double sum = 0;
     for (int w = 0; w < W_; w++)
-      phi_B_[w] *= multiplier;
+      sum += background_model_->GetProbability(lexicon_->id2token(w));
+    double scale = AW_ * gamma_[0] / gamma_sum_;
+    if (sum > 0)
+      scale /= sum;
+    for (int w = 0; w < num_new_words; w++) {
+      if (word_ids[w] >= W_) {
+        base_NWB[w] = static_cast<int>(
+            background_model_->GetProbability(new_lexicon.id2token(w))
+            * scale);
+        trained_NB += base_NWB[w];
+      }
+    }
   }
 
-  // Update phi for COL.
-  for (int c = 0; c < C_; c++)
-    for (int w = 0; w < W_; w++)
-      phi_C_[c][w] *= multiplier;
+  const int* token_ids = corpus.token_ids();
+  const int* token_document_words = corpus.token_document_words();
+  const int* sentence_offsets = corpus.sentence_offsets();
+  const int* document_offsets = corpus.document_offsets();
+  double W_lambda[K_];
+  for (int k = 0; k < K_; k++)
+    W_lambda[k] = num_words * lambda_[k];
+
+  // The parameters of the COL topic are accumulated lazily like in
+  // CalculateParams, for the words of the new documents.
+  int burnin = iterations / 2;
+  double sum_inv = 0;
+  vector<double> phi(num_new_words, 0.0);
+
+  for (int iteration = -1; iteration < iterations; iteration++) {
+    for (int d = 0; d < corpus.num_documents(); d++) {
+      int* topic_counts[K_] = { &NB, &NC, &ND[d] };
+      for (int s = document_offsets[d]; s < document_offsets[d + 1]; s++) {
+        int* sentence_counts = &NZS[s * K_];
+        for (int i = sentence_offsets[s]; i < sentence_offsets[s + 1]; i++) {
+          int w = token_ids[i];
+          int* word_counts[K_] = { &NWB[w], &NWC[w],
+                                   &NWD[token_document_words[i]] };
+          int topic;
+          if (iteration < 0) {
+            // Initial assignment.
+            topic = SampleUniform(K_, random);
+          } else {
+            topic = z[i];
+            if (!fixed || topic != 0) {
+              (*word_counts[topic])--;
+              (*topic_counts[topic])--;
+            }
+            sentence_counts[topic]--;
+
+            double base_word_counts[K_] = { base_NWB[w], base_NWC[w], 0 };
+            double base_topic_counts[K_] = { trained_NB, trained_NC, 0 };
+            double cumulative[K_];
+            double sum = 0;
+            for (int k = 0; k < K_; k++) {
+              sum += (base_word_counts[k] + *word_counts[k] + lambda_[k])
+                  * (sentence_counts[k] + gamma_[k])
+                  / (base_topic_counts[k] + *topic_counts[k] + W_lambda[k]);
+              cumulative[k] = sum;
+            }
+            double x = random->Uniform() * sum;
+            topic = 0;
+            while (topic < K_ - 1 && x > cumulative[topic])
+              topic++;
+          }
+
+          if (!fixed || topic != 0) {
+            (*word_counts[topic])++;
+            (*topic_counts[topic])++;
+          }
+          sentence_counts[topic]++;
+          z[i] = topic;
+        }
+      }
+    }
 
-  // Update phi for DOC.
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++)
-      for (int w = 0; w < W_; w++)
-        phi_D_[c][d][w] *= multiplier;
+    if (iteration >= burnin) {
+      double inv = 1 / (trained_NC + NC + W_lambda[1]);
+      sum_inv += inv;
+      for (int w = 0; w < num_new_words; w++) {
+        if (NWC[w] != 0)
+          phi[w] += NWC[w] * inv;
+      }
+    }
+  }
+
+  // Average the samples over the extended vocabulary.
+  int num_samples = iterations - burnin;
+  for (int w = 0; w < W_; w++) {
+    double v = (trained_NWC[w] + lambda_[1]) * sum_inv / num_samples;
+    if (v > 0)
+      wd->insert(make_pair(lexicon_->id2token(w), v));
+  }
+  for (int w = 0; w < num_new_words; w++) {
+    const string& word = new_lexicon.id2token(w);
+    if (word_ids[w] >= W_)
+      (*wd)[word] = lambda_[1] * sum_inv / num_samples;
+    (*wd)[word] += phi[w] / num_samples;
   }
+
+  NormalizeDistribution(wd);
+  return true;
+}
+
+void TopicSumGibbsSampler::MultiplyParams(double multiplier) {
+  params_scale_ *= multiplier;
 }
 
 void TopicSumGibbsSampler::CalculateParams() {
+  // The terms are divided by the scale of the parameters, so that the sums
+  // which were multiplied since the last call are not.
+  double inv_scale = 1 / params_scale_;
+
   // Update psi.
-  for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        for (int k = 0; k < K_; k++)
-          psi_[c][d][s][k] += (NZS_[c][d][s][k] + gamma_[k])
-                              / (NS_[c][d][s] + gamma_sum_);
-      }
+  for (int i = 0; i < S_; i++) {
+    double inv = inv_scale / (NS_[i] + gamma_sum_);
+    sum_inv_S_[i] += inv;
+    for (int k = 0; k < K_; k++) {
+      if (NZS_[i * K_ + k] != 0)
+        psi_[i * K_ + k] += NZS_[i * K_ + k] * inv;
     }
   }
 
   // Update phi for BKG.
-  if (background_ == NULL) {
-    for (int w = 0; w < W_; w++)
-      phi_B_[w] += (NWB_[w] + lambda_[0]) / (NB_ + W_ * lambda_[0]);
+  if (!fixed_background()) {
+    double inv = inv_scale / (NB_ + W_ * lambda_[0]);
+    sum_inv_B_ += inv;
+    for (int w = 0; w < W_; w++) {
+      if (NWB_[w] != 0)
+        phi_B_[w] += NWB_[w] * inv;
+    }
   }
 
   // Update phi for COL.
-  for (int c = 0; c < C_; c++)
-    for (int w = 0; w < W_; w++)
-      phi_C_[c][w] += (NWC_[c][w] + lambda_[1]) / (NC_[c] + W_ * lambda_[1]);
-
-  // Update phi for DOC.
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++)
-      for (int w = 0; w < W_; w++)
-        phi_D_[c][d][w] += (NWD_[c][d][w] + lambda_[2])
-                           / (ND_[c][d] + W_ * lambda_[2]);
+    double inv = inv_scale / (NC_[c] + W_ * lambda_[1]);
+    sum_inv_C_[c] += inv;
+    double* phi_C = phi_C_ + c * W_;
+    const int* NWC = NWC_ + c * W_;
+    for (int w = 0; w < W_; w++) {
+      if (NWC[w] != 0)
+        phi_C[w] += NWC[w] * inv;
+    }
   }
-}
 
-void TopicSumGibbsSampler::IncrementCounters(int colid,
-                                             int docid,
-                                             int sentid,
-                                             int wordid,
-                                             int topic) {
-  if (topic == 0) {
-    if (background_ == NULL) {
-      NWB_[wordid]++;
-      NB_++;
+  // Update phi for DOC.
+  for (int d = 0; d < D_; d++) {
+    double inv = inv_scale / (ND_[d] + W_ * lambda_[2]);
+    sum_inv_D_[d] += inv;
+    for (int i = document_word_offsets_[d];
+         i < document_word_offsets_[d + 1];
+         i++) {
+      if (NWD_[i] != 0)
+        phi_D_[i] += NWD_[i] * inv;
     }
+  }
+}
 
-    NZS_[colid][docid][sentid][0]++;
-    NS_[colid][docid][sentid]++;
-  } else if (topic == 1) {
-    NWC_[colid][wordid]++;
-    NC_[colid]++;
+void TopicSumGibbsSampler::FinishParams() {
+  for (int i = 0; i < S_; i++) {
+    for (int k = 0; k < K_; k++)
+      psi_[i * K_ + k] = psi(i, k);
+    sum_inv_S_[i] = 0;
+  }
 
-    NZS_[colid][docid][sentid][1]++;
-    NS_[colid][docid][sentid]++;
+  if (!fixed_background()) {
+    for (int w = 0; w < W_; w++)
+      phi_B_[w] = phi_B(w);
+    sum_inv_B_ = 0;
+  }
 
-  } else if (topic == 2) {
-    NWD_[colid][docid][wordid]++;
-    ND_[colid][docid]++;
+  for (int c = 0; c < C_; c++) {
+    for (int w = 0; w < W_; w++)
+      phi_C_[c * W_ + w] = phi_C(c, w);
+    sum_inv_C_[c] = 0;
+  }
 
-    NZS_[colid][docid][sentid][2]++;
-    NS_[colid][docid][sentid]++;
+  for (int d = 0; d < D_; d++) {
+    for (int i = document_word_offsets_[d];
+         i < document_word_offsets_[d + 1];
+         i++) {
+      phi_D_[i] = phi_D(d, i);
+    }
+    sum_inv_D_[d] = 0;
   }
+
+  params_scale_ = 1;
 }
 
-void TopicSumGibbsSampler::DecrementCounters(int colid,
-                                             int docid,
-                                             int sentid,
+void TopicSumGibbsSampler::IncrementCounters(SharedCounts* counts,
+                                             int colid,
+                                             int doc_index,
+                                             int sent_index,
                                              int wordid,
+                                             int doc_word,
                                              int topic) {
   if (topic == 0) {
-    if (background_ == NULL) {
-      NWB_[wordid]--;
-      NB_--;
+    if (!fixed_background()) {
+      counts->NWB[wordid]++;
+      (*counts->NB)++;
     }
-
-    NZS_[colid][docid][sentid][0]--;
-    NS_[colid][docid][sentid]--;
   } else if (topic == 1) {
-    NWC_[colid][wordid]--;
-    NC_[colid]--;
-
-    NZS_[colid][docid][sentid][1]--;
-    NS_[colid][docid][sentid]--;
-
+    counts->NWC[(colid - counts->begin_col) * W_ + wordid]++;
+    counts->NC[colid - counts->begin_col]++;
   } else if (topic == 2) {
-    NWD_[colid][docid][wordid]--;
-    ND_[colid][docid]--;
-
-    NZS_[colid][docid][sentid][2]--;
-    NS_[colid][docid][sentid]--;
+    NWD_[doc_word]++;
+    ND_[doc_index]++;
   }
+
+  NZS_[sent_index * K_ + topic]++;
+  NS_[sent_index]++;
 }
 
 void TopicSumGibbsSampler::DoInitialAssignment() {
+  SharedCounts counts = GetSharedCounts();
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        const Sentence& sent = doc.sentence(s);
-        for (int w = 0; w < sent.token_size(); w++) {
-          const string& word = sent.token(w);
-          int wordid = lexicon_->token2id(word);
+    for (int d = 0; d < num_documents(c); d++) {
+      int doc_index = collection_offsets_[c] + d;
+      for (int s = 0; s < num_sentences(doc_index); s++) {
+        int sent_index = document_offsets_[doc_index] + s;
+        for (int i = sentence_offsets_[sent_index];
+             i < sentence_offsets_[sent_index + 1];
+             i++) {
+          int wordid = token_ids_[i];
 
-          int new_topic = SampleUniform(K_);
+          int new_topic = SampleUniform(K_, random());
 
-          IncrementCounters(c, d, s, wordid, new_topic);
+          IncrementCounters(&counts, c, doc_index, sent_index, wordid,
+                            token_document_words_[i], new_topic);
 
-          lastZ_[c][d][s][w] = new_topic;
+          lastZ_[i] = new_topic;
         }
       }
     }
@@ -832,29 +1028,123 @@ void TopicSumGibbsSampler::DoInitialAssignment() {
 }
 
 void TopicSumGibbsSampler::DoIteration() {
-  scoped_array<double> distri(new double[K_]());
+  if (shards_.empty()) {
+    SharedCounts counts = GetSharedCounts();
+    SampleDocuments(0, D_, &counts, random());
+    return;
+  }
 
+  SweepTask sweep(this);
+  thread_pool_->Run(shards_.size(), &sweep);
+
+  // The counts of the documents and of the sentences have been updated by
+  // their shard. Add the changes of the shared counts of all the shards.
+  MergeTask merge(this, num_threads_);
+  thread_pool_->Run(num_threads_, &merge);
+  int NB = NB_;
+  for (uint j = 0; j < shards_.size(); j++)
+    NB += shards_[j]->topic_counts[0] - NB_;
+  NB_ = NB;
   for (int c = 0; c < C_; c++) {
-    const DocumentCollection& col = *training_cols_[c];
-    for (int d = 0; d < col.document_size(); d++) {
-      const Document& doc = col.document(d);
-      for (int s = 0; s < doc.sentence_size(); s++) {
-        const Sentence& sent = doc.sentence(s);
-        for (int w = 0; w < sent.token_size(); w++) {
-          const string& word = sent.token(w);
-          int wordid = lexicon_->token2id(word);
-          int last_topic = lastZ_[c][d][s][w];
-
-          DecrementCounters(c, d, s, wordid, last_topic);
-
-          GenerateConditionalDistribution(c, d, s, wordid, distri.get());
+    int NC = NC_[c];
+    for (int j = collection_shards_[c].first;
+         j < collection_shards_[c].second;
+         j++) {
+      NC += shards_[j]->topic_counts[c - shards_[j]->begin_col + 1] - NC_[c];
+    }
+    NC_[c] = NC;
+  }
+}
 
-          int new_topic = SampleMulti(distri.get(), K_);
+void TopicSumGibbsSampler::SampleDocuments(int begin_doc,
+                                           int end_doc,
+                                           SharedCounts* counts,
+                                           Random* random) {
+  if (fixed_background()) {
+    SampleDocumentsKernel<true>(begin_doc, end_doc, counts, random);
+  } else {
+    SampleDocumentsKernel<false>(begin_doc, end_doc, counts, random);
+  }
+}
 
-          IncrementCounters(c, d, s, wordid, new_topic);
+template <bool kFixedBackground>
+void TopicSumGibbsSampler::SampleDocumentsKernel(int begin_doc,
+                                                 int end_doc,
+                                                 SharedCounts* counts,
+                                                 Random* random) {
+  // The topic of each token is sampled from the distribution
+  // p(z_i=j|z_{-i},w) & \propto &
+  //        \frac{n_{-i,j}^{w} + \lambda_j}
+  //             {\sum_{w'} (n_{-i,j}^{w'} + \lambda_j)}
+  //        .
+  //        \frac{n_{-i,j}^{(cds)} + \gamma_j}
+  //             {\sum_{k} ( n_{-i,k}^{(cds)} + \gamma_k)}
+  //
+  // where n_{-i,j} is the number of words assigned to topic j, except the
+  // current word. The second denominator is the same for all the topics, so
+  // the distribution is sampled unnormalized and without it. The reciprocals
+  // of the first denominators of the BKG topic, of the COL topic of the
+  // current collection and of the DOC topic of the current document are
+  // cached in inv, and only recomputed when their counts change. The counts
+  // of each topic are selected by indexing arrays of pointers, and the counts
+  // of the BKG topic do not change if the background is fixed.
+  double W_lambda[K_];
+  for (int k = 0; k < K_; k++)
+    W_lambda[k] = W_ * lambda_[k];
+  double inv[K_];
+  inv[0] = 1 / (*counts->NB + W_lambda[0]);
+
+  // Collection of the first document.
+  int c = upper_bound(collection_offsets_, collection_offsets_ + C_ + 1,
+                      begin_doc) - collection_offsets_ - 1;
+  int begin_col = counts->begin_col;
+  inv[1] = 1 / (counts->NC[c - begin_col] + W_lambda[1]);
+  for (int doc_index = begin_doc; doc_index < end_doc; doc_index++) {
+    while (doc_index >= collection_offsets_[c + 1]) {
+      c++;
+      inv[1] = 1 / (counts->NC[c - begin_col] + W_lambda[1]);
+    }
+    inv[2] = 1 / (ND_[doc_index] + W_lambda[2]);
+    int* topic_counts[K_] = { counts->NB, &counts->NC[c - begin_col],
+                              &ND_[doc_index] };
+    int* NWC = counts->NWC + static_cast<int64>(c - begin_col) * W_;
+
+    for (int sent_index = document_offsets_[doc_index];
+         sent_index < document_offsets_[doc_index + 1];
+         sent_index++) {
+      // The size of the sentence does not change.
+      int* NZS = NZS_ + sent_index * K_;
+      for (int i = sentence_offsets_[sent_index];
+           i < sentence_offsets_[sent_index + 1];
+           i++) {
+        int wordid = token_ids_[i];
+        int* word_counts[K_] = { &counts->NWB[wordid], &NWC[wordid],
+                                 &NWD_[token_document_words_[i]] };
+
+        int topic = lastZ_[i];
+        if (!kFixedBackground || topic != 0) {
+          (*word_counts[topic])--;
+          inv[topic] = 1 / (--(*topic_counts[topic]) + W_lambda[topic]);
+        }
+        NZS[topic]--;
 
-          lastZ_[c][d][s][w] = new_topic;
+        double cumulative[K_];
+        double sum = 0;
+        for (int k = 0; k < K_; k++) {
+          sum += (*word_counts[k] + lambda_[k]) * (NZS[k] + gamma_[k]) * inv[k];
+          cumulative[k] = sum;
+        }
+        double x = random->Uniform() * sum;
+        topic = 0;
+        while (topic < K_ - 1 && x > cumulative[topic])
+          topic++;
+
+        if (!kFixedBackground || topic != 0) {
+          (*word_counts[topic])++;
+          inv[topic] = 1 / (++(*topic_counts[topic]) + W_lambda[topic]);
         }
+        NZS[topic]++;
+        lastZ_[i] = topic;
       }
     }
   }
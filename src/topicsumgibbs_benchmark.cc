@@ -0,0 +1,108 @@
+// Copyright 2012 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//
+// Benchmark of the parallel mode of the TopicSum Gibbs sampler. Trains the
+// sampler on a synthetic corpus with an increasing number of threads, and
+// prints the time per iteration and the speedup with respect to one thread.
+//
+// Usage: topicsumgibbs_benchmark [num_tokens] [num_iterations] [max_threads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include <string>
+#include <vector>
+
+#include "summarizer/document.pb.h"
+#include "summarizer/random.h"
+#include "summarizer/topicsumgibbs.h"
+
+using std::string;
+using std::vector;
+using topicsum::Document;
+using topicsum::DocumentCollection;
+using topicsum::Random;
+using topicsum::Sentence;
+using topicsum::TopicSumGibbsSampler;
+
+namespace {
+
+// Shape of the synthetic corpus.
+static const int kNumCollections = 4;
+static const int kTokensPerSentence = 20;
+static const int kSentencesPerDocument = 25;
+static const int kVocabularySize = 20000;
+
+double Now() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// Builds collections with about num_tokens tokens in total. The words are
+// drawn with a probability decreasing with their rank, as in natural text.
+void BuildCorpus(int num_tokens, vector<DocumentCollection>* collections) {
+  Random random(0);
+  int tokens_per_document = kTokensPerSentence * kSentencesPerDocument;
+  int num_documents = num_tokens / tokens_per_document + 1;
+  collections->resize(kNumCollections);
+  char word[16];
+  for (int d = 0; d < num_documents; d++) {
+    Document* document =
+        (*collections)[d % kNumCollections].add_document();
+    for (int s = 0; s < kSentencesPerDocument; s++) {
+      Sentence* sentence = document->add_sentence();
+      for (int w = 0; w < kTokensPerSentence; w++) {
+        double u = random.Uniform();
+        snprintf(word, sizeof(word), "w%d",
+                 static_cast<int>(kVocabularySize * u * u * u));
+        sentence->add_token(word);
+      }
+    }
+  }
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+  int num_tokens = argc > 1 ? atoi(argv[1]) : 500000;
+  int num_iterations = argc > 2 ? atoi(argv[2]) : 20;
+  int max_threads = argc > 3 ? atoi(argv[3]) : 8;
+
+  vector<DocumentCollection> collections;
+  BuildCorpus(num_tokens, &collections);
+  vector<const DocumentCollection*> training_cols;
+  for (int c = 0; c < kNumCollections; ++c)
+    training_cols.push_back(&collections[c]);
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+  double reference = 0;
+  printf("%8s %16s %8s %16s\n", "threads", "ms/iteration", "speedup",
+         "likelihood");
+  for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    TopicSumGibbsSampler sampler(num_iterations, 0, num_iterations, true,
+                                 lambda, gamma, training_cols, NULL);
+    sampler.set_num_threads(num_threads);
+    double start = Now();
+    sampler.Train();
+    double time = (Now() - start) * 1e3 / num_iterations;
+    if (num_threads == 1) reference = time;
+    printf("%8d %16.2f %8.2f %16.1f\n", num_threads, time, reference / time,
+           sampler.saved_likelihoods().back().second);
+  }
+  return 0;
+}
@@ -15,88 +15,36 @@
 
 #include "summarizer/topicsumgibbs.h"
 
+#include <math.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
 #include "gtest/gtest.h"
-#include "summarizer/file.h"
 #include "summarizer/logging.h"
-#include "summarizer/xml_parser.h"
+#include "summarizer/test_collections.h"
+#include "summarizer/thread_pool.h"
 
 namespace topicsum {
 
 namespace {
-void BuildToyCollections(vector<const DocumentCollection*>* cols) {
-  XmlParser xml_parser;
-  string file;
-
-  string p1 = DATADIR "testdata/toycol1/";
-  string p2 = DATADIR "testdata/toycol2/";
-
-  DocumentCollection* col1 = new DocumentCollection();
-  col1->set_id(p1);
-  DocumentCollection* col2 = new DocumentCollection();
-  col2->set_id(p2);
-
-  file = "";
-  File::ReadFileToStringOrDie(p1 + "d1.xml", &file);
-  xml_parser.ParseDocument(file, col1->add_document());
-
-  file = "";
-  File::ReadFileToStringOrDie(p1 + "d2.xml", &file);
-  xml_parser.ParseDocument(file, col1->add_document());
-
-  file = "";
-  File::ReadFileToStringOrDie(p2 + "d1.xml", &file);
-  xml_parser.ParseDocument(file, col2->add_document());
-
-  file = "";
-  File::ReadFileToStringOrDie(p2 + "d2.xml", &file);
-  xml_parser.ParseDocument(file, col2->add_document());
-
-  file = "";
-  File::ReadFileToStringOrDie(p2 + "d3.xml", &file);
-  xml_parser.ParseDocument(file, col2->add_document());
-
-  LOG(INFO) << col1->document(0).sentence_size();
-
-  cols->push_back(col1);
-  cols->push_back(col2);
-}
 
-void BuildRealCollections(vector<const DocumentCollection*>* cols) {
-  vector<string> paths;
-  XmlParser xml_parser;
-
-  string p1 = DATADIR "testdata/realcol1/";
-  string p2 = DATADIR "testdata/realcol2/";
-  string p3 = DATADIR "testdata/realcol3/";
-  paths.push_back(p1);
-  paths.push_back(p2);
-  paths.push_back(p3);
-
-  string file;
-  for (vector<string>::iterator it = paths.begin();
-       it != paths.end();
-       ++it) {
-    DocumentCollection* col = new DocumentCollection();
-
-    file = "";
-    File::ReadFileToStringOrDie(*it + "d1.xml", &file);
-    xml_parser.ParseDocument(file, col->add_document());
-
-    file = "";
-    File::ReadFileToStringOrDie(*it + "d2.xml", &file);
-    xml_parser.ParseDocument(file, col->add_document());
-
-    file = "";
-    File::ReadFileToStringOrDie(*it + "d3.xml", &file);
-    xml_parser.ParseDocument(file, col->add_document());
-
-    file = "";
-    File::ReadFileToStringOrDie(*it + "d4.xml", &file);
-    xml_parser.ParseDocument(file, col->add_document());
-
-    cols->push_back(col);
+// Number of chains trained on the toy collections by the tests which check
+// the estimated distributions. The collections are so small that the
+// estimates of a single chain depend on its random stream, so the tests check
+// their averages over the chains.
+const int kNumToyChains = 5;
+
+// Adds the probabilities of the distribution of a chain, divided by the
+// number of chains, to the ones of average.
+void AddChainDistribution(const Distribution& distri, Distribution* average) {
+  for (Distribution::const_iterator it = distri.begin();
+       it != distri.end(); ++it) {
+    (*average)[it->first] += it->second / kNumToyChains;
   }
 }
+
 }  // unnamed namespace
 
 class ToyCollectionsTest : public testing::Test {
@@ -111,7 +59,9 @@ class ToyCollectionsTest : public testing::Test {
     cols_.clear();
   }
 
-  virtual void TrainToy(int num_iterations, Distribution* background) {
+  virtual void TrainToy(int num_iterations, Distribution* background,
+                        const BackgroundModel* background_model = NULL,
+                        int chain = 0) {
     BuildToyCollections(&cols_);
 
     // Important notes on the parameters: The toy collection is built so as to
@@ -134,9 +84,6 @@ class ToyCollectionsTest : public testing::Test {
     // to achieve better results. And the sum of all gammas should be equal to
     // the average size of a sentence.
 
-    // Reset seed. Necessary to be able to reproduce the experiments.
-    srandom(0);
-
     int burnin = 0;
     int lag = 100;
     bool track_likelihood = true;
@@ -151,7 +98,11 @@ class ToyCollectionsTest : public testing::Test {
                                              gamma,
                                              cols_,
                                              background));
+    topicsum_->set_background_model(background_model);
 
+    // Fixed seed. Necessary to be able to reproduce the experiments. The
+    // chains are different streams of the seed.
+    topicsum_->set_seed(0, chain);
     topicsum_->Train();
   }
 
@@ -168,82 +119,89 @@ TEST_F(ToyCollectionsTest, ToyCollectionsTraining) {
   }
 
   EXPECT_EQ(0, topicsum_->saved_likelihoods()[0].first);
-  EXPECT_NEAR(-51.329371535815405,
+  EXPECT_NEAR(-54.328134085489111,
               topicsum_->saved_likelihoods()[0].second, 0.000001);
   Reset();
 }
 
 TEST_F(ToyCollectionsTest, GetCollectionDistribution) {
-  TrainToy(1000, NULL  /* no predefined background */);
-  Distribution distri;
-  // Check that the collection distributions should contain the
-  // expected words. 'apple' appears in all the documents so it
-  // should be considered background, not a collection word.
-  topicsum_->GetCollectionDistribution(0, &distri);
-  EXPECT_LT(0.1, distri["iphone"]);
-  EXPECT_LT(0.1, distri["ipad"]);
-  EXPECT_LT(0.1, distri["company"]);
-  EXPECT_GT(0.1, distri["apple"]);
-  distri.clear();
-  topicsum_->GetCollectionDistribution(1, &distri);
-  EXPECT_LT(0.1, distri["banana"]);
-  EXPECT_LT(0.1, distri["fruit"]);
-  EXPECT_GT(0.1, distri["apple"]);
-  Reset();
-}
-
-TEST_F(ToyCollectionsTest, GetPosteriorDistribution) {
-  TrainToy(1000, NULL  /* no predefined background */);
-  Distribution distri;
-
-  // Check that the posterior distributions are as expected.
-
-  // iphone should only belong to the first collection.
-  topicsum_->GetPosteriorDistribution("iphone", &distri);
-  EXPECT_EQ(0, distri["background"]);
-  EXPECT_EQ(0, distri["document"]);
-  for (Distribution::const_iterator cit = distri.begin();
-       cit != distri.end(); ++cit) {
-    if (cit->first[cit->first.size() - 1] == '1') {
-      EXPECT_EQ(1.0, cit->second);
-    } else if (cit->first[cit->first.size() - 1] == '2') {
-      EXPECT_EQ(0.0, cit->second);
-    }
-  }
-  distri.clear();
-
-  // banana should only belong to the second collection.
-  topicsum_->GetPosteriorDistribution("banana", &distri);
-  EXPECT_EQ(0, distri["background"]);
-  EXPECT_EQ(0, distri["document"]);
-  for (Distribution::const_iterator cit = distri.begin();
-       cit != distri.end(); ++cit) {
-    if (cit->first[cit->first.size() - 1] == '1') {
-      EXPECT_EQ(0.0, cit->second);
-    } else if (cit->first[cit->first.size() - 1] == '2') {
-      EXPECT_EQ(1.0, cit->second);
+  Distribution distri[2];
+  Distribution background;
+  for (int chain = 0; chain < kNumToyChains; chain++) {
+    TrainToy(1000, NULL  /* no predefined background */, NULL, chain);
+    for (int c = 0; c < 2; c++) {
+      Distribution chain_distri;
+      topicsum_->GetCollectionDistribution(c, &chain_distri);
+      AddChainDistribution(chain_distri, &distri[c]);
     }
+    Distribution chain_background;
+    topicsum_->GetBackgroundDistribution(&chain_background);
+    AddChainDistribution(chain_background, &background);
+    Reset();
   }
-  distri.clear();
-
-  // apple should belong to the two collections
-  topicsum_->GetPosteriorDistribution("apple", &distri);
-  EXPECT_EQ(0, distri["background"]);
-  EXPECT_EQ(0, distri["document"]);
-  for (Distribution::const_iterator cit = distri.begin();
-       cit != distri.end(); ++cit) {
-    if (cit->first[cit->first.size() - 1] == '1') {
-      EXPECT_NEAR(0.5, cit->second, 0.2);
-    } else if (cit->first[cit->first.size() - 1] == '2') {
-      EXPECT_NEAR(0.5, cit->second, 0.2);
-    }
+
+  // Check that the collection distributions contain the expected words.
+  EXPECT_LT(0.1, distri[0]["iphone"]);
+  EXPECT_LT(0.1, distri[0]["ipad"]);
+  EXPECT_LT(0.1, distri[0]["company"]);
+  EXPECT_LT(0.1, distri[1]["banana"]);
+  EXPECT_LT(0.1, distri[1]["fruit"]);
+
+  // 'apple' and 'the' appear in all the documents, so they should be
+  // considered background rather than collection words. 'and' is about as
+  // frequent in the first collection as in the background.
+  const char* kBackgroundWords[] = { "apple", "the" };
+  for (uint i = 0; i < ARRAYSIZE(kBackgroundWords); i++) {
+    const char* word = kBackgroundWords[i];
+    EXPECT_LT(distri[0][word], background[word]) << word;
+    EXPECT_LT(distri[1][word], background[word]) << word;
   }
+  EXPECT_LT(0.05, background["and"]);
+}
 
-  // notfound is not found in the vocabulary.
-  distri.clear();
-  EXPECT_FALSE(topicsum_->GetPosteriorDistribution("notfound", &distri));
+TEST_F(ToyCollectionsTest, GetPosteriorDistribution) {
+  Distribution iphone;
+  Distribution banana;
+  string col1;
+  string col2;
+  for (int chain = 0; chain < kNumToyChains; chain++) {
+    TrainToy(1000, NULL  /* no predefined background */, NULL, chain);
+    col1 = cols_[0]->id();
+    col2 = cols_[1]->id();
+
+    // The posterior distributions are the ones of the last sample, so only
+    // their averages over the chains are meaningful, except for the topics
+    // which cannot generate the words: no word comes from a DOC topic, and
+    // iphone and banana each appear in only one collection.
+    Distribution distri;
+    topicsum_->GetPosteriorDistribution("iphone", &distri);
+    EXPECT_EQ(0, distri["document"]);
+    EXPECT_EQ(0, distri[col2]);
+    AddChainDistribution(distri, &iphone);
+    distri.clear();
+
+    topicsum_->GetPosteriorDistribution("banana", &distri);
+    EXPECT_EQ(0, distri["document"]);
+    EXPECT_EQ(0, distri[col1]);
+    AddChainDistribution(distri, &banana);
+    distri.clear();
+
+    // apple belongs to the two collections or to the background.
+    topicsum_->GetPosteriorDistribution("apple", &distri);
+    EXPECT_EQ(0, distri["document"]);
+    EXPECT_NEAR(1.0, distri["background"] + distri[col1] + distri[col2],
+                1e-9);
+    distri.clear();
+
+    // notfound is not found in the vocabulary.
+    EXPECT_FALSE(topicsum_->GetPosteriorDistribution("notfound", &distri));
+    Reset();
+  }
 
-  Reset();
+  // iphone should often belong to the first collection, and banana to the
+  // second one, rather than to the background.
+  EXPECT_LT(0.2, iphone[col1]);
+  EXPECT_LT(0.2, banana[col2]);
 }
 
 TEST_F(ToyCollectionsTest, GetCollectionDistributionFixedBackground) {
@@ -253,47 +211,164 @@ TEST_F(ToyCollectionsTest, GetCollectionDistributionFixedBackground) {
   Distribution background;
   background["the"] = 0.5;
   background["and"] = 0.5;
-  TrainToy(1000, &background);
-  LOG(INFO) << topicsum_->PrintSamplingIterationInfo();
+  Distribution distri[2];
+  for (int chain = 0; chain < kNumToyChains; chain++) {
+    TrainToy(1000, &background, NULL, chain);
+    LOG(INFO) << topicsum_->PrintSamplingIterationInfo();
+    for (int c = 0; c < 2; c++) {
+      Distribution chain_distri;
+      topicsum_->GetCollectionDistribution(c, &chain_distri);
+      AddChainDistribution(chain_distri, &distri[c]);
+    }
+    Reset();
+  }
+
   // Check the words from the two collections. 'apple' is now forced
   // not to belong to the background, so it has to be assigned to
   // both collection distributions with a high score.
-  Distribution distri;
-  topicsum_->GetCollectionDistribution(0, &distri);
-  EXPECT_LT(0.2, distri["apple"]);
-  EXPECT_LT(0.1, distri["iphone"]);
-  EXPECT_LT(0.1, distri["ipad"]);
-  EXPECT_LT(0.1, distri["company"]);
-  distri.clear();
-  topicsum_->GetCollectionDistribution(1, &distri);
-  EXPECT_LT(0.2, distri["apple"]);
-  EXPECT_LT(0.1, distri["banana"]);
-  EXPECT_LT(0.1, distri["fruit"]);
-  Reset();
+  EXPECT_LT(0.2, distri[0]["apple"]);
+  EXPECT_LT(0.1, distri[0]["iphone"]);
+  EXPECT_LT(0.1, distri[0]["ipad"]);
+  EXPECT_LT(0.1, distri[0]["company"]);
+  EXPECT_LT(0.2, distri[1]["apple"]);
+  EXPECT_LT(0.1, distri[1]["banana"]);
+  EXPECT_LT(0.1, distri[1]["fruit"]);
 }
 
 TEST_F(ToyCollectionsTest, GetPosteriorDistributionFixedBackground) {
   Distribution background;
   background["the"] = 0.5;
   background["and"] = 0.5;
+  Distribution the;
+  for (int chain = 0; chain < kNumToyChains; chain++) {
+    TrainToy(1000, &background, NULL, chain);
+    Distribution distri;
+    topicsum_->GetPosteriorDistribution("the", &distri);
+    EXPECT_EQ(0, distri["document"]);
+    AddChainDistribution(distri, &the);
+    Reset();
+  }
+
+  // Check that the posterior distributions are as expected.
+  // 'the' should have most of the probability assigned to the background now.
+  EXPECT_LT(0.8, the["background"]);
+}
+
+TEST_F(ToyCollectionsTest, BackgroundModel) {
+  // A model of the words of the collections gives the same samples as the
+  // same fixed background distribution.
+  Distribution background;
+  background["the"] = 0.5;
+  background["and"] = 0.5;
+  const char kPath[] = "topicsumgibbs_test_background.tmp";
+  ASSERT_TRUE(BackgroundModel::Write(background, 0, kPath));
+  BackgroundModel model;
+  ASSERT_TRUE(model.Open(kPath));
+
   TrainToy(1000, &background);
+  Distribution expected;
+  topicsum_->GetCollectionDistribution(0, &expected);
+  Reset();
+
+  TrainToy(1000, NULL, &model);
   Distribution distri;
+  topicsum_->GetCollectionDistribution(0, &distri);
+  EXPECT_TRUE(expected == distri);
+  topicsum_->GetBackgroundDistribution(&distri);
+  EXPECT_EQ(2, distri.size());
+  EXPECT_EQ(0.5, distri["the"]);
+  Reset();
+  remove(kPath);
+}
 
-  // Check that the posterior distributions are as expected.
-  // 'the' should have all probability assigned to the background now.
-  topicsum_->GetPosteriorDistribution("the", &distri);
-  EXPECT_EQ(1.0, distri["background"]);
-  EXPECT_EQ(0, distri["document"]);
+TEST_F(ToyCollectionsTest, FoldIn) {
+  TrainToy(1000, NULL  /* no predefined background */);
+  Distribution trained;
+  topicsum_->GetCollectionDistribution(0, &trained);
+
+  // A new document of the first collection, with a word which is not in the
+  // training collections.
+  DocumentCollection documents;
+  Sentence* sentence = documents.add_document()->add_sentence();
+  const char* kTokens[] = { "the", "iphone", "and", "iphone", "ipod" };
+  for (uint i = 0; i < ARRAYSIZE(kTokens); i++)
+    sentence->add_token(kTokens[i]);
+
+  Random random(0);
+  Distribution folded;
+  ASSERT_TRUE(topicsum_->FoldIn(0, documents, 20, &random, &folded));
+  double sum = 0;
+  for (Distribution::const_iterator it = folded.begin();
+       it != folded.end(); ++it) {
+    sum += it->second;
+  }
+  EXPECT_NEAR(1.0, sum, 1e-9);
+  EXPECT_LT(0, folded["ipod"]);
+  EXPECT_LT(trained["iphone"], folded["iphone"]);
+  EXPECT_GT(trained["ipad"], folded["ipad"]);
+  EXPECT_GT(0.1, folded["banana"]);
+
+  // The same generator gives the same result, and the model does not change.
+  Random same_random(0);
+  Distribution same;
+  ASSERT_TRUE(topicsum_->FoldIn(0, documents, 20, &same_random, &same));
+  EXPECT_TRUE(folded == same);
+  Distribution after;
+  topicsum_->GetCollectionDistribution(0, &after);
+  EXPECT_TRUE(trained == after);
+  Reset();
+}
+
+TEST_F(ToyCollectionsTest, FoldInBackgroundModel) {
+  // Two models with the same probabilities for the words of the collections,
+  // which give the same samples, but only the second one has 'ipod'.
+  Distribution background;
+  background["the"] = 0.5;
+  background["and"] = 0.5;
+  const char kPath[] = "topicsumgibbs_test_background.tmp";
+  const char kIpodPath[] = "topicsumgibbs_test_ipod_background.tmp";
+  ASSERT_TRUE(BackgroundModel::Write(background, 0, kPath));
+  background["ipod"] = 1;
+  ASSERT_TRUE(BackgroundModel::Write(background, 0, kIpodPath));
+  BackgroundModel model, ipod_model;
+  ASSERT_TRUE(model.Open(kPath));
+  ASSERT_TRUE(ipod_model.Open(kIpodPath));
+
+  // A new document with one token per sentence, so that the tokens cannot
+  // be assigned to its DOC topic.
+  DocumentCollection documents;
+  Document* document = documents.add_document();
+  const char* kTokens[] = { "the", "ipod", "and", "ipod", "ipod" };
+  for (uint i = 0; i < ARRAYSIZE(kTokens); i++)
+    document->add_sentence()->add_token(kTokens[i]);
+
+  TrainToy(1000, NULL, &model);
+  Random random(0);
+  Distribution folded;
+  ASSERT_TRUE(topicsum_->FoldIn(0, documents, 20, &random, &folded));
+  Reset();
+
+  // 'ipod' is not in the training collections, but it is in the second
+  // model, so that most of its tokens are assigned to the background.
+  TrainToy(1000, NULL, &ipod_model);
+  Random ipod_random(0);
+  Distribution ipod_folded;
+  ASSERT_TRUE(topicsum_->FoldIn(0, documents, 20, &ipod_random, &ipod_folded));
+  EXPECT_GT(folded["ipod"], 2 * ipod_folded["ipod"]);
   Reset();
+  remove(kPath);
+  remove(kIpodPath);
 }
 
+// The long chains converge to the same distribution from any stream, within
+// the tolerances below.
 TEST_F(ToyCollectionsTest, GetBackgroundDistribution100000Iterations) {
   TrainToy(100000, NULL  /* no predefined background */);
   Distribution distri;
   topicsum_->GetBackgroundDistribution(&distri);
-  EXPECT_NEAR(0.14, distri["and"], 0.01);
-  EXPECT_NEAR(0.25, distri["the"], 0.01);
-  EXPECT_NEAR(0.46, distri["apple"], 0.01);
+  EXPECT_NEAR(0.13, distri["and"], 0.02);
+  EXPECT_NEAR(0.255, distri["the"], 0.02);
+  EXPECT_NEAR(0.46, distri["apple"], 0.02);
   Reset();
 }
 
@@ -301,9 +376,9 @@ TEST_F(ToyCollectionsTest, GetBackgroundDistribution200000Iterations) {
   TrainToy(200000, NULL  /* no predefined background */);
   Distribution distri;
   topicsum_->GetBackgroundDistribution(&distri);
-  EXPECT_NEAR(0.14, distri["and"], 0.01);
-  EXPECT_NEAR(0.25, distri["the"], 0.01);
-  EXPECT_NEAR(0.46, distri["apple"], 0.01);
+  EXPECT_NEAR(0.13, distri["and"], 0.01);
+  EXPECT_NEAR(0.255, distri["the"], 0.01);
+  EXPECT_NEAR(0.46, distri["apple"], 0.02);
   Reset();
 }
 
@@ -320,9 +395,6 @@ TEST(TopicSumGibbsSampler, RealCollectionsTraining) {
   // regarding the parameters here. We just use the exact same ones as those
   // given in the original paper by Haghighi in NAACL 2009.
 
-  // Reset seed. Necessary to be able to reproduce the experiments.
-  srandom(0);
-
   double lambda[3] = {0.1, 1, 1};
   double gamma[3] = {1, 5, 10};
 
@@ -335,6 +407,8 @@ TEST(TopicSumGibbsSampler, RealCollectionsTraining) {
                                   gamma,
                                   cols,
                                   NULL);
+    // Fixed seed. Necessary to be able to reproduce the experiments.
+    topicsum.set_seed(0, 0);
     topicsum.Train();
 
     LOG(INFO) << "Likelihoods of the model after each iteration:";
@@ -344,7 +418,7 @@ TEST(TopicSumGibbsSampler, RealCollectionsTraining) {
     }
 
     EXPECT_EQ(1100, topicsum.saved_likelihoods()[0].first);
-    EXPECT_NEAR(-6963.279241539145,
+    EXPECT_NEAR(-6971.669181300016,
                 topicsum.saved_likelihoods()[0].second, 0.000001);
   }
 
@@ -355,6 +429,329 @@ TEST(TopicSumGibbsSampler, RealCollectionsTraining) {
   }
 }
 
+TEST(TopicSumGibbsSampler, Seed) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  TopicSumGibbsSampler topicsum(20, 0, 10, false, lambda, gamma, cols, NULL);
+  TopicSumGibbsSampler same_seed(20, 0, 10, false, lambda, gamma, cols, NULL);
+  TopicSumGibbsSampler other_seed(20, 0, 10, false, lambda, gamma, cols, NULL);
+  TopicSumGibbsSampler other_stream(20, 0, 10, false, lambda, gamma, cols,
+                                    NULL);
+  topicsum.set_seed(17, 0);
+  same_seed.set_seed(17, 0);
+  other_seed.set_seed(18, 0);
+  other_stream.set_seed(17, 1);
+  topicsum.Train();
+  same_seed.Train();
+  other_seed.Train();
+  other_stream.Train();
+
+  int num_tokens = 0;
+  for (uint c = 0; c < cols.size(); c++) {
+    const DocumentCollection& col = *cols[c];
+    for (int d = 0; d < col.document_size(); d++) {
+      for (int s = 0; s < col.document(d).sentence_size(); s++)
+        num_tokens += col.document(d).sentence(s).token_size();
+    }
+  }
+  ASSERT_LT(0, num_tokens);
+
+  int num_same_seed_differences = 0;
+  int num_other_seed_differences = 0;
+  int num_other_stream_differences = 0;
+  for (int i = 0; i < num_tokens; i++) {
+    int topic = topicsum.GetTopicAssignments()[i];
+    if (topic != same_seed.GetTopicAssignments()[i])
+      num_same_seed_differences++;
+    if (topic != other_seed.GetTopicAssignments()[i])
+      num_other_seed_differences++;
+    if (topic != other_stream.GetTopicAssignments()[i])
+      num_other_stream_differences++;
+  }
+  EXPECT_EQ(0, num_same_seed_differences);
+  EXPECT_LT(0, num_other_seed_differences);
+  EXPECT_LT(0, num_other_stream_differences);
+
+  // Training again restarts the sequence of the seed.
+  vector<int> assignments(topicsum.GetTopicAssignments(),
+                          topicsum.GetTopicAssignments() + num_tokens);
+  topicsum.Train();
+  EXPECT_TRUE(std::equal(assignments.begin(), assignments.end(),
+                         topicsum.GetTopicAssignments()));
+
+  for (vector<const DocumentCollection*>::iterator it = cols.begin();
+       it != cols.end();
+       ++it) {
+    delete *it;
+  }
+}
+
+// Chains trained concurrently over a shared corpus are the same as chains
+// trained with their own corpus.
+TEST(TopicSumGibbsSampler, SharedCorpus) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  class TrainTask : public ParallelTask {
+   public:
+    explicit TrainTask(vector<TopicSumGibbsSampler*>* chains)
+        : chains_(chains) {}
+    virtual void Run(int chain) { (*chains_)[chain]->Train(); }
+
+   private:
+    vector<TopicSumGibbsSampler*>* chains_;
+  };
+
+  const int kNumChains = 3;
+  TopicSumCorpus corpus(cols, NULL);
+  vector<TopicSumGibbsSampler*> chains;
+  for (int chain = 0; chain < kNumChains; chain++) {
+    chains.push_back(
+        new TopicSumGibbsSampler(20, 0, 10, false, lambda, gamma, cols, NULL));
+    chains.back()->set_corpus(&corpus);
+    chains.back()->set_seed(17, chain);
+  }
+  ThreadPool thread_pool(kNumChains);
+  TrainTask task(&chains);
+  thread_pool.Run(kNumChains, &task);
+
+  for (int chain = 0; chain < kNumChains; chain++) {
+    TopicSumGibbsSampler alone(20, 0, 10, false, lambda, gamma, cols, NULL);
+    alone.set_seed(17, chain);
+    alone.Train();
+    EXPECT_TRUE(std::equal(alone.GetTopicAssignments(),
+                           alone.GetTopicAssignments() + corpus.num_tokens(),
+                           chains[chain]->GetTopicAssignments()));
+    delete chains[chain];
+  }
+
+  for (vector<const DocumentCollection*>::iterator it = cols.begin();
+       it != cols.end();
+       ++it) {
+    delete *it;
+  }
+}
+
+TEST(TopicSumGibbsSampler, Parallel) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  TopicSumGibbsSampler serial(500, 100, 100, true, lambda, gamma, cols, NULL);
+  TopicSumGibbsSampler parallel(500, 100, 100, true, lambda, gamma, cols,
+                                NULL);
+  TopicSumGibbsSampler same_threads(500, 100, 100, true, lambda, gamma, cols,
+                                    NULL);
+  parallel.set_num_threads(4);
+  same_threads.set_num_threads(4);
+  serial.Train();
+  parallel.Train();
+  same_threads.Train();
+
+  // The samples only depend on the seed and the number of threads.
+  int num_tokens = 0;
+  for (uint c = 0; c < cols.size(); c++) {
+    const DocumentCollection& col = *cols[c];
+    for (int d = 0; d < col.document_size(); d++) {
+      for (int s = 0; s < col.document(d).sentence_size(); s++)
+        num_tokens += col.document(d).sentence(s).token_size();
+    }
+  }
+  EXPECT_TRUE(std::equal(parallel.GetTopicAssignments(),
+                         parallel.GetTopicAssignments() + num_tokens,
+                         same_threads.GetTopicAssignments()));
+
+  // The parallel sampler converges to a model as likely as the serial one.
+  double serial_likelihood = serial.saved_likelihoods().back().second;
+  double parallel_likelihood = parallel.saved_likelihoods().back().second;
+  EXPECT_NEAR(serial_likelihood, parallel_likelihood,
+              0.01 * fabs(serial_likelihood));
+
+  for (uint c = 0; c < cols.size(); c++) {
+    Distribution distri;
+    parallel.GetCollectionDistribution(c, &distri);
+    double sum = 0;
+    for (Distribution::const_iterator it = distri.begin();
+         it != distri.end();
+         ++it) {
+      sum += it->second;
+    }
+    EXPECT_NEAR(1, sum, 1e-6);
+  }
+
+  for (vector<const DocumentCollection*>::iterator it = cols.begin();
+       it != cols.end();
+       ++it) {
+    delete *it;
+  }
+}
+
+TEST(TopicSumGibbsSampler, EarlyStopping) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  {
+    // The likelihood of the real collections plateaus long before 10000
+    // iterations.
+    TopicSumGibbsSampler topicsum(10000, 0, 10, false, lambda, gamma, cols,
+                                  NULL);
+    topicsum.set_convergence(1e-3, 5, 200);
+    topicsum.Train();
+    EXPECT_EQ(GibbsSampler::CONVERGED, topicsum.stop_reason());
+    EXPECT_LE(200, topicsum.num_done_iterations());
+    EXPECT_GT(10000, topicsum.num_done_iterations());
+
+    // The likelihoods are recorded even though track_likelihood is false, and
+    // the last one is within the tolerance of the one 5 estimations before.
+    const vector<pair<int, double> >& likelihoods =
+        topicsum.saved_likelihoods();
+    ASSERT_LT(5, likelihoods.size());
+    double last = likelihoods.back().second;
+    double previous = likelihoods[likelihoods.size() - 6].second;
+    EXPECT_GE(1e-3 * fabs(previous), fabs(last - previous));
+  }
+
+  {
+    // Without tolerance, all the iterations are done.
+    TopicSumGibbsSampler topicsum(100, 0, 10, false, lambda, gamma, cols,
+                                  NULL);
+    topicsum.set_convergence(0, 5, 0);
+    topicsum.Train();
+    EXPECT_EQ(GibbsSampler::MAX_ITERATIONS, topicsum.stop_reason());
+    EXPECT_EQ(100, topicsum.num_done_iterations());
+    EXPECT_TRUE(topicsum.saved_likelihoods().empty());
+  }
+
+  for (vector<const DocumentCollection*>::iterator it = cols.begin();
+       it != cols.end();
+       ++it) {
+    delete *it;
+  }
+}
+
+TEST(TopicSumGibbsSampler, Checkpoint) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+  int num_tokens = 0;
+  for (uint c = 0; c < cols.size(); c++) {
+    const DocumentCollection& col = *cols[c];
+    for (int d = 0; d < col.document_size(); d++) {
+      for (int s = 0; s < col.document(d).sentence_size(); s++)
+        num_tokens += col.document(d).sentence(s).token_size();
+    }
+  }
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+  const char kPath[] = "topicsumgibbs_test_checkpoint.tmp";
+
+  for (int num_threads = 1; num_threads <= 2; num_threads++) {
+    TopicSumGibbsSampler uninterrupted(300, 50, 10, true, lambda, gamma, cols,
+                                       NULL);
+    uninterrupted.set_num_threads(num_threads);
+    uninterrupted.Train();
+
+    // Stop after 100 iterations, and resume with another sampler.
+    TopicSumGibbsSampler interrupted(50, 50, 10, true, lambda, gamma, cols,
+                                     NULL);
+    interrupted.set_num_threads(num_threads);
+    interrupted.set_checkpoint(kPath, 100);
+    interrupted.Train();
+
+    TopicSumGibbsSampler resumed(300, 50, 10, true, lambda, gamma, cols,
+                                 NULL);
+    resumed.set_num_threads(num_threads);
+    ASSERT_TRUE(resumed.RestoreCheckpoint(kPath));
+    resumed.Train();
+
+    EXPECT_EQ(uninterrupted.num_done_iterations(),
+              resumed.num_done_iterations());
+    EXPECT_TRUE(std::equal(uninterrupted.GetTopicAssignments(),
+                           uninterrupted.GetTopicAssignments() + num_tokens,
+                           resumed.GetTopicAssignments()));
+    EXPECT_TRUE(uninterrupted.saved_likelihoods() ==
+                resumed.saved_likelihoods());
+    Distribution expected, distri;
+    uninterrupted.GetCollectionDistribution(0, &expected);
+    resumed.GetCollectionDistribution(0, &distri);
+    EXPECT_TRUE(expected == distri);
+
+    // The checkpoint does not match other hyper-parameters or threads.
+    double other_lambda[3] = {0.2, 1, 1};
+    TopicSumGibbsSampler other(300, 50, 10, true, other_lambda, gamma, cols,
+                               NULL);
+    other.set_num_threads(num_threads);
+    EXPECT_FALSE(other.RestoreCheckpoint(kPath));
+    TopicSumGibbsSampler other_threads(300, 50, 10, true, lambda, gamma, cols,
+                                       NULL);
+    other_threads.set_num_threads(num_threads + 1);
+    EXPECT_FALSE(other_threads.RestoreCheckpoint(kPath));
+  }
+  remove(kPath);
+
+  for (vector<const DocumentCollection*>::iterator it = cols.begin();
+       it != cols.end();
+       ++it) {
+    delete *it;
+  }
+}
+
+TEST(TopicSumGibbsSampler, Deadline) {
+  vector<const DocumentCollection*> cols;
+  BuildRealCollections(&cols);
+
+  double lambda[3] = {0.1, 1, 1};
+  double gamma[3] = {1, 5, 10};
+
+  {
+    // The sampler runs out of time during the burnin, and estimates the
+    // parameters from its last sample.
+    TopicSumGibbsSampler topicsum(100000000, 100000000, 100, false,
+                                  lambda, gamma, cols, NULL);
+    topicsum.set_deadline_ms(50);
+    topicsum.Train();
+    EXPECT_TRUE(topicsum.deadline_exceeded());
+    EXPECT_LT(topicsum.num_done_iterations(), 100000000);
+
+    Distribution distri;
+    topicsum.GetCollectionDistribution(0, &distri);
+    double sum = 0;
+    for (Distribution::const_iterator it = distri.begin();
+         it != distri.end();
+         ++it) {
+      sum += it->second;
+    }
+    EXPECT_NEAR(1, sum, 1e-6);
+  }
+
+  {
+    // A budget which is not used up does not change anything.
+    TopicSumGibbsSampler topicsum(10, 0, 1, false, lambda, gamma, cols, NULL);
+    topicsum.set_deadline_ms(600000);
+    topicsum.Train();
+    EXPECT_FALSE(topicsum.deadline_exceeded());
+    EXPECT_EQ(10, topicsum.num_done_iterations());
+  }
+
+  for (vector<const DocumentCollection*>::iterator it = cols.begin();
+       it != cols.end();
+       ++it) {
+    delete *it;
+  }
+}
+
 }  // namespace topicsum
 
 int main(int argc, char** argv) {